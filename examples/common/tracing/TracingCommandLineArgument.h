@@ -19,6 +19,8 @@
 
 #include "tracing/enabled_features.h"
 
+#include <tracing/binary/binary_tracing.h>
+#include <tracing/histogram/histogram_backend.h>
 #include <tracing/json/json_tracing.h>
 
 #if ENABLE_PERFETTO_TRACING
@@ -29,9 +31,9 @@
 /// A string with supported command line tracing targets
 /// to be pretty-printed in help strings if needed
 #if ENABLE_PERFETTO_TRACING
-#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>, perfetto, perfetto:<path>"
+#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>, binary:<path>, histogram, perfetto, perfetto:<path>"
 #else
-#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>"
+#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>, binary:<path>, histogram"
 #endif
 
 namespace chip {
@@ -58,6 +60,8 @@ public:
 
 private:
     ::chip::Tracing::Json::JsonBackend mJsonBackend;
+    ::chip::Tracing::Binary::BinaryBackend mBinaryBackend;
+    ::chip::Tracing::Histogram::HistogramBackend mHistogramBackend;
 
 #if ENABLE_PERFETTO_TRACING
     chip::Tracing::Perfetto::FileTraceOutput mPerfettoFileOutput;
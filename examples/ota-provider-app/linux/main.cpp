@@ -55,6 +55,8 @@ constexpr uint16_t kOptionUserConsentState          = 'u';
 constexpr uint16_t kOptionIgnoreQueryImage          = 'x';
 constexpr uint16_t kOptionIgnoreApplyUpdate         = 'y';
 constexpr uint16_t kOptionPollInterval              = 'P';
+constexpr uint16_t kOptionMaxBdxRate                = 'R';
+constexpr uint16_t kOptionMaxBdxSessions            = 'S';
 
 OTAProviderExample gOtaProvider;
 chip::ota::DefaultOTAProviderUserConsent gUserConsentProvider;
@@ -72,6 +74,8 @@ static bool gUserConsentNeeded                       = false;
 static uint32_t gIgnoreQueryImageCount               = 0;
 static uint32_t gIgnoreApplyUpdateCount              = 0;
 static uint32_t gPollInterval                        = 0;
+static uint32_t gMaxBdxSessions                      = 0;
+static uint32_t gMaxBdxRate                          = 0;
 
 // Parses the JSON filepath and extracts DeviceSoftwareVersionModel parameters
 static bool ParseJsonFileAndPopulateCandidates(const char * filepath,
@@ -245,6 +249,12 @@ bool HandleOptions(const char * aProgram, OptionSet * aOptions, int aIdentifier,
     case kOptionPollInterval:
         gPollInterval = static_cast<uint32_t>(strtoul(aValue, NULL, 0));
         break;
+    case kOptionMaxBdxSessions:
+        gMaxBdxSessions = static_cast<uint32_t>(strtoul(aValue, NULL, 0));
+        break;
+    case kOptionMaxBdxRate:
+        gMaxBdxRate = static_cast<uint32_t>(strtoul(aValue, NULL, 0));
+        break;
 
     default:
         PrintArgError("%s: INTERNAL ERROR: Unhandled option: %s\n", aProgram, aName);
@@ -268,6 +278,8 @@ OptionDef cmdLineOptionsDef[] = {
     { "ignoreQueryImage", chip::ArgParser::kArgumentRequired, kOptionIgnoreQueryImage },
     { "ignoreApplyUpdate", chip::ArgParser::kArgumentRequired, kOptionIgnoreApplyUpdate },
     { "pollInterval", chip::ArgParser::kArgumentRequired, kOptionPollInterval },
+    { "maxBdxSessions", chip::ArgParser::kArgumentRequired, kOptionMaxBdxSessions },
+    { "maxBdxRate", chip::ArgParser::kArgumentRequired, kOptionMaxBdxRate },
     {},
 };
 
@@ -308,7 +320,13 @@ OptionSet cmdLineOptions = { HandleOptions, cmdLineOptionsDef, "PROGRAM OPTIONS"
                              "  -y, --ignoreApplyUpdate <ignore count>\n"
                              "        The number of times to ignore the ApplyUpdateRequest Command and not send a response.\n"
                              "  -P, --pollInterval <time in milliseconds>\n"
-                             "        Poll interval for the BDX transfer \n" };
+                             "        Poll interval for the BDX transfer \n"
+                             "  -R, --maxBdxRate <bytes per second>\n"
+                             "        Maximum rate at which each BDX transfer sends the OTA image.\n"
+                             "        If none is supplied, transfers are not rate limited.\n"
+                             "  -S, --maxBdxSessions <count>\n"
+                             "        Maximum number of concurrent BDX transfers.\n"
+                             "        If none is supplied, CHIP_OTA_PROVIDER_MAX_BDX_SESSIONS transfers are served at once.\n" };
 
 OptionSet * allOptions[] = { &cmdLineOptions, nullptr };
 
@@ -318,6 +336,8 @@ void ApplicationInit()
 
     BdxOtaSender * bdxOtaSender = gOtaProvider.GetBdxOtaSender();
     VerifyOrReturn(bdxOtaSender != nullptr);
+    bdxOtaSender->SetMaxSessions(gMaxBdxSessions);
+    bdxOtaSender->SetMaxBytesPerSecond(gMaxBdxRate);
     err = chip::Server::GetInstance().GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(chip::Protocols::BDX::Id,
                                                                                                         bdxOtaSender);
     if (err != CHIP_NO_ERROR)
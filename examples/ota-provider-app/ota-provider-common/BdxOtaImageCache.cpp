@@ -0,0 +1,108 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <ota-provider-common/BdxOtaImageCache.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+BdxOtaImageCache::~BdxOtaImageCache()
+{
+    for (auto & entry : mImages)
+    {
+        Unmap(entry.second);
+    }
+    mImages.clear();
+}
+
+CHIP_ERROR BdxOtaImageCache::Acquire(const char * path, chip::ByteSpan & image)
+{
+    VerifyOrReturnError(path != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    auto existing = mImages.find(path);
+    if (existing != mImages.end())
+    {
+        existing->second.mRefCount++;
+        image = chip::ByteSpan(static_cast<const uint8_t *>(existing->second.mAddress), existing->second.mLength);
+        return CHIP_NO_ERROR;
+    }
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_OPEN_FAILED, ChipLogError(BDX, "Cannot open OTA image %s", path));
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size < 0)
+    {
+        close(fd);
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    MappedImage mapped;
+    mapped.mLength   = static_cast<size_t>(fileStat.st_size);
+    mapped.mRefCount = 1;
+
+    // mmap() rejects empty mappings, an empty image is simply served as an empty span
+    if (mapped.mLength > 0)
+    {
+        void * address = mmap(nullptr, mapped.mLength, PROT_READ, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED)
+        {
+            close(fd);
+            ChipLogError(BDX, "Cannot map OTA image %s", path);
+            return CHIP_ERROR_NO_MEMORY;
+        }
+
+        // Blocks are read sequentially by every transfer
+        madvise(address, mapped.mLength, MADV_SEQUENTIAL);
+        mapped.mAddress = address;
+    }
+    close(fd);
+
+    ChipLogProgress(BDX, "Mapped OTA image %s (%lu bytes)", path, static_cast<unsigned long>(mapped.mLength));
+
+    image = chip::ByteSpan(static_cast<const uint8_t *>(mapped.mAddress), mapped.mLength);
+    mImages.emplace(path, mapped);
+    return CHIP_NO_ERROR;
+}
+
+void BdxOtaImageCache::Release(const char * path)
+{
+    VerifyOrReturn(path != nullptr);
+
+    auto existing = mImages.find(path);
+    VerifyOrReturn(existing != mImages.end());
+    VerifyOrReturn(--existing->second.mRefCount == 0);
+
+    Unmap(existing->second);
+    mImages.erase(existing);
+}
+
+void BdxOtaImageCache::Unmap(MappedImage & image)
+{
+    if (image.mAddress != nullptr)
+    {
+        munmap(image.mAddress, image.mLength);
+    }
+
+    image.mAddress = nullptr;
+    image.mLength  = 0;
+}
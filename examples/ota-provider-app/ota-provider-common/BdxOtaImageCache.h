@@ -0,0 +1,70 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+
+#include <map>
+#include <string>
+
+/**
+ * Read-only memory mappings of the OTA image files being served.
+ *
+ * Each image file is mapped once and shared by all BDX transfers serving it, so concurrent transfers
+ * read blocks straight out of the page cache instead of opening and seeking the file for every block.
+ * Mappings are reference counted and unmapped when the last transfer using them releases them.
+ */
+class BdxOtaImageCache
+{
+public:
+    BdxOtaImageCache() = default;
+    ~BdxOtaImageCache();
+
+    BdxOtaImageCache(const BdxOtaImageCache &)             = delete;
+    BdxOtaImageCache & operator=(const BdxOtaImageCache &) = delete;
+
+    /**
+     * Get the content of the image file at the given path, mapping it if it is not mapped yet.
+     *
+     * Every successful call must be balanced by a call to Release() with the same path.
+     *
+     * @param[in]  path   Null-terminated path of the image file
+     * @param[out] image  Span covering the whole file content, valid until the matching Release()
+     */
+    CHIP_ERROR Acquire(const char * path, chip::ByteSpan & image);
+
+    /**
+     * Release a reference obtained with Acquire().
+     */
+    void Release(const char * path);
+
+    size_t GetMappedImageCount() const { return mImages.size(); }
+
+private:
+    struct MappedImage
+    {
+        void * mAddress  = nullptr;
+        size_t mLength   = 0;
+        size_t mRefCount = 0;
+    };
+
+    static void Unmap(MappedImage & image);
+
+    std::map<std::string, MappedImage> mImages;
+};
@@ -24,44 +24,27 @@
 #include <messaging/Flags.h>
 #include <protocols/bdx/BdxTransferSession.h>
 
-#include <fstream>
+#include <algorithm>
 
 using chip::bdx::StatusCode;
 using chip::bdx::TransferControlFlags;
 using chip::bdx::TransferSession;
 
-BdxOtaSender::BdxOtaSender()
+BdxOtaSession::BdxOtaSession(BdxOtaSender & sender, chip::FabricIndex fabricIndex, chip::NodeId nodeId) :
+    mSender(sender), mFabricIndex(fabricIndex), mNodeId(nodeId)
 {
     memset(mFileDesignator, 0, chip::bdx::kMaxFileDesignatorLen);
 }
 
-CHIP_ERROR BdxOtaSender::InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId)
+BdxOtaSession::~BdxOtaSession()
 {
-    if (mInitialized)
+    if (mImageAcquired)
     {
-        // Reset stale connection from the Same Node if exists
-        if ((mFabricIndex.HasValue() && mFabricIndex.Value() == fabricIndex) && (mNodeId.HasValue() && mNodeId.Value() == nodeId))
-        {
-            Reset();
-        }
-        // Prevent a new node connection since another is active
-        else if ((mFabricIndex.HasValue() && mFabricIndex.Value() != fabricIndex) ||
-                 (mNodeId.HasValue() && mNodeId.Value() != nodeId))
-        {
-            return CHIP_ERROR_BUSY;
-        }
-        else
-        {
-            return CHIP_ERROR_INTERNAL;
-        }
+        mSender.mImageCache.Release(mFileDesignator);
     }
-    mFabricIndex.SetValue(fabricIndex);
-    mNodeId.SetValue(nodeId);
-    mInitialized = true;
-    return CHIP_NO_ERROR;
 }
 
-void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & event)
+void BdxOtaSession::HandleTransferSessionOutput(TransferSession::OutputEvent & event)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
@@ -92,6 +75,7 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
             {
                 // After sending the StatusReport, exchange context gets closed so, set mExchangeCtx to null
                 mExchangeCtx = nullptr;
+                Reset();
             }
         }
         else
@@ -102,94 +86,18 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
 
         break;
     }
-    case TransferSession::OutputEventType::kInitReceived: {
-        // TransferSession will automatically reject a transfer if there are no
-        // common supported control modes. It will also default to the smaller
-        // block size.
-        TransferSession::TransferAcceptData acceptData;
-        acceptData.ControlMode  = TransferControlFlags::kReceiverDrive; // OTA must use receiver drive
-        acceptData.MaxBlockSize = mTransfer.GetTransferBlockSize();
-        acceptData.StartOffset  = mTransfer.GetStartOffset();
-        acceptData.Length       = mTransfer.GetTransferLength();
-        VerifyOrReturn(mTransfer.AcceptTransfer(acceptData) == CHIP_NO_ERROR,
-                       ChipLogError(BDX, "AcceptTransfer failed: %" CHIP_ERROR_FORMAT, err.Format()));
-
-        // Store the file designator used during block query
-        uint16_t fdl       = 0;
-        const uint8_t * fd = mTransfer.GetFileDesignator(fdl);
-        VerifyOrReturn(fdl < chip::bdx::kMaxFileDesignatorLen,
-                       ChipLogError(BDX, "Cannot store file designator with length = %d", fdl));
-        memcpy(mFileDesignator, fd, fdl);
-        mFileDesignator[fdl] = 0;
-
+    case TransferSession::OutputEventType::kInitReceived:
+        err = OnInitReceived();
+        VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(BDX, "AcceptTransfer failed: %" CHIP_ERROR_FORMAT, err.Format()));
         break;
-    }
     case TransferSession::OutputEventType::kQueryReceived:
-    case TransferSession::OutputEventType::kQueryWithSkipReceived: {
-        TransferSession::BlockData blockData;
-        uint16_t blockSize   = mTransfer.GetTransferBlockSize();
-        uint16_t bytesToRead = blockSize;
-        uint64_t bytesToSkip = 0;
-
-        if (event.EventType == TransferSession::OutputEventType::kQueryWithSkipReceived)
-        {
-            bytesToSkip = event.bytesToSkip.BytesToSkip;
-        }
-        uint64_t seekOffset = mNumBytesSent + bytesToSkip;
-
-        // TODO: This should be a utility function in TransferSession
-        if ((mTransfer.GetTransferLength() > 0) && ((seekOffset + blockSize) > mTransfer.GetTransferLength()))
-        {
-            // cast should be safe because of condition above
-            bytesToRead = static_cast<uint16_t>(mTransfer.GetTransferLength() - seekOffset);
-        }
-
-        chip::System::PacketBufferHandle blockBuf = chip::System::PacketBufferHandle::New(bytesToRead);
-        if (blockBuf.IsNull())
-        {
-            // TODO(#13981): AbortTransfer() needs to support GeneralStatusCode failures as well as BDX specific errors.
-            mTransfer.AbortTransfer(StatusCode::kUnknown);
-            return;
-        }
-
-        std::ifstream otaFile(mFileDesignator, std::ifstream::in);
-        if (!otaFile.good())
-        {
-            ChipLogError(BDX, "OTA file open failed");
-            mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
-            return;
-        }
-
-        if (seekOffset > static_cast<uint64_t>(std::numeric_limits<std::streamoff>::max()))
-        {
-            ChipLogError(BDX, "Seek offset too large");
-            mTransfer.AbortTransfer(StatusCode::kLengthTooLarge);
-            return;
-        }
-        otaFile.seekg(static_cast<std::streamoff>(seekOffset));
-        otaFile.read(reinterpret_cast<char *>(blockBuf->Start()), bytesToRead);
-        if (!(otaFile.good() || otaFile.eof()))
-        {
-            ChipLogError(BDX, "OTA file read failed");
-            mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
-            return;
-        }
-
-        blockData.Data   = blockBuf->Start();
-        blockData.Length = static_cast<size_t>(otaFile.gcount());
-        blockData.IsEof  = (blockData.Length < blockSize) ||
-            (seekOffset + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength() || (otaFile.peek() == EOF));
-        mNumBytesSent = static_cast<uint32_t>(seekOffset + blockData.Length);
-        otaFile.close();
-
-        err = mTransfer.PrepareBlock(blockData);
-        if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(BDX, "PrepareBlock failed: %" CHIP_ERROR_FORMAT, err.Format());
-            mTransfer.AbortTransfer(StatusCode::kUnknown);
-        }
+        err = OnQueryReceived(0);
+        VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(BDX, "Block query failed: %" CHIP_ERROR_FORMAT, err.Format()));
+        break;
+    case TransferSession::OutputEventType::kQueryWithSkipReceived:
+        err = OnQueryReceived(event.bytesToSkip.BytesToSkip);
+        VerifyOrReturn(err == CHIP_NO_ERROR, ChipLogError(BDX, "Block query failed: %" CHIP_ERROR_FORMAT, err.Format()));
         break;
-    }
     case TransferSession::OutputEventType::kAckReceived:
         break;
     case TransferSession::OutputEventType::kAckEOFReceived:
@@ -216,23 +124,308 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
     }
 }
 
+CHIP_ERROR BdxOtaSession::OnInitReceived()
+{
+    // TransferSession will automatically reject a transfer if there are no
+    // common supported control modes. It will also default to the smaller
+    // block size.
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = TransferControlFlags::kReceiverDrive; // OTA must use receiver drive
+    acceptData.MaxBlockSize = mTransfer.GetTransferBlockSize();
+    acceptData.StartOffset  = mTransfer.GetStartOffset();
+    acceptData.Length       = mTransfer.GetTransferLength();
+    ReturnErrorOnFailure(mTransfer.AcceptTransfer(acceptData));
+
+    // Store the file designator used during block query
+    uint16_t fdl       = 0;
+    const uint8_t * fd = mTransfer.GetFileDesignator(fdl);
+    VerifyOrReturnError(fdl < chip::bdx::kMaxFileDesignatorLen, CHIP_ERROR_BUFFER_TOO_SMALL,
+                        ChipLogError(BDX, "Cannot store file designator with length = %d", fdl));
+    VerifyOrReturnError(!mImageAcquired, CHIP_ERROR_INCORRECT_STATE);
+    memcpy(mFileDesignator, fd, fdl);
+    mFileDesignator[fdl] = 0;
+
+    CHIP_ERROR err = mSender.mImageCache.Acquire(mFileDesignator, mImage);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "OTA file open failed");
+        mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
+        return err;
+    }
+    mImageAcquired = true;
+    mNextBlockTime = chip::System::SystemClock().GetMonotonicTimestamp();
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BdxOtaSession::OnQueryReceived(uint64_t bytesToSkip)
+{
+    VerifyOrReturnError(mImageAcquired, CHIP_ERROR_INCORRECT_STATE, mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown));
+
+    uint16_t blockSize  = mTransfer.GetTransferBlockSize();
+    uint64_t seekOffset = mNumBytesSent + bytesToSkip;
+
+    if (seekOffset > mImage.size())
+    {
+        ChipLogError(BDX, "Seek offset too large");
+        mTransfer.AbortTransfer(StatusCode::kLengthTooLarge);
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    uint64_t bytesToRead = std::min<uint64_t>(blockSize, mImage.size() - seekOffset);
+    // TODO: This should be a utility function in TransferSession
+    if ((mTransfer.GetTransferLength() > 0) && ((seekOffset + bytesToRead) > mTransfer.GetTransferLength()))
+    {
+        bytesToRead = (seekOffset < mTransfer.GetTransferLength()) ? mTransfer.GetTransferLength() - seekOffset : 0;
+    }
+
+    mBlockOffset  = seekOffset;
+    mBlockLength  = static_cast<size_t>(bytesToRead);
+    mBlockIsEof   = (mBlockLength < blockSize) || (seekOffset + mBlockLength == mTransfer.GetTransferLength()) ||
+        (seekOffset + mBlockLength == mImage.size());
+    mNumBytesSent = seekOffset + mBlockLength;
+
+    uint32_t maxBytesPerSecond = mSender.mMaxBytesPerSecond;
+    if (maxBytesPerSecond == 0)
+    {
+        return SendBlock();
+    }
+
+    // Pace blocks so that the transfer stays under the configured rate, without ever delaying the first block
+    chip::System::Clock::Timestamp now      = chip::System::SystemClock().GetMonotonicTimestamp();
+    chip::System::Clock::Timestamp sendTime = std::max(now, mNextBlockTime);
+    chip::System::Clock::Milliseconds64 blockDuration((static_cast<uint64_t>(mBlockLength) * 1000) / maxBytesPerSecond);
+    mNextBlockTime = sendTime + blockDuration;
+
+    if (sendTime == now)
+    {
+        return SendBlock();
+    }
+
+    return mSender.mSystemLayer->StartTimer(std::chrono::duration_cast<chip::System::Clock::Timeout>(sendTime - now),
+                                            HandleRateLimitTimer, this);
+}
+
+CHIP_ERROR BdxOtaSession::SendBlock()
+{
+    // The block is taken straight from the mapped image, TransferSession copies it into the outgoing message
+    TransferSession::BlockData blockData;
+    blockData.Data   = mImage.data() + mBlockOffset;
+    blockData.Length = mBlockLength;
+    blockData.IsEof  = mBlockIsEof;
+
+    CHIP_ERROR err = mTransfer.PrepareBlock(blockData);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(BDX, "PrepareBlock failed: %" CHIP_ERROR_FORMAT, err.Format());
+        mTransfer.AbortTransfer(StatusCode::kUnknown);
+    }
+    return err;
+}
+
+void BdxOtaSession::HandleRateLimitTimer(chip::System::Layer * systemLayer, void * appState)
+{
+    auto * session = static_cast<BdxOtaSession *>(appState);
+    VerifyOrReturn(!session->mReleasePending);
+
+    LogErrorOnFailure(session->SendBlock());
+    session->ScheduleImmediatePoll();
+}
+
+void BdxOtaSession::HandleTransferInitTimeout(chip::System::Layer * systemLayer, void * appState)
+{
+    auto * session = static_cast<BdxOtaSession *>(appState);
+    VerifyOrReturn(!session->mReleasePending && session->mExchangeCtx == nullptr);
+
+    // TransferSession does not time out before the first message, so a requestor that never starts the transfer
+    // would otherwise hold its session forever
+    ChipLogError(BDX, "No TransferInit received from node " ChipLogFormatX64 ", releasing its session",
+                 ChipLogValueX64(session->mNodeId));
+    session->Reset();
+}
+
+void BdxOtaSession::OnExchangeClosing(chip::Messaging::ExchangeContext * ec)
+{
+    // The exchange was closed by us, Reset() is already taking care of the session
+    VerifyOrReturn(!mIsExchangeClosing);
+
+    // The exchange is closed externally (e.g. response timeout), so it must not be used anymore
+    mExchangeCtx = nullptr;
+    Reset();
+}
+
 /* Reset() calls bdx::TransferSession::Reset() which sets the output event type to
  * TransferSession::OutputEventType::kNone. So, bdx::TransferFacilitator::PollForOutput()
  * will call HandleTransferSessionOutput() with event TransferSession::OutputEventType::kNone.
  * Since we are ignoring kNone events so, it is okay HandleTransferSessionOutput() being called with event kNone
  */
-void BdxOtaSender::Reset()
+void BdxOtaSession::Reset()
 {
-    mFabricIndex.ClearValue();
-    mNodeId.ClearValue();
+    VerifyOrReturn(!mReleasePending);
+
+    if (mSender.mSystemLayer != nullptr)
+    {
+        mSender.mSystemLayer->CancelTimer(HandleRateLimitTimer, this);
+        mSender.mSystemLayer->CancelTimer(HandleTransferInitTimeout, this);
+    }
+
     ResetTransfer();
     if (mExchangeCtx != nullptr)
     {
+        mIsExchangeClosing = true;
         mExchangeCtx->Close();
-        mExchangeCtx = nullptr;
+        mIsExchangeClosing = false;
+        mExchangeCtx       = nullptr;
     }
 
-    mInitialized  = false;
-    mNumBytesSent = 0;
-    memset(mFileDesignator, 0, chip::bdx::kMaxFileDesignatorLen);
+    mSender.ReleaseSessionLater(this);
+}
+
+BdxOtaSender::~BdxOtaSender()
+{
+    if (mReleaseScheduled)
+    {
+        mSystemLayer->CancelTimer(HandleReleaseWork, this);
+    }
+    mSessions.ReleaseAll();
+}
+
+CHIP_ERROR BdxOtaSender::InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId)
+{
+    // Reset stale connection from the Same Node if exists
+    BdxOtaSession * session = FindSession(fabricIndex, nodeId);
+    if (session != nullptr)
+    {
+        session->Reset();
+    }
+
+    // Called from the QueryImage handler, so no session is on the call stack and the sessions of finished transfers
+    // can be reclaimed right away instead of occupying the pool until the scheduled release runs
+    ReleasePendingSessions();
+
+    // Prevent a new node connection once the maximum number of transfers are active
+    VerifyOrReturnError(mSessions.Allocated() < mMaxSessions, CHIP_ERROR_BUSY);
+
+    mPendingSession = mSessions.CreateObject(*this, fabricIndex, nodeId);
+    VerifyOrReturnError(mPendingSession != nullptr, CHIP_ERROR_BUSY);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BdxOtaSender::PrepareForTransfer(chip::System::Layer * layer, chip::bdx::TransferRole role,
+                                            chip::BitFlags<TransferControlFlags> xferControlOpts, uint16_t maxBlockSize,
+                                            chip::System::Clock::Timeout timeout, chip::System::Clock::Timeout pollFreq)
+{
+    VerifyOrReturnError(layer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mPendingSession != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    BdxOtaSession * session = mPendingSession;
+    mPendingSession         = nullptr;
+    mSystemLayer            = layer;
+
+    CHIP_ERROR err = session->PrepareForTransfer(layer, role, xferControlOpts, maxBlockSize, timeout, pollFreq);
+    if (err == CHIP_NO_ERROR)
+    {
+        // Release the session if the requestor does not start the transfer within the BDX timeout
+        err = layer->StartTimer(timeout, BdxOtaSession::HandleTransferInitTimeout, session);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        session->Reset();
+    }
+    return err;
+}
+
+void BdxOtaSender::AbortAllTransfers()
+{
+    mSessions.ForEachActiveObject([](BdxOtaSession * session) {
+        session->Reset();
+        return chip::Loop::Continue;
+    });
+}
+
+CHIP_ERROR BdxOtaSender::OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader,
+                                                      chip::Messaging::ExchangeDelegate *& newDelegate)
+{
+    // The peer is only known once the exchange exists, so the first message is dispatched in OnMessageReceived()
+    newDelegate = this;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BdxOtaSender::OnMessageReceived(chip::Messaging::ExchangeContext * ec, const chip::PayloadHeader & payloadHeader,
+                                           chip::System::PacketBufferHandle && payload)
+{
+    VerifyOrReturnError(ec != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    chip::FabricIndex fabricIndex = ec->GetSessionHandle()->GetFabricIndex();
+    chip::NodeId nodeId           = ec->GetSessionHandle()->GetPeer().GetNodeId();
+
+    BdxOtaSession * session = FindSession(fabricIndex, nodeId);
+    VerifyOrReturnError(session != nullptr && session->mExchangeCtx == nullptr, CHIP_ERROR_INCORRECT_STATE,
+                        ChipLogError(BDX, "No BDX transfer prepared for node " ChipLogFormatX64, ChipLogValueX64(nodeId)));
+
+    // Every further message on this exchange goes straight to the session, which times out on its own from now on
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(BdxOtaSession::HandleTransferInitTimeout, session);
+    }
+    ec->SetDelegate(session);
+    return session->OnMessageReceived(ec, payloadHeader, std::move(payload));
+}
+
+BdxOtaSession * BdxOtaSender::FindSession(chip::FabricIndex fabricIndex, chip::NodeId nodeId)
+{
+    BdxOtaSession * found = nullptr;
+    mSessions.ForEachActiveObject([&](BdxOtaSession * session) {
+        if (!session->mReleasePending && session->IsForPeer(fabricIndex, nodeId))
+        {
+            found = session;
+            return chip::Loop::Break;
+        }
+        return chip::Loop::Continue;
+    });
+    return found;
+}
+
+void BdxOtaSender::ReleaseSessionLater(BdxOtaSession * session)
+{
+    session->mReleasePending = true;
+    if (mPendingSession == session)
+    {
+        mPendingSession = nullptr;
+    }
+
+    // Without a system layer no transfer was ever prepared, so nothing can still be using the session
+    VerifyOrReturn(mSystemLayer != nullptr, mSessions.ReleaseObject(session));
+
+    mReleasePendingCount++;
+    VerifyOrReturn(!mReleaseScheduled);
+
+    // A single scheduled work releases all the sessions reset in the meantime. If it cannot be scheduled, the session
+    // stays pending until the next InitializeTransfer() or the next successfully scheduled release.
+    CHIP_ERROR err = mSystemLayer->ScheduleWork(HandleReleaseWork, this);
+    VerifyOrReturn(err == CHIP_NO_ERROR,
+                   ChipLogError(BDX, "Cannot schedule the release of BDX sessions: %" CHIP_ERROR_FORMAT, err.Format()));
+    mReleaseScheduled = true;
+}
+
+void BdxOtaSender::ReleasePendingSessions()
+{
+    VerifyOrReturn(mReleasePendingCount > 0);
+
+    mSessions.ForEachActiveObject([this](BdxOtaSession * session) {
+        if (session->mReleasePending)
+        {
+            mSessions.ReleaseObject(session);
+            mReleasePendingCount--;
+        }
+        return chip::Loop::Continue;
+    });
+}
+
+void BdxOtaSender::HandleReleaseWork(chip::System::Layer * systemLayer, void * appState)
+{
+    auto * _this             = static_cast<BdxOtaSender *>(appState);
+    _this->mReleaseScheduled = false;
+    _this->ReleasePendingSessions();
 }
@@ -15,33 +15,160 @@
  *    limitations under the License.
  */
 
+#include <lib/support/Pool.h>
+#include <messaging/ExchangeDelegate.h>
+#include <ota-provider-common/BdxOtaImageCache.h>
 #include <protocols/bdx/BdxTransferSession.h>
 #include <protocols/bdx/TransferFacilitator.h>
+#include <system/SystemClock.h>
 
 #pragma once
 
-class BdxOtaSender : public chip::bdx::Responder
+/**
+ * @def CHIP_OTA_PROVIDER_MAX_BDX_SESSIONS
+ *
+ * @brief Upper bound on the number of BDX transfers an OTA provider serves concurrently.
+ */
+#ifndef CHIP_OTA_PROVIDER_MAX_BDX_SESSIONS
+#define CHIP_OTA_PROVIDER_MAX_BDX_SESSIONS 256
+#endif
+
+class BdxOtaSender;
+
+/**
+ * A single BDX transfer serving an OTA image to one requestor.
+ */
+class BdxOtaSession : public chip::bdx::Responder
 {
 public:
-    BdxOtaSender();
+    BdxOtaSession(BdxOtaSender & sender, chip::FabricIndex fabricIndex, chip::NodeId nodeId);
+    ~BdxOtaSession() override;
 
-    // Initializes BDX transfer-related metadata. Should always be called first.
-    CHIP_ERROR InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
+    bool IsForPeer(chip::FabricIndex fabricIndex, chip::NodeId nodeId) const
+    {
+        return mFabricIndex == fabricIndex && mNodeId == nodeId;
+    }
+
+    /**
+     * Abort the transfer and return the session to the pool.
+     */
+    void Reset();
 
 private:
+    friend class BdxOtaSender;
+
     // Inherited from bdx::TransferFacilitator
     void HandleTransferSessionOutput(chip::bdx::TransferSession::OutputEvent & event) override;
 
-    void Reset();
+    // Inherited from Messaging::ExchangeDelegate
+    void OnExchangeClosing(chip::Messaging::ExchangeContext * ec) override;
+
+    CHIP_ERROR OnInitReceived();
+    CHIP_ERROR OnQueryReceived(uint64_t bytesToSkip);
+    CHIP_ERROR SendBlock();
+
+    static void HandleRateLimitTimer(chip::System::Layer * systemLayer, void * appState);
+    static void HandleTransferInitTimeout(chip::System::Layer * systemLayer, void * appState);
+
+    BdxOtaSender & mSender;
+    const chip::FabricIndex mFabricIndex;
+    const chip::NodeId mNodeId;
 
     // Null-terminated string representing file designator
     char mFileDesignator[chip::bdx::kMaxFileDesignatorLen];
 
-    uint32_t mNumBytesSent = 0;
+    // Content of the served image, owned by the image cache of mSender
+    chip::ByteSpan mImage;
+    bool mImageAcquired = false;
+
+    uint64_t mNumBytesSent = 0;
+
+    // Block prepared in response to the last query, possibly waiting for the rate limiter
+    uint64_t mBlockOffset = 0;
+    size_t mBlockLength   = 0;
+    bool mBlockIsEof      = false;
+
+    // Earliest time at which the next block may be sent when rate limiting is enabled
+    chip::System::Clock::Timestamp mNextBlockTime;
+
+    bool mIsExchangeClosing = false;
+    bool mReleasePending    = false;
+};
+
+/**
+ * Serves OTA images to many requestors at once.
+ *
+ * Every requestor which got an image URI from the provider gets its own BdxOtaSession, allocated in
+ * InitializeTransfer(). BDX exchanges are dispatched to the session of their peer, all sessions share
+ * the memory mapped image content, and each session can be limited to a maximum transfer rate.
+ */
+class BdxOtaSender : public chip::Messaging::UnsolicitedMessageHandler, public chip::Messaging::ExchangeDelegate
+{
+public:
+    BdxOtaSender() = default;
+    ~BdxOtaSender() override;
+
+    // Initializes BDX transfer-related metadata. Should always be called first.
+    // Returns CHIP_ERROR_BUSY if the maximum number of concurrent transfers has been reached.
+    CHIP_ERROR InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
+
+    // Prepares the session allocated by the last InitializeTransfer() call for the incoming BDX transfer.
+    CHIP_ERROR PrepareForTransfer(chip::System::Layer * layer, chip::bdx::TransferRole role,
+                                  chip::BitFlags<chip::bdx::TransferControlFlags> xferControlOpts, uint16_t maxBlockSize,
+                                  chip::System::Clock::Timeout timeout,
+                                  chip::System::Clock::Timeout pollFreq = kDefaultPollFreq);
+
+    // Limits the number of concurrent transfers, up to CHIP_OTA_PROVIDER_MAX_BDX_SESSIONS.
+    void SetMaxSessions(size_t maxSessions)
+    {
+        mMaxSessions = (maxSessions == 0 || maxSessions > CHIP_OTA_PROVIDER_MAX_BDX_SESSIONS) ? CHIP_OTA_PROVIDER_MAX_BDX_SESSIONS
+                                                                                               : maxSessions;
+    }
+
+    // Limits the rate at which each transfer sends blocks. Zero disables rate limiting.
+    void SetMaxBytesPerSecond(uint32_t maxBytesPerSecond) { mMaxBytesPerSecond = maxBytesPerSecond; }
+
+    // Sessions released by a Reset() but not yet returned to the pool are not counted.
+    size_t GetActiveSessionCount() const { return mSessions.Allocated() - mReleasePendingCount; }
+
+    /**
+     * Abort all transfers in progress.
+     */
+    void AbortAllTransfers();
+
+private:
+    friend class BdxOtaSession;
+
+    static constexpr chip::System::Clock::Timeout kDefaultPollFreq = chip::System::Clock::Milliseconds32(500);
+
+    //// UnsolicitedMessageHandler Implementation ////
+    CHIP_ERROR OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader,
+                                            chip::Messaging::ExchangeDelegate *& newDelegate) override;
+
+    //// ExchangeDelegate Implementation ////
+    CHIP_ERROR OnMessageReceived(chip::Messaging::ExchangeContext * ec, const chip::PayloadHeader & payloadHeader,
+                                 chip::System::PacketBufferHandle && payload) override;
+    void OnResponseTimeout(chip::Messaging::ExchangeContext * ec) override {}
+
+    BdxOtaSession * FindSession(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
+
+    // Release the session once the current call stack, which may still be inside the session, has unwound
+    void ReleaseSessionLater(BdxOtaSession * session);
+
+    // Return every session whose release is pending to the pool. Must not be called from within a session.
+    void ReleasePendingSessions();
+
+    static void HandleReleaseWork(chip::System::Layer * systemLayer, void * appState);
 
-    bool mInitialized = false;
+    chip::ObjectPool<BdxOtaSession, CHIP_OTA_PROVIDER_MAX_BDX_SESSIONS> mSessions;
+    BdxOtaImageCache mImageCache;
 
-    chip::Optional<chip::FabricIndex> mFabricIndex;
+    // Session allocated by InitializeTransfer() and not yet prepared by PrepareForTransfer()
+    BdxOtaSession * mPendingSession = nullptr;
 
-    chip::Optional<chip::NodeId> mNodeId;
+    chip::System::Layer * mSystemLayer = nullptr;
+    size_t mMaxSessions                = CHIP_OTA_PROVIDER_MAX_BDX_SESSIONS;
+    uint32_t mMaxBytesPerSecond        = 0;
+    size_t mReleasePendingCount        = 0;
+    bool mReleaseScheduled             = false;
 };
@@ -0,0 +1,292 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/tests/MessagingContext.h>
+#include <ota-provider-common/BdxOtaSender.h>
+#include <protocols/bdx/BdxMessages.h>
+#include <protocols/bdx/TransferFacilitator.h>
+#include <transport/SessionHolder.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace chip;
+using chip::bdx::TransferControlFlags;
+using chip::bdx::TransferSession;
+
+namespace {
+
+constexpr uint16_t kMaxBlockSize                  = 256;
+constexpr size_t kImageSize                       = 1000;
+constexpr System::Clock::Timeout kBdxTimeout      = System::Clock::Seconds16(5);
+constexpr System::Clock::Timeout kPollFreq        = System::Clock::Milliseconds32(1);
+constexpr System::Clock::Timeout kMaxTransferTime = System::Clock::Seconds16(30);
+constexpr NodeId kFirstRequestorNodeId            = 0x1000;
+constexpr uint16_t kFirstSessionId                = 1000;
+
+// Downloads the image from the sender, checking every block against the expected content.
+class TestRequestor : public bdx::Initiator
+{
+public:
+    ~TestRequestor() override { Finish(false); }
+
+    CHIP_ERROR Start(System::Layer & systemLayer, Messaging::ExchangeManager & exchangeMgr, const SessionHandle & session,
+                     const char * imagePath, ByteSpan expectedImage)
+    {
+        mExpectedImage = expectedImage;
+
+        mExchangeCtx = exchangeMgr.NewContext(session, this);
+        VerifyOrReturnError(mExchangeCtx != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        TransferSession::TransferInitData initOptions;
+        initOptions.TransferCtlFlags = TransferControlFlags::kReceiverDrive;
+        initOptions.MaxBlockSize     = kMaxBlockSize;
+        initOptions.FileDesLength    = static_cast<uint16_t>(strlen(imagePath));
+        initOptions.FileDesignator   = Uint8::from_const_char(imagePath);
+
+        CHIP_ERROR err = InitiateTransfer(&systemLayer, bdx::TransferRole::kReceiver, initOptions, kBdxTimeout, kPollFreq);
+        if (err != CHIP_NO_ERROR)
+        {
+            mExchangeCtx->Close();
+            mExchangeCtx = nullptr;
+        }
+        return err;
+    }
+
+    bool IsDone() const { return mSucceeded || mFailed; }
+    bool Succeeded() const { return mSucceeded; }
+
+private:
+    void HandleTransferSessionOutput(TransferSession::OutputEvent & event) override
+    {
+        switch (event.EventType)
+        {
+        case TransferSession::OutputEventType::kMsgToSend: {
+            Messaging::SendFlags sendFlags;
+            const bool isLast = event.msgTypeData.HasMessageType(bdx::MessageType::BlockAckEOF) ||
+                event.msgTypeData.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport);
+            if (!isLast)
+            {
+                sendFlags.Set(Messaging::SendMessageFlags::kExpectResponse);
+            }
+            VerifyOrReturn(mExchangeCtx != nullptr, Finish(false));
+            CHIP_ERROR err = mExchangeCtx->SendMessage(event.msgTypeData.ProtocolId, event.msgTypeData.MessageType,
+                                                       std::move(event.MsgData), sendFlags);
+            if (err != CHIP_NO_ERROR || isLast)
+            {
+                // The exchange closes itself once a message which expects no response has been sent
+                mExchangeCtx = nullptr;
+                Finish(err == CHIP_NO_ERROR && mReceivedEof);
+            }
+            break;
+        }
+        case TransferSession::OutputEventType::kAcceptReceived:
+            VerifyOrReturn(mTransfer.PrepareBlockQuery() == CHIP_NO_ERROR, Finish(false));
+            break;
+        case TransferSession::OutputEventType::kBlockReceived: {
+            const TransferSession::BlockData & block = event.blockdata;
+            const bool matches = (mReceived + block.Length <= mExpectedImage.size()) &&
+                (memcmp(block.Data, mExpectedImage.data() + mReceived, block.Length) == 0);
+            VerifyOrReturn(matches, mTransfer.AbortTransfer(bdx::StatusCode::kUnknown));
+            mReceived += block.Length;
+            if (block.IsEof)
+            {
+                VerifyOrReturn(mReceived == mExpectedImage.size(), mTransfer.AbortTransfer(bdx::StatusCode::kUnknown));
+                VerifyOrReturn(mTransfer.PrepareBlockAck() == CHIP_NO_ERROR, Finish(false));
+                mReceivedEof = true;
+            }
+            else
+            {
+                VerifyOrReturn(mTransfer.PrepareBlockQuery() == CHIP_NO_ERROR, Finish(false));
+            }
+            break;
+        }
+        case TransferSession::OutputEventType::kStatusReceived:
+        case TransferSession::OutputEventType::kInternalError:
+        case TransferSession::OutputEventType::kTransferTimeout:
+            Finish(false);
+            break;
+        default:
+            break;
+        }
+    }
+
+    void Finish(bool succeeded)
+    {
+        VerifyOrReturn(!IsDone());
+        if (mExchangeCtx != nullptr)
+        {
+            mExchangeCtx->Close();
+            mExchangeCtx = nullptr;
+        }
+        ResetTransfer();
+        mSucceeded = succeeded;
+        mFailed    = !succeeded;
+    }
+
+    ByteSpan mExpectedImage;
+    size_t mReceived  = 0;
+    bool mReceivedEof = false;
+    bool mSucceeded   = false;
+    bool mFailed      = false;
+};
+
+class TestBdxOtaSender : public chip::Test::LoopbackMessagingContext
+{
+public:
+    void SetUp() override
+    {
+        chip::Test::LoopbackMessagingContext::SetUp();
+
+        for (size_t i = 0; i < kImageSize; i++)
+        {
+            mImage[i] = static_cast<uint8_t>(i * 7);
+        }
+
+        strcpy(mImagePath, "/tmp/TestBdxOtaSender-XXXXXX");
+        int fd = mkstemp(mImagePath);
+        ASSERT_GE(fd, 0);
+        ASSERT_EQ(write(fd, mImage, kImageSize), static_cast<ssize_t>(kImageSize));
+        close(fd);
+    }
+
+    void TearDown() override
+    {
+        unlink(mImagePath);
+        chip::Test::LoopbackMessagingContext::TearDown();
+    }
+
+    // What the QueryImage handler of the provider does before handing out the image URI.
+    CHIP_ERROR QueryImage(BdxOtaSender & sender, NodeId requestorNodeId)
+    {
+        BitFlags<TransferControlFlags> bdxFlags;
+        bdxFlags.Set(TransferControlFlags::kReceiverDrive);
+        ReturnErrorOnFailure(sender.InitializeTransfer(GetAliceFabricIndex(), requestorNodeId));
+        return sender.PrepareForTransfer(&GetSystemLayer(), bdx::TransferRole::kSender, bdxFlags, kMaxBlockSize, kBdxTimeout,
+                                         kPollFreq);
+    }
+
+    uint8_t mImage[kImageSize];
+    char mImagePath[32];
+};
+
+// A requestor which queries again restarts its transfer. The session of the aborted transfer is only returned to
+// the pool once the event loop runs, which must not make the provider report itself busy.
+TEST_F(TestBdxOtaSender, RequeriesDoNotExhaustSessions)
+{
+    constexpr size_t kMaxSessions = 4;
+    constexpr size_t kQueryCount  = 300;
+
+    auto sender = std::make_unique<BdxOtaSender>();
+    sender->SetMaxSessions(kMaxSessions);
+
+    for (size_t i = 0; i < kQueryCount; i++)
+    {
+        EXPECT_EQ(QueryImage(*sender, kFirstRequestorNodeId + i % kMaxSessions), CHIP_NO_ERROR);
+        EXPECT_EQ(sender->GetActiveSessionCount(), std::min(i + 1, kMaxSessions));
+    }
+
+    // All the sessions are in use by other requestors
+    EXPECT_EQ(QueryImage(*sender, kFirstRequestorNodeId + kMaxSessions), CHIP_ERROR_BUSY);
+
+    sender->AbortAllTransfers();
+    EXPECT_EQ(sender->GetActiveSessionCount(), 0u);
+    DrainAndServiceIO();
+
+    EXPECT_EQ(QueryImage(*sender, kFirstRequestorNodeId + kMaxSessions), CHIP_NO_ERROR);
+    sender->AbortAllTransfers();
+}
+
+// Hundreds of requestors download the image over the loopback transport. Each wave queries while the sessions of
+// the previous one may still be waiting for their release, and is only as large as the exchange pool allows.
+TEST_F(TestBdxOtaSender, ServesManyRequestors)
+{
+    constexpr size_t kConcurrentTransfers = CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS / 2;
+    constexpr size_t kRequestorCount      = 300;
+
+    auto sender = std::make_unique<BdxOtaSender>();
+    sender->SetMaxSessions(kConcurrentTransfers);
+    ASSERT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(Protocols::BDX::Id, sender.get()), CHIP_NO_ERROR);
+
+    const NodeId providerNodeId = GetAliceFabric()->GetNodeId();
+    size_t succeeded            = 0;
+
+    for (size_t first = 0; first < kRequestorCount; first += kConcurrentTransfers)
+    {
+        SessionHolder requestorSessions[kConcurrentTransfers];
+        SessionHolder providerSessions[kConcurrentTransfers];
+        std::vector<std::unique_ptr<TestRequestor>> requestors;
+
+        for (size_t i = 0; i < kConcurrentTransfers; i++)
+        {
+            const size_t index     = first + i;
+            const NodeId nodeId    = kFirstRequestorNodeId + index;
+            const uint16_t localId = static_cast<uint16_t>(kFirstSessionId + 2 * index);
+
+            ASSERT_EQ(GetSecureSessionManager().InjectCaseSessionWithTestKey(
+                          requestorSessions[i], localId, static_cast<uint16_t>(localId + 1), nodeId, providerNodeId,
+                          GetAliceFabricIndex(), GetAliceAddress(), CryptoContext::SessionRole::kInitiator),
+                      CHIP_NO_ERROR);
+            ASSERT_EQ(GetSecureSessionManager().InjectCaseSessionWithTestKey(
+                          providerSessions[i], static_cast<uint16_t>(localId + 1), localId, providerNodeId, nodeId,
+                          GetAliceFabricIndex(), GetBobAddress(), CryptoContext::SessionRole::kResponder),
+                      CHIP_NO_ERROR);
+
+            ASSERT_EQ(QueryImage(*sender, nodeId), CHIP_NO_ERROR);
+
+            requestors.push_back(std::make_unique<TestRequestor>());
+            ASSERT_EQ(requestors.back()->Start(GetSystemLayer(), GetExchangeManager(), requestorSessions[i].Get().Value(),
+                                               mImagePath, ByteSpan(mImage)),
+                      CHIP_NO_ERROR);
+        }
+
+        EXPECT_EQ(sender->GetActiveSessionCount(), kConcurrentTransfers);
+        EXPECT_EQ(QueryImage(*sender, kFirstRequestorNodeId + kRequestorCount), CHIP_ERROR_BUSY);
+
+        GetIOContext().DriveIOUntil(kMaxTransferTime, [&]() {
+            return sender->GetActiveSessionCount() == 0 &&
+                std::all_of(requestors.begin(), requestors.end(), [](const auto & requestor) { return requestor->IsDone(); });
+        });
+        DrainAndServiceIO();
+
+        for (size_t i = 0; i < kConcurrentTransfers; i++)
+        {
+            EXPECT_TRUE(requestors[i]->Succeeded());
+            succeeded += requestors[i]->Succeeded() ? 1 : 0;
+            requestorSessions[i].Get().Value()->AsSecureSession()->MarkForEviction();
+            providerSessions[i].Get().Value()->AsSecureSession()->MarkForEviction();
+        }
+        EXPECT_EQ(sender->GetActiveSessionCount(), 0u);
+        EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+    }
+
+    EXPECT_EQ(succeeded, kRequestorCount);
+    EXPECT_EQ(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForProtocol(Protocols::BDX::Id), CHIP_NO_ERROR);
+}
+
+} // namespace
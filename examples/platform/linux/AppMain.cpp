@@ -100,6 +100,7 @@
 
 #include "AppMain.h"
 #include "CommissionableInit.h"
+#include "MappedEventLogStorage.h"
 
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
 #include "ExampleAccessRestrictionProvider.h"
@@ -630,6 +631,24 @@ void ChipLinuxAppMainLoop(AppMainLoopImplementation * impl)
     initParams.accessRestrictionProvider = exampleAccessRestrictionProvider.get();
 #endif
 
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+    if (LinuxDeviceOptions::GetInstance().eventLogFile != nullptr)
+    {
+        static MappedEventLogStorage sEventLogStorage;
+        CHIP_ERROR err = sEventLogStorage.Init(LinuxDeviceOptions::GetInstance().eventLogFile,
+                                               LinuxDeviceOptions::GetInstance().eventLogBufferSize);
+        if (err == CHIP_NO_ERROR)
+        {
+            initParams.eventLogStorageResources = sEventLogStorage.GetLogStorageResources();
+        }
+        else
+        {
+            ChipLogError(NotSpecified, "Failed to map the event log file, events are kept in memory: %" CHIP_ERROR_FORMAT,
+                         err.Format());
+        }
+    }
+#endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+
     // Init ZCL Data Model and CHIP App Server
     Server::GetInstance().Init(initParams);
 
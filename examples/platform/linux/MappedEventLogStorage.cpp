@@ -0,0 +1,105 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "MappedEventLogStorage.h"
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace chip;
+
+CHIP_ERROR MappedEventLogStorage::Init(const char * path, uint32_t bufferSize)
+{
+    static constexpr app::PriorityLevel kPriorities[kBufferCount] = { app::PriorityLevel::Debug, app::PriorityLevel::Info,
+                                                                      app::PriorityLevel::Critical };
+
+    VerifyOrReturnError(mMapping == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(path != nullptr && bufferSize > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const size_t length = sizeof(FileHeader) + kBufferCount * static_cast<size_t>(bufferSize);
+
+    int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+
+    struct stat st;
+    bool resume = fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) == length;
+    if (!resume && ftruncate(fd, static_cast<off_t>(length)) != 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        close(fd);
+        return err;
+    }
+
+    void * mapping = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    CHIP_ERROR err = mapping == MAP_FAILED ? CHIP_ERROR_POSIX(errno) : CHIP_NO_ERROR;
+    // The mapping stays valid once the file is closed.
+    close(fd);
+    ReturnErrorOnFailure(err);
+
+    mMapping       = static_cast<uint8_t *>(mapping);
+    mMappingLength = length;
+
+    FileHeader * header = reinterpret_cast<FileHeader *>(mMapping);
+    resume = resume && header->mMagic == FileHeader::kMagic && header->mVersion == FileHeader::kVersion &&
+        header->mBufferSize == bufferSize && header->mBufferCount == kBufferCount;
+    if (!resume)
+    {
+        // Invalidate the persisted states so that the buffers start empty.
+        *header              = FileHeader();
+        header->mMagic       = FileHeader::kMagic;
+        header->mVersion     = FileHeader::kVersion;
+        header->mBufferSize  = bufferSize;
+        header->mBufferCount = kBufferCount;
+    }
+
+    for (size_t i = 0; i < kBufferCount; i++)
+    {
+        mResources[i].mpBuffer         = mMapping + sizeof(FileHeader) + i * bufferSize;
+        mResources[i].mBufferSize      = bufferSize;
+        mResources[i].mPriority        = kPriorities[i];
+        mResources[i].mpPersistedState = &header->mStates[i];
+    }
+
+    ChipLogProgress(EventLogging, "Event log mapped from %s (%u bytes per priority, %s)", path, static_cast<unsigned>(bufferSize),
+                    resume ? "resumed" : "new");
+    return CHIP_NO_ERROR;
+}
+
+void MappedEventLogStorage::Shutdown()
+{
+    VerifyOrReturn(mMapping != nullptr);
+
+    if (msync(mMapping, mMappingLength, MS_SYNC) != 0)
+    {
+        ChipLogError(EventLogging, "Failed to flush the event log: %s", strerror(errno));
+    }
+    munmap(mMapping, mMappingLength);
+
+    mMapping       = nullptr;
+    mMappingLength = 0;
+    for (auto & resources : mResources)
+    {
+        resources = app::LogStorageResources();
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/EventManagement.h>
+#include <lib/core/CHIPError.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Event log storage backed by a memory mapped file.
+ *
+ * The event buffers of every priority level, along with their persisted bookkeeping, live in a single file mapped in
+ * memory. Events logged by a previous run are resumed at startup, and large buffers only cost page cache instead of
+ * heap or static memory.
+ */
+class MappedEventLogStorage
+{
+public:
+    // Debug, Info and Critical, matching the buffers the server sets up
+    static constexpr size_t kBufferCount = 3;
+
+    MappedEventLogStorage() = default;
+    ~MappedEventLogStorage() { Shutdown(); }
+
+    MappedEventLogStorage(const MappedEventLogStorage &)             = delete;
+    MappedEventLogStorage & operator=(const MappedEventLogStorage &) = delete;
+
+    /**
+     * Map the event log file, creating it if needed.
+     *
+     * A file laid out for a different buffer size is reset, dropping the events it held.
+     *
+     * @param[in] path        Path of the event log file.
+     * @param[in] bufferSize  Size, in bytes, of the buffer of each priority level.
+     */
+    CHIP_ERROR Init(const char * path, uint32_t bufferSize);
+
+    /**
+     * Flush the event log to its file and unmap it.
+     */
+    void Shutdown();
+
+    /**
+     * Resources to pass as ServerInitParams::eventLogStorageResources, valid until Shutdown().
+     */
+    const chip::app::LogStorageResources * GetLogStorageResources() const { return mResources; }
+
+private:
+    struct FileHeader
+    {
+        static constexpr uint32_t kMagic   = 0x4D45564C; // "MEVL"
+        static constexpr uint32_t kVersion = 1;
+
+        uint32_t mMagic;
+        uint32_t mVersion;
+        uint32_t mBufferSize;
+        uint32_t mBufferCount;
+        chip::app::PersistedEventBufferState mStates[kBufferCount];
+    };
+
+    uint8_t * mMapping    = nullptr;
+    size_t mMappingLength = 0;
+    chip::app::LogStorageResources mResources[kBufferCount];
+};
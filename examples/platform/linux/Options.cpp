@@ -128,6 +128,10 @@ enum
     kDeviceOption_WiFi_PAF,
 #endif
     kDeviceOption_DacProvider,
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+    kDeviceOption_EventLogFile,
+    kDeviceOption_EventLogBufferSize,
+#endif
 };
 
 constexpr unsigned kAppUsageLength = 64;
@@ -204,6 +208,10 @@ OptionDef sDeviceOptionDefs[] = {
     { "faults", kArgumentRequired, kDeviceOption_FaultInjection },
 #endif
     { "dac_provider", kArgumentRequired, kDeviceOption_DacProvider },
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+    { "event-log-file", kArgumentRequired, kDeviceOption_EventLogFile },
+    { "event-log-buffer-size", kArgumentRequired, kDeviceOption_EventLogBufferSize },
+#endif
     {}
 };
 
@@ -368,7 +376,16 @@ const char * sDeviceOptionHelp =
 #endif
     "   --dac_provider <filepath>\n"
     "       A json file with data used by the example dac provider to validate device attestation procedure.\n"
-    "\n";
+    "\n"
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+    "  --event-log-file <filepath>\n"
+    "       A file to keep the event log in. Events survive restarts of the application.\n"
+    "\n"
+    "  --event-log-buffer-size <bytes>\n"
+    "       Size of the event log of each priority level when --event-log-file is used (default: 65536).\n"
+    "\n"
+#endif
+    "";
 
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
 bool ParseAccessRestrictionEntriesFromJson(const char * jsonString, std::vector<AccessRestrictionProvider::Entry> & entries)
@@ -747,6 +764,20 @@ bool HandleOption(const char * aProgram, OptionSet * aOptions, int aIdentifier,
         LinuxDeviceOptions::GetInstance().dacProvider = &testDacProvider;
         break;
     }
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+    case kDeviceOption_EventLogFile:
+        LinuxDeviceOptions::GetInstance().eventLogFile = aValue;
+        break;
+
+    case kDeviceOption_EventLogBufferSize:
+        if (!ParseInt(aValue, LinuxDeviceOptions::GetInstance().eventLogBufferSize) ||
+            LinuxDeviceOptions::GetInstance().eventLogBufferSize == 0)
+        {
+            PrintArgError("%s: invalid value specified for event log buffer size: %s\n", aProgram, aValue);
+            retval = false;
+        }
+        break;
+#endif
     default:
         PrintArgError("%s: INTERNAL ERROR: Unhandled option: %s\n", aProgram, aName);
         retval = false;
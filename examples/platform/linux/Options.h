@@ -81,6 +81,10 @@ struct LinuxDeviceOptions
     uint8_t testEventTriggerEnableKey[16] = { 0 };
     std::vector<std::string> traceTo;
     bool mSimulateNoInternalTime = false;
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+    const char * eventLogFile   = nullptr;
+    uint32_t eventLogBufferSize = 65536;
+#endif
 #if defined(PW_RPC_ENABLED)
     uint16_t rpcServerPort = 33000;
 #endif
@@ -337,6 +337,7 @@ class HostBuilder(GnBuilder):
                  disable_shell=False,
                  use_googletest=False,
                  terms_and_conditions_required: Optional[bool] = None,
+                 enable_bg_event_processing=False,
                  ):
         super(HostBuilder, self).__init__(
             root=os.path.join(root, 'examples', app.ExamplePath()),
@@ -466,6 +467,9 @@ class HostBuilder(GnBuilder):
             else:
                 self.extra_gn_options.append('chip_terms_and_conditions_required=false')
 
+        if enable_bg_event_processing:
+            self.extra_gn_options.append('chip_device_config_enable_bg_event_processing=true')
+
         if self.board == HostBoard.ARM64:
             if not use_clang:
                 raise Exception("Cross compile only supported using clang")
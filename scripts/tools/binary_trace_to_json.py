@@ -0,0 +1,216 @@
+#!/usr/bin/env -S python3 -B
+
+#
+#    Copyright (c) 2024 Project CHIP Authors
+#    All rights reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+"""Converts traces written by the binary tracing backend (src/tracing/binary) into the
+Chrome trace event JSON format, which both chrome://tracing and https://ui.perfetto.dev open.
+
+The file layout is documented in src/tracing/binary/binary_tracing.h.
+"""
+
+import json
+import logging
+import struct
+import sys
+
+import click
+
+MAGIC = b'MTRB'
+VERSION = 1
+
+ENTRY_STRING = 1
+ENTRY_EVENT = 2
+ENTRY_DROPPED = 3
+
+EVENT_FORMAT = struct.Struct('<BIQII4Q')
+DROPPED_FORMAT = struct.Struct('<IQ')
+STRING_HEADER_FORMAT = struct.Struct('<IH')
+
+KIND_TRACE_BEGIN = 1
+KIND_TRACE_END = 2
+KIND_TRACE_INSTANT = 3
+KIND_TRACE_COUNTER = 4
+KIND_MESSAGE_SEND = 5
+KIND_MESSAGE_RECEIVED = 6
+KIND_NODE_LOOKUP = 7
+KIND_NODE_DISCOVERED = 8
+KIND_NODE_DISCOVERY_FAILED = 9
+KIND_METRIC_EVENT = 10
+
+OUTGOING_MESSAGE_TYPES = ['Group', 'Secure', 'Unauthenticated']
+INCOMING_MESSAGE_TYPES = ['Group', 'Secure', 'Unauthenticated']
+DISCOVERY_TYPES = ['intermediate', 'done', 'retry-different']
+METRIC_EVENT_TYPES = ['B', 'E', 'i']
+
+# MetricEvent::Value::Type
+METRIC_VALUE_UNDEFINED = 0
+METRIC_VALUE_INT32 = 1
+METRIC_VALUE_UINT32 = 2
+METRIC_VALUE_ERROR = 3
+
+
+def _name(table, index):
+    return table[index] if index < len(table) else 'Unknown(%d)' % index
+
+
+def _message_args(kind, values):
+    message_types = OUTGOING_MESSAGE_TYPES if kind == KIND_MESSAGE_SEND else INCOMING_MESSAGE_TYPES
+    protocol_id = values[0] >> 32
+    args = {
+        'messageType': _name(message_types, values[0] & 0xFF),
+        'protocol_id': protocol_id & 0xFFFF,
+        'vendor_id': protocol_id >> 16,
+        'protocol_opcode': (values[0] >> 16) & 0xFF,
+        'exchange_flags': (values[0] >> 8) & 0xFF,
+        'exchange_id': values[1] >> 48,
+        'session_id': (values[1] >> 32) & 0xFFFF,
+        'msg_counter': values[1] & 0xFFFFFFFF,
+        'size': values[2],
+    }
+    if values[3]:
+        args['destination_node_id' if kind == KIND_MESSAGE_SEND else 'source_node_id'] = '0x%016X' % values[3]
+    return args
+
+
+def _metric_value(value_type, raw):
+    if value_type == METRIC_VALUE_INT32:
+        return struct.unpack('<i', struct.pack('<I', raw & 0xFFFFFFFF))[0]
+    if value_type == METRIC_VALUE_UINT32:
+        return raw
+    if value_type == METRIC_VALUE_ERROR:
+        return '0x%08X' % raw
+    return None
+
+
+class Converter:
+    def __init__(self):
+        self.strings = {0: None}
+        self.counters = {}
+        self.dropped = {}
+        self.events = []
+
+    def _event(self, phase, name, thread, timestamp, category=None, args=None):
+        event = {'ph': phase, 'name': name, 'pid': 0, 'tid': thread, 'ts': timestamp}
+        if category:
+            event['cat'] = category
+        if phase == 'i':
+            event['s'] = 't'
+        if args:
+            event['args'] = args
+        self.events.append(event)
+
+    def _add_event(self, kind, thread, timestamp, label_id, group_id, values):
+        label = self.strings.get(label_id)
+        group = self.strings.get(group_id)
+
+        if kind == KIND_TRACE_BEGIN:
+            self._event('B', label, thread, timestamp, group)
+        elif kind == KIND_TRACE_END:
+            self._event('E', label, thread, timestamp, group)
+        elif kind == KIND_TRACE_INSTANT:
+            self._event('i', label, thread, timestamp, group)
+        elif kind == KIND_TRACE_COUNTER:
+            self.counters[label] = self.counters.get(label, 0) + 1
+            self._event('C', label, thread, timestamp, args={'count': self.counters[label]})
+        elif kind in (KIND_MESSAGE_SEND, KIND_MESSAGE_RECEIVED):
+            name = 'MessageSend' if kind == KIND_MESSAGE_SEND else 'MessageReceived'
+            self._event('i', name, thread, timestamp, 'Messages', _message_args(kind, values))
+        elif kind == KIND_NODE_LOOKUP:
+            self._event('i', 'LogNodeLookup', thread, timestamp, 'DNSSD', {
+                'node_id': '0x%016X' % values[0],
+                'compressed_fabric_id': '0x%016X' % values[1],
+                'min_lookup_time_ms': values[2],
+                'max_lookup_time_ms': values[3],
+            })
+        elif kind == KIND_NODE_DISCOVERED:
+            self._event('i', 'LogNodeDiscovered', thread, timestamp, 'DNSSD', {
+                'node_id': '0x%016X' % values[0],
+                'compressed_fabric_id': '0x%016X' % values[1],
+                'type': _name(DISCOVERY_TYPES, values[2]),
+            })
+        elif kind == KIND_NODE_DISCOVERY_FAILED:
+            self._event('i', 'LogNodeDiscoveryFailed', thread, timestamp, 'DNSSD', {
+                'node_id': '0x%016X' % values[0],
+                'compressed_fabric_id': '0x%016X' % values[1],
+                'error': '0x%08X' % values[2],
+            })
+        elif kind == KIND_METRIC_EVENT:
+            args = {}
+            value = _metric_value(values[1], values[2])
+            if value is not None:
+                args['value'] = value
+            self._event(_name(METRIC_EVENT_TYPES, values[0]), label, thread, timestamp, 'Metrics', args)
+        else:
+            logging.warning('Skipping event of unknown kind %d', kind)
+
+    def parse(self, data):
+        if data[:4] != MAGIC:
+            raise click.ClickException('Not a binary trace file')
+        version = struct.unpack_from('<H', data, 4)[0]
+        if version != VERSION:
+            raise click.ClickException('Unsupported binary trace version %d' % version)
+
+        offset = 8
+        while offset < len(data):
+            entry_type = data[offset]
+            offset += 1
+            try:
+                if entry_type == ENTRY_STRING:
+                    string_id, length = STRING_HEADER_FORMAT.unpack_from(data, offset)
+                    offset += STRING_HEADER_FORMAT.size
+                    self.strings[string_id] = data[offset:offset + length].decode('utf-8', errors='replace')
+                    offset += length
+                elif entry_type == ENTRY_EVENT:
+                    kind, thread, timestamp, label_id, group_id, *values = EVENT_FORMAT.unpack_from(data, offset)
+                    offset += EVENT_FORMAT.size
+                    self._add_event(kind, thread, timestamp, label_id, group_id, values)
+                elif entry_type == ENTRY_DROPPED:
+                    thread, dropped = DROPPED_FORMAT.unpack_from(data, offset)
+                    offset += DROPPED_FORMAT.size
+                    self.dropped[thread] = dropped
+                else:
+                    raise click.ClickException('Unknown entry type %d at offset %d' % (entry_type, offset - 1))
+            except struct.error:
+                # The application may have exited without closing the trace.
+                logging.warning('Trace truncated at offset %d', offset - 1)
+                break
+
+        for thread, dropped in sorted(self.dropped.items()):
+            logging.warning('Thread %d dropped %d events because its buffer was full', thread, dropped)
+
+    def chrome_trace(self):
+        # Threads are drained independently, so the file is only ordered per thread.
+        # The sort is stable, keeping the order of events sharing a timestamp.
+        self.events.sort(key=lambda event: event['ts'])
+        return {'traceEvents': self.events, 'displayTimeUnit': 'ms'}
+
+
+@click.command()
+@click.argument('input_file', type=click.File('rb'))
+@click.argument('output_file', type=click.File('w'), default='-')
+def main(input_file, output_file):
+    """Convert the binary trace INPUT_FILE to Chrome/Perfetto JSON in OUTPUT_FILE (stdout by default)."""
+    logging.basicConfig(level=logging.INFO, format='%(levelname)s %(message)s')
+
+    converter = Converter()
+    converter.parse(input_file.read())
+    json.dump(converter.chrome_trace(), output_file)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,209 @@
+#!/usr/bin/env -S python3 -B
+
+#
+#    Copyright (c) 2024 Project CHIP Authors
+#    All rights reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+"""Formats the log files written by the deferred logger (src/lib/support/logging/deferred)
+into text, one message per line.
+
+The file layout is documented in src/lib/support/logging/deferred/DeferredLogging.h.
+"""
+
+import logging
+import re
+import struct
+import sys
+
+import click
+
+MAGIC = b'MTRL'
+VERSION = 1
+
+ENTRY_STRING = 1
+ENTRY_LOG = 2
+ENTRY_DROPPED = 3
+
+FLAG_PREFORMATTED = 0x01
+FLAG_TRUNCATED = 0x02
+
+LOG_FORMAT = struct.Struct('<IQIBBIH')
+DROPPED_FORMAT = struct.Struct('<IQ')
+STRING_HEADER_FORMAT = struct.Struct('<IH')
+
+# Same conversions as the logger records, see NextConversion() in DeferredLogging.cpp
+CONVERSION = re.compile(r"%([-+ #0']*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|j|z|t|L)?(.?)")
+
+# Integers printed with these length modifiers are converted to narrower types by printf
+NARROW_BITS = {'hh': 8, 'h': 16, None: 32}
+
+
+class Payload:
+    def __init__(self, data):
+        self.data = data
+        self.offset = 0
+
+    def _unpack(self, fmt):
+        value = struct.unpack_from(fmt, self.data, self.offset)[0]
+        self.offset += struct.calcsize(fmt)
+        return value
+
+    def signed(self):
+        return self._unpack('<q')
+
+    def unsigned(self):
+        return self._unpack('<Q')
+
+    def double(self):
+        return self._unpack('<d')
+
+    def string(self):
+        length = self._unpack('<H')
+        value = self.data[self.offset:self.offset + length]
+        if len(value) != length:
+            raise struct.error('string past the end of the payload')
+        self.offset += length
+        return value.decode('utf-8', errors='replace')
+
+
+def _narrow(value, length, signed):
+    bits = NARROW_BITS.get(length, 64)
+    value &= (1 << bits) - 1
+    if signed and value >= 1 << (bits - 1):
+        value -= 1 << bits
+    return value
+
+
+def format_message(fmt, payload):
+    """Replays the printf-style format fmt with the arguments recorded in payload."""
+    args = Payload(payload)
+
+    def replace(match):
+        flags, width, precision, length, conversion = match.groups()
+        if conversion == '%':
+            return '%'
+
+        flags = flags.replace("'", '')
+        if width == '*':
+            width = args.signed()
+            if width < 0:
+                flags += '-'
+            width = str(abs(width))
+        if precision == '*':
+            precision = args.signed()
+            precision = str(precision) if precision >= 0 else None
+        spec = '%' + flags + (width or '') + ('.' + precision if precision is not None else '')
+
+        if conversion in 'di':
+            return (spec + 'd') % _narrow(args.signed(), length, True)
+        if conversion == 'o' and '#' in flags:
+            # Python prefixes alternate form octals with 0o, printf with 0
+            value = _narrow(args.unsigned(), length, False)
+            return ('%' + flags.replace('#', '').replace('0', '') + (width or '') + 's') % ('0%o' % value if value else '0')
+        if conversion in 'uoxX':
+            return (spec + conversion.replace('u', 'd')) % _narrow(args.unsigned(), length, False)
+        if conversion == 'c':
+            return (spec + 'c') % chr(args.signed() & 0xFF)
+        if conversion == 's':
+            return (spec + 's') % args.string()
+        if conversion == 'p':
+            value = args.unsigned()
+            return (spec + 's') % ('0x%x' % value if value else '(nil)')
+        if conversion in 'aA':
+            # Python keeps the trailing zeros of the mantissa, printf does not
+            value = re.sub(r'\.?0+p', 'p', float.hex(args.double()))
+            return (spec + 's') % (value.upper() if conversion == 'A' else value)
+        if conversion in 'eEfFgG':
+            return (spec + conversion) % args.double()
+        raise ValueError('Unsupported conversion %r' % match.group(0))
+
+    return CONVERSION.sub(replace, fmt)
+
+
+class Decoder:
+    def __init__(self, output):
+        self.output = output
+        self.strings = {0: None}
+        self.dropped = {}
+
+    def _log(self, thread, timestamp, module_id, category, flags, format_id, payload):
+        if flags & FLAG_PREFORMATTED:
+            text = payload.decode('utf-8', errors='replace')
+        else:
+            try:
+                text = format_message(self.strings.get(format_id) or '', payload)
+            except (ValueError, TypeError, struct.error) as e:
+                text = '<cannot format %r: %s>' % (self.strings.get(format_id), e)
+        if flags & FLAG_TRUNCATED:
+            text += '...'
+
+        seconds, microseconds = divmod(timestamp, 1000000)
+        self.output.write('[%d.%06d][%d] CHIP:%s: %s\n' %
+                          (seconds, microseconds, thread, self.strings.get(module_id), text))
+
+    def parse(self, data):
+        if data[:4] != MAGIC:
+            raise click.ClickException('Not a deferred log file')
+        version = struct.unpack_from('<H', data, 4)[0]
+        if version != VERSION:
+            raise click.ClickException('Unsupported deferred log version %d' % version)
+
+        offset = 8
+        while offset < len(data):
+            entry_type = data[offset]
+            offset += 1
+            try:
+                if entry_type == ENTRY_STRING:
+                    string_id, length = STRING_HEADER_FORMAT.unpack_from(data, offset)
+                    offset += STRING_HEADER_FORMAT.size
+                    self.strings[string_id] = data[offset:offset + length].decode('utf-8', errors='replace')
+                    offset += length
+                elif entry_type == ENTRY_LOG:
+                    thread, timestamp, module_id, category, flags, format_id, length = LOG_FORMAT.unpack_from(data, offset)
+                    offset += LOG_FORMAT.size
+                    payload = data[offset:offset + length]
+                    if len(payload) != length:
+                        raise struct.error('payload past the end of the file')
+                    offset += length
+                    self._log(thread, timestamp, module_id, category, flags, format_id, payload)
+                elif entry_type == ENTRY_DROPPED:
+                    thread, dropped = DROPPED_FORMAT.unpack_from(data, offset)
+                    offset += DROPPED_FORMAT.size
+                    self.dropped[thread] = self.dropped.get(thread, 0) + dropped
+                    self.output.write('<thread %d dropped %d messages>\n' % (thread, dropped))
+                else:
+                    raise click.ClickException('Unknown entry type %d at offset %d' % (entry_type, offset - 1))
+            except struct.error:
+                # The application may have exited without stopping the logger.
+                logging.warning('Log truncated at offset %d', offset - 1)
+                break
+
+        for thread, dropped in sorted(self.dropped.items()):
+            logging.warning('Thread %d dropped %d messages because its buffer was full', thread, dropped)
+
+
+@click.command()
+@click.argument('input_file', type=click.File('rb'))
+@click.argument('output_file', type=click.File('w'), default='-')
+def main(input_file, output_file):
+    """Format the deferred log INPUT_FILE as text into OUTPUT_FILE (stdout by default)."""
+    logging.basicConfig(level=logging.INFO, format='%(levelname)s %(message)s')
+
+    Decoder(output_file).parse(input_file.read())
+
+
+if __name__ == '__main__':
+    sys.exit(main())
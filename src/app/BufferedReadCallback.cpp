@@ -26,6 +26,8 @@
 #include <app/InteractionModelEngine.h>
 #include <lib/support/ScopedBuffer.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace app {
 
@@ -85,11 +87,16 @@ CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::ScopedBufferTLVReader & aR
     for (auto & bufHandle : mBufferedList)
     {
         System::PacketBufferTLVReader reader;
+        CHIP_ERROR err;
 
         reader.Init(std::move(bufHandle));
 
-        ReturnErrorOnFailure(reader.Next());
-        ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+            ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
+        }
+
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
     }
 
     ReturnErrorOnFailure(writer.EndContainer(outerType));
@@ -103,34 +110,40 @@ CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::ScopedBufferTLVReader & aR
 
 CHIP_ERROR BufferedReadCallback::BufferListItem(TLV::TLVReader & reader)
 {
-    System::PacketBufferTLVWriter writer;
-    System::PacketBufferHandle handle;
-
     //
-    // We conservatively allocate a packet buffer as big as an IPv6 MTU (since we're buffering
-    // data received over the wire, which should always fit within that).
+    // Figure out how big the item is going to be once copied: the reader is already positioned past the control octet, the
+    // tag and the length field of the item, so skipping a copy of it to its end gives us the size of its value. The copy
+    // gets an anonymous tag, so on top of that we only need room for a control octet and a length field.
+    //
+    constexpr size_t kMaxElementHeadSize = 1 + sizeof(uint64_t);
+
+    TLV::TLVReader elementReader;
+    elementReader.Init(reader);
+    ReturnErrorOnFailure(elementReader.Skip());
+    const size_t elementSize = kMaxElementHeadSize + (elementReader.GetLengthRead() - reader.GetLengthRead());
+
     //
-    // We could have snapshotted the reader at its current position, advanced it past the current element
-    // and computed the delta in its read point to figure out the size of the element before allocating
-    // our target buffer. However, the reader's current position is already set past the control octet
-    // and the tag. Consequently, the computed size is always going to omit the sizes of these two parts of the
-    // TLV element. Since the tag can vary in size, for now, let's just do the safe thing. In the future, if this is a problem,
-    // we can improve this.
+    // Items are packed one after another into the last buffer while they fit, so that reports carrying many list
+    // items (e.g. large reports received over TCP) don't cost a buffer allocation per item. A new buffer is as big as
+    // an IPv6 MTU, or as big as the item if it came in a large report and is larger than that.
     //
-    handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-    VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
+    if (mBufferedList.empty() || mBufferedList.back()->AvailableDataLength() < elementSize)
+    {
+        System::PacketBufferHandle handle =
+            System::PacketBufferHandle::New(std::max(elementSize, chip::app::kMaxSecureSduLengthBytes), 0);
+        VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
 
-    writer.Init(std::move(handle), false);
+        mBufferedList.push_back(std::move(handle));
+    }
 
-    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
-    ReturnErrorOnFailure(writer.Finalize(&handle));
+    System::PacketBufferHandle & buffer = mBufferedList.back();
+    TLV::TLVWriter writer;
 
-    // Compact the buffer down to a more reasonably sized packet buffer
-    // if we can.
-    //
-    handle.RightSize();
+    writer.Init(buffer->Start() + buffer->DataLength(), buffer->AvailableDataLength());
+    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
+    ReturnErrorOnFailure(writer.Finalize());
 
-    mBufferedList.push_back(std::move(handle));
+    buffer->SetDataLength(buffer->DataLength() + writer.GetLengthWritten());
 
     return CHIP_NO_ERROR;
 }
@@ -121,8 +121,8 @@ private:
     }
 
     /*
-     * Given a reader positioned at a list element, allocate a packet buffer, copy the list item where
-     * the reader is positioned into that buffer and add it to our buffered list for tracking.
+     * Given a reader positioned at a list element, copy the list item where the reader is positioned
+     * at the end of the last buffer of our buffered list, allocating a new packet buffer if it doesn't fit.
      *
      * This should be called in list index order starting from the lowest index that needs to be buffered.
      *
@@ -68,6 +68,16 @@ struct ReclaimEventCtx
     size_t mSpaceNeededForMovedEvent    = 0;
 };
 
+/**
+ * @brief
+ *  Internal structure for checking the events resumed from a persisted buffer.
+ */
+struct ResumedEventsContext
+{
+    EventNumber mLastEventNumber = 0;
+    size_t mEventCount           = 0;
+};
+
 /**
  * @brief
  *  Internal structure for traversing event list.
@@ -80,6 +90,17 @@ struct CopyAndAdjustDeltaTimeContext
     EventLoadOutContext * mpContext = nullptr;
 };
 
+/**
+ * @brief
+ *  Whether the timestamp of the current event is reported as a delta from the previous event. Timestamps can go backwards
+ *  between events resumed from persisted storage and events of the current run, those keep their absolute timestamp.
+ */
+static bool UseDeltaTimestamp(const EventLoadOutContext & aContext)
+{
+    return !aContext.mFirst && aContext.mCurrentTime.mType == aContext.mPreviousTime.mType &&
+        aContext.mCurrentTime.mValue >= aContext.mPreviousTime.mValue;
+}
+
 void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, uint32_t aNumBuffers,
                            CircularEventBuffer * apCircularEventBuffer, const LogStorageResources * const apLogStorageResources,
                            MonotonicallyIncreasingCounter<EventNumber> * apEventNumberCounter,
@@ -108,7 +129,7 @@ void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, uint3
 
         current = &apCircularEventBuffer[bufferIndex];
         current->Init(apLogStorageResources[bufferIndex].mpBuffer, apLogStorageResources[bufferIndex].mBufferSize, prev, next,
-                      apLogStorageResources[bufferIndex].mPriority);
+                      apLogStorageResources[bufferIndex].mPriority, apLogStorageResources[bufferIndex].mpPersistedState);
 
         prev = current;
 
@@ -123,6 +144,8 @@ void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, uint3
     mState        = EventManagementStates::Idle;
     mBytesWritten = 0;
 
+    CheckResumedEvents();
+
     mMonotonicStartupTime = aMonotonicStartupTime;
 
     // TODO(#36890): Should remove using the global instance and rely only on passed in variable.
@@ -136,11 +159,80 @@ void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, uint3
     }
 }
 
+CHIP_ERROR EventManagement::CheckResumedEvent(const TLVReader & aReader, size_t, void * apContext)
+{
+    ResumedEventsContext * const ctx = static_cast<ResumedEventsContext *>(apContext);
+    EventNumber eventNumber          = 0;
+
+    ReturnErrorOnFailure(PeekEventNumber(aReader, eventNumber));
+    VerifyOrReturnError(ctx->mEventCount == 0 || eventNumber >= ctx->mLastEventNumber, CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+    ctx->mLastEventNumber = eventNumber;
+    ctx->mEventCount++;
+    return CHIP_NO_ERROR;
+}
+
+void EventManagement::CheckResumedEvents()
+{
+    size_t eventCount = 0;
+
+    for (auto * buffer = mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer())
+    {
+        CircularTLVReader reader;
+        ResumedEventsContext ctx;
+
+        if (buffer->DataLength() == 0)
+        {
+            continue;
+        }
+
+        reader.Init(*buffer);
+        CHIP_ERROR err = TLV::Utilities::Iterate(reader, CheckResumedEvent, &ctx, false /*recurse*/);
+        if (err == CHIP_END_OF_TLV)
+        {
+            err = CHIP_NO_ERROR;
+        }
+
+        // Events numbered at or above the counter would be reported twice under the same number; this happens when the event
+        // log outlived the storage of the event number counter.
+        if (err == CHIP_NO_ERROR && ctx.mEventCount != 0 && ctx.mLastEventNumber >= mLastEventNumber)
+        {
+            err = CHIP_ERROR_INCORRECT_STATE;
+        }
+
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(EventLogging, "Dropping persisted events with priority %u: %" CHIP_ERROR_FORMAT,
+                         static_cast<unsigned>(buffer->GetPriority()), err.Format());
+            buffer->Clear();
+            continue;
+        }
+
+        buffer->SetLastEventNumber(ctx.mLastEventNumber);
+        buffer->SyncPersistedState();
+        eventCount += ctx.mEventCount;
+    }
+
+    if (eventCount != 0)
+    {
+        ChipLogProgress(EventLogging, "Resumed %u persisted events", static_cast<unsigned>(eventCount));
+    }
+}
+
+void EventManagement::SyncPersistedState()
+{
+    for (auto * buffer = mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer())
+    {
+        buffer->SyncPersistedState();
+    }
+}
+
 CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer)
 {
     CircularTLVWriter writer;
     CircularTLVReader reader;
     CHIP_ERROR err                   = CHIP_NO_ERROR;
+    EventNumber eventNumber          = 0;
     CircularEventBuffer * nextBuffer = apEventBuffer->GetNextCircularEventBuffer();
     if (nextBuffer == nullptr)
     {
@@ -159,12 +251,18 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     err = reader.Next();
     SuccessOrExit(err);
 
+    err = PeekEventNumber(reader, eventNumber);
+    SuccessOrExit(err);
+
     err = writer.CopyElement(reader);
     SuccessOrExit(err);
 
     err = writer.Finalize();
     SuccessOrExit(err);
 
+    // The head event of the current buffer is newer than everything already stored in the next buffer.
+    nextBuffer->SetLastEventNumber(eventNumber);
+
     ChipLogDetail(EventLogging, "Copy Event to next buffer with priority %u", static_cast<unsigned>(nextBuffer->GetPriority()));
 exit:
     if (err != CHIP_NO_ERROR)
@@ -390,14 +488,12 @@ CHIP_ERROR EventManagement::CopyAndAdjustDeltaTime(const TLVReader & aReader, si
         // Does not go on the wire.
         return CHIP_NO_ERROR;
     }
-    if ((aReader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kSystemTimestamp)) && !(ctx->mpContext->mFirst) &&
-        (ctx->mpContext->mCurrentTime.mType == ctx->mpContext->mPreviousTime.mType))
+    if ((aReader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kSystemTimestamp)) && UseDeltaTimestamp(*ctx->mpContext))
     {
         return ctx->mpWriter->Put(TLV::ContextTag(EventDataIB::Tag::kDeltaSystemTimestamp),
                                   ctx->mpContext->mCurrentTime.mValue - ctx->mpContext->mPreviousTime.mValue);
     }
-    if ((aReader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kEpochTimestamp)) && !(ctx->mpContext->mFirst) &&
-        (ctx->mpContext->mCurrentTime.mType == ctx->mpContext->mPreviousTime.mType))
+    if ((aReader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kEpochTimestamp)) && UseDeltaTimestamp(*ctx->mpContext))
     {
         return ctx->mpWriter->Put(TLV::ContextTag(EventDataIB::Tag::kDeltaEpochTimestamp),
                                   ctx->mpContext->mCurrentTime.mValue - ctx->mpContext->mPreviousTime.mValue);
@@ -478,6 +574,7 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     err = ConstructEvent(&ctxt, apDelegate, &opts);
     SuccessOrExit(err);
 
+    mpEventBuffer->SetLastEventNumber(ctxt.mCurrentEventNumber);
     mBytesWritten += writer.GetLengthWritten();
 
 exit:
@@ -503,10 +600,14 @@ exit:
         err = mpEventReporter->NewEventGenerated(opts.mPath, mBytesWritten);
     }
 
+    // Making space may have evicted or moved events even if this one could not be logged.
+    SyncPersistedState();
+
     return err;
 }
 
-CHIP_ERROR EventManagement::CopyEvent(const TLVReader & aReader, TLVWriter & aWriter, EventLoadOutContext * apContext)
+CHIP_ERROR EventManagement::CopyEvent(const TLVReader & aReader, TLVWriter & aWriter, EventLoadOutContext * apContext,
+                                      const EventEnvelopeContext & aEvent)
 {
     TLVReader reader;
     TLVType containerType;
@@ -515,6 +616,15 @@ CHIP_ERROR EventManagement::CopyEvent(const TLVReader & aReader, TLVWriter & aWr
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     reader.Init(aReader);
+
+    // Without a fabric index to strip or a timestamp to turn into a delta, the stored encoding is exactly what goes on the wire.
+    if (!aEvent.mFabricIndex.HasValue() && !UseDeltaTimestamp(*apContext))
+    {
+        ReturnErrorOnFailure(aWriter.CopyElement(reader));
+        ReturnErrorOnFailure(aWriter.Finalize());
+        return CHIP_NO_ERROR;
+    }
+
     ReturnErrorOnFailure(reader.EnterContainer(containerType));
     ReturnErrorOnFailure(aWriter.StartContainer(AnonymousTag(), kTLVType_Structure, containerType));
 
@@ -629,13 +739,22 @@ CHIP_ERROR EventManagement::CopyEventsSince(const TLVReader & aReader, size_t aD
 {
     EventLoadOutContext * const loadOutContext = static_cast<EventLoadOutContext *>(apContext);
     EventEnvelopeContext event;
+    EventNumber eventNumber;
+
+    // Events which were already delivered are skipped without decoding their envelope.
+    if (PeekEventNumber(aReader, eventNumber) == CHIP_NO_ERROR && eventNumber < loadOutContext->mStartingEventNumber)
+    {
+        loadOutContext->mCurrentEventNumber = eventNumber;
+        return CHIP_NO_ERROR;
+    }
+
     CHIP_ERROR err = EventIterator(aReader, aDepth, loadOutContext, &event);
     if (err == CHIP_EVENT_ID_FOUND)
     {
         // checkpoint the writer
         TLV::TLVWriter checkpoint = loadOutContext->mWriter;
 
-        err = CopyEvent(aReader, loadOutContext->mWriter, loadOutContext);
+        err = CopyEvent(aReader, loadOutContext->mWriter, loadOutContext, event);
 
         // CHIP_NO_ERROR and CHIP_END_OF_TLV signify a
         // successful copy.  In all other cases, roll back the
@@ -662,13 +781,28 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLi
     CHIP_ERROR err     = CHIP_NO_ERROR;
     const bool recurse = false;
     TLVReader reader;
+    CircularEventReader circularReader;
     CircularEventBufferWrapper bufWrapper;
     EventLoadOutContext context(aWriter, PriorityLevel::Invalid, aEventMin);
+    CircularEventBuffer * buffer = GetPriorityBuffer(PriorityLevel::Critical);
 
     context.mSubjectDescriptor     = aSubjectDescriptor;
     context.mpInterestedEventPaths = apEventPathList;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
-    SuccessOrExit(err);
+
+    // Event numbers grow along the read order, from the critical buffer down to the debug buffer, so whole buffers holding
+    // only events older than aEventMin are skipped without being read.
+    while (buffer != mpEventBuffer && (buffer->DataLength() == 0 || buffer->GetLastEventNumber() < aEventMin))
+    {
+        if (buffer->DataLength() != 0)
+        {
+            context.mCurrentEventNumber = buffer->GetLastEventNumber();
+        }
+        buffer = buffer->GetPreviousCircularEventBuffer();
+    }
+
+    bufWrapper.mpCurrent = buffer;
+    circularReader.Init(&bufWrapper);
+    reader.Init(circularReader);
 
     err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
     if (err == CHIP_END_OF_TLV)
@@ -676,7 +810,6 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLi
         err = CHIP_NO_ERROR;
     }
 
-exit:
     if (err == CHIP_ERROR_BUFFER_TOO_SMALL || err == CHIP_ERROR_NO_MEMORY)
     {
         // We failed to fetch the current event because the buffer is too small, we will start from this one the next time.
@@ -817,6 +950,28 @@ CHIP_ERROR EventManagement::FetchEventParameters(const TLVReader & aReader, size
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR EventManagement::PeekEventNumber(const TLVReader & aReader, EventNumber & aEventNumber)
+{
+    TLVReader reader;
+    TLVType containerType;
+    TLVType containerType1;
+
+    reader.Init(aReader);
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    ReturnErrorOnFailure(reader.Next(TLV::ContextTag(EventReportIB::Tag::kEventData)));
+    ReturnErrorOnFailure(reader.EnterContainer(containerType1));
+
+    // ConstructEvent puts the event number right after the path, so this only steps over the path container.
+    while (true)
+    {
+        ReturnErrorOnFailure(reader.Next());
+        if (reader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kEventNumber))
+        {
+            return reader.Get(aEventNumber);
+        }
+    }
+}
+
 CHIP_ERROR EventManagement::EvictEvent(TLVCircularBuffer & apBuffer, void * apAppData, TLVReader & aReader)
 {
     // pull out the delta time, pull out the priority
@@ -872,12 +1027,41 @@ CHIP_ERROR EventManagement::GenerateEvent(EventLoggingDelegate * eventPayloadWri
 }
 
 void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, CircularEventBuffer * apPrev,
-                               CircularEventBuffer * apNext, PriorityLevel aPriorityLevel)
+                               CircularEventBuffer * apNext, PriorityLevel aPriorityLevel,
+                               PersistedEventBufferState * apPersistedState)
 {
     TLVCircularBuffer::Init(apBuffer, aBufferLength);
-    mpPrev    = apPrev;
-    mpNext    = apNext;
-    mPriority = aPriorityLevel;
+    mpPrev           = apPrev;
+    mpNext           = apNext;
+    mPriority        = aPriorityLevel;
+    mLastEventNumber = 0;
+    mpPersistedState = apPersistedState;
+
+    if (mpPersistedState != nullptr && mpPersistedState->mMagic == PersistedEventBufferState::kMagic &&
+        mpPersistedState->mBufferSize == aBufferLength &&
+        Resume(mpPersistedState->mHeadOffset, mpPersistedState->mDataLength) == CHIP_NO_ERROR)
+    {
+        mLastEventNumber = mpPersistedState->mLastEventNumber;
+    }
+    SyncPersistedState();
+}
+
+void CircularEventBuffer::Clear()
+{
+    TLVCircularBuffer::Init(GetQueue(), GetTotalDataLength());
+    mLastEventNumber = 0;
+    SyncPersistedState();
+}
+
+void CircularEventBuffer::SyncPersistedState()
+{
+    VerifyOrReturn(mpPersistedState != nullptr);
+
+    mpPersistedState->mMagic           = PersistedEventBufferState::kMagic;
+    mpPersistedState->mBufferSize      = GetTotalDataLength();
+    mpPersistedState->mHeadOffset      = static_cast<uint32_t>(QueueHead() - GetQueue());
+    mpPersistedState->mDataLength      = DataLength();
+    mpPersistedState->mLastEventNumber = mLastEventNumber;
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
@@ -78,6 +78,23 @@ inline constexpr size_t kMaxEventSizeReserve            = 512;
 constexpr uint16_t kRequiredEventField =
     (1 << to_underlying(EventDataIB::Tag::kPriority)) | (1 << to_underlying(EventDataIB::Tag::kPath));
 
+/**
+ * @brief
+ *   Bookkeeping of a CircularEventBuffer kept next to its storage, so that a buffer living in persistent storage (e.g. a memory
+ *   mapped file) can be resumed after a restart. The layout is fixed; it is shared by the process writing and the process
+ *   resuming the event log.
+ */
+struct PersistedEventBufferState
+{
+    static constexpr uint32_t kMagic = 0x45564C31; // "EVL1"
+
+    uint32_t mMagic              = 0;
+    uint32_t mBufferSize         = 0;
+    uint32_t mHeadOffset         = 0;
+    uint32_t mDataLength         = 0;
+    EventNumber mLastEventNumber = 0;
+};
+
 /**
  * @brief
  *   Internal event buffer, built around the TLV::TLVCircularBuffer
@@ -107,9 +124,24 @@ public:
      *                           events of greater priority.
      *
      * @param[in] aPriorityLevel CircularEventBuffer priority level
+     *
+     * @param[in] apPersistedState Optional state persisted along with \c apBuffer. When it describes events left in
+     *                           \c apBuffer by a previous run, the buffer resumes with these events.
      */
     void Init(uint8_t * apBuffer, uint32_t aBufferLength, CircularEventBuffer * apPrev, CircularEventBuffer * apNext,
-              PriorityLevel aPriorityLevel);
+              PriorityLevel aPriorityLevel, PersistedEventBufferState * apPersistedState = nullptr);
+
+    /**
+     * @brief
+     *   Drop all events held by the buffer.
+     */
+    void Clear();
+
+    /**
+     * @brief
+     *   Record the current bounds of the buffer in its persisted state, if any.
+     */
+    void SyncPersistedState();
 
     /**
      * @brief
@@ -130,6 +162,14 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   Event number of the newest event appended to this buffer. Only meaningful while the buffer holds data; events are
+     *   always appended at the tail, so this is the highest event number stored in the buffer.
+     */
+    EventNumber GetLastEventNumber() const { return mLastEventNumber; }
+    void SetLastEventNumber(EventNumber aEventNumber) { mLastEventNumber = aEventNumber; }
+
     ~CircularEventBuffer() override = default;
 
 private:
@@ -141,6 +181,10 @@ private:
 
     size_t mRequiredSpaceForEvicted = 0; ///< Required space for previous buffer to evict event to new buffer
 
+    EventNumber mLastEventNumber = 0; ///< Event number of the newest event in this buffer
+
+    PersistedEventBufferState * mpPersistedState = nullptr; ///< Optional state persisted along with the buffer storage
+
     CHIP_ERROR OnInit(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
 };
 
@@ -189,6 +233,9 @@ struct LogStorageResources
     uint32_t mBufferSize = 0; ///< The size, in bytes, of the `mBuffer`.
     PriorityLevel mPriority =
         PriorityLevel::Invalid; // Log priority level associated with the resources provided in this structure.
+    PersistedEventBufferState * mpPersistedState =
+        nullptr; // Optional. When the buffer lives in persistent storage, its bookkeeping is kept here so the events
+                 // survive a restart. Must live in the same storage as `mpBuffer`.
 };
 
 /**
@@ -218,7 +265,8 @@ public:
      *
      * @param[in] apCircularEventBuffer  An array of CircularEventBuffer for each priority level.
      *
-     * @param[in] apLogStorageResources  An array of LogStorageResources for each priority level.
+     * @param[in] apLogStorageResources  An array of LogStorageResources for each priority level. Buffers with a persisted
+     *                                   state resume the events left in them by a previous run.
      *
      * @param[in] apEventNumberCounter   A counter to use for event numbers.
      *
@@ -420,6 +468,19 @@ private:
     };
 
     void VendEventNumber();
+
+    /**
+     * @brief Validate the events resumed from persisted buffers, dropping the buffers which cannot be read back or which hold
+     * event numbers the event number counter would vend again.
+     */
+    void CheckResumedEvents();
+    static CHIP_ERROR CheckResumedEvent(const TLV::TLVReader & aReader, size_t aDepth, void * apContext);
+
+    /**
+     * @brief Record the current bounds of every buffer in its persisted state.
+     */
+    void SyncPersistedState();
+
     CHIP_ERROR CalculateEventSize(EventLoggingDelegate * apDelegate, const EventOptions * apOptions, uint32_t & requiredSize);
     /**
      * @brief Helper function for writing event header and data according to event
@@ -508,6 +569,11 @@ private:
      */
     static CHIP_ERROR FetchEventParameters(const TLV::TLVReader & aReader, size_t aDepth, void * apContext);
 
+    /**
+     * @brief Read only the event number of the event the reader is positioned on, without decoding the rest of the event.
+     */
+    static CHIP_ERROR PeekEventNumber(const TLV::TLVReader & aReader, EventNumber & aEventNumber);
+
     /**
      * @brief Internal iterator function used to scan and filter though event logs
      * First event gets a timestamp, subsequent ones get a delta T
@@ -540,8 +606,11 @@ private:
 
     /**
      * @brief copy event from circular buffer to target buffer for report
+     *
+     * Events which carry no internal fields and need no delta timestamp are copied verbatim, as stored in the log.
      */
-    static CHIP_ERROR CopyEvent(const TLV::TLVReader & aReader, TLV::TLVWriter & aWriter, EventLoadOutContext * apContext);
+    static CHIP_ERROR CopyEvent(const TLV::TLVReader & aReader, TLV::TLVWriter & aWriter, EventLoadOutContext * apContext,
+                                const EventEnvelopeContext & aEvent);
 
     /**
      * @brief
@@ -217,13 +217,17 @@ void InteractionModelEngine::Shutdown()
         readClient->mpImEngine = nullptr;
         auto * tmpClient       = readClient->GetNextClient();
         readClient->SetNextClient(nullptr);
-        readClient = tmpClient;
+        readClient->mpPrev         = nullptr;
+        readClient->mpNextInBucket = nullptr;
+        readClient->mpPrevInBucket = nullptr;
+        readClient                 = tmpClient;
     }
 
     //
     // After that, we just null out our tracker.
     //
     mpActiveReadClientList = nullptr;
+    ResetReadClientIndex();
 #endif // CHIP_CONFIG_ENABLE_READ_CLIENT
 
     for (auto & writeHandler : mWriteHandlers)
@@ -351,20 +355,18 @@ uint32_t InteractionModelEngine::GetNumActiveWriteHandlers() const
 CHIP_ERROR InteractionModelEngine::ShutdownSubscription(const ScopedNodeId & aPeerNodeId, SubscriptionId aSubscriptionId)
 {
     assertChipStackLockedByCurrentThread();
-    for (auto * readClient = mpActiveReadClientList; readClient != nullptr;)
-    {
-        // Grab the next client now, because we might be about to delete readClient.
-        auto * nextClient = readClient->GetNextClient();
-        if (readClient->IsSubscriptionType() && readClient->IsMatchingSubscriptionId(aSubscriptionId) &&
-            readClient->GetFabricIndex() == aPeerNodeId.GetFabricIndex() && readClient->GetPeerNodeId() == aPeerNodeId.GetNodeId())
+    CHIP_ERROR err = CHIP_ERROR_KEY_NOT_FOUND;
+    ForEachReadClientOfPeer(aPeerNodeId, [&](ReadClient * readClient) {
+        if (!readClient->IsSubscriptionType() || !readClient->IsMatchingSubscriptionId(aSubscriptionId))
         {
-            readClient->Close(CHIP_NO_ERROR);
-            return CHIP_NO_ERROR;
+            return Loop::Continue;
         }
-        readClient = nextClient;
-    }
+        readClient->Close(CHIP_NO_ERROR);
+        err = CHIP_NO_ERROR;
+        return Loop::Break;
+    });
 
-    return CHIP_ERROR_KEY_NOT_FOUND;
+    return err;
 }
 
 void InteractionModelEngine::ShutdownSubscriptions(FabricIndex aFabricIndex, NodeId aPeerNodeId)
@@ -917,32 +919,16 @@ Status InteractionModelEngine::OnUnsolicitedReportData(Messaging::ExchangeContex
     VerifyOrReturnError(report.ExitContainer() == CHIP_NO_ERROR, Status::InvalidAction);
 
     ReadClient * foundSubscription = nullptr;
-    for (auto * readClient = mpActiveReadClientList; readClient != nullptr; readClient = readClient->GetNextClient())
-    {
-        auto peer = apExchangeContext->GetSessionHandle()->GetPeer();
-        if (readClient->GetFabricIndex() != peer.GetFabricIndex() || readClient->GetPeerNodeId() != peer.GetNodeId())
-        {
-            continue;
-        }
-
+    ForEachReadClientOfPeer(apExchangeContext->GetSessionHandle()->GetPeer(), [&](ReadClient * readClient) {
         // Notify Subscriptions about incoming communication from node
         readClient->OnUnsolicitedMessageFromPublisher();
 
-        if (!readClient->IsSubscriptionActive())
-        {
-            continue;
-        }
-
-        if (!readClient->IsMatchingSubscriptionId(subscriptionId))
-        {
-            continue;
-        }
-
-        if (!foundSubscription)
+        if (!foundSubscription && readClient->IsSubscriptionActive() && readClient->IsMatchingSubscriptionId(subscriptionId))
         {
             foundSubscription = readClient;
         }
-    }
+        return Loop::Continue;
+    });
 
     if (foundSubscription)
     {
@@ -1034,39 +1020,116 @@ void InteractionModelEngine::OnResponseTimeout(Messaging::ExchangeContext * ec)
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
 void InteractionModelEngine::OnActiveModeNotification(ScopedNodeId aPeer)
 {
-    for (ReadClient * pListItem = mpActiveReadClientList; pListItem != nullptr;)
-    {
-        auto pNextItem = pListItem->GetNextClient();
-        // It is possible that pListItem is destroyed by the app in OnActiveModeNotification.
-        // Get the next item before invoking `OnActiveModeNotification`.
-        if (ScopedNodeId(pListItem->GetPeerNodeId(), pListItem->GetFabricIndex()) == aPeer)
-        {
-            pListItem->OnActiveModeNotification();
-        }
-        pListItem = pNextItem;
-    }
+    // It is possible that the read client is destroyed by the app in OnActiveModeNotification, which
+    // ForEachReadClientOfPeer allows.
+    ForEachReadClientOfPeer(aPeer, [](ReadClient * readClient) {
+        readClient->OnActiveModeNotification();
+        return Loop::Continue;
+    });
 }
 
 void InteractionModelEngine::OnPeerTypeChange(ScopedNodeId aPeer, ReadClient::PeerType aType)
 {
-    // TODO: Follow up to use a iterator function to avoid copy/paste here.
-    for (ReadClient * pListItem = mpActiveReadClientList; pListItem != nullptr;)
-    {
-        // It is possible that pListItem is destroyed by the app in OnPeerTypeChange.
-        // Get the next item before invoking `OnPeerTypeChange`.
-        auto pNextItem = pListItem->GetNextClient();
-        if (ScopedNodeId(pListItem->GetPeerNodeId(), pListItem->GetFabricIndex()) == aPeer)
-        {
-            pListItem->OnPeerTypeChange(aType);
-        }
-        pListItem = pNextItem;
-    }
+    // It is possible that the read client is destroyed by the app in OnPeerTypeChange, which
+    // ForEachReadClientOfPeer allows.
+    ForEachReadClientOfPeer(aPeer, [aType](ReadClient * readClient) {
+        readClient->OnPeerTypeChange(aType);
+        return Loop::Continue;
+    });
 }
 
 void InteractionModelEngine::AddReadClient(ReadClient * apReadClient)
 {
     apReadClient->SetNextClient(mpActiveReadClientList);
+    apReadClient->mpPrev = nullptr;
+    if (mpActiveReadClientList != nullptr)
+    {
+        mpActiveReadClientList->mpPrev = apReadClient;
+    }
     mpActiveReadClientList = apReadClient;
+    mNumActiveReadClients++;
+
+    // Growing the index rehashes the new read client along with the others.
+    if (mNumActiveReadClients <= mReadClientBucketCount || !GrowReadClientIndex())
+    {
+        IndexReadClient(apReadClient);
+    }
+}
+
+size_t InteractionModelEngine::GetReadClientBucket(const ScopedNodeId & aPeer) const
+{
+    // Fibonacci hashing: the multiplication spreads sequential node ids, which are common, across the buckets.
+    uint64_t hash = (aPeer.GetNodeId() ^ (static_cast<uint64_t>(aPeer.GetFabricIndex()) << 56)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(hash >> 32) & (mReadClientBucketCount - 1);
+}
+
+void InteractionModelEngine::IndexReadClient(ReadClient * apReadClient)
+{
+    VerifyOrReturn(mReadClientBucketCount > 0);
+
+    ReadClient *& bucket         = mReadClientBuckets[GetReadClientBucket(apReadClient->mPeer)];
+    apReadClient->mpNextInBucket = bucket;
+    apReadClient->mpPrevInBucket = nullptr;
+    if (bucket != nullptr)
+    {
+        bucket->mpPrevInBucket = apReadClient;
+    }
+    bucket = apReadClient;
+}
+
+void InteractionModelEngine::UnindexReadClient(ReadClient * apReadClient)
+{
+    VerifyOrReturn(mReadClientBucketCount > 0);
+
+    if (apReadClient->mpPrevInBucket != nullptr)
+    {
+        apReadClient->mpPrevInBucket->mpNextInBucket = apReadClient->mpNextInBucket;
+    }
+    else
+    {
+        ReadClient *& bucket = mReadClientBuckets[GetReadClientBucket(apReadClient->mPeer)];
+        //
+        // Item must be at the head of its bucket. If not, there's a bug somewhere.
+        //
+        VerifyOrDie(bucket == apReadClient);
+        bucket = apReadClient->mpNextInBucket;
+    }
+    if (apReadClient->mpNextInBucket != nullptr)
+    {
+        apReadClient->mpNextInBucket->mpPrevInBucket = apReadClient->mpPrevInBucket;
+    }
+
+    apReadClient->mpNextInBucket = nullptr;
+    apReadClient->mpPrevInBucket = nullptr;
+}
+
+bool InteractionModelEngine::GrowReadClientIndex()
+{
+    static constexpr size_t kMinBucketCount = 8;
+    static_assert((CHIP_CONFIG_IM_MAX_READ_CLIENT_INDEX_BUCKETS & (CHIP_CONFIG_IM_MAX_READ_CLIENT_INDEX_BUCKETS - 1)) == 0,
+                  "CHIP_CONFIG_IM_MAX_READ_CLIENT_INDEX_BUCKETS must be a power of two");
+
+    size_t bucketCount = mReadClientBucketCount > 0 ? mReadClientBucketCount * 2 : kMinBucketCount;
+    VerifyOrReturnValue(bucketCount <= CHIP_CONFIG_IM_MAX_READ_CLIENT_INDEX_BUCKETS, false);
+
+    Platform::ScopedMemoryBuffer<ReadClient *> buckets;
+    // Keep using the current buckets, or the list when there are none, if the memory is not available.
+    VerifyOrReturnValue(buckets.Calloc(bucketCount), false);
+
+    mReadClientBuckets     = std::move(buckets);
+    mReadClientBucketCount = bucketCount;
+    for (auto * readClient = mpActiveReadClientList; readClient != nullptr; readClient = readClient->GetNextClient())
+    {
+        IndexReadClient(readClient);
+    }
+    return true;
+}
+
+void InteractionModelEngine::ResetReadClientIndex()
+{
+    mReadClientBuckets.Free();
+    mReadClientBucketCount = 0;
+    mNumActiveReadClients  = 0;
 }
 #endif // CHIP_CONFIG_ENABLE_READ_CLIENT
 
@@ -1469,61 +1532,43 @@ Protocols::InteractionModel::Status InteractionModelEngine::EnsureResourceForRea
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
 void InteractionModelEngine::RemoveReadClient(ReadClient * apReadClient)
 {
-    ReadClient * pPrevListItem = nullptr;
-    ReadClient * pCurListItem  = mpActiveReadClientList;
-
-    while (pCurListItem != apReadClient)
+    if (apReadClient->mpPrev != nullptr)
     {
-        //
-        // Item must exist in this tracker list. If not, there's a bug somewhere.
-        //
-        VerifyOrDie(pCurListItem != nullptr);
-
-        pPrevListItem = pCurListItem;
-        pCurListItem  = pCurListItem->GetNextClient();
-    }
-
-    if (pPrevListItem)
-    {
-        pPrevListItem->SetNextClient(apReadClient->GetNextClient());
+        apReadClient->mpPrev->SetNextClient(apReadClient->GetNextClient());
     }
     else
     {
+        //
+        // Item must be at the head of the tracker list. If not, there's a bug somewhere.
+        //
+        VerifyOrDie(mpActiveReadClientList == apReadClient);
         mpActiveReadClientList = apReadClient->GetNextClient();
     }
+    if (apReadClient->GetNextClient() != nullptr)
+    {
+        apReadClient->GetNextClient()->mpPrev = apReadClient->mpPrev;
+    }
 
     apReadClient->SetNextClient(nullptr);
+    apReadClient->mpPrev = nullptr;
+    UnindexReadClient(apReadClient);
+    mNumActiveReadClients--;
 }
 
 size_t InteractionModelEngine::GetNumActiveReadClients()
 {
-    ReadClient * pListItem = mpActiveReadClientList;
-    size_t count           = 0;
-
-    while (pListItem)
-    {
-        pListItem = pListItem->GetNextClient();
-        count++;
-    }
-
-    return count;
+    return mNumActiveReadClients;
 }
 
 bool InteractionModelEngine::InActiveReadClientList(ReadClient * apReadClient)
 {
-    ReadClient * pListItem = mpActiveReadClientList;
-
-    while (pListItem)
-    {
-        if (pListItem == apReadClient)
-        {
-            return true;
-        }
-
-        pListItem = pListItem->GetNextClient();
-    }
+    bool found = false;
+    ForEachReadClientOfPeer(apReadClient->mPeer, [&](ReadClient * readClient) {
+        found = (readClient == apReadClient);
+        return found ? Loop::Break : Loop::Continue;
+    });
 
-    return false;
+    return found;
 }
 #endif // CHIP_CONFIG_ENABLE_READ_CLIENT
 
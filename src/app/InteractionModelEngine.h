@@ -61,6 +61,7 @@
 #include <lib/support/DLLUtil.h>
 #include <lib/support/LinkedList.h>
 #include <lib/support/Pool.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
@@ -252,8 +253,9 @@ public:
     void OnPeerTypeChange(ScopedNodeId aPeer, ReadClient::PeerType aType);
 
     /**
-     * Add a read client to the internally tracked list of weak references. This list is used to
-     * correctly dispatch unsolicited reports to the right matching handler by subscription ID.
+     * Add a read client to the internally tracked list of weak references. This list, along with an
+     * index of its read clients by peer, is used to correctly dispatch unsolicited reports to the right
+     * matching handler by subscription ID.
      */
     void AddReadClient(ReadClient * apReadClient);
 
@@ -394,6 +396,9 @@ public:
             readClient->mpImEngine = nullptr;
             auto * tmpClient       = readClient->GetNextClient();
             readClient->SetNextClient(nullptr);
+            readClient->mpPrev         = nullptr;
+            readClient->mpNextInBucket = nullptr;
+            readClient->mpPrevInBucket = nullptr;
             readClient->Close(CHIP_NO_ERROR);
             readClient = tmpClient;
         }
@@ -402,6 +407,7 @@ public:
         // After that, we just null out our tracker.
         //
         mpActiveReadClientList = nullptr;
+        ResetReadClientIndex();
 #endif // CHIP_CONFIG_ENABLE_READ_CLIENT
 
         mReadHandlers.ReleaseAll();
@@ -614,6 +620,47 @@ private:
     void ShutdownMatchingSubscriptions(const Optional<FabricIndex> & aFabricIndex = NullOptional,
                                        const Optional<NodeId> & aPeerNodeId       = NullOptional);
 
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+    friend class ReadClient;
+
+    /**
+     * Add or remove a read client, which must be in mpActiveReadClientList, to or from the index by peer.
+     * ReadClient uses these when its peer changes.
+     */
+    void IndexReadClient(ReadClient * apReadClient);
+    void UnindexReadClient(ReadClient * apReadClient);
+
+    /**
+     * Double the number of buckets of the read client index, and rehash the active read clients into them.
+     * Returns false, leaving the index untouched, if it already has the maximum number of buckets or memory
+     * is not available.
+     */
+    bool GrowReadClientIndex();
+    void ResetReadClientIndex();
+    size_t GetReadClientBucket(const ScopedNodeId & aPeer) const;
+
+    /**
+     * Invoke aFunction on every active read client for the given peer, until it returns Loop::Break.
+     * aFunction may destroy the read client it is given, but no other.
+     */
+    template <typename Function>
+    void ForEachReadClientOfPeer(const ScopedNodeId & aPeer, Function && aFunction)
+    {
+        const bool useIndex     = mReadClientBucketCount > 0;
+        ReadClient * readClient = useIndex ? mReadClientBuckets[GetReadClientBucket(aPeer)] : mpActiveReadClientList;
+        while (readClient != nullptr)
+        {
+            // Grab the next client now, because aFunction might delete readClient.
+            ReadClient * nextClient = useIndex ? readClient->mpNextInBucket : readClient->GetNextClient();
+            if (readClient->IsMatchingPeer(aPeer) && aFunction(readClient) == Loop::Break)
+            {
+                return;
+            }
+            readClient = nextClient;
+        }
+    }
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
+
     Status CheckCommandExistence(const ConcreteCommandPath & aCommandPath);
     Status CheckCommandAccess(const DataModel::InvokeRequest & aRequest);
     Status CheckCommandFlags(const DataModel::InvokeRequest & aRequest);
@@ -672,6 +719,13 @@ private:
 
 #if CHIP_CONFIG_ENABLE_READ_CLIENT
     ReadClient * mpActiveReadClientList = nullptr;
+
+    // Hash index of the active read clients by peer, doubly chained through ReadClient::mpNextInBucket and
+    // mpPrevInBucket. The bucket count is a power of two which grows along with the number of read clients;
+    // while no buckets could be allocated, lookups fall back to walking mpActiveReadClientList.
+    Platform::ScopedMemoryBuffer<ReadClient *> mReadClientBuckets;
+    size_t mReadClientBucketCount = 0;
+    size_t mNumActiveReadClients  = 0;
 #endif
 
     ReadHandler::ApplicationCallback * mpReadHandlerApplicationCallback = nullptr;
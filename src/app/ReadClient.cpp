@@ -76,6 +76,23 @@ void ReadClient::ClearActiveSubscriptionState()
     MoveToState(ClientState::Idle);
 }
 
+void ReadClient::SetPeer(const ScopedNodeId & aPeer)
+{
+    VerifyOrReturn(mPeer != aPeer);
+
+    // Only subscriptions are tracked by the engine, and only while it is still around.
+    bool isTracked = IsSubscriptionType() && mpImEngine != nullptr;
+    if (isTracked)
+    {
+        mpImEngine->UnindexReadClient(this);
+    }
+    mPeer = aPeer;
+    if (isTracked)
+    {
+        mpImEngine->IndexReadClient(this);
+    }
+}
+
 void ReadClient::StopResubscription()
 {
     CancelLivenessCheckTimer();
@@ -365,7 +382,7 @@ CHIP_ERROR ReadClient::SendReadRequest(ReadPrepareParams & aReadPrepareParams)
     ReturnErrorOnFailure(mExchange->SendMessage(Protocols::InteractionModel::MsgType::ReadRequest, std::move(msgBuf),
                                                 Messaging::SendFlags(Messaging::SendMessageFlags::kExpectResponse)));
 
-    mPeer = aReadPrepareParams.mSessionHolder->AsSecureSession()->GetPeer();
+    SetPeer(aReadPrepareParams.mSessionHolder->AsSecureSession()->GetPeer());
     MoveToState(ClientState::AwaitingInitialReport);
 
     return CHIP_NO_ERROR;
@@ -1120,7 +1137,7 @@ CHIP_ERROR ReadClient::SendAutoResubscribeRequest(ReadPrepareParams && aReadPrep
 
 CHIP_ERROR ReadClient::SendAutoResubscribeRequest(const ScopedNodeId & aPublisherId, ReadPrepareParams && aReadPrepareParams)
 {
-    mPeer              = aPublisherId;
+    SetPeer(aPublisherId);
     mReadPrepareParams = std::move(aReadPrepareParams);
     CHIP_ERROR err     = EstablishSessionToPeer();
     if (err != CHIP_NO_ERROR)
@@ -1257,7 +1274,7 @@ CHIP_ERROR ReadClient::SendSubscribeRequestImpl(const ReadPrepareParams & aReadP
     ReturnErrorOnFailure(mExchange->SendMessage(Protocols::InteractionModel::MsgType::SubscribeRequest, std::move(msgBuf),
                                                 Messaging::SendFlags(Messaging::SendMessageFlags::kExpectResponse)));
 
-    mPeer = aReadPrepareParams.mSessionHolder->AsSecureSession()->GetPeer();
+    SetPeer(aReadPrepareParams.mSessionHolder->AsSecureSession()->GetPeer());
     MoveToState(ClientState::AwaitingInitialReport);
 
     return CHIP_NO_ERROR;
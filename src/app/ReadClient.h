@@ -529,6 +529,11 @@ private:
         return aSubscriptionId == mSubscriptionId && mInteractionType == InteractionType::Subscribe;
     }
 
+    bool IsMatchingPeer(const ScopedNodeId & aPeer) const { return mPeer == aPeer; }
+
+    // Updates mPeer, keeping the engine's subscription index up to date.
+    void SetPeer(const ScopedNodeId & aPeer);
+
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PayloadHeader & aPayloadHeader,
                                  System::PacketBufferHandle && aPayload) override;
     void OnResponseTimeout(Messaging::ExchangeContext * apExchangeContext) override;
@@ -652,7 +657,11 @@ private:
     chip::Callback::Callback<OnDeviceConnected> mOnConnectedCallback;
     chip::Callback::Callback<OperationalSessionSetup::OnSetupFailure> mOnConnectionFailureCallback;
 
+    // Links of the active read client list of the engine, and of the bucket of its index this read client is in.
     ReadClient * mpNext                 = nullptr;
+    ReadClient * mpPrev                 = nullptr;
+    ReadClient * mpNextInBucket         = nullptr;
+    ReadClient * mpPrevInBucket         = nullptr;
     InteractionModelEngine * mpImEngine = nullptr;
 
     //
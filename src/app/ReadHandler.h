@@ -589,6 +589,9 @@ private:
 
     uint32_t mLastWrittenEventsBytes = 0;
 
+    // The reporting engine run that last considered this handler, so that each run serves a handler at most once.
+    uint32_t mLastReportRun = 0;
+
     // The detailed encoding state for a single attribute, used by list chunking feature.
     // The size of AttributeEncoderState is 2 bytes for now.
     AttributeEncodeState mAttributeEncoderState;
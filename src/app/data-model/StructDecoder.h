@@ -0,0 +1,136 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/data-model/Decode.h>
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CodeUtils.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <tuple>
+#include <utility>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+namespace detail {
+
+// Tags of the fields of a struct, which every decoder of that struct shares.
+template <auto... Tags>
+struct StructFieldTags
+{
+    static constexpr size_t kCount   = sizeof...(Tags);
+    static constexpr uint8_t kTags[] = { static_cast<uint8_t>(Tags)... };
+};
+
+// Decodes the value of the field at aIndex in aValues.
+template <typename ValueTuple, size_t... I>
+CHIP_ERROR DecodeStructFieldAt(TLV::TLVReader & reader, ValueTuple & aValues, size_t aIndex, std::index_sequence<I...>)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    // Expands to a dispatch on the field index, which the compiler can turn into a jump table.
+    (void) ((aIndex == I && ((err = Decode(reader, std::get<I>(aValues))), true)) || ...);
+    return err;
+}
+
+#if CHIP_CONFIG_DATA_MODEL_INDEXED_STRUCT_DECODE
+// Decodes the field matching aTagNum, if any, into aValues. aNextIndex is the index of the field expected next.
+template <typename FieldTags, typename ValueTuple, size_t... I>
+CHIP_ERROR DecodeStructField(TLV::TLVReader & reader, ValueTuple & aValues, uint32_t aTagNum, size_t & aNextIndex,
+                             std::index_sequence<I...> aIndices)
+{
+    constexpr size_t kFieldCount = FieldTags::kCount;
+    constexpr auto & tags        = FieldTags::kTags;
+
+    // Encoders write fields in tag order, so the field following the last decoded one is checked first.
+    size_t index = aNextIndex;
+    if (index >= kFieldCount || tags[index] != aTagNum)
+    {
+        for (index = 0; index < kFieldCount && tags[index] != aTagNum; index++)
+        {
+        }
+        VerifyOrReturnError(index < kFieldCount, CHIP_NO_ERROR);
+    }
+    aNextIndex = index + 1;
+    return DecodeStructFieldAt(reader, aValues, index, aIndices);
+}
+#else
+// Decodes the field matching aTagNum, if any, into aValues, comparing the tag with each field in turn.
+template <typename FieldTags, typename ValueTuple, size_t... I>
+CHIP_ERROR DecodeStructField(TLV::TLVReader & reader, ValueTuple & aValues, uint32_t aTagNum, size_t & /* aNextIndex */,
+                             std::index_sequence<I...>)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    (void) ((aTagNum == FieldTags::kTags[I] && ((err = Decode(reader, std::get<I>(aValues))), true)) || ...);
+    return err;
+}
+#endif // CHIP_CONFIG_DATA_MODEL_INDEXED_STRUCT_DECODE
+
+} // namespace detail
+
+/*
+ * @brief
+ *
+ * Decodes the structure the reader is positioned on into the given fields, in a single pass over its elements.
+ *
+ * The tags of the fields, context tag numbers which are typically values of the Fields enum of a cluster object,
+ * are passed as template arguments, so that their table is built at compile time. The values follow in the same
+ * order. Passing the fields in the order encoders write them, which is ascending tag order, makes lookups cheapest:
+ *
+ *     return DataModel::DecodeStruct<Fields::kLabel, Fields::kValue>(reader, label, value);
+ *
+ * Elements which are not context tagged, or whose tag matches no field, are skipped. Fields missing from the
+ * structure are left untouched.
+ */
+template <auto... Tags, typename... Values>
+CHIP_ERROR DecodeStruct(TLV::TLVReader & reader, Values &... aValues)
+{
+    static_assert(sizeof...(Tags) == sizeof...(Values), "Each field needs a tag and a value");
+
+    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
+
+    TLV::TLVType outer;
+    ReturnErrorOnFailure(reader.EnterContainer(outer));
+
+    CHIP_ERROR err;
+    [[maybe_unused]] auto values      = std::tie(aValues...);
+    [[maybe_unused]] size_t nextIndex = 0;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if constexpr (sizeof...(Values) > 0)
+        {
+            const TLV::Tag tag = reader.GetTag();
+            if (TLV::IsContextTag(tag))
+            {
+                ReturnErrorOnFailure(detail::DecodeStructField<detail::StructFieldTags<Tags...>>(
+                    reader, values, TLV::TagNumFromTag(tag), nextIndex, std::index_sequence_for<Values...>()));
+            }
+        }
+    }
+    VerifyOrReturnError(err == CHIP_ERROR_END_OF_TLV, err);
+
+    return reader.ExitContainer(outer);
+}
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
@@ -225,8 +225,8 @@ CHIP_ERROR Engine::Init(EventManagement * apEventManagement)
 {
     VerifyOrReturnError(apEventManagement != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     mNumReportsInFlight = 0;
-    mCurReadHandlerIdx  = 0;
     mpEventManagement   = apEventManagement;
+    mRunQueue.Clear();
 
     return CHIP_NO_ERROR;
 }
@@ -237,7 +237,8 @@ void Engine::Shutdown()
     ScheduleUrgentEventDeliverySync();
 
     mNumReportsInFlight = 0;
-    mCurReadHandlerIdx  = 0;
+    mRunQueue.Clear();
+    mSharedAttributeReport.Clear();
     mGlobalDirtySet.ReleaseAll();
 }
 
@@ -674,6 +675,10 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     bool hasMoreChunks                   = false;
     bool needCloseReadHandler            = false;
     size_t reportBufferMaxSize           = 0;
+    bool hasEncodedAttributes            = false;
+    bool usesSharedAttributes            = false;
+    bool isNewReport                     = false;
+    bool isPriming                       = false;
 
     // Reserved size for the MoreChunks boolean flag, which takes up 1 byte for the control tag and 1 byte for the context tag.
     const uint32_t kReservedSizeForMoreChunksFlag = 1 + 1;
@@ -691,6 +696,10 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     VerifyOrExit(apReadHandler != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(apReadHandler->GetSession() != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
+    // Captured before the report updates them, for sharing its attribute data with identical subscriptions.
+    isNewReport = !apReadHandler->IsReporting();
+    isPriming   = apReadHandler->IsPriming();
+
     reportBufferMaxSize = apReadHandler->GetReportBufferMaxSize();
 
     bufHandle = System::PacketBufferHandle::New(reportBufferMaxSize);
@@ -735,17 +744,46 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     {
         bool hasMoreChunksForAttributes = false;
         bool hasMoreChunksForEvents     = false;
-        bool hasEncodedAttributes       = false;
         bool hasEncodedEvents           = false;
 
-        err = BuildSingleReportDataAttributeReportIBs(reportDataBuilder, apReadHandler, &hasMoreChunksForAttributes,
-                                                      &hasEncodedAttributes);
-        SuccessOrExit(err);
+        if (CanUseSharedAttributeReport(apReadHandler))
+        {
+            TLV::TLVWriter checkpoint;
+            reportDataBuilder.Checkpoint(checkpoint);
+            if (CopySharedAttributeReport(reportDataBuilder) == CHIP_NO_ERROR)
+            {
+                usesSharedAttributes = true;
+                hasEncodedAttributes = true;
+                mSharedAttributeReportCount++;
+            }
+            else
+            {
+                // Does not fit this handler's report, e.g. over a session with a smaller MTU: encode the data instead.
+                reportDataBuilder.Rollback(checkpoint);
+            }
+        }
+
+        if (!usesSharedAttributes)
+        {
+            err = BuildSingleReportDataAttributeReportIBs(reportDataBuilder, apReadHandler, &hasMoreChunksForAttributes,
+                                                          &hasEncodedAttributes);
+            SuccessOrExit(err);
+        }
         SuccessOrExit(err = reportDataWriter.UnreserveBuffer(kReservedSizeForEventReportIBs));
         err = BuildSingleReportDataEventReports(reportDataBuilder, apReadHandler, hasEncodedAttributes, &hasMoreChunksForEvents,
                                                 &hasEncodedEvents);
         SuccessOrExit(err);
 
+        if (usesSharedAttributes && hasMoreChunksForEvents)
+        {
+            // The next chunk resumes the attribute paths where this one left them: all of them were reported.
+            ConcreteAttributePath path;
+            for (apReadHandler->ResetPathIterator(); apReadHandler->GetAttributePathExpandIterator()->Get(path);
+                 apReadHandler->GetAttributePathExpandIterator()->Next())
+            {
+            }
+        }
+
         hasMoreChunks = hasMoreChunksForAttributes || hasMoreChunksForEvents;
 
         if (!hasEncodedAttributes && !hasEncodedEvents && hasMoreChunks)
@@ -784,13 +822,28 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     err = reportDataWriter.Finalize(&bufHandle);
     SuccessOrExit(err);
 
+    if (isNewReport && !hasMoreChunks && hasEncodedAttributes && !usesSharedAttributes &&
+        HasPendingSameAttributeInterest(apReadHandler))
+    {
+        // Sending encrypts the buffer in place, keep a copy of the plaintext.
+        mSharedAttributeReport.Clear();
+        mSharedAttributeReport.payload = bufHandle.CloneData();
+        if (!mSharedAttributeReport.payload.IsNull())
+        {
+            mSharedAttributeReport.readHandler                    = apReadHandler;
+            mSharedAttributeReport.previousReportsBeginGeneration = apReadHandler->mPreviousReportsBeginGeneration;
+            mSharedAttributeReport.dirtyGeneration                = mDirtyGeneration;
+            mSharedAttributeReport.priming                        = isPriming;
+        }
+    }
+
     ChipLogDetail(DataManagement, "<RE> Sending report (payload has %" PRIu32 " bytes)...", reportDataWriter.GetLengthWritten());
     err = SendReport(apReadHandler, std::move(bufHandle), hasMoreChunks);
     VerifyOrExit(err == CHIP_NO_ERROR,
                  ChipLogError(DataManagement, "<RE> Error sending out report data with %" CHIP_ERROR_FORMAT "!", err.Format()));
 
-    ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %" PRIu32 " with readHandler %" PRIu32 ", RE has %s", mNumReportsInFlight,
-                  mCurReadHandlerIdx, hasMoreChunks ? "more messages" : "no more messages");
+    ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %" PRIu32 ", RE has %s", mNumReportsInFlight,
+                  hasMoreChunks ? "more messages" : "no more messages");
 
 exit:
     if (err != CHIP_NO_ERROR || (apReadHandler->IsType(ReadHandler::InteractionType::Read) && !hasMoreChunks) ||
@@ -841,48 +894,194 @@ CHIP_ERROR Engine::ScheduleRun()
     return CHIP_NO_ERROR;
 }
 
-void Engine::Run()
+void Engine::CollectReportableHandlers(RunQueue & aQueue)
 {
-    uint32_t numReadHandled = 0;
+    ReportScheduler * scheduler = mpImEngine->GetReportScheduler();
+
+    mpImEngine->mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
+        System::Clock::Timestamp deadline;
+        if (handler->mLastReportRun == mRunCount)
+        {
+            return Loop::Continue;
+        }
 
-    // We may be deallocating read handlers as we go.  Track how many we had
-    // initially, so we make sure to go through all of them.
-    size_t initialAllocated = mpImEngine->mReadHandlers.Allocated();
-    while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < initialAllocated))
+        if (handler->ShouldReportUnscheduled())
+        {
+            // Reads and priming reports answer a request the peer is waiting on, they go first.
+            aQueue.Offer(handler, System::Clock::kZero);
+        }
+        else if (scheduler->IsReportableNow(handler, deadline))
+        {
+            aQueue.Offer(handler, deadline);
+        }
+        return Loop::Continue;
+    });
+}
+
+uint32_t Engine::GetNumReportsInFlightToPeer(const ReadHandler & aReadHandler)
+{
+    uint32_t numReports = 0;
+    mpImEngine->mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
+        if (handler->IsAwaitingReportResponse() && handler->GetAccessingFabricIndex() == aReadHandler.GetAccessingFabricIndex() &&
+            handler->GetInitiatorNodeId() == aReadHandler.GetInitiatorNodeId())
+        {
+            numReports++;
+        }
+        return Loop::Continue;
+    });
+    return numReports;
+}
+
+namespace {
+
+template <typename T>
+bool IsSameList(const SingleLinkedListNode<T> * aList, const SingleLinkedListNode<T> * aOther)
+{
+    for (; aList != nullptr && aOther != nullptr; aList = aList->mpNext, aOther = aOther->mpNext)
     {
-        ReadHandler * readHandler =
-            mpImEngine->ActiveHandlerAt(mCurReadHandlerIdx % (uint32_t) mpImEngine->mReadHandlers.Allocated());
-        VerifyOrDie(readHandler != nullptr);
+        if (!(aList->mValue == aOther->mValue))
+        {
+            return false;
+        }
+    }
+    return aList == nullptr && aOther == nullptr;
+}
+
+} // namespace
 
-        if (readHandler->ShouldReportUnscheduled() || mpImEngine->GetReportScheduler()->IsReportableNow(readHandler))
+bool Engine::IsSameAttributeInterest(const ReadHandler & aReadHandler, const ReadHandler & aOther)
+{
+    if (!aReadHandler.IsType(ReadHandler::InteractionType::Subscribe) || !aOther.IsType(ReadHandler::InteractionType::Subscribe) ||
+        aReadHandler.IsFabricFiltered() != aOther.IsFabricFiltered() || aReadHandler.GetSession() == nullptr ||
+        aOther.GetSession() == nullptr)
+    {
+        return false;
+    }
+
+    // Access control and fabric filtering of the data depend on the subject.
+    const SubjectDescriptor subject      = aReadHandler.GetSubjectDescriptor();
+    const SubjectDescriptor otherSubject = aOther.GetSubjectDescriptor();
+    if (subject.fabricIndex != otherSubject.fabricIndex || subject.authMode != otherSubject.authMode ||
+        subject.subject != otherSubject.subject || subject.cats != otherSubject.cats ||
+        subject.isCommissioning != otherSubject.isCommissioning)
+    {
+        return false;
+    }
+
+    return IsSameList(aReadHandler.GetAttributePathList(), aOther.GetAttributePathList()) &&
+        IsSameList(aReadHandler.GetDataVersionFilterList(), aOther.GetDataVersionFilterList());
+}
+
+bool Engine::HasPendingSameAttributeInterest(const ReadHandler * apReadHandler)
+{
+    bool found = false;
+    mpImEngine->mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
+        if (handler != apReadHandler && handler->mLastReportRun != mRunCount && IsSameAttributeInterest(*apReadHandler, *handler))
         {
+            found = true;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+    return found;
+}
 
-            mRunningReadHandler = readHandler;
-            CHIP_ERROR err      = BuildAndSendSingleReportData(readHandler);
-            mRunningReadHandler = nullptr;
-            if (err != CHIP_NO_ERROR)
-            {
-                return;
-            }
+bool Engine::CanUseSharedAttributeReport(const ReadHandler * apReadHandler)
+{
+    const SharedAttributeReport & shared = mSharedAttributeReport;
+
+    // Data marked dirty since the shared report was built may have a different value now.
+    if (shared.readHandler == nullptr || shared.readHandler == apReadHandler || apReadHandler->IsReporting() ||
+        apReadHandler->IsPriming() != shared.priming || shared.dirtyGeneration != mDirtyGeneration ||
+        !IsSameAttributeInterest(*shared.readHandler, *apReadHandler))
+    {
+        return false;
+    }
+
+    if (shared.priming)
+    {
+        // Priming reports carry every path.
+        return true;
+    }
+
+    // Both handlers must select the same dirty paths, i.e. have reported the same changes so far.
+    bool sameDirtyPaths = true;
+    mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
+        if ((dirtyPath->mGeneration > apReadHandler->mPreviousReportsBeginGeneration) !=
+            (dirtyPath->mGeneration > shared.previousReportsBeginGeneration))
+        {
+            sameDirtyPaths = false;
+            return Loop::Break;
         }
+        return Loop::Continue;
+    });
+    return sameDirtyPaths;
+}
 
-        numReadHandled++;
-        // If readHandler removed itself from our list, we also decremented
-        // mCurReadHandlerIdx to account for that removal, so it's safe to
-        // increment here.
-        mCurReadHandlerIdx++;
+CHIP_ERROR Engine::CopySharedAttributeReport(ReportDataMessage::Builder & aReportDataBuilder)
+{
+    TLV::TLVReader reader;
+    TLV::TLVType reportDataType;
+    CHIP_ERROR err;
+
+    reader.Init(mSharedAttributeReport.payload->Start(), mSharedAttributeReport.payload->DataLength());
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+    ReturnErrorOnFailure(reader.EnterContainer(reportDataType));
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (reader.GetTag() == TLV::ContextTag(ReportDataMessage::Tag::kAttributeReportIBs))
+        {
+            return aReportDataBuilder.GetWriter()->CopyElement(reader);
+        }
     }
+    return err == CHIP_END_OF_TLV ? CHIP_ERROR_NOT_FOUND : err;
+}
 
-    //
-    // If our tracker has exceeded the bounds of the handler list, reset it back to 0.
-    // This isn't strictly necessary, but does make it easier to debug issues in this code if they
-    // do arise.
-    //
-    if (mCurReadHandlerIdx >= mpImEngine->mReadHandlers.Allocated())
+CHIP_ERROR Engine::SendReport(ReadHandler & aReadHandler, System::Clock::Timestamp aDeadline)
+{
+    if (!aReadHandler.ShouldReportUnscheduled())
     {
-        mCurReadHandlerIdx = 0;
+        System::Clock::Timestamp now = mpImEngine->GetReportScheduler()->GetCurrentMonotonicTimestamp();
+        if (now > aDeadline + kMaxIntervalOverrunSlack)
+        {
+            mMaxIntervalOverrunCount++;
+            ChipLogProgress(DataManagement, "<RE> Report is %" PRIu32 " ms past the max interval",
+                            std::chrono::duration_cast<System::Clock::Milliseconds32>(now - aDeadline).count());
+        }
     }
 
+    return BuildAndSendSingleReportData(&aReadHandler);
+}
+
+void Engine::Run()
+{
+    // Serve every ReadHandler that can report at most once per run, earliest deadline first, so that handlers late in the pool
+    // are not starved by the ones before them.
+    struct EngineRun
+    {
+        Engine & engine;
+
+        bool HasReportSlot() const { return engine.mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT; }
+        void CollectReportableHandlers(RunQueue & aQueue) { engine.CollectReportableHandlers(aQueue); }
+        void MarkServed(ReadHandler & aReadHandler) { aReadHandler.mLastReportRun = engine.mRunCount; }
+        uint32_t GetNumReportsInFlightToPeer(const ReadHandler & aReadHandler)
+        {
+            return engine.GetNumReportsInFlightToPeer(aReadHandler);
+        }
+        CHIP_ERROR SendReport(ReadHandler & aReadHandler, System::Clock::Timestamp aDeadline)
+        {
+            return engine.SendReport(aReadHandler, aDeadline);
+        }
+    };
+
+    EngineRun run{ *this };
+
+    mRunCount++;
+    mSharedAttributeReport.Clear();
+    CHIP_ERROR err = ServeReportRun(mRunQueue, run, GetMaxReportsInFlightPerPeer(), mHandlersWaitingForPeer);
+    mSharedAttributeReport.Clear();
+    VerifyOrReturn(err == CHIP_NO_ERROR);
+
     bool allReadClean = true;
 
     mpImEngine->mReadHandlers.ForEachActiveObject([&allReadClean](ReadHandler * handler) {
@@ -1090,7 +1289,7 @@ void Engine::OnReportConfirm()
 {
     VerifyOrDie(mNumReportsInFlight > 0);
 
-    if (mNumReportsInFlight == CHIP_IM_MAX_REPORTS_IN_FLIGHT)
+    if (mNumReportsInFlight == CHIP_IM_MAX_REPORTS_IN_FLIGHT || mHandlersWaitingForPeer)
     {
         // We could have other things waiting to go now that this report is no
         // longer in flight.
@@ -29,6 +29,7 @@
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
 #include <app/data-model-provider/ProviderChangeListener.h>
+#include <app/reporting/ReportRunQueue.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
@@ -80,6 +81,11 @@ public:
     void SetWriterReserved(uint32_t aReservedSize) { mReservedSize = aReservedSize; }
 
     void SetMaxAttributesPerChunk(uint32_t aMaxAttributesPerChunk) { mMaxAttributesPerChunk = aMaxAttributesPerChunk; }
+
+    void SetMaxReportsInFlightPerPeer(uint32_t aMaxReportsInFlightPerPeer)
+    {
+        mMaxReportsInFlightPerPeer = aMaxReportsInFlightPerPeer;
+    }
 #endif
 
     /**
@@ -100,29 +106,30 @@ public:
     CHIP_ERROR SetDirty(const AttributePathParams & aAttributePathParams);
 
     /*
-     * Resets the tracker that tracks the currently serviced read handler.
-     * apReadHandler can be non-null to indicate that the reset is due to a
-     * specific ReadHandler being deallocated.
+     * Forgets a ReadHandler that is being deallocated, so that the current run does not serve it.
      */
     void ResetReadHandlerTracker(ReadHandler * apReadHandlerBeingDeleted)
     {
-        if (apReadHandlerBeingDeleted == mRunningReadHandler)
+        mRunQueue.Remove(apReadHandlerBeingDeleted);
+        if (mSharedAttributeReport.readHandler == apReadHandlerBeingDeleted)
         {
-            // Just decrement, so our increment after we finish running it will
-            // do the right thing.
-            --mCurReadHandlerIdx;
-        }
-        else
-        {
-            // No idea what to do here to make the indexing sane.  Just start at
-            // the beginning.  We need to do better here; see
-            // https://github.com/project-chip/connectedhomeip/issues/13809
-            mCurReadHandlerIdx = 0;
+            mSharedAttributeReport.Clear();
         }
     }
 
     uint32_t GetNumReportsInFlight() const { return mNumReportsInFlight; }
 
+    /**
+     * Number of subscription reports that started more than kMaxIntervalOverrunSlack after the end of the max interval of
+     * their subscription, e.g. because all report slots were taken.
+     */
+    uint32_t GetMaxIntervalOverrunCount() const { return mMaxIntervalOverrunCount; }
+
+    /**
+     * Number of reports whose attribute data was copied from the report of an identical subscription rather than encoded.
+     */
+    uint32_t GetSharedAttributeReportCount() const { return mSharedAttributeReportCount; }
+
     uint64_t GetDirtySetGeneration() const { return mDirtyGeneration; }
 
     /**
@@ -146,6 +153,61 @@ private:
      */
     void Run();
 
+    /**
+     * Lateness past the max interval beyond which a subscription report is counted as an overrun. Reports normally start a few
+     * milliseconds late, the time for the report timer to schedule the run.
+     */
+    static constexpr System::Clock::Milliseconds32 kMaxIntervalOverrunSlack = System::Clock::Milliseconds32(1000);
+
+    using RunQueue = ReportRunQueue<ReadHandler, CHIP_IM_MAX_REPORTS_IN_FLIGHT>;
+
+    /**
+     * Queue the ReadHandlers that can report now, up to the number of reports that can be sent, by earliest deadline.
+     * Handlers already served by the current run are skipped.
+     */
+    void CollectReportableHandlers(RunQueue & aQueue);
+
+    /**
+     * Send the report of a ReadHandler collected by the current run, counting it as an overrun when it starts more than
+     * kMaxIntervalOverrunSlack after aDeadline.
+     */
+    CHIP_ERROR SendReport(ReadHandler & aReadHandler, System::Clock::Timestamp aDeadline);
+
+    /**
+     * Number of reports in flight to the peer of a ReadHandler, against CHIP_IM_MAX_REPORTS_IN_FLIGHT_PER_PEER.
+     */
+    uint32_t GetNumReportsInFlightToPeer(const ReadHandler & aReadHandler);
+
+    uint32_t GetMaxReportsInFlightPerPeer() const
+    {
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+        return mMaxReportsInFlightPerPeer;
+#else
+        return CHIP_IM_MAX_REPORTS_IN_FLIGHT_PER_PEER;
+#endif
+    }
+
+    /**
+     * Whether two subscriptions ask for the same attribute data on behalf of the same subject, so that a report built for one
+     * can carry the attribute data encoded for the other.
+     */
+    static bool IsSameAttributeInterest(const ReadHandler & aReadHandler, const ReadHandler & aOther);
+
+    /**
+     * Whether a ReadHandler not yet served by the current run has the same attribute interest as apReadHandler.
+     */
+    bool HasPendingSameAttributeInterest(const ReadHandler * apReadHandler);
+
+    /**
+     * Whether the attribute data held in mSharedAttributeReport is what a report for apReadHandler would encode now.
+     */
+    bool CanUseSharedAttributeReport(const ReadHandler * apReadHandler);
+
+    /**
+     * Copy the AttributeReportIBs held in mSharedAttributeReport into the report being built.
+     */
+    CHIP_ERROR CopySharedAttributeReport(ReportDataMessage::Builder & aReportDataBuilder);
+
     friend class TestReportingEngine;
     friend class ::chip::app::TestReadInteraction;
 
@@ -248,15 +310,43 @@ private:
     uint32_t mNumReportsInFlight = 0;
 
     /**
-     *  Current read handler index
-     *
+     * ReadHandlers the current run is about to serve, earliest deadline first.
+     */
+    RunQueue mRunQueue;
+
+    /**
+     * Number of the current run, ReadHandlers record the last run that considered them.
+     */
+    uint32_t mRunCount = 0;
+
+    /**
+     * Whether a run left reportable handlers waiting for a report to their peer to be acknowledged.
      */
-    uint32_t mCurReadHandlerIdx = 0;
+    bool mHandlersWaitingForPeer = false;
+
+    uint32_t mMaxIntervalOverrunCount = 0;
 
     /**
-     * The read handler we're calling BuildAndSendSingleReportData on right now.
+     * Last complete report of the current run whose attribute data other subscriptions may reuse, to encode the data once when
+     * several subscriptions of the same subject ask for the same paths (e.g. a controller subscribing once per application).
      */
-    ReadHandler * mRunningReadHandler = nullptr;
+    struct SharedAttributeReport
+    {
+        const ReadHandler * readHandler         = nullptr; // handler the report was built for, nullptr when nothing is held
+        uint64_t previousReportsBeginGeneration = 0;       // of readHandler when its report was built
+        uint64_t dirtyGeneration                = 0;       // of the dirty set when the report was built
+        bool priming                            = false;
+        System::PacketBufferHandle payload; // ReportDataMessage, before encryption
+
+        void Clear()
+        {
+            readHandler = nullptr;
+            payload     = nullptr;
+        }
+    };
+
+    SharedAttributeReport mSharedAttributeReport;
+    uint32_t mSharedAttributeReportCount = 0;
 
     /**
      *  mGlobalDirtySet is used to track the set of attribute/event paths marked dirty for reporting purposes.
@@ -284,8 +374,9 @@ private:
     uint64_t mDirtyGeneration = 1;
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-    uint32_t mReservedSize          = 0;
-    uint32_t mMaxAttributesPerChunk = UINT32_MAX;
+    uint32_t mReservedSize              = 0;
+    uint32_t mMaxAttributesPerChunk     = UINT32_MAX;
+    uint32_t mMaxReportsInFlightPerPeer = CHIP_IM_MAX_REPORTS_IN_FLIGHT_PER_PEER;
 #endif
 
     InteractionModelEngine * mpImEngine = nullptr;
@@ -0,0 +1,205 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <system/SystemClock.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * @brief Orders the handlers that can report now by the time they must report by, so that the reporting engine serves them
+ *        earliest deadline first rather than in the order of its handler pool.
+ *
+ * Only the kCapacity handlers with the earliest deadlines are kept, which is all the engine can send at once. When more
+ * handlers were offered, IsTruncated() is set so that the engine knows to collect the remaining ones once it has served the
+ * queued ones. Handlers with the same deadline are served in the order they were offered.
+ */
+template <typename Handler, size_t kCapacity>
+class ReportRunQueue
+{
+public:
+    using Timestamp = System::Clock::Timestamp;
+
+    void Clear()
+    {
+        mCount     = 0;
+        mTruncated = false;
+    }
+
+    /**
+     * @brief Queue a handler that can report now.
+     *
+     * @param aHandler handler to queue
+     * @param aDeadline time by which the handler must report, e.g. the end of its max interval
+     */
+    void Offer(Handler * aHandler, Timestamp aDeadline)
+    {
+        size_t index = mCount;
+        while (index > 0 && aDeadline < mEntries[index - 1].deadline)
+        {
+            index--;
+        }
+
+        if (index == kCapacity)
+        {
+            mTruncated = true;
+            return;
+        }
+
+        if (mCount == kCapacity)
+        {
+            // Drop the handler with the latest deadline, it will be collected again.
+            mTruncated = true;
+            mCount--;
+        }
+
+        for (size_t i = mCount; i > index; i--)
+        {
+            mEntries[i] = mEntries[i - 1];
+        }
+        mEntries[index] = { aHandler, aDeadline };
+        mCount++;
+    }
+
+    /**
+     * @brief Remove and return the handler with the earliest deadline, nullptr if the queue is empty.
+     *
+     * @param[out] apDeadline if not null, set to the deadline the handler was queued with
+     */
+    Handler * Pop(Timestamp * apDeadline = nullptr)
+    {
+        if (mCount == 0)
+        {
+            return nullptr;
+        }
+
+        Handler * handler = mEntries[0].handler;
+        if (apDeadline != nullptr)
+        {
+            *apDeadline = mEntries[0].deadline;
+        }
+        RemoveAt(0);
+        return handler;
+    }
+
+    /**
+     * @brief Remove a handler from the queue, e.g. because it is being released.
+     */
+    void Remove(const Handler * aHandler)
+    {
+        for (size_t i = 0; i < mCount; i++)
+        {
+            if (mEntries[i].handler == aHandler)
+            {
+                RemoveAt(i);
+                return;
+            }
+        }
+    }
+
+    size_t Size() const { return mCount; }
+
+    /// Whether handlers were offered beyond the capacity of the queue since it was last cleared.
+    bool IsTruncated() const { return mTruncated; }
+
+private:
+    struct Entry
+    {
+        Handler * handler;
+        Timestamp deadline;
+    };
+
+    void RemoveAt(size_t aIndex)
+    {
+        for (size_t i = aIndex + 1; i < mCount; i++)
+        {
+            mEntries[i - 1] = mEntries[i];
+        }
+        mCount--;
+    }
+
+    Entry mEntries[kCapacity];
+    size_t mCount   = 0;
+    bool mTruncated = false;
+};
+
+/**
+ * @brief Serve the handlers that can report now, each at most once, earliest deadline first: one run of the reporting engine.
+ *
+ * The queue only holds as many handlers as reports can be sent, so handlers are collected again while it was truncated and
+ * report slots remain. A handler whose peer already has aMaxReportsInFlightPerPeer reports in flight is skipped for this run
+ * and aHandlersWaitingForPeer is set, so that the caller runs again once a report to that peer is acknowledged.
+ *
+ * aRun provides:
+ *   - bool HasReportSlot(): whether another report can be sent
+ *   - void CollectReportableHandlers(ReportRunQueue & aQueue): offer the handlers that can report now and that were not
+ *     served by this run yet
+ *   - void MarkServed(Handler & aHandler): the handler must not be collected again by this run
+ *   - uint32_t GetNumReportsInFlightToPeer(const Handler & aHandler)
+ *   - CHIP_ERROR SendReport(Handler & aHandler, Timestamp aDeadline)
+ *
+ * @return the error of the first report that could not be sent, which ends the run
+ */
+template <typename Handler, size_t kCapacity, typename Run>
+CHIP_ERROR ServeReportRun(ReportRunQueue<Handler, kCapacity> & aQueue, Run & aRun, uint32_t aMaxReportsInFlightPerPeer,
+                          bool & aHandlersWaitingForPeer)
+{
+    CHIP_ERROR err          = CHIP_NO_ERROR;
+    aHandlersWaitingForPeer = false;
+
+    while (err == CHIP_NO_ERROR && aRun.HasReportSlot())
+    {
+        aQueue.Clear();
+        aRun.CollectReportableHandlers(aQueue);
+        const bool moreHandlers = aQueue.IsTruncated();
+
+        Handler * handler;
+        System::Clock::Timestamp deadline;
+        while (err == CHIP_NO_ERROR && aRun.HasReportSlot() && (handler = aQueue.Pop(&deadline)) != nullptr)
+        {
+            aRun.MarkServed(*handler);
+
+            // No peer can hold more reports than can be in flight at once, only count them when the limit is lower.
+            if (aMaxReportsInFlightPerPeer < kCapacity && aRun.GetNumReportsInFlightToPeer(*handler) >= aMaxReportsInFlightPerPeer)
+            {
+                aHandlersWaitingForPeer = true;
+                continue;
+            }
+
+            err = aRun.SendReport(*handler, deadline);
+        }
+
+        if (!moreHandlers)
+        {
+            break;
+        }
+    }
+
+    aQueue.Clear();
+    return err;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -206,6 +206,22 @@ public:
         return (nullptr != node) ? node->IsReportableNow(now) : false;
     }
 
+    /// @brief Check whether a ReadHandler is reportable right now and get the time by which it must report, which is the end
+    /// of its maximum interval.
+    /// @param aReadHandler read handler to check
+    /// @param aDeadline set to the end of the maximum interval of the read handler when it is reportable
+    bool IsReportableNow(ReadHandler * aReadHandler, Timestamp & aDeadline)
+    {
+        Timestamp now          = mTimerDelegate->GetCurrentMonotonicTimestamp();
+        ReadHandlerNode * node = FindReadHandlerNode(aReadHandler);
+        VerifyOrReturnValue(nullptr != node && node->IsReportableNow(now), false);
+        aDeadline = node->GetMaxTimestamp();
+        return true;
+    }
+
+    /// @brief Get the current time, as used by the scheduler to evaluate the intervals of ReadHandlers
+    Timestamp GetCurrentMonotonicTimestamp() { return mTimerDelegate->GetCurrentMonotonicTimestamp(); }
+
     /// @brief Check if a ReadHandler is reportable without considering the timing
     bool IsReadHandlerReportable(ReadHandler * aReadHandler) const
     {
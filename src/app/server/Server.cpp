@@ -31,6 +31,7 @@
 #if CONFIG_NETWORK_LAYER_BLE
 #include <ble/Ble.h>
 #endif
+#include <credentials/CHIPCertDecodeCache.h>
 #include <inet/IPAddress.h>
 #include <inet/InetError.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
@@ -139,6 +140,9 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     // TODO(16969): Remove Platform::MemoryInit() call from Server class, it belongs to outer code
     Platform::MemoryInit();
 
+    // Operational certificates are decoded once for all the CASE establishments using them.
+    SuccessOrExit(err = Credentials::RetainSharedChipCertificateDecodeCache());
+
     // Initialize PersistentStorageDelegate-based storage
     mDeviceStorage                 = initParams.persistentStorageDelegate;
     mSessionResumptionStorage      = initParams.sessionResumptionStorage;
@@ -283,9 +287,12 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
             { &sInfoEventBuffer[0], sizeof(sInfoEventBuffer), app::PriorityLevel::Info },
             { &sCritEventBuffer[0], sizeof(sCritEventBuffer), app::PriorityLevel::Critical }
         };
+        const app::LogStorageResources * eventLogStorageResources = initParams.eventLogStorageResources != nullptr
+            ? initParams.eventLogStorageResources
+            : &logStorageResources[0];
 
         app::EventManagement::GetInstance().Init(&mExchangeMgr, CHIP_NUM_EVENT_LOGGING_BUFFERS, &sLoggingBuffer[0],
-                                                 &logStorageResources[0], &sGlobalEventIdCounter,
+                                                 eventLogStorageResources, &sGlobalEventIdCounter,
                                                  std::chrono::duration_cast<System::Clock::Milliseconds64>(mInitTimestamp));
     }
 #endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
@@ -667,6 +674,7 @@ void Server::Shutdown()
     }
     mICDManager.Shutdown();
 #endif // CHIP_CONFIG_ENABLE_ICD_SERVER
+    Credentials::ReleaseSharedChipCertificateDecodeCache();
 
     // TODO(16969): Remove chip::Platform::MemoryInit() call from Server class, it belongs to outer code
     chip::Platform::MemoryShutdown();
@@ -123,6 +123,10 @@ using UdcTransportMgr = TransportMgr<Transport::UDP /* IPv6 */
                                      >;
 #endif
 
+namespace app {
+struct LogStorageResources;
+} // namespace app
+
 struct ServerInitParams
 {
     ServerInitParams() = default;
@@ -193,6 +197,13 @@ struct ServerInitParams
     // data model it wants to use. Backwards-compatibility can use `CodegenDataModelProviderInstance`
     // for ember/zap-generated models.
     chip::app::DataModel::Provider * dataModelProvider = nullptr;
+
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
+    // Optional. Storage of the event log, one entry per priority level from Debug to Critical. When
+    // null, events are kept in static RAM buffers sized by CHIP_DEVICE_CONFIG_EVENT_LOGGING_*_BUFFER_SIZE.
+    // Must stay valid until the server is shut down.
+    const app::LogStorageResources * eventLogStorageResources = nullptr;
+#endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
 };
 
 /**
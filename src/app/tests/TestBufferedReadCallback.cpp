@@ -24,6 +24,7 @@
 #include "system/TLVPacketBufferBackingStore.h"
 #include <app-common/zap-generated/cluster-objects.h>
 #include <app/BufferedReadCallback.h>
+#include <app/StatusResponse.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
 #include <app/tests/AppTestContext.h>
@@ -51,6 +52,7 @@ struct ValidationInstruction
         kListAttributeC_Empty,
         kListAttributeC_NotEmpty,
         kListAttributeC_NotEmpty_Chunked,
+        kListAttributeC_LargeItems_Chunked,
         kListAttributeC_Error,
         kListAttributeD_Empty,
         kListAttributeD_NotEmpty,
@@ -64,6 +66,17 @@ struct ValidationInstruction
 
 using InstructionListType = std::vector<ValidationInstruction>;
 
+// Items of C_LargeItems have octet strings of varying sizes, every 16th one larger than an IPv6 MTU when large
+// payloads (TCP) are supported, since only large reports can carry such items.
+constexpr uint32_t kLargeItemsListLength = 100;
+constexpr size_t kMaxItemOctetStringSize =
+    System::PacketBuffer::kMaxAllocSize > 2 * chip::app::kMaxSecureSduLengthBytes ? 2000 : 500;
+
+size_t LargeItemsOctetStringSize(uint32_t index)
+{
+    return (index % 16 == 0) ? kMaxItemOctetStringSize : (index * 37) % 200;
+}
+
 using TestBufferedReadCallback = chip::Test::AppContext;
 
 class DataSeriesValidator : public BufferedReadCallback::Callback
@@ -193,6 +206,37 @@ void DataSeriesValidator::OnAttributeData(const ConcreteDataAttributePath & aPat
         break;
     }
 
+    case ValidationInstruction::kListAttributeC_LargeItems_Chunked: {
+        ChipLogProgress(DataManagement, "\t\t -- Validating C[%" PRIu32 "] with large items", kLargeItemsListLength);
+
+        Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo::DecodableType value;
+        size_t len;
+
+        EXPECT_EQ(aPath.mAttributeId, Clusters::UnitTesting::Attributes::ListStructOctetString::Id);
+        EXPECT_EQ(aPath.mListOp, ConcreteDataAttributePath::ListOperation::ReplaceAll);
+        EXPECT_EQ(DataModel::Decode(*apData, value), CHIP_NO_ERROR);
+        EXPECT_EQ(value.ComputeSize(&len), CHIP_NO_ERROR);
+        EXPECT_EQ(len, kLargeItemsListLength);
+
+        auto iter = value.begin();
+
+        uint32_t index = 0;
+        while (iter.Next() && index < kLargeItemsListLength)
+        {
+            auto & iterValue = iter.GetValue();
+            EXPECT_EQ(iterValue.member1, index);
+            EXPECT_EQ(iterValue.member2.size(), LargeItemsOctetStringSize(index));
+            for (uint8_t byte : iterValue.member2)
+            {
+                EXPECT_EQ(byte, static_cast<uint8_t>(index));
+            }
+            index++;
+        }
+
+        EXPECT_EQ(iter.GetStatus(), CHIP_NO_ERROR);
+        break;
+    }
+
     case ValidationInstruction::kListAttributeD_Empty: {
         ChipLogProgress(DataManagement, "\t\t -- Validating D[]");
 
@@ -458,6 +502,52 @@ void DataSeriesGenerator::Generate()
             break;
         }
 
+        case ValidationInstruction::kListAttributeC_LargeItems_Chunked: {
+            hasData = false;
+            Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo::Type value;
+            uint8_t octetString[kMaxItemOctetStringSize];
+
+            {
+                ChipLogProgress(DataManagement, "\t -- Generating C[]");
+
+                path.mAttributeId = Clusters::UnitTesting::Attributes::ListStructOctetString::Id;
+                path.mListOp      = ConcreteDataAttributePath::ListOperation::ReplaceAll;
+                EXPECT_EQ(DataModel::Encode(writer, TLV::AnonymousTag(), value), CHIP_NO_ERROR);
+
+                writer.Finalize(&handle);
+                reader.Init(std::move(handle));
+                EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+                callback->OnAttributeData(path, &reader, status);
+            }
+
+            ChipLogProgress(DataManagement, "\t -- Generating C0..C%" PRIu32 " with large items", kLargeItemsListLength);
+
+            for (uint32_t i = 0; i < kLargeItemsListLength; i++)
+            {
+                Clusters::UnitTesting::Structs::TestListStructOctet::Type listItem;
+
+                handle = System::PacketBufferHandle::New(kMaxItemOctetStringSize + 100, 0);
+                writer.Init(std::move(handle), false);
+                status = StatusIB();
+
+                path.mAttributeId = Clusters::UnitTesting::Attributes::ListStructOctetString::Id;
+                path.mListOp      = ConcreteDataAttributePath::ListOperation::AppendItem;
+
+                memset(octetString, static_cast<uint8_t>(i), sizeof(octetString));
+                listItem.member1 = i;
+                listItem.member2 = ByteSpan(octetString, LargeItemsOctetStringSize(i));
+
+                EXPECT_EQ(DataModel::Encode(writer, TLV::AnonymousTag(), listItem), CHIP_NO_ERROR);
+
+                writer.Finalize(&handle);
+                reader.Init(std::move(handle));
+                EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+                callback->OnAttributeData(path, &reader, status);
+            }
+
+            break;
+        }
+
         case ValidationInstruction::kListAttributeD_NotEmpty_Chunked: {
             hasData = false;
             Clusters::UnitTesting::Attributes::ListInt8u::TypeInfo::Type value;
@@ -595,6 +685,13 @@ TEST_F(TestBufferedReadCallback, TestBufferedSequences)
         { ValidationInstruction::kListAttributeC_NotEmpty_Chunked },
         { ValidationInstruction::kListAttributeD_NotEmpty_Chunked },
     });
+
+    ChipLogProgress(DataManagement, "A C[] C0 C1 (large) A --> A C[2] A");
+    RunAndValidateSequence({
+        { ValidationInstruction::kSimpleAttributeA },
+        { ValidationInstruction::kListAttributeC_LargeItems_Chunked },
+        { ValidationInstruction::kSimpleAttributeA },
+    });
 }
 
 } // namespace
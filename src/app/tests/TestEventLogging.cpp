@@ -247,6 +247,91 @@ TEST_F(TestEventLogging, TestCheckLogEventWithEvictToNextBuffer)
     CheckLogReadOut(logMgmt, 0, 6, pathsWithWildcard);
 }
 
+TEST_F(TestEventLogging, TestFetchEventsSinceSkipsDeliveredEvents)
+{
+    chip::EventNumber eid[6];
+    chip::app::EventOptions options;
+    options.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Info;
+    TestEventGenerator testEventGenerator;
+
+    // Six events fill the debug buffer and push the three oldest ones to the info buffer.
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    for (size_t i = 0; i < ArraySize(eid); i++)
+    {
+        testEventGenerator.SetStatus(static_cast<int32_t>(i % 2));
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eid[i]), CHIP_NO_ERROR);
+    }
+    CheckLogState(logMgmt, 6, chip::app::PriorityLevel::Info);
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> path;
+    chip::Platform::ScopedMemoryBuffer<uint8_t> backingStore;
+    ASSERT_TRUE(backingStore.Alloc(1024));
+
+    // Only the events still in the debug buffer are newer than the starting event number.
+    chip::TLV::TLVWriter writer;
+    chip::EventNumber eventMin = eid[4];
+    size_t eventCount          = 0;
+    writer.Init(backingStore.Get(), 1024);
+    EXPECT_EQ(logMgmt.FetchEventsSince(writer, &path, eventMin, eventCount, chip::Access::SubjectDescriptor{}), CHIP_NO_ERROR);
+    EXPECT_EQ(eventCount, 2u);
+    EXPECT_EQ(eventMin, eid[5] + 1);
+
+    // Once everything was delivered, nothing is fetched and the starting event number does not move.
+    eventCount = 0;
+    writer.Init(backingStore.Get(), 1024);
+    EXPECT_EQ(logMgmt.FetchEventsSince(writer, &path, eventMin, eventCount, chip::Access::SubjectDescriptor{}), CHIP_NO_ERROR);
+    EXPECT_EQ(eventCount, 0u);
+    EXPECT_EQ(writer.GetLengthWritten(), 0u);
+    EXPECT_EQ(eventMin, eid[5] + 1);
+}
+
+TEST_F(TestEventLogging, TestResumePersistedEvents)
+{
+    chip::app::PersistedEventBufferState states[3];
+    const chip::app::LogStorageResources logStorageResources[] = {
+        { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), chip::app::PriorityLevel::Debug, &states[0] },
+        { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), chip::app::PriorityLevel::Info, &states[1] },
+        { &gCritEventBuffer[0], sizeof(gCritEventBuffer), chip::app::PriorityLevel::Critical, &states[2] },
+    };
+    chip::EventNumber eid1, eid2, eid3;
+    chip::app::EventOptions options;
+    options.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Info;
+    TestEventGenerator testEventGenerator;
+    testEventGenerator.SetStatus(0);
+
+    chip::MonotonicallyIncreasingCounter<chip::EventNumber> counter;
+    ASSERT_EQ(counter.Init(100), CHIP_NO_ERROR);
+    chip::app::EventManagement::DestroyEventManagement();
+    chip::app::EventManagement::CreateEventManagement(&GetExchangeManager(), ArraySize(logStorageResources), gCircularEventBuffer,
+                                                      logStorageResources, &counter);
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eid1), CHIP_NO_ERROR);
+    EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eid2), CHIP_NO_ERROR);
+
+    // After a restart the event number counter resumes above the numbers it vended before, and so do the events.
+    chip::MonotonicallyIncreasingCounter<chip::EventNumber> resumedCounter;
+    ASSERT_EQ(resumedCounter.Init(200), CHIP_NO_ERROR);
+    chip::app::EventManagement::DestroyEventManagement();
+    chip::app::EventManagement::CreateEventManagement(&GetExchangeManager(), ArraySize(logStorageResources), gCircularEventBuffer,
+                                                      logStorageResources, &resumedCounter);
+    CheckLogState(logMgmt, 2, chip::app::PriorityLevel::Critical);
+
+    EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eid3), CHIP_NO_ERROR);
+    EXPECT_LT(eid2, eid3);
+    CheckLogState(logMgmt, 3, chip::app::PriorityLevel::Critical);
+
+    // Events the counter would vend again are dropped.
+    chip::MonotonicallyIncreasingCounter<chip::EventNumber> resetCounter;
+    ASSERT_EQ(resetCounter.Init(0), CHIP_NO_ERROR);
+    chip::app::EventManagement::DestroyEventManagement();
+    chip::app::EventManagement::CreateEventManagement(&GetExchangeManager(), ArraySize(logStorageResources), gCircularEventBuffer,
+                                                      logStorageResources, &resetCounter);
+    CheckLogState(logMgmt, 0, chip::app::PriorityLevel::Critical);
+}
+
 TEST_F(TestEventLogging, TestCheckLogEventWithDiscardLowEvent)
 {
 
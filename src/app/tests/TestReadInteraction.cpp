@@ -15,6 +15,10 @@
  *    See the License for the specific language governing permissions and
  *    limitations under the License.
  */
+#include <chrono>
+#include <memory>
+#include <vector>
+
 #include <access/examples/PermissiveAccessControlDelegate.h>
 #include <app/AttributeValueEncoder.h>
 #include <app/InteractionModelEngine.h>
@@ -357,6 +361,8 @@ public:
     void TestReadClientInvalidAttributeId();
     void TestReadClientInvalidReport();
     void TestReadClientReceiveInvalidMessage();
+    void TestReadClientSubscriptionIndex();
+    void TestReadClientRemovalScaling();
     void TestReadHandler();
     void TestReadHandlerInvalidAttributePath();
     void TestReadHandlerInvalidSubscribeRequest();
@@ -394,9 +400,12 @@ public:
     void TestSubscribeSendInvalidStatusReport();
     void TestSubscribeSendUnknownMessage();
     void TestSubscribeSetDirtyFullyOverlap();
+    void TestSubscribeIdenticalSharedReport();
     void TestSubscribeUrgentWildcardEvent();
     void TestSubscribeWildcard();
     void TestSubscriptionReportWithDefunctSession();
+    void TestSubscriptionReportsEarliestDeadlineFirst();
+    void TestSubscriptionReportsPerPeerLimit();
 
     enum class ReportType : uint8_t
     {
@@ -409,6 +418,9 @@ public:
                                    bool aHasSubscriptionId);
 
 protected:
+    // Subscribe from Bob to (E2, C3, aAttributeId) with no min interval, keeping the existing subscriptions.
+    void SubscribeToMockAttribute(ReadClient & aReadClient, AttributeId aAttributeId);
+
     chip::MonotonicallyIncreasingCounter<chip::EventNumber> mEventCounter;
     chip::app::DataModel::Provider * mOldProvider = nullptr;
 };
@@ -2869,6 +2881,215 @@ void TestReadInteraction::TestSubscribeSetDirtyFullyOverlap()
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+// Subscribe twice to (E2, C3, A1) over the same session, then setDirty (E2, C3, A1): the attribute data is encoded once and
+// reported to both subscriptions.
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestSubscribeIdenticalSharedReport)
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestSubscribeIdenticalSharedReport)
+void TestReadInteraction::TestSubscribeIdenticalSharedReport()
+{
+    Messaging::ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    MockInteractionModelApp delegates[2];
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    {
+        app::ReadClient readClient0(engine, &GetExchangeManager(), delegates[0], chip::app::ReadClient::InteractionType::Subscribe);
+        app::ReadClient readClient1(engine, &GetExchangeManager(), delegates[1], chip::app::ReadClient::InteractionType::Subscribe);
+        app::ReadClient * readClients[] = { &readClient0, &readClient1 };
+
+        for (size_t i = 0; i < 2; i++)
+        {
+            auto attributePathParams            = std::make_unique<chip::app::AttributePathParams[]>(1);
+            attributePathParams[0].mEndpointId  = chip::Test::kMockEndpoint2;
+            attributePathParams[0].mClusterId   = chip::Test::MockClusterId(3);
+            attributePathParams[0].mAttributeId = chip::Test::MockAttributeId(1);
+
+            ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+            readPrepareParams.mpAttributePathParamsList    = attributePathParams.release();
+            readPrepareParams.mAttributePathParamsListSize = 1;
+            readPrepareParams.mMinIntervalFloorSeconds     = 0;
+            readPrepareParams.mMaxIntervalCeilingSeconds   = 1;
+            // Otherwise the second subscription replaces the first one.
+            readPrepareParams.mKeepSubscriptions = true;
+
+            EXPECT_EQ(readClients[i]->SendAutoResubscribeRequest(std::move(readPrepareParams)), CHIP_NO_ERROR);
+            DrainAndServiceIO();
+            EXPECT_TRUE(delegates[i].mGotReport);
+        }
+        EXPECT_EQ(engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe), 2u);
+
+        const uint32_t sharedReports = engine->GetReportingEngine().GetSharedAttributeReportCount();
+        for (auto & delegate : delegates)
+        {
+            delegate.mGotReport            = false;
+            delegate.mNumAttributeResponse = 0;
+        }
+
+        AttributePathParams dirtyPath(chip::Test::kMockEndpoint2, chip::Test::MockClusterId(3), chip::Test::MockAttributeId(1));
+        EXPECT_EQ(engine->GetReportingEngine().SetDirty(dirtyPath), CHIP_NO_ERROR);
+
+        DrainAndServiceIO();
+
+        for (auto & delegate : delegates)
+        {
+            EXPECT_TRUE(delegate.mGotReport);
+            EXPECT_EQ(delegate.mNumAttributeResponse, 1);
+            EXPECT_EQ(delegate.mReceivedAttributePaths[0].mEndpointId, chip::Test::kMockEndpoint2);
+            EXPECT_EQ(delegate.mReceivedAttributePaths[0].mClusterId, chip::Test::MockClusterId(3));
+            EXPECT_EQ(delegate.mReceivedAttributePaths[0].mAttributeId, chip::Test::MockAttributeId(1));
+        }
+        EXPECT_EQ(engine->GetReportingEngine().GetSharedAttributeReportCount(), sharedReports + 1);
+    }
+
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+void TestReadInteraction::SubscribeToMockAttribute(ReadClient & aReadClient, AttributeId aAttributeId)
+{
+    auto attributePathParams            = std::make_unique<chip::app::AttributePathParams[]>(1);
+    attributePathParams[0].mEndpointId  = chip::Test::kMockEndpoint2;
+    attributePathParams[0].mClusterId   = chip::Test::MockClusterId(3);
+    attributePathParams[0].mAttributeId = aAttributeId;
+
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams.release();
+    readPrepareParams.mAttributePathParamsListSize = 1;
+    readPrepareParams.mMinIntervalFloorSeconds     = 0;
+    readPrepareParams.mMaxIntervalCeilingSeconds   = 60;
+    readPrepareParams.mKeepSubscriptions           = true;
+
+    EXPECT_EQ(aReadClient.SendAutoResubscribeRequest(std::move(readPrepareParams)), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+}
+
+// With a single report slot left, the subscription whose max interval ended reports first, even though it comes later in the
+// handler pool, and its report is counted as an overrun.
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestSubscriptionReportsEarliestDeadlineFirst)
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestSubscriptionReportsEarliestDeadlineFirst)
+void TestReadInteraction::TestSubscriptionReportsEarliestDeadlineFirst()
+{
+    MockInteractionModelApp laterDelegate;
+    MockInteractionModelApp earlierDelegate;
+    auto * engine                       = chip::app::InteractionModelEngine::GetInstance();
+    reporting::Engine & reportingEngine = engine->GetReportingEngine();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    // Leave room to move a max interval into the past.
+    gMockClock.AdvanceMonotonic(Seconds16(3600));
+
+    {
+        app::ReadClient laterClient(engine, &GetExchangeManager(), laterDelegate,
+                                    chip::app::ReadClient::InteractionType::Subscribe);
+        app::ReadClient earlierClient(engine, &GetExchangeManager(), earlierDelegate,
+                                      chip::app::ReadClient::InteractionType::Subscribe);
+        SubscribeToMockAttribute(laterClient, chip::Test::MockAttributeId(1));
+        SubscribeToMockAttribute(earlierClient, chip::Test::MockAttributeId(2));
+        EXPECT_TRUE(laterDelegate.mGotReport);
+        EXPECT_TRUE(earlierDelegate.mGotReport);
+        ASSERT_EQ(engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe), 2u);
+
+        ReadHandler * laterHandler   = engine->ActiveHandlerAt(0);
+        ReadHandler * earlierHandler = engine->ActiveHandlerAt(1);
+        ASSERT_NE(laterHandler, nullptr);
+        ASSERT_NE(earlierHandler, nullptr);
+
+        // The max interval of the subscription last in the pool ended 5 seconds ago, both subscriptions have changes to report.
+        uint16_t minInterval, maxInterval;
+        earlierHandler->GetReportingIntervals(minInterval, maxInterval);
+        gReportScheduler->GetReadHandlerNode(earlierHandler)
+            ->SetIntervalTimeStamps(earlierHandler, gMockClock.GetMonotonicTimestamp() - Seconds16(maxInterval) - Seconds16(5));
+        EXPECT_EQ(reportingEngine.SetDirty(AttributePathParams(chip::Test::kMockEndpoint2, chip::Test::MockClusterId(3),
+                                                               chip::Test::MockAttributeId(1))),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(reportingEngine.SetDirty(AttributePathParams(chip::Test::kMockEndpoint2, chip::Test::MockClusterId(3),
+                                                               chip::Test::MockAttributeId(2))),
+                  CHIP_NO_ERROR);
+
+        const uint32_t overruns             = reportingEngine.GetMaxIntervalOverrunCount();
+        reportingEngine.mNumReportsInFlight = CHIP_IM_MAX_REPORTS_IN_FLIGHT - 1;
+        reportingEngine.Run();
+
+        EXPECT_TRUE(earlierHandler->IsAwaitingReportResponse());
+        EXPECT_FALSE(laterHandler->IsAwaitingReportResponse());
+        EXPECT_EQ(reportingEngine.GetNumReportsInFlight(), static_cast<uint32_t>(CHIP_IM_MAX_REPORTS_IN_FLIGHT));
+        EXPECT_EQ(reportingEngine.GetMaxIntervalOverrunCount(), overruns + 1);
+
+        // Free the slots taken above, the later subscription reports once the scheduler runs the engine again.
+        reportingEngine.mNumReportsInFlight -= CHIP_IM_MAX_REPORTS_IN_FLIGHT - 1;
+        laterDelegate.mGotReport   = false;
+        earlierDelegate.mGotReport = false;
+
+        DrainAndServiceIO();
+
+        EXPECT_TRUE(earlierDelegate.mGotReport);
+        EXPECT_TRUE(laterDelegate.mGotReport);
+        EXPECT_EQ(reportingEngine.GetNumReportsInFlight(), 0u);
+        EXPECT_EQ(reportingEngine.GetMaxIntervalOverrunCount(), overruns + 1);
+    }
+
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+// With a limit of one report in flight per peer, a run sends a single report to Bob and the other subscription of Bob reports
+// once that report is acknowledged.
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestSubscriptionReportsPerPeerLimit)
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestSubscriptionReportsPerPeerLimit)
+void TestReadInteraction::TestSubscriptionReportsPerPeerLimit()
+{
+    MockInteractionModelApp delegates[2];
+    auto * engine                       = chip::app::InteractionModelEngine::GetInstance();
+    reporting::Engine & reportingEngine = engine->GetReportingEngine();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    {
+        app::ReadClient readClient0(engine, &GetExchangeManager(), delegates[0], chip::app::ReadClient::InteractionType::Subscribe);
+        app::ReadClient readClient1(engine, &GetExchangeManager(), delegates[1], chip::app::ReadClient::InteractionType::Subscribe);
+        SubscribeToMockAttribute(readClient0, chip::Test::MockAttributeId(1));
+        SubscribeToMockAttribute(readClient1, chip::Test::MockAttributeId(2));
+        ASSERT_EQ(engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe), 2u);
+        ReadHandler * handlers[] = { engine->ActiveHandlerAt(0), engine->ActiveHandlerAt(1) };
+        ASSERT_NE(handlers[0], nullptr);
+        ASSERT_NE(handlers[1], nullptr);
+
+        for (auto & delegate : delegates)
+        {
+            delegate.mGotReport = false;
+        }
+        EXPECT_EQ(reportingEngine.SetDirty(AttributePathParams(chip::Test::kMockEndpoint2, chip::Test::MockClusterId(3),
+                                                               chip::Test::MockAttributeId(1))),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(reportingEngine.SetDirty(AttributePathParams(chip::Test::kMockEndpoint2, chip::Test::MockClusterId(3),
+                                                               chip::Test::MockAttributeId(2))),
+                  CHIP_NO_ERROR);
+
+        reportingEngine.SetMaxReportsInFlightPerPeer(1);
+        reportingEngine.Run();
+
+        EXPECT_EQ(reportingEngine.GetNumReportsInFlight(), 1u);
+        EXPECT_NE(handlers[0]->IsAwaitingReportResponse(), handlers[1]->IsAwaitingReportResponse());
+        EXPECT_TRUE(reportingEngine.mHandlersWaitingForPeer);
+
+        DrainAndServiceIO();
+
+        EXPECT_TRUE(delegates[0].mGotReport);
+        EXPECT_TRUE(delegates[1].mGotReport);
+        EXPECT_EQ(reportingEngine.GetNumReportsInFlight(), 0u);
+        EXPECT_FALSE(reportingEngine.mHandlersWaitingForPeer);
+        reportingEngine.SetMaxReportsInFlightPerPeer(CHIP_IM_MAX_REPORTS_IN_FLIGHT_PER_PEER);
+    }
+
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 // Verify that subscription can be shut down just after receiving SUBSCRIBE RESPONSE,
 // before receiving any subsequent REPORT DATA.
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestSubscribeEarlyShutdown)
@@ -4842,6 +5063,96 @@ void TestReadInteraction::TestSubscribeInvalidateFabric()
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+TEST_F_FROM_FIXTURE(TestReadInteraction, TestReadClientSubscriptionIndex)
+{
+    // Enough read clients to make the engine grow its index a few times.
+    constexpr size_t kNumReadClients = 1000;
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    auto peerFor = [](size_t i) { return ScopedNodeId(static_cast<NodeId>(0x1000 + i / 2), static_cast<FabricIndex>(1 + i % 2)); };
+
+    std::unique_ptr<ReadClient> readClients[kNumReadClients];
+    for (size_t i = 0; i < kNumReadClients; i++)
+    {
+        readClients[i] =
+            std::make_unique<ReadClient>(engine, &GetExchangeManager(), delegate, ReadClient::InteractionType::Subscribe);
+        readClients[i]->SetPeer(peerFor(i));
+        readClients[i]->mSubscriptionId = static_cast<SubscriptionId>(i);
+    }
+    EXPECT_EQ(engine->GetNumActiveReadClients(), kNumReadClients);
+
+    for (size_t i = 0; i < kNumReadClients; i++)
+    {
+        EXPECT_TRUE(engine->InActiveReadClientList(readClients[i].get()));
+    }
+
+    // Subscription ids only match on their own peer.
+    EXPECT_EQ(engine->ShutdownSubscription(peerFor(1), 0), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(engine->ShutdownSubscription(peerFor(kNumReadClients), 0), CHIP_ERROR_KEY_NOT_FOUND);
+
+    EXPECT_EQ(engine->ShutdownSubscription(peerFor(kNumReadClients - 1), kNumReadClients - 1), CHIP_NO_ERROR);
+    EXPECT_FALSE(readClients[kNumReadClients - 1]->IsMatchingSubscriptionId(kNumReadClients - 1));
+
+    // Moving a read client to another peer keeps it reachable through its new peer only.
+    readClients[10]->SetPeer(peerFor(kNumReadClients));
+    EXPECT_TRUE(engine->InActiveReadClientList(readClients[10].get()));
+    EXPECT_EQ(engine->ShutdownSubscription(peerFor(10), 10), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(engine->ShutdownSubscription(peerFor(kNumReadClients), 10), CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < kNumReadClients; i += 2)
+    {
+        readClients[i].reset();
+    }
+    EXPECT_EQ(engine->GetNumActiveReadClients(), kNumReadClients / 2);
+    for (size_t i = 1; i < kNumReadClients; i += 2)
+    {
+        EXPECT_TRUE(engine->InActiveReadClientList(readClients[i].get()));
+    }
+
+    for (auto & readClient : readClients)
+    {
+        readClient.reset();
+    }
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+}
+
+TEST_F_FROM_FIXTURE(TestReadInteraction, TestReadClientRemovalScaling)
+{
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    // The time to remove a read client should not depend on the number of active read clients. They are removed
+    // oldest first, which are the last ones of the list.
+    for (size_t numReadClients : { 10u, 1000u, 50000u })
+    {
+        std::vector<std::unique_ptr<ReadClient>> readClients(numReadClients);
+        for (size_t i = 0; i < numReadClients; i++)
+        {
+            readClients[i] =
+                std::make_unique<ReadClient>(engine, &GetExchangeManager(), delegate, ReadClient::InteractionType::Subscribe);
+            readClients[i]->SetPeer(ScopedNodeId(static_cast<NodeId>(0x1000 + i), 1));
+        }
+        EXPECT_EQ(engine->GetNumActiveReadClients(), numReadClients);
+
+        auto start = std::chrono::steady_clock::now();
+        for (auto & readClient : readClients)
+        {
+            readClient.reset();
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        ChipLogProgress(DataManagement, "Removing %u read clients: %u ns on average", static_cast<unsigned>(numReadClients),
+                        static_cast<unsigned>(elapsed.count() / static_cast<int64_t>(numReadClients)));
+        EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    }
+
+    engine->Shutdown();
+}
+
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestShutdownSubscription)
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestShutdownSubscription)
 void TestReadInteraction::TestShutdownSubscription()
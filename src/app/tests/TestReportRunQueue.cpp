@@ -0,0 +1,403 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/ReportRunQueue.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <pw_unit_test/framework.h>
+
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+using chip::app::reporting::ReportRunQueue;
+using chip::app::reporting::ServeReportRun;
+using Milliseconds64 = System::Clock::Milliseconds64;
+using Timestamp      = System::Clock::Timestamp;
+
+struct TestHandler
+{
+    int id;
+};
+
+TEST(TestReportRunQueue, PopsEarliestDeadlineFirst)
+{
+    TestHandler handlers[4] = { { 0 }, { 1 }, { 2 }, { 3 } };
+    ReportRunQueue<TestHandler, 4> queue;
+
+    queue.Offer(&handlers[0], Timestamp(300));
+    queue.Offer(&handlers[1], Timestamp(100));
+    queue.Offer(&handlers[2], Timestamp(300));
+    queue.Offer(&handlers[3], Timestamp(200));
+    EXPECT_FALSE(queue.IsTruncated());
+
+    Timestamp deadline;
+    EXPECT_EQ(queue.Pop(&deadline), &handlers[1]);
+    EXPECT_EQ(deadline, Timestamp(100));
+    EXPECT_EQ(queue.Pop(), &handlers[3]);
+    // Equal deadlines keep the order they were offered in.
+    EXPECT_EQ(queue.Pop(), &handlers[0]);
+    EXPECT_EQ(queue.Pop(), &handlers[2]);
+    EXPECT_EQ(queue.Pop(), nullptr);
+}
+
+TEST(TestReportRunQueue, KeepsEarliestDeadlinesWhenFull)
+{
+    TestHandler handlers[4] = { { 0 }, { 1 }, { 2 }, { 3 } };
+    ReportRunQueue<TestHandler, 2> queue;
+
+    queue.Offer(&handlers[0], Timestamp(300));
+    queue.Offer(&handlers[1], Timestamp(200));
+    EXPECT_FALSE(queue.IsTruncated());
+    queue.Offer(&handlers[2], Timestamp(400));
+    EXPECT_TRUE(queue.IsTruncated());
+    queue.Offer(&handlers[3], Timestamp(100));
+
+    EXPECT_EQ(queue.Size(), 2u);
+    EXPECT_EQ(queue.Pop(), &handlers[3]);
+    EXPECT_EQ(queue.Pop(), &handlers[1]);
+
+    queue.Clear();
+    EXPECT_FALSE(queue.IsTruncated());
+}
+
+TEST(TestReportRunQueue, RemovesHandlers)
+{
+    TestHandler handlers[3] = { { 0 }, { 1 }, { 2 } };
+    ReportRunQueue<TestHandler, 4> queue;
+
+    queue.Offer(&handlers[0], Timestamp(100));
+    queue.Offer(&handlers[1], Timestamp(200));
+    queue.Offer(&handlers[2], Timestamp(300));
+    queue.Remove(&handlers[1]);
+    queue.Remove(&handlers[1]);
+
+    EXPECT_EQ(queue.Size(), 2u);
+    EXPECT_EQ(queue.Pop(), &handlers[0]);
+    EXPECT_EQ(queue.Pop(), &handlers[2]);
+}
+
+// Run over handlers with a fixed deadline, each on a peer, recording the order reports are sent in.
+struct TestRun
+{
+    struct Handler
+    {
+        uint32_t peer;
+        Timestamp deadline;
+        bool served = false;
+    };
+
+    std::vector<Handler> handlers;
+    std::vector<uint32_t> reportsInFlightPerPeer;
+    std::vector<size_t> sent;
+    size_t reportSlots;
+    size_t collectCount = 0;
+
+    bool HasReportSlot() const { return sent.size() < reportSlots; }
+    template <typename Queue>
+    void CollectReportableHandlers(Queue & queue)
+    {
+        collectCount++;
+        for (auto & handler : handlers)
+        {
+            if (!handler.served)
+            {
+                queue.Offer(&handler, handler.deadline);
+            }
+        }
+    }
+    void MarkServed(Handler & handler) { handler.served = true; }
+    uint32_t GetNumReportsInFlightToPeer(const Handler & handler) { return reportsInFlightPerPeer[handler.peer]; }
+    CHIP_ERROR SendReport(Handler & handler, Timestamp deadline)
+    {
+        EXPECT_EQ(deadline, handler.deadline);
+        sent.push_back(static_cast<size_t>(&handler - handlers.data()));
+        reportsInFlightPerPeer[handler.peer]++;
+        return CHIP_NO_ERROR;
+    }
+};
+
+TEST(TestReportRunQueue, ServesEarliestDeadlineFirstAcrossCollections)
+{
+    TestRun run;
+    run.handlers               = { { 0, Timestamp(400) }, { 1, Timestamp(100) }, { 2, Timestamp(300) }, { 3, Timestamp(200) } };
+    run.reportsInFlightPerPeer = { 0, 0, 0, 0 };
+    run.reportSlots            = 4;
+
+    ReportRunQueue<TestRun::Handler, 2> queue;
+    bool waitingForPeer = true;
+    EXPECT_EQ(ServeReportRun(queue, run, 2, waitingForPeer), CHIP_NO_ERROR);
+
+    // The queue holds two handlers, the two others are collected once those are served.
+    EXPECT_EQ(run.sent, (std::vector<size_t>{ 1, 3, 2, 0 }));
+    EXPECT_EQ(run.collectCount, 2u);
+    EXPECT_FALSE(waitingForPeer);
+    EXPECT_EQ(queue.Size(), 0u);
+}
+
+TEST(TestReportRunQueue, ServeLimitsReportsPerPeer)
+{
+    TestRun run;
+    run.handlers               = { { 0, Timestamp(100) }, { 0, Timestamp(200) }, { 1, Timestamp(300) }, { 1, Timestamp(400) } };
+    run.reportsInFlightPerPeer = { 0, 1 };
+    run.reportSlots            = 4;
+
+    ReportRunQueue<TestRun::Handler, 4> queue;
+    bool waitingForPeer = false;
+    EXPECT_EQ(ServeReportRun(queue, run, 1, waitingForPeer), CHIP_NO_ERROR);
+
+    // Peer 0 takes a single report, peer 1 already had one in flight. Skipped handlers are not collected again by the run.
+    EXPECT_EQ(run.sent, (std::vector<size_t>{ 0 }));
+    EXPECT_TRUE(run.handlers[1].served);
+    EXPECT_TRUE(waitingForPeer);
+    EXPECT_EQ(run.collectCount, 1u);
+
+    // A limit no lower than the report slots never holds a report back.
+    run.sent.clear();
+    run.reportsInFlightPerPeer = { 4, 4 };
+    for (auto & handler : run.handlers)
+    {
+        handler.served = false;
+    }
+    EXPECT_EQ(ServeReportRun(queue, run, 4, waitingForPeer), CHIP_NO_ERROR);
+    EXPECT_EQ(run.sent, (std::vector<size_t>{ 0, 1, 2, 3 }));
+    EXPECT_FALSE(waitingForPeer);
+}
+
+//
+// Simulation of the reporting engine serving subscriptions, counting the reports sent more than a second past the max
+// interval of their subscription. It models what drives Engine::Run: the report slots, the intervals of the subscriptions and
+// how long their peers take to acknowledge reports.
+//
+class ReportingSimulation
+{
+public:
+    static constexpr size_t kMaxReportsInFlight = 4;
+
+    enum class Policy
+    {
+        kPoolOrder,             // handlers in pool order, resuming after the last one served
+        kEarliestDeadlineFirst, // handlers queued by the end of their max interval
+    };
+
+    ReportingSimulation(Policy policy, uint32_t maxReportsInFlightPerPeer) :
+        mPolicy(policy), mMaxReportsInFlightPerPeer(maxReportsInFlightPerPeer)
+    {}
+
+    // Subscribers are established at evenly spread times over their max interval. Chatty subscribers always have changes to
+    // report once their min interval has elapsed, the others only report at the end of their max interval.
+    void AddSubscribers(size_t count, uint32_t firstPeer, uint32_t peerCount, Milliseconds64 minInterval,
+                        Milliseconds64 maxInterval, Milliseconds64 roundTrip, bool chatty)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            Subscriber subscriber;
+            subscriber.peer         = firstPeer + static_cast<uint32_t>(i % peerCount);
+            subscriber.minInterval  = minInterval;
+            subscriber.maxInterval  = maxInterval;
+            subscriber.roundTrip    = roundTrip;
+            subscriber.chatty       = chatty;
+            subscriber.maxTimestamp = Timestamp(maxInterval.count() * (i + 1) / count);
+            mSubscribers.push_back(subscriber);
+            if (subscriber.peer >= mReportsInFlightPerPeer.size())
+            {
+                mReportsInFlightPerPeer.resize(subscriber.peer + 1);
+            }
+        }
+    }
+
+    void Simulate(Milliseconds64 duration)
+    {
+        for (Timestamp now = 0_ms64; now < duration; now += 50_ms64)
+        {
+            mNow = now;
+            for (auto & subscriber : mSubscribers)
+            {
+                if (subscriber.inFlight && subscriber.ackTimestamp <= now)
+                {
+                    subscriber.inFlight = false;
+                    mReportsInFlight--;
+                    mReportsInFlightPerPeer[subscriber.peer]--;
+                }
+            }
+            mPolicy == Policy::kPoolOrder ? RunPoolOrder() : RunEarliestDeadlineFirst();
+        }
+    }
+
+    uint32_t GetReportCount() const { return mReportCount; }
+    uint32_t GetOverrunCount() const { return mOverrunCount; }
+
+private:
+    struct Subscriber
+    {
+        uint32_t peer;
+        Milliseconds64 minInterval;
+        Milliseconds64 maxInterval;
+        Milliseconds64 roundTrip;
+        bool chatty;
+        Timestamp minTimestamp = 0_ms64;
+        Timestamp maxTimestamp = 0_ms64;
+        Timestamp ackTimestamp = 0_ms64;
+        bool inFlight          = false;
+        uint32_t lastRun       = 0;
+
+        bool IsReportable(Timestamp now) const { return !inFlight && now >= minTimestamp && (chatty || now >= maxTimestamp); }
+    };
+
+    // As the reporting engine did before handlers were ordered by deadline.
+    void RunPoolOrder()
+    {
+        size_t numHandled = 0;
+        while (mReportsInFlight < kMaxReportsInFlight && numHandled < mSubscribers.size())
+        {
+            Subscriber & subscriber = mSubscribers[mCursor % mSubscribers.size()];
+            if (subscriber.IsReportable(mNow))
+            {
+                Send(subscriber);
+            }
+            numHandled++;
+            mCursor++;
+        }
+    }
+
+    // Engine::Run, serving subscribers in place of ReadHandlers.
+    struct SimulationRun
+    {
+        ReportingSimulation & simulation;
+
+        bool HasReportSlot() const { return simulation.mReportsInFlight < kMaxReportsInFlight; }
+        void CollectReportableHandlers(ReportRunQueue<Subscriber, kMaxReportsInFlight> & queue)
+        {
+            for (auto & subscriber : simulation.mSubscribers)
+            {
+                if (subscriber.lastRun != simulation.mRunCount && subscriber.IsReportable(simulation.mNow))
+                {
+                    queue.Offer(&subscriber, subscriber.maxTimestamp);
+                }
+            }
+        }
+        void MarkServed(Subscriber & subscriber) { subscriber.lastRun = simulation.mRunCount; }
+        uint32_t GetNumReportsInFlightToPeer(const Subscriber & subscriber)
+        {
+            return simulation.mReportsInFlightPerPeer[subscriber.peer];
+        }
+        CHIP_ERROR SendReport(Subscriber & subscriber, Timestamp)
+        {
+            simulation.Send(subscriber);
+            return CHIP_NO_ERROR;
+        }
+    };
+
+    void RunEarliestDeadlineFirst()
+    {
+        SimulationRun run{ *this };
+        bool waitingForPeer;
+
+        mRunCount++;
+        EXPECT_EQ(ServeReportRun(mQueue, run, mMaxReportsInFlightPerPeer, waitingForPeer), CHIP_NO_ERROR);
+    }
+
+    void Send(Subscriber & subscriber)
+    {
+        if (mNow > subscriber.maxTimestamp + 1000_ms64)
+        {
+            mOverrunCount++;
+        }
+        mReportCount++;
+        mReportsInFlight++;
+        mReportsInFlightPerPeer[subscriber.peer]++;
+
+        subscriber.inFlight     = true;
+        subscriber.ackTimestamp = mNow + subscriber.roundTrip;
+        subscriber.minTimestamp = mNow + subscriber.minInterval;
+        subscriber.maxTimestamp = mNow + subscriber.maxInterval;
+    }
+
+    Policy mPolicy;
+    uint32_t mMaxReportsInFlightPerPeer;
+    std::vector<Subscriber> mSubscribers;
+    std::vector<uint32_t> mReportsInFlightPerPeer;
+    ReportRunQueue<Subscriber, kMaxReportsInFlight> mQueue;
+    Timestamp mNow          = 0_ms64;
+    size_t mReportsInFlight = 0;
+    size_t mCursor          = 0;
+    uint32_t mRunCount      = 0;
+    uint32_t mReportCount   = 0;
+    uint32_t mOverrunCount  = 0;
+};
+
+constexpr size_t kSubscriberCount = 500;
+
+// 100 subscriptions with constant changes come first in the handler pool, and take all the report slots they can. The 400
+// others only need a report every 30 seconds, 13 per second in total out of the 20 that 4 report slots allow.
+void AddBusyAndQuietSubscribers(ReportingSimulation & simulation)
+{
+    constexpr size_t kBusyCount = 100;
+    simulation.AddSubscribers(kBusyCount, 0, kBusyCount, 1000_ms64, 30000_ms64, 200_ms64, true);
+    simulation.AddSubscribers(kSubscriberCount - kBusyCount, kBusyCount, kSubscriberCount - kBusyCount, 0_ms64, 30000_ms64,
+                              200_ms64, false);
+}
+
+TEST(TestReportRunQueue, SimulatedSubscribersMeetMaxInterval)
+{
+    ReportingSimulation poolOrder(ReportingSimulation::Policy::kPoolOrder, ReportingSimulation::kMaxReportsInFlight);
+    AddBusyAndQuietSubscribers(poolOrder);
+    poolOrder.Simulate(300000_ms64);
+
+    ReportingSimulation earliestDeadlineFirst(ReportingSimulation::Policy::kEarliestDeadlineFirst,
+                                              ReportingSimulation::kMaxReportsInFlight);
+    AddBusyAndQuietSubscribers(earliestDeadlineFirst);
+    earliestDeadlineFirst.Simulate(300000_ms64);
+
+    ChipLogProgress(DataManagement, "%u subscribers, max interval overruns: pool order %" PRIu32 "/%" PRIu32
+                    " reports, earliest deadline first %" PRIu32 "/%" PRIu32 " reports",
+                    static_cast<unsigned>(kSubscriberCount), poolOrder.GetOverrunCount(), poolOrder.GetReportCount(),
+                    earliestDeadlineFirst.GetOverrunCount(), earliestDeadlineFirst.GetReportCount());
+
+    EXPECT_GT(poolOrder.GetOverrunCount(), 0u);
+    EXPECT_EQ(earliestDeadlineFirst.GetOverrunCount(), 0u);
+}
+
+// A single peer slow to acknowledge has 5 busy subscriptions, the 300 others need 10 reports per second.
+void AddSlowPeerSubscribers(ReportingSimulation & simulation)
+{
+    constexpr size_t kSlowCount = 5;
+    simulation.AddSubscribers(kSlowCount, 0, 1, 1000_ms64, 30000_ms64, 5000_ms64, true);
+    simulation.AddSubscribers(300, 1, 300, 0_ms64, 30000_ms64, 200_ms64, false);
+}
+
+TEST(TestReportRunQueue, SimulatedSlowPeerIsLimited)
+{
+    ReportingSimulation unlimited(ReportingSimulation::Policy::kEarliestDeadlineFirst, ReportingSimulation::kMaxReportsInFlight);
+    AddSlowPeerSubscribers(unlimited);
+    unlimited.Simulate(300000_ms64);
+
+    ReportingSimulation limited(ReportingSimulation::Policy::kEarliestDeadlineFirst, 1);
+    AddSlowPeerSubscribers(limited);
+    limited.Simulate(300000_ms64);
+
+    ChipLogProgress(DataManagement, "Slow peer, max interval overruns: unlimited %" PRIu32 "/%" PRIu32 " reports, limited %" PRIu32
+                    "/%" PRIu32 " reports",
+                    unlimited.GetOverrunCount(), unlimited.GetReportCount(), limited.GetOverrunCount(), limited.GetReportCount());
+
+    EXPECT_GT(unlimited.GetOverrunCount(), 0u);
+    EXPECT_EQ(limited.GetOverrunCount(), 0u);
+}
+
+} // namespace
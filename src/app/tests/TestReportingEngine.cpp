@@ -98,6 +98,7 @@ public:
     void TestBuildAndSendSingleReportData();
     void TestMergeOverlappedAttributePath();
     void TestMergeAttributePathWhenDirtySetPoolExhausted();
+    void TestReportConfirmRunsHandlersWaitingForPeer();
 
 private:
     chip::app::DataModel::Provider * mOldProvider = nullptr;
@@ -352,6 +353,34 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
 
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestReportConfirmRunsHandlersWaitingForPeer)
+{
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
+              CHIP_NO_ERROR);
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    DrainAndServiceIO();
+
+    // A report slot frees up while no handler waits for one: nothing to run.
+    engine.mNumReportsInFlight = 1;
+    engine.OnReportConfirm();
+    EXPECT_EQ(engine.GetNumReportsInFlight(), 0u);
+    EXPECT_FALSE(engine.IsRunScheduled());
+
+    // Handlers held back by the limit of reports in flight to their peer run again once a report is acknowledged.
+    engine.mNumReportsInFlight     = 1;
+    engine.mHandlersWaitingForPeer = true;
+    engine.OnReportConfirm();
+    EXPECT_EQ(engine.GetNumReportsInFlight(), 0u);
+    EXPECT_TRUE(engine.IsRunScheduled());
+
+    DrainAndServiceIO();
+    EXPECT_FALSE(engine.IsRunScheduled());
+    EXPECT_FALSE(engine.mHandlersWaitingForPeer);
+
+    InteractionModelEngine::GetInstance()->Shutdown();
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -814,6 +814,18 @@ public:
 
     Credentials::DeviceAttestationVerifier * GetDeviceAttestationVerifier() const { return mDeviceAttestationVerifier; }
 
+    /**
+     * Set the commissioning delegate driving the commissioning started by PairDevice and Commission, in place of the one given
+     * at Init. nullptr selects the built-in AutoCommissioner.
+     *
+     * Must not be called while a device is being commissioned.
+     */
+    void SetDefaultCommissioner(CommissioningDelegate * defaultCommissioner)
+    {
+        mDefaultCommissioner = defaultCommissioner == nullptr ? &mAutoCommissioner : defaultCommissioner;
+    }
+    CommissioningDelegate * GetDefaultCommissioner() const { return mDefaultCommissioner; }
+
     Optional<CommissioningParameters> GetCommissioningParameters()
     {
         return mDefaultCommissioner == nullptr ? NullOptional : MakeOptional(mDefaultCommissioner->GetCommissioningParameters());
@@ -29,6 +29,7 @@
 #include <app/TimerDelegates.h>
 #include <app/reporting/ReportSchedulerImpl.h>
 #include <app/util/DataModelHandler.h>
+#include <credentials/CHIPCertDecodeCache.h>
 #include <lib/core/ErrorStr.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 
@@ -314,6 +315,9 @@ CHIP_ERROR DeviceControllerFactory::InitSystemState(FactoryInitParams params)
     ReturnErrorOnFailure(interactionModelEngine->Init(stateParams.exchangeMgr, stateParams.fabricTable, stateParams.reportScheduler,
                                                       stateParams.caseSessionManager));
 
+    // Shared with a Server in the same process, released by DeviceControllerSystemState::Shutdown.
+    ReturnErrorOnFailure(Credentials::RetainSharedChipCertificateDecodeCache());
+
     // store the system state
     mSystemState = chip::Platform::New<DeviceControllerSystemState>(std::move(stateParams));
     mSystemState->SetTempFabricTable(tempFabricTable, params.enableServerInteractions);
@@ -602,6 +606,8 @@ void DeviceControllerSystemState::Shutdown()
         mFabrics = nullptr;
     }
 
+    Credentials::ReleaseSharedChipCertificateDecodeCache();
+
 #if CONFIG_DEVICE_LAYER
     //
     // We can safely call PlatformMgr().Shutdown(), which like DeviceController::Shutdown(),
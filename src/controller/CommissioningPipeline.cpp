@@ -0,0 +1,381 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/CommissioningPipeline.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+
+namespace chip {
+namespace Controller {
+
+CommissioningPipeline::Phase CommissioningPipeline::PhaseOf(CommissioningStage aStage)
+{
+    switch (aStage)
+    {
+    case CommissioningStage::kSecurePairing:
+        return Phase::kPairing;
+    case CommissioningStage::kSendPAICertificateRequest:
+    case CommissioningStage::kSendDACCertificateRequest:
+    case CommissioningStage::kSendAttestationRequest:
+    case CommissioningStage::kAttestationVerification:
+    case CommissioningStage::kAttestationRevocationCheck:
+        return Phase::kAttestation;
+    case CommissioningStage::kSendOpCertSigningRequest:
+    case CommissioningStage::kValidateCSR:
+    case CommissioningStage::kGenerateNOCChain:
+    case CommissioningStage::kSendTrustedRootCert:
+    case CommissioningStage::kSendNOC:
+        return Phase::kCredentials;
+    case CommissioningStage::kScanNetworks:
+    case CommissioningStage::kWiFiNetworkSetup:
+    case CommissioningStage::kThreadNetworkSetup:
+    case CommissioningStage::kFailsafeBeforeWiFiEnable:
+    case CommissioningStage::kFailsafeBeforeThreadEnable:
+    case CommissioningStage::kWiFiNetworkEnable:
+    case CommissioningStage::kThreadNetworkEnable:
+        return Phase::kNetworkSetup;
+    default:
+        // Including kCleanup, so that failing devices always get through.
+        return Phase::kOther;
+    }
+}
+
+CHIP_ERROR CommissioningPipeline::Lane::PerformStep(CommissioningStage nextStage)
+{
+    return mPipeline.RequestStep(*this, nextStage);
+}
+
+void CommissioningPipeline::Lane::OnPairingComplete(CHIP_ERROR error)
+{
+    mPipeline.OnPairingComplete(*this, error);
+}
+
+void CommissioningPipeline::Lane::OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error)
+{
+    mPipeline.OnCommissioningComplete(*this, deviceId, error);
+}
+
+void CommissioningPipeline::Lane::FailStep(CommissioningStage aStage, CHIP_ERROR aError)
+{
+    // The commissioner only cleans up after the steps it was asked to perform from its own callbacks.
+    CompletionStatus status;
+    status.err         = aError;
+    status.failedStage = MakeOptional(aStage);
+    mParams.SetCompletionStatus(status);
+
+    mPipeline.EnterPhase(*this, Phase::kOther);
+    if (mPipeline.PerformStep(*this, CommissioningStage::kCleanup) != CHIP_NO_ERROR)
+    {
+        mPipeline.FinishDevice(*this, aError, false);
+    }
+}
+
+CommissioningPipeline::~CommissioningPipeline()
+{
+    if (mDispatchScheduled)
+    {
+        DeviceLayer::SystemLayer().CancelTimer(DispatchTimerCallback, this);
+    }
+
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        DeviceCommissioner & commissioner = mLanes[i]->GetDeviceCommissioner();
+        if (commissioner.GetPairingDelegate() == mLanes[i])
+        {
+            commissioner.RegisterPairingDelegate(mLanes[i]->mPreviousPairingDelegate);
+        }
+        if (commissioner.GetDefaultCommissioner() == mLanes[i])
+        {
+            commissioner.SetDefaultCommissioner(mLanes[i]->mPreviousDefaultCommissioner);
+        }
+        Platform::Delete(mLanes[i]);
+    }
+}
+
+CHIP_ERROR CommissioningPipeline::AddCommissioner(DeviceCommissioner * aCommissioner)
+{
+    VerifyOrReturnError(aCommissioner != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!mInProgress, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mLaneCount < kMaxLanes, CHIP_ERROR_NO_MEMORY);
+
+    Lane * lane = Platform::New<Lane>(*this, *aCommissioner);
+    VerifyOrReturnError(lane != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    lane->mPreviousPairingDelegate     = aCommissioner->GetPairingDelegate();
+    lane->mPreviousDefaultCommissioner = aCommissioner->GetDefaultCommissioner();
+    aCommissioner->RegisterPairingDelegate(lane);
+    aCommissioner->SetDefaultCommissioner(lane);
+
+    mLanes[mLaneCount++] = lane;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CommissioningPipeline::Start(Span<const Device> aDevices, const Params & aParams)
+{
+    VerifyOrReturnError(mDelegate != nullptr && mLaneCount > 0, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!mInProgress, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(aParams.maxPairing > 0 && aParams.maxAttestation > 0 && aParams.maxCredentials > 0 &&
+                            aParams.maxNetworkSetup > 0,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    mDevices         = aDevices;
+    mParams          = aParams;
+    mNextDevice      = 0;
+    mDevicesInFlight = 0;
+    mResult          = Result();
+    mInProgress      = true;
+    for (auto & count : mDevicesInPhase)
+    {
+        count = 0;
+    }
+
+    ChipLogProgress(Controller, "Commissioning %u devices with %u commissioners", static_cast<unsigned>(mDevices.size()),
+                    static_cast<unsigned>(mLaneCount));
+
+    Dispatch();
+    return CHIP_NO_ERROR;
+}
+
+size_t CommissioningPipeline::GetLimit(Phase aPhase) const
+{
+    switch (aPhase)
+    {
+    case Phase::kPairing:
+        return mParams.maxPairing;
+    case Phase::kAttestation:
+        return mParams.maxAttestation;
+    case Phase::kCredentials:
+        return mParams.maxCredentials;
+    case Phase::kNetworkSetup:
+        return mParams.maxNetworkSetup;
+    default:
+        return SIZE_MAX;
+    }
+}
+
+void CommissioningPipeline::EnterPhase(Lane & aLane, Phase aPhase)
+{
+    mDevicesInPhase[static_cast<size_t>(aLane.mPhase)]--;
+    aLane.mPhase = aPhase;
+    mDevicesInPhase[static_cast<size_t>(aPhase)]++;
+}
+
+CommissioningPipeline::Lane * CommissioningPipeline::NextWaitingLane()
+{
+    Lane * next = nullptr;
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        Lane * lane = mLanes[i];
+        if (lane->mWaiting && HasRoom(PhaseOf(lane->mWaitingStage)) &&
+            (next == nullptr || lane->mWaitingSequence < next->mWaitingSequence))
+        {
+            next = lane;
+        }
+    }
+    return next;
+}
+
+CommissioningPipeline::Lane * CommissioningPipeline::NextIdleLane()
+{
+    for (size_t i = 0; i < mLaneCount; i++)
+    {
+        if (!mLanes[i]->mBusy)
+        {
+            return mLanes[i];
+        }
+    }
+    return nullptr;
+}
+
+CHIP_ERROR CommissioningPipeline::RequestStep(Lane & aLane, CommissioningStage aStage)
+{
+    const Phase phase = PhaseOf(aStage);
+    if (!aLane.mBusy || phase == aLane.mPhase)
+    {
+        return PerformStep(aLane, aStage);
+    }
+
+    // Leaving the current phase makes room for another device.
+    EnterPhase(aLane, Phase::kOther);
+
+    if (!HasRoom(phase))
+    {
+        ChipLogDetail(Controller, "Holding back %s for device " ChipLogFormatX64, StageToString(aStage),
+                      ChipLogValueX64(mDevices[aLane.mDeviceIndex].nodeId));
+        aLane.mWaiting         = true;
+        aLane.mWaitingStage    = aStage;
+        aLane.mWaitingSequence = mNextWaitingSequence++;
+        Dispatch();
+        return CHIP_NO_ERROR;
+    }
+
+    EnterPhase(aLane, phase);
+    CHIP_ERROR err = PerformStep(aLane, aStage);
+    Dispatch();
+    return err;
+}
+
+void CommissioningPipeline::OnPairingComplete(Lane & aLane, CHIP_ERROR aError)
+{
+    // The commissioner may already have moved on to the first commissioning step.
+    VerifyOrReturn(aLane.mBusy && aLane.mPhase == Phase::kPairing);
+
+    if (aError != CHIP_NO_ERROR)
+    {
+        FinishDevice(aLane, aError, true);
+        return;
+    }
+
+    EnterPhase(aLane, Phase::kOther);
+    Dispatch();
+}
+
+void CommissioningPipeline::OnCommissioningComplete(Lane & aLane, NodeId aNodeId, CHIP_ERROR aError)
+{
+    VerifyOrReturn(aLane.mBusy && mDevices[aLane.mDeviceIndex].nodeId == aNodeId);
+    FinishDevice(aLane, aError, false);
+}
+
+void CommissioningPipeline::Dispatch()
+{
+    // Steps may complete before the calls performing them return: the outermost call does the work.
+    VerifyOrReturn(!mDispatching);
+    mDispatching = true;
+
+    bool progress = true;
+    while (progress)
+    {
+        progress = false;
+
+        // Devices already being commissioned go first, their fail-safe is running.
+        Lane * lane = NextWaitingLane();
+        if (lane != nullptr)
+        {
+            const CommissioningStage stage = lane->mWaitingStage;
+            lane->mWaiting                 = false;
+            EnterPhase(*lane, PhaseOf(stage));
+
+            CHIP_ERROR err = PerformStep(*lane, stage);
+            if (err != CHIP_NO_ERROR)
+            {
+                ChipLogError(Controller, "Failed to perform %s for device " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                             StageToString(stage), ChipLogValueX64(mDevices[lane->mDeviceIndex].nodeId), err.Format());
+                lane->FailStep(stage, err);
+            }
+            progress = true;
+            continue;
+        }
+
+        if (!mInProgress || mNextDevice >= mDevices.size() || !HasRoom(Phase::kPairing))
+        {
+            break;
+        }
+
+        lane = NextIdleLane();
+        if (lane == nullptr)
+        {
+            break;
+        }
+
+        const size_t deviceIndex = mNextDevice++;
+        lane->mBusy              = true;
+        lane->mDeviceIndex       = deviceIndex;
+        lane->mPhase             = Phase::kPairing;
+        mDevicesInPhase[static_cast<size_t>(Phase::kPairing)]++;
+        mDevicesInFlight++;
+
+        CHIP_ERROR err = StartPairing(*lane, mDevices[deviceIndex]);
+        if (err != CHIP_NO_ERROR && lane->mBusy && lane->mDeviceIndex == deviceIndex)
+        {
+            FinishDevice(*lane, err, true);
+        }
+        progress = true;
+    }
+
+    mDispatching = false;
+
+    if (mInProgress && mNextDevice == mDevices.size() && mDevicesInFlight == 0)
+    {
+        mInProgress = false;
+        ChipLogProgress(Controller, "Commissioning done: %u devices succeeded, %u failed (%u without PASE)",
+                        static_cast<unsigned>(mResult.succeeded), static_cast<unsigned>(mResult.failed),
+                        static_cast<unsigned>(mResult.pairingFailures));
+        // May destroy or restart this object.
+        mDelegate->OnDone(*this);
+    }
+}
+
+void CommissioningPipeline::FinishDevice(Lane & aLane, CHIP_ERROR aError, bool aPairingFailure)
+{
+    const size_t deviceIndex = aLane.mDeviceIndex;
+
+    mDevicesInPhase[static_cast<size_t>(aLane.mPhase)]--;
+    aLane.mPhase   = Phase::kOther;
+    aLane.mBusy    = false;
+    aLane.mWaiting = false;
+    mDevicesInFlight--;
+
+    if (aError == CHIP_NO_ERROR)
+    {
+        mResult.succeeded++;
+    }
+    else
+    {
+        ChipLogError(Controller, "Commissioning of device " ChipLogFormatX64 " failed: %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(mDevices[deviceIndex].nodeId), aError.Format());
+        mResult.failed++;
+        if (aPairingFailure)
+        {
+            mResult.pairingFailures++;
+        }
+    }
+
+    mDelegate->OnDeviceDone(*this, deviceIndex, aError);
+    ScheduleDispatch();
+}
+
+CHIP_ERROR CommissioningPipeline::StartPairing(Lane & aLane, const Device & aDevice)
+{
+    return aLane.GetDeviceCommissioner().PairDevice(aDevice.nodeId, aDevice.setUpCode, mParams.commissioningParameters,
+                                                    mParams.discoveryType);
+}
+
+void CommissioningPipeline::ScheduleDispatch()
+{
+    VerifyOrReturn(!mDispatchScheduled);
+
+    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(System::Clock::kZero, DispatchTimerCallback, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to schedule commissioning of the next device: %" CHIP_ERROR_FORMAT, err.Format());
+        Dispatch();
+        return;
+    }
+    mDispatchScheduled = true;
+}
+
+void CommissioningPipeline::DispatchTimerCallback(System::Layer * aLayer, void * aAppState)
+{
+    auto * self              = static_cast<CommissioningPipeline *>(aAppState);
+    self->mDispatchScheduled = false;
+    self->Dispatch();
+}
+
+} // namespace Controller
+} // namespace chip
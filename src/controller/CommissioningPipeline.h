@@ -0,0 +1,251 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <controller/AutoCommissioner.h>
+#include <controller/CHIPDeviceController.h>
+#include <controller/CommissioningDelegate.h>
+#include <controller/DevicePairingDelegate.h>
+#include <controller/SetUpCodePairer.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/NodeId.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * Commissions many devices at once, e.g. on a factory line, with several DeviceCommissioner instances of the same fabric.
+ *
+ * A DeviceCommissioner commissions one device at a time, and most of the time of a commissioning is spent waiting for the
+ * device: PASE establishment, attestation, CSR and NOC issuance, network setup. The pipeline gives every commissioner (a lane)
+ * the next device of the list as soon as it is done with the previous one, so that these phases overlap across devices.
+ *
+ * Each phase is limited to a number of devices at once, to bound the load it puts on the controller (the PASE computations),
+ * on the attestation verifier and the NOC issuer, and on the network being joined. A device whose next step belongs to a full
+ * phase waits for a device to leave that phase, devices that waited the longest going first. Steps outside these phases are
+ * never held back. A waiting device keeps its fail-safe running, so the limits must let it through well within the fail-safe
+ * expiry of the commissioning parameters.
+ *
+ * The pipeline takes over the pairing delegate and the default commissioner of its commissioners until it is destroyed. The
+ * commissioners must share the fabric and node id allocation of the caller (see permitMultiControllerFabrics); if they share
+ * an OperationalCredentialsDelegate issuing NOCs asynchronously, Params::maxCredentials must be 1 since the delegate only
+ * knows about the next node id to issue a NOC for.
+ *
+ * The pipeline, the device list, the buffers of the commissioning parameters and the Delegate must stay valid until
+ * Delegate::OnDone is called.
+ */
+class CommissioningPipeline
+{
+public:
+    static constexpr size_t kMaxLanes = CHIP_CONFIG_CONTROLLER_MAX_COMMISSIONING_PIPELINE_LANES;
+
+    struct Device
+    {
+        NodeId nodeId;
+        const char * setUpCode; // QR code or manual pairing code
+    };
+
+    struct Params
+    {
+        // Devices at once in each phase. SIZE_MAX leaves a phase unlimited.
+        size_t maxPairing      = 2; // PASE establishment
+        size_t maxAttestation  = SIZE_MAX;
+        size_t maxCredentials  = SIZE_MAX; // CSR, NOC issuance and installation
+        size_t maxNetworkSetup = SIZE_MAX; // Network scan, setup and enabling
+
+        DiscoveryType discoveryType = DiscoveryType::kAll;
+        CommissioningParameters commissioningParameters;
+    };
+
+    struct Result
+    {
+        size_t succeeded       = 0;
+        size_t failed          = 0; // Including the devices PASE could not be established with
+        size_t pairingFailures = 0;
+    };
+
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        /**
+         * Called once per device, with the error that ended its pairing or its commissioning, if any.
+         */
+        virtual void OnDeviceDone(CommissioningPipeline & aPipeline, size_t aDeviceIndex, CHIP_ERROR aError) {}
+
+        /**
+         * Called once all devices are done. The pipeline may be destroyed or started again from this call.
+         */
+        virtual void OnDone(CommissioningPipeline & aPipeline) = 0;
+    };
+
+    enum class Phase : uint8_t
+    {
+        kPairing,
+        kAttestation,
+        kCredentials,
+        kNetworkSetup,
+        kOther, // Never limited
+    };
+
+    static constexpr size_t kPhaseCount = static_cast<size_t>(Phase::kOther) + 1;
+
+    static Phase PhaseOf(CommissioningStage aStage);
+
+    /**
+     * A commissioner of the pipeline, commissioning one device at a time.
+     */
+    class Lane : public AutoCommissioner, public DevicePairingDelegate
+    {
+    public:
+        Lane(CommissioningPipeline & aPipeline, DeviceCommissioner & aCommissioner) :
+            mPipeline(aPipeline), mCommissioner(aCommissioner)
+        {}
+
+        DeviceCommissioner & GetDeviceCommissioner() { return mCommissioner; }
+        bool IsBusy() const { return mBusy; }
+        size_t GetDeviceIndex() const { return mDeviceIndex; }
+        Phase GetPhase() const { return mPhase; }
+
+        // Performs the step if its phase has room, holds it back otherwise.
+        CHIP_ERROR PerformStep(CommissioningStage nextStage) override;
+
+        // Performs the step right away, through the commissioner.
+        CHIP_ERROR PerformCommissionerStep(CommissioningStage aStage) { return AutoCommissioner::PerformStep(aStage); }
+
+        // DevicePairingDelegate
+        void OnPairingComplete(CHIP_ERROR error) override;
+        void OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error) override;
+
+    private:
+        friend class CommissioningPipeline;
+
+        // Ends the commissioning of the device after a held back step failed to start.
+        void FailStep(CommissioningStage aStage, CHIP_ERROR aError);
+
+        CommissioningPipeline & mPipeline;
+        DeviceCommissioner & mCommissioner;
+        DevicePairingDelegate * mPreviousPairingDelegate     = nullptr;
+        CommissioningDelegate * mPreviousDefaultCommissioner = nullptr;
+
+        bool mBusy          = false;
+        size_t mDeviceIndex = 0;
+        Phase mPhase        = Phase::kOther;
+
+        bool mWaiting                    = false;
+        CommissioningStage mWaitingStage = CommissioningStage::kError;
+        uint32_t mWaitingSequence        = 0;
+    };
+
+    explicit CommissioningPipeline(Delegate * aDelegate) : mDelegate(aDelegate) {}
+    virtual ~CommissioningPipeline();
+
+    CommissioningPipeline(const CommissioningPipeline &)             = delete;
+    CommissioningPipeline & operator=(const CommissioningPipeline &) = delete;
+
+    /**
+     * Add a commissioner to the pipeline, which commissions one device at a time.
+     *
+     * @retval CHIP_ERROR_INCORRECT_STATE if devices are being commissioned
+     * @retval CHIP_ERROR_NO_MEMORY if the pipeline has kMaxLanes commissioners or the lane cannot be allocated
+     */
+    CHIP_ERROR AddCommissioner(DeviceCommissioner * aCommissioner);
+
+    /**
+     * Start commissioning the given devices, in the order of the list.
+     *
+     * Delegate::OnDone may be called before Start returns, e.g. for an empty device list.
+     *
+     * @retval CHIP_ERROR_INCORRECT_STATE if devices are already being commissioned, or there is no commissioner
+     * @retval CHIP_ERROR_INVALID_ARGUMENT if a phase limit of aParams is 0
+     */
+    CHIP_ERROR Start(Span<const Device> aDevices, const Params & aParams);
+
+    bool IsInProgress() const { return mInProgress; }
+
+    const Device & GetDevice(size_t aDeviceIndex) const { return mDevices[aDeviceIndex]; }
+
+    /**
+     * Number of devices currently in aPhase, including the ones between two steps of the phase.
+     */
+    size_t GetDevicesInPhase(Phase aPhase) const { return mDevicesInPhase[static_cast<size_t>(aPhase)]; }
+
+    /**
+     * Outcome of the devices done so far, complete once Delegate::OnDone is called.
+     */
+    const Result & GetResult() const { return mResult; }
+
+protected:
+    /**
+     * Establish PASE with aDevice through the commissioner of aLane, then commission it. The outcome is reported to the
+     * pairing delegate of the commissioner, which is aLane.
+     */
+    virtual CHIP_ERROR StartPairing(Lane & aLane, const Device & aDevice);
+
+    /**
+     * Perform a step of the commissioning of the device of aLane, once its phase has room.
+     */
+    virtual CHIP_ERROR PerformStep(Lane & aLane, CommissioningStage aStage) { return aLane.PerformCommissionerStep(aStage); }
+
+    /**
+     * Have Dispatch called from the event loop. A commissioner reporting the end of a commissioning is still using its
+     * pairing delegate, so it is only handed the next device once it is out of its callbacks.
+     */
+    virtual void ScheduleDispatch();
+
+    /**
+     * Resume the devices waiting for a phase, then start new devices while lanes and pairing capacity are available.
+     */
+    void Dispatch();
+
+private:
+    static void DispatchTimerCallback(System::Layer * aLayer, void * aAppState);
+
+    CHIP_ERROR RequestStep(Lane & aLane, CommissioningStage aStage);
+    void OnPairingComplete(Lane & aLane, CHIP_ERROR aError);
+    void OnCommissioningComplete(Lane & aLane, NodeId aNodeId, CHIP_ERROR aError);
+
+    void FinishDevice(Lane & aLane, CHIP_ERROR aError, bool aPairingFailure);
+    Lane * NextWaitingLane();
+    Lane * NextIdleLane();
+
+    size_t GetLimit(Phase aPhase) const;
+    bool HasRoom(Phase aPhase) const { return GetDevicesInPhase(aPhase) < GetLimit(aPhase); }
+    void EnterPhase(Lane & aLane, Phase aPhase);
+
+    Delegate * mDelegate = nullptr;
+    Lane * mLanes[kMaxLanes];
+    size_t mLaneCount = 0;
+
+    Span<const Device> mDevices;
+    Params mParams;
+    Result mResult;
+    size_t mNextDevice                  = 0;
+    size_t mDevicesInFlight             = 0;
+    size_t mDevicesInPhase[kPhaseCount] = {};
+    uint32_t mNextWaitingSequence       = 0;
+    bool mInProgress                    = false;
+    bool mDispatching                   = false;
+    bool mDispatchScheduled             = false;
+};
+
+} // namespace Controller
+} // namespace chip
@@ -26,6 +26,11 @@
 #include <lib/support/SafeInt.h>
 #include <lib/support/ScopedBuffer.h>
 #include <lib/support/TestGroupData.h>
+#include <system/SystemConfig.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <thread>
+#endif
 
 namespace chip {
 namespace Controller {
@@ -153,6 +158,94 @@ CHIP_ERROR IssueX509Cert(uint32_t now, uint32_t validity, ChipDN issuerDn, ChipD
     return CopySpanToMutableSpan(derSpan, outX509Cert);
 }
 
+// Extracts the CSR from NOCSR elements and verifies it, providing its public key.
+CHIP_ERROR VerifyCSRElements(const ByteSpan & csrElements, P256PublicKey & pubkey)
+{
+    TLVReader reader;
+    reader.Init(csrElements);
+
+    if (reader.GetType() == kTLVType_NotSpecified)
+    {
+        ReturnErrorOnFailure(reader.Next());
+    }
+
+    ReturnErrorOnFailure(reader.Expect(kTLVType_Structure, AnonymousTag()));
+
+    TLVType containerType;
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    ReturnErrorOnFailure(reader.Next(kTLVType_ByteString, TLV::ContextTag(1)));
+
+    ByteSpan csr(reader.GetReadPoint(), reader.GetLength());
+    reader.ExitContainer(containerType);
+
+    return VerifyCertificateSigningRequest(csr.data(), csr.size(), pubkey);
+}
+
+// Requests of a GenerateNOCChains batch are processed by chunks, whose CSRs are verified together.
+constexpr size_t kBatchChunkSize = 16;
+
+struct VerifiedCSR
+{
+    P256PublicKey pubkey;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+};
+
+void VerifyCSRs(Span<const OperationalCredentialsDelegate::NOCChainRequest> requests, VerifiedCSR * csrs, size_t threadCount)
+{
+    auto verify = [requests, csrs](size_t first, size_t stride) {
+        for (size_t i = first; i < requests.size(); i += stride)
+        {
+            csrs[i].err = VerifyCSRElements(requests[i].csrElements, csrs[i].pubkey);
+        }
+    };
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    // Verification only uses the public key of every CSR, it can run on several threads at once.
+    threadCount = std::min(threadCount, requests.size());
+    if (threadCount > 1)
+    {
+        std::thread threads[kBatchChunkSize - 1];
+        for (size_t t = 1; t < threadCount; t++)
+        {
+            threads[t - 1] = std::thread(verify, t, threadCount);
+        }
+        verify(0, threadCount);
+        for (size_t t = 1; t < threadCount; t++)
+        {
+            threads[t - 1].join();
+        }
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    verify(0, 1);
+}
+
+// Calls back onto the commissioner with the generated chain.
+CHIP_ERROR ProvideNOCChain(Callback::Callback<OnNOCChainGeneration> * onCompletion, const ByteSpan & noc, const ByteSpan & icac,
+                           const ByteSpan & rcac)
+{
+    // TODO(#13825): Should always generate some IPK. Using a temporary fixed value until APIs are plumbed in to set it end-to-end
+    // TODO: Force callers to set IPK if used before GenerateNOCChain will succeed.
+    ByteSpan defaultIpkSpan = chip::GroupTesting::DefaultIpkValue::GetDefaultIpk();
+
+    // The below static assert validates a key assumption in types used (needed for public API conformance)
+    static_assert(CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES == kAES_CCM128_Key_Length, "IPK span sizing must match");
+
+    // Prepare IPK to be sent back. A more fully-fledged operational credentials delegate
+    // would obtain a suitable key per fabric.
+    uint8_t ipkValue[CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES];
+    Crypto::IdentityProtectionKeySpan ipkSpan(ipkValue);
+
+    VerifyOrReturnError(defaultIpkSpan.size() == sizeof(ipkValue), CHIP_ERROR_INTERNAL);
+    memcpy(&ipkValue[0], defaultIpkSpan.data(), defaultIpkSpan.size());
+
+    // Callback onto commissioner.
+    ChipLogProgress(Controller, "Providing certificate chain to the commissioner");
+    onCompletion->mCall(onCompletion->mContext, CHIP_NO_ERROR, noc, icac, rcac, MakeOptional(ipkSpan), Optional<NodeId>());
+    return CHIP_NO_ERROR;
+}
+
 } // namespace
 
 CHIP_ERROR ExampleOperationalCredentialsIssuer::Initialize(PersistentStorageDelegate & storage)
@@ -222,17 +315,21 @@ CHIP_ERROR ExampleOperationalCredentialsIssuer::Initialize(PersistentStorageDele
         ReturnErrorOnFailure(mIntermediateIssuer.Deserialize(serializedKey));
     }
 
-    mStorage     = &storage;
-    mInitialized = true;
+    mStorage           = &storage;
+    mInitialized       = true;
+    mIssuerChainLoaded = false;
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR ExampleOperationalCredentialsIssuer::GenerateNOCChainAfterValidation(NodeId nodeId, FabricId fabricId,
-                                                                                const CATValues & cats,
-                                                                                const Crypto::P256PublicKey & pubkey,
-                                                                                MutableByteSpan & rcac, MutableByteSpan & icac,
-                                                                                MutableByteSpan & noc)
+CHIP_ERROR ExampleOperationalCredentialsIssuer::LoadIssuerChain()
 {
+    // Maximally sized certificates are regenerated for every chain.
+    VerifyOrReturnError(!mIssuerChainLoaded || mUseMaximallySizedCerts, CHIP_NO_ERROR);
+    mIssuerChainLoaded = false;
+
+    MutableByteSpan rcac(mRcac);
+    MutableByteSpan icac(mIcac);
+
     ChipDN rcac_dn;
     CHIP_ERROR err      = CHIP_NO_ERROR;
     uint16_t rcacBufLen = static_cast<uint16_t>(std::min(rcac.size(), static_cast<size_t>(UINT16_MAX)));
@@ -307,16 +404,38 @@ CHIP_ERROR ExampleOperationalCredentialsIssuer::GenerateNOCChainAfterValidation(
                           ReturnErrorOnFailure(mStorage->SyncSetKeyValue(key, icac.data(), static_cast<uint16_t>(icac.size()))));
     }
 
+    mRcacLen           = rcac.size();
+    mIcacLen           = icac.size();
+    mIcacDN            = icac_dn;
+    mIssuerChainLoaded = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ExampleOperationalCredentialsIssuer::IssueNOC(NodeId nodeId, FabricId fabricId, const CATValues & cats,
+                                                         const Crypto::P256PublicKey & pubkey, MutableByteSpan & noc)
+{
     ChipDN noc_dn;
     ReturnErrorOnFailure(noc_dn.AddAttribute_MatterFabricId(fabricId));
     ReturnErrorOnFailure(noc_dn.AddAttribute_MatterNodeId(nodeId));
     ReturnErrorOnFailure(noc_dn.AddCATs(cats));
 
     ChipLogProgress(Controller, "Generating NOC");
-    return IssueX509Cert(mNow, mValidity, icac_dn, noc_dn, CertType::kNoc, mUseMaximallySizedCerts, pubkey, mIntermediateIssuer,
+    return IssueX509Cert(mNow, mValidity, mIcacDN, noc_dn, CertType::kNoc, mUseMaximallySizedCerts, pubkey, mIntermediateIssuer,
                          noc);
 }
 
+CHIP_ERROR ExampleOperationalCredentialsIssuer::GenerateNOCChainAfterValidation(NodeId nodeId, FabricId fabricId,
+                                                                                const CATValues & cats,
+                                                                                const Crypto::P256PublicKey & pubkey,
+                                                                                MutableByteSpan & rcac, MutableByteSpan & icac,
+                                                                                MutableByteSpan & noc)
+{
+    ReturnErrorOnFailure(LoadIssuerChain());
+    ReturnErrorOnFailure(CopySpanToMutableSpan(ByteSpan(mRcac, mRcacLen), rcac));
+    ReturnErrorOnFailure(CopySpanToMutableSpan(ByteSpan(mIcac, mIcacLen), icac));
+    return IssueNOC(nodeId, fabricId, cats, pubkey, noc);
+}
+
 CHIP_ERROR ExampleOperationalCredentialsIssuer::GenerateNOCChain(const ByteSpan & csrElements, const ByteSpan & csrNonce,
                                                                  const ByteSpan & attestationSignature,
                                                                  const ByteSpan & attestationChallenge, const ByteSpan & DAC,
@@ -340,25 +459,8 @@ CHIP_ERROR ExampleOperationalCredentialsIssuer::GenerateNOCChain(const ByteSpan
     }
 
     ChipLogProgress(Controller, "Verifying Certificate Signing Request");
-    TLVReader reader;
-    reader.Init(csrElements);
-
-    if (reader.GetType() == kTLVType_NotSpecified)
-    {
-        ReturnErrorOnFailure(reader.Next());
-    }
-
-    ReturnErrorOnFailure(reader.Expect(kTLVType_Structure, AnonymousTag()));
-
-    TLVType containerType;
-    ReturnErrorOnFailure(reader.EnterContainer(containerType));
-    ReturnErrorOnFailure(reader.Next(kTLVType_ByteString, TLV::ContextTag(1)));
-
-    ByteSpan csr(reader.GetReadPoint(), reader.GetLength());
-    reader.ExitContainer(containerType);
-
     P256PublicKey pubkey;
-    ReturnErrorOnFailure(VerifyCertificateSigningRequest(csr.data(), csr.size(), pubkey));
+    ReturnErrorOnFailure(VerifyCSRElements(csrElements, pubkey));
 
     chip::Platform::ScopedMemoryBuffer<uint8_t> noc;
     VerifyOrReturnError(noc.Alloc(kMaxDERCertLength), CHIP_ERROR_NO_MEMORY);
@@ -375,25 +477,54 @@ CHIP_ERROR ExampleOperationalCredentialsIssuer::GenerateNOCChain(const ByteSpan
     ReturnErrorOnFailure(
         GenerateNOCChainAfterValidation(assignedId, mNextFabricId, mNextCATs, pubkey, rcacSpan, icacSpan, nocSpan));
 
-    // TODO(#13825): Should always generate some IPK. Using a temporary fixed value until APIs are plumbed in to set it end-to-end
-    // TODO: Force callers to set IPK if used before GenerateNOCChain will succeed.
-    ByteSpan defaultIpkSpan = chip::GroupTesting::DefaultIpkValue::GetDefaultIpk();
+    return ProvideNOCChain(onCompletion, nocSpan, icacSpan, rcacSpan);
+}
 
-    // The below static assert validates a key assumption in types used (needed for public API conformance)
-    static_assert(CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES == kAES_CCM128_Key_Length, "IPK span sizing must match");
+CHIP_ERROR ExampleOperationalCredentialsIssuer::GenerateNOCChains(Span<const NOCChainRequest> requests)
+{
+    for (const auto & request : requests)
+    {
+        VerifyOrReturnError(request.onCompletion != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_UNINITIALIZED);
 
-    // Prepare IPK to be sent back. A more fully-fledged operational credentials delegate
-    // would obtain a suitable key per fabric.
-    uint8_t ipkValue[CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES];
-    Crypto::IdentityProtectionKeySpan ipkSpan(ipkValue);
+    chip::Platform::ScopedMemoryBuffer<uint8_t> noc;
+    VerifyOrReturnError(noc.Alloc(kMaxDERCertLength), CHIP_ERROR_NO_MEMORY);
 
-    VerifyOrReturnError(defaultIpkSpan.size() == sizeof(ipkValue), CHIP_ERROR_INTERNAL);
-    memcpy(&ipkValue[0], defaultIpkSpan.data(), defaultIpkSpan.size());
+    const CHIP_ERROR chainErr = LoadIssuerChain();
 
-    // Callback onto commissioner.
-    ChipLogProgress(Controller, "Providing certificate chain to the commissioner");
-    onCompletion->mCall(onCompletion->mContext, CHIP_NO_ERROR, nocSpan, icacSpan, rcacSpan, MakeOptional(ipkSpan),
-                        Optional<NodeId>());
+    ChipLogProgress(Controller, "Generating %u NOC chains", static_cast<unsigned>(requests.size()));
+    for (size_t first = 0; first < requests.size(); first += kBatchChunkSize)
+    {
+        Span<const NOCChainRequest> chunk = requests.SubSpan(first, std::min(kBatchChunkSize, requests.size() - first));
+
+        VerifiedCSR csrs[kBatchChunkSize];
+        VerifyCSRs(chunk, csrs, mBatchVerificationThreads);
+
+        for (size_t i = 0; i < chunk.size(); i++)
+        {
+            const NOCChainRequest & request = chunk[i];
+            const NodeId assignedId         = (request.nodeId != kUndefinedNodeId) ? request.nodeId : mNextAvailableNodeId++;
+
+            MutableByteSpan nocSpan(noc.Get(), kMaxDERCertLength);
+            CHIP_ERROR err = (chainErr != CHIP_NO_ERROR) ? chainErr : csrs[i].err;
+            if (err == CHIP_NO_ERROR)
+            {
+                err = IssueNOC(assignedId, mNextFabricId, mNextCATs, csrs[i].pubkey, nocSpan);
+            }
+            if (err == CHIP_NO_ERROR)
+            {
+                err = ProvideNOCChain(request.onCompletion, nocSpan, ByteSpan(mIcac, mIcacLen), ByteSpan(mRcac, mRcacLen));
+            }
+            if (err != CHIP_NO_ERROR)
+            {
+                ChipLogError(Controller, "Failed to generate NOC chain for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                             ChipLogValueX64(assignedId), err.Format());
+                request.onCompletion->mCall(request.onCompletion->mContext, err, ByteSpan(), ByteSpan(), ByteSpan(), NullOptional,
+                                            NullOptional);
+            }
+        }
+    }
     return CHIP_NO_ERROR;
 }
 
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <controller/OperationalCredentialsDelegate.h>
+#include <credentials/CHIPCert.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/CASEAuthTag.h>
 #include <lib/core/CHIPError.h>
@@ -59,6 +60,19 @@ public:
                                 const ByteSpan & attestationChallenge, const ByteSpan & DAC, const ByteSpan & PAI,
                                 Callback::Callback<OnNOCChainGeneration> * onCompletion) override;
 
+    /**
+     * Generates the chains of a batch of requests, loading the root and intermediate certificates once for the whole batch.
+     * Requests without a node id hint get the next available node ids, in order.
+     */
+    CHIP_ERROR GenerateNOCChains(Span<const NOCChainRequest> requests) override;
+
+    /**
+     * Set the number of threads verifying the CSRs of a GenerateNOCChains batch, 1 to verify them on the calling thread. Only
+     * used on platforms with POSIX threads. NOCs are always signed on the calling thread, since the DRBG of some crypto
+     * backends is not thread-safe.
+     */
+    void SetBatchVerificationThreads(size_t threads) { mBatchVerificationThreads = threads; }
+
     void SetNodeIdForNextNOCRequest(NodeId nodeId) override
     {
         mNextRequestedNodeId = nodeId;
@@ -84,7 +98,11 @@ public:
     [[deprecated("This class stores the encryption key in clear storage. Don't use it for production code.")]] CHIP_ERROR
     Initialize(PersistentStorageDelegate & storage);
 
-    void SetIssuerId(uint32_t id) { mIssuerId = id; }
+    void SetIssuerId(uint32_t id)
+    {
+        mIssuerId          = id;
+        mIssuerChainLoaded = false;
+    }
 
     void SetCurrentEpoch(uint32_t epoch) { mNow = epoch; }
 
@@ -109,6 +127,11 @@ public:
                                                MutableByteSpan & noc);
 
 private:
+    // Loads the root and intermediate certificates from the storage, or generates them, unless already loaded.
+    CHIP_ERROR LoadIssuerChain();
+    CHIP_ERROR IssueNOC(NodeId nodeId, FabricId fabricId, const CATValues & cats, const Crypto::P256PublicKey & pubkey,
+                        MutableByteSpan & noc);
+
     Crypto::P256Keypair mIssuer;
     Crypto::P256Keypair mIntermediateIssuer;
     bool mInitialized              = false;
@@ -128,6 +151,15 @@ private:
     CATValues mNextCATs         = kUndefinedCATs;
     bool mNodeIdRequested       = false;
     uint64_t mIndex             = 0;
+
+    uint8_t mRcac[Credentials::kMaxDERCertLength];
+    size_t mRcacLen = 0;
+    uint8_t mIcac[Credentials::kMaxDERCertLength];
+    size_t mIcacLen = 0;
+    Credentials::ChipDN mIcacDN;
+    bool mIssuerChainLoaded = false;
+
+    size_t mBatchVerificationThreads = 1;
 };
 
 } // namespace Controller
@@ -0,0 +1,208 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/MultiNodeInteraction.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Controller {
+
+MultiNodeInteraction::MultiNodeInteraction(DeviceController * aController, Delegate * aDelegate) :
+    mController(aController), mDelegate(aDelegate)
+{
+    for (auto & slot : mSlots)
+    {
+        slot.owner = this;
+    }
+}
+
+MultiNodeInteraction::~MultiNodeInteraction()
+{
+    // Sessions still being looked up must not call back into a destroyed object.
+    for (auto & slot : mSlots)
+    {
+        slot.onConnected.Cancel();
+        slot.onConnectionFailure.Cancel();
+    }
+}
+
+CHIP_ERROR MultiNodeInteraction::Start(Span<const NodeId> aNodes, const Params & aParams)
+{
+    VerifyOrReturnError(mController != nullptr && mDelegate != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!mInProgress, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(aParams.maxConcurrentNodes > 0 && aParams.maxSessionSetups > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mNodes                     = aNodes;
+    mParams                    = aParams;
+    mParams.maxConcurrentNodes = std::min(mParams.maxConcurrentNodes, kMaxConcurrentNodes);
+    mNextNode                  = 0;
+    mNodesInFlight             = 0;
+    mSessionSetups             = 0;
+    mResult                    = Result();
+    mInProgress                = true;
+
+    ChipLogProgress(Controller, "Starting interaction with %u nodes, %u at once", static_cast<unsigned>(mNodes.size()),
+                    static_cast<unsigned>(mParams.maxConcurrentNodes));
+
+    Dispatch();
+    return CHIP_NO_ERROR;
+}
+
+void MultiNodeInteraction::Dispatch()
+{
+    // Session lookups and interactions may complete before the calls starting them return: the outermost call does the work.
+    VerifyOrReturn(!mDispatching);
+    mDispatching = true;
+
+    while (mNextNode < mNodes.size() && mNodesInFlight < mParams.maxConcurrentNodes && mSessionSetups < mParams.maxSessionSetups)
+    {
+        Slot * slot = nullptr;
+        for (auto & candidate : mSlots)
+        {
+            if (candidate.state == SlotState::kIdle)
+            {
+                slot = &candidate;
+                break;
+            }
+        }
+        VerifyOrDie(slot != nullptr);
+
+        slot->nodeIndex = mNextNode++;
+        slot->state     = SlotState::kConnecting;
+        slot->error     = CHIP_NO_ERROR;
+        mNodesInFlight++;
+        mSessionSetups++;
+
+        CHIP_ERROR err = mController->GetConnectedDevice(mNodes[slot->nodeIndex], &slot->onConnected, &slot->onConnectionFailure);
+        if (err != CHIP_NO_ERROR)
+        {
+            // Neither callback will be called.
+            mSessionSetups--;
+            FinishNode(*slot, err, true);
+        }
+    }
+
+    mDispatching = false;
+
+    if (mInProgress && mNextNode == mNodes.size() && mNodesInFlight == 0)
+    {
+        mInProgress = false;
+        ChipLogProgress(Controller, "Interaction done: %u nodes succeeded, %u failed (%u without session)",
+                        static_cast<unsigned>(mResult.succeeded), static_cast<unsigned>(mResult.failed),
+                        static_cast<unsigned>(mResult.sessionFailures));
+        // May destroy or restart this object.
+        mDelegate->OnDone(*this);
+    }
+}
+
+void MultiNodeInteraction::FinishNode(Slot & aSlot, CHIP_ERROR aError, bool aSessionFailure)
+{
+    const size_t nodeIndex = aSlot.nodeIndex;
+
+    aSlot.state = SlotState::kIdle;
+    mNodesInFlight--;
+
+    if (aError == CHIP_NO_ERROR)
+    {
+        mResult.succeeded++;
+    }
+    else
+    {
+        ChipLogError(Controller, "Interaction with node " ChipLogFormatX64 " failed: %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(mNodes[nodeIndex]), aError.Format());
+        mResult.failed++;
+        if (aSessionFailure)
+        {
+            mResult.sessionFailures++;
+        }
+    }
+
+    mDelegate->OnNodeDone(*this, nodeIndex, aError);
+    Dispatch();
+}
+
+MultiNodeInteraction::Slot * MultiNodeInteraction::FindInteractingSlot(size_t aNodeIndex)
+{
+    for (auto & slot : mSlots)
+    {
+        if (slot.state == SlotState::kInteracting && slot.nodeIndex == aNodeIndex)
+        {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+void MultiNodeInteraction::OnNodeInteractionDone(size_t aNodeIndex, CHIP_ERROR aError)
+{
+    Slot * slot = FindInteractingSlot(aNodeIndex);
+    VerifyOrReturn(slot != nullptr);
+
+    FinishNode(*slot, slot->error != CHIP_NO_ERROR ? slot->error : aError, false);
+}
+
+void MultiNodeInteraction::SetNodeError(size_t aNodeIndex, CHIP_ERROR aError)
+{
+    Slot * slot = FindInteractingSlot(aNodeIndex);
+    if (slot != nullptr && slot->error == CHIP_NO_ERROR)
+    {
+        slot->error = aError;
+    }
+}
+
+void MultiNodeInteraction::OnDeviceConnectedCallback(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                                     const SessionHandle & sessionHandle)
+{
+    auto * slot = static_cast<Slot *>(context);
+    auto * self = slot->owner;
+    VerifyOrReturn(slot->state == SlotState::kConnecting);
+
+    self->mSessionSetups--;
+    slot->state = SlotState::kInteracting;
+
+    // Hold off dispatching while the interaction starts, it may complete right away and must not end the whole interaction
+    // (possibly destroying this object) from under us.
+    const bool wasDispatching = self->mDispatching;
+    self->mDispatching        = true;
+
+    CHIP_ERROR err = self->mDelegate->StartNodeInteraction(*self, slot->nodeIndex, exchangeMgr, sessionHandle);
+    if (err != CHIP_NO_ERROR)
+    {
+        self->OnNodeInteractionDone(slot->nodeIndex, err);
+    }
+
+    self->mDispatching = wasDispatching;
+
+    // Another node can start.
+    self->Dispatch();
+}
+
+void MultiNodeInteraction::OnDeviceConnectionFailureCallback(void * context, const ScopedNodeId & peerId, CHIP_ERROR error)
+{
+    auto * slot = static_cast<Slot *>(context);
+    auto * self = slot->owner;
+    VerifyOrReturn(slot->state == SlotState::kConnecting);
+
+    self->mSessionSetups--;
+    self->FinishNode(*slot, error, true);
+}
+
+} // namespace Controller
+} // namespace chip
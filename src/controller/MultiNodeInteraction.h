@@ -0,0 +1,324 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/OperationalSessionSetup.h>
+#include <controller/CHIPDeviceController.h>
+#include <controller/InvokeInteraction.h>
+#include <controller/ReadInteraction.h>
+#include <lib/core/CHIPCallback.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/NodeId.h>
+#include <lib/core/Optional.h>
+#include <lib/support/Span.h>
+
+#include <functional>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * A helper class to run the same interaction with many nodes of the fabric of a controller, e.g. to send a command to every
+ * light of a building.
+ *
+ * Nodes are served in the order of the node list, with up to Params::maxConcurrentNodes of them in progress at once: as soon as
+ * the interaction with a node completes, the session of the next node is looked up, so that session establishment with some
+ * nodes overlaps the interactions with others. At most Params::maxSessionSetups sessions are looked up at once, since every
+ * CASE establishment is costly for the controller and for the network.
+ *
+ * The interaction itself is started by the Delegate once the session of a node is available. The Delegate must report its
+ * completion through OnNodeInteractionDone, and gets the outcome of every node followed by a summary once all nodes are done.
+ *
+ * The MultiNodeInteraction, the node list and the Delegate must stay valid until Delegate::OnDone is called.
+ */
+class MultiNodeInteraction
+{
+public:
+    static constexpr size_t kMaxConcurrentNodes = CHIP_CONFIG_CONTROLLER_MAX_MULTI_NODE_INTERACTIONS;
+
+    struct Params
+    {
+        size_t maxConcurrentNodes = kMaxConcurrentNodes; // Nodes in progress at once, at most kMaxConcurrentNodes
+        size_t maxSessionSetups   = CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_CASE_CLIENTS; // Sessions looked up at once
+    };
+
+    struct Result
+    {
+        size_t succeeded       = 0;
+        size_t failed          = 0; // Including the nodes whose session could not be established
+        size_t sessionFailures = 0;
+    };
+
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        /**
+         * Start the interaction with the node at aNodeIndex of the node list, over its session.
+         *
+         * Unless an error is returned, aInteraction.OnNodeInteractionDone must be called once the interaction completes. It
+         * may be called before StartNodeInteraction returns.
+         */
+        virtual CHIP_ERROR StartNodeInteraction(MultiNodeInteraction & aInteraction, size_t aNodeIndex,
+                                                Messaging::ExchangeManager & aExchangeMgr, const SessionHandle & aSession) = 0;
+
+        /**
+         * Called once per node, with the error that ended its session establishment or its interaction, if any.
+         */
+        virtual void OnNodeDone(MultiNodeInteraction & aInteraction, size_t aNodeIndex, CHIP_ERROR aError) {}
+
+        /**
+         * Called once all nodes are done. The MultiNodeInteraction may be destroyed or started again from this call.
+         */
+        virtual void OnDone(MultiNodeInteraction & aInteraction) = 0;
+    };
+
+    MultiNodeInteraction(DeviceController * aController, Delegate * aDelegate);
+    ~MultiNodeInteraction();
+
+    MultiNodeInteraction(const MultiNodeInteraction &)             = delete;
+    MultiNodeInteraction & operator=(const MultiNodeInteraction &) = delete;
+
+    /**
+     * Start interacting with the given nodes of the fabric of the controller.
+     *
+     * Delegate::OnDone may be called before Start returns, e.g. for an empty node list.
+     *
+     * @retval CHIP_ERROR_INCORRECT_STATE if an interaction is already in progress
+     * @retval CHIP_ERROR_INVALID_ARGUMENT if a concurrency limit of aParams is 0
+     */
+    CHIP_ERROR Start(Span<const NodeId> aNodes, const Params & aParams);
+    CHIP_ERROR Start(Span<const NodeId> aNodes) { return Start(aNodes, Params()); }
+
+    /**
+     * Report the completion of the interaction started by Delegate::StartNodeInteraction for the node at aNodeIndex.
+     *
+     * Calls for a node that is already done are ignored, so that an interaction may report its completion from both its error
+     * and its done callbacks.
+     */
+    void OnNodeInteractionDone(size_t aNodeIndex, CHIP_ERROR aError = CHIP_NO_ERROR);
+
+    /**
+     * Record an error for the node at aNodeIndex, reported once its interaction completes. The first error recorded, or
+     * passed to OnNodeInteractionDone, is the one reported.
+     */
+    void SetNodeError(size_t aNodeIndex, CHIP_ERROR aError);
+
+    bool IsInProgress() const { return mInProgress; }
+
+    NodeId GetNodeId(size_t aNodeIndex) const { return mNodes[aNodeIndex]; }
+
+    /**
+     * Outcome of the nodes done so far, complete once Delegate::OnDone is called.
+     */
+    const Result & GetResult() const { return mResult; }
+
+private:
+    enum class SlotState : uint8_t
+    {
+        kIdle,
+        kConnecting,
+        kInteracting,
+    };
+
+    // A node in progress.
+    struct Slot
+    {
+        Slot() : onConnected(&OnDeviceConnectedCallback, this), onConnectionFailure(&OnDeviceConnectionFailureCallback, this) {}
+
+        MultiNodeInteraction * owner = nullptr;
+        size_t nodeIndex             = 0;
+        SlotState state              = SlotState::kIdle;
+        CHIP_ERROR error             = CHIP_NO_ERROR;
+
+        Callback::Callback<OnDeviceConnected> onConnected;
+        Callback::Callback<OnDeviceConnectionFailure> onConnectionFailure;
+    };
+
+    static void OnDeviceConnectedCallback(void * context, Messaging::ExchangeManager & exchangeMgr,
+                                          const SessionHandle & sessionHandle);
+    static void OnDeviceConnectionFailureCallback(void * context, const ScopedNodeId & peerId, CHIP_ERROR error);
+
+    Slot * FindInteractingSlot(size_t aNodeIndex);
+
+    // Start the next nodes while the limits allow it, then call Delegate::OnDone once all nodes are done.
+    void Dispatch();
+    void FinishNode(Slot & aSlot, CHIP_ERROR aError, bool aSessionFailure);
+
+    DeviceController * mController;
+    Delegate * mDelegate;
+
+    Span<const NodeId> mNodes;
+    Params mParams;
+    size_t mNextNode      = 0;
+    size_t mNodesInFlight = 0;
+    size_t mSessionSetups = 0;
+    Result mResult;
+    bool mInProgress  = false;
+    bool mDispatching = false;
+
+    Slot mSlots[kMaxConcurrentNodes];
+};
+
+/**
+ * Sends a command to many nodes through a MultiNodeInteraction, see InvokeCommandRequest.
+ *
+ * The request is copied, but data it refers to (e.g. spans) must stay valid until the OnDone callback is called.
+ */
+template <typename RequestObjectT>
+class MultiNodeCommandInvoker : private MultiNodeInteraction::Delegate
+{
+public:
+    using ResponseType = typename RequestObjectT::ResponseType;
+    using OnSuccessCallbackType =
+        std::function<void(NodeId aNodeId, const app::ConcreteCommandPath & aPath, const app::StatusIB & aStatus,
+                           const ResponseType & aResponse)>;
+    using OnErrorCallbackType = std::function<void(NodeId aNodeId, CHIP_ERROR aError)>;
+    using OnDoneCallbackType  = std::function<void(const MultiNodeInteraction::Result & aResult)>;
+
+    MultiNodeCommandInvoker(DeviceController * aController, EndpointId aEndpointId, const RequestObjectT & aRequest,
+                            OnSuccessCallbackType aOnSuccess, OnErrorCallbackType aOnError, OnDoneCallbackType aOnDone,
+                            const Optional<uint16_t> & aTimedInvokeTimeoutMs = NullOptional) :
+        mInteraction(aController, this),
+        mEndpointId(aEndpointId), mRequest(aRequest), mTimedInvokeTimeoutMs(aTimedInvokeTimeoutMs), mOnSuccess(aOnSuccess),
+        mOnError(aOnError), mOnDone(aOnDone)
+    {}
+
+    CHIP_ERROR Start(Span<const NodeId> aNodes, const MultiNodeInteraction::Params & aParams = MultiNodeInteraction::Params())
+    {
+        return mInteraction.Start(aNodes, aParams);
+    }
+
+private:
+    CHIP_ERROR StartNodeInteraction(MultiNodeInteraction & aInteraction, size_t aNodeIndex,
+                                    Messaging::ExchangeManager & aExchangeMgr, const SessionHandle & aSession) override
+    {
+        auto onSuccess = [this, aNodeIndex](const app::ConcreteCommandPath & aPath, const app::StatusIB & aStatus,
+                                            const ResponseType & aResponse) {
+            if (mOnSuccess)
+            {
+                mOnSuccess(mInteraction.GetNodeId(aNodeIndex), aPath, aStatus, aResponse);
+            }
+            mInteraction.OnNodeInteractionDone(aNodeIndex);
+        };
+        auto onError = [this, aNodeIndex](CHIP_ERROR aError) { mInteraction.OnNodeInteractionDone(aNodeIndex, aError); };
+
+        return InvokeCommandRequest(&aExchangeMgr, aSession, mEndpointId, mRequest, onSuccess, onError, mTimedInvokeTimeoutMs);
+    }
+
+    void OnNodeDone(MultiNodeInteraction & aInteraction, size_t aNodeIndex, CHIP_ERROR aError) override
+    {
+        if (aError != CHIP_NO_ERROR && mOnError)
+        {
+            mOnError(aInteraction.GetNodeId(aNodeIndex), aError);
+        }
+    }
+
+    void OnDone(MultiNodeInteraction & aInteraction) override
+    {
+        if (mOnDone)
+        {
+            mOnDone(aInteraction.GetResult());
+        }
+    }
+
+    MultiNodeInteraction mInteraction;
+    EndpointId mEndpointId;
+    RequestObjectT mRequest;
+    Optional<uint16_t> mTimedInvokeTimeoutMs;
+    OnSuccessCallbackType mOnSuccess;
+    OnErrorCallbackType mOnError;
+    OnDoneCallbackType mOnDone;
+};
+
+/**
+ * Reads an attribute of many nodes through a MultiNodeInteraction, see ReadAttribute.
+ *
+ * The AttributeTypeInfo is generally expected to be a ClusterName::Attributes::AttributeName::TypeInfo struct.
+ */
+template <typename AttributeTypeInfo>
+class MultiNodeAttributeReader : private MultiNodeInteraction::Delegate
+{
+public:
+    using DecodableType = typename AttributeTypeInfo::DecodableType;
+    using OnSuccessCallbackType =
+        std::function<void(NodeId aNodeId, const app::ConcreteDataAttributePath & aPath, const DecodableType & aData)>;
+    using OnErrorCallbackType = std::function<void(NodeId aNodeId, CHIP_ERROR aError)>;
+    using OnDoneCallbackType  = std::function<void(const MultiNodeInteraction::Result & aResult)>;
+
+    MultiNodeAttributeReader(DeviceController * aController, EndpointId aEndpointId, OnSuccessCallbackType aOnSuccess,
+                             OnErrorCallbackType aOnError, OnDoneCallbackType aOnDone, bool aFabricFiltered = true) :
+        mInteraction(aController, this),
+        mEndpointId(aEndpointId), mFabricFiltered(aFabricFiltered), mOnSuccess(aOnSuccess), mOnError(aOnError), mOnDone(aOnDone)
+    {}
+
+    CHIP_ERROR Start(Span<const NodeId> aNodes, const MultiNodeInteraction::Params & aParams = MultiNodeInteraction::Params())
+    {
+        return mInteraction.Start(aNodes, aParams);
+    }
+
+private:
+    CHIP_ERROR StartNodeInteraction(MultiNodeInteraction & aInteraction, size_t aNodeIndex,
+                                    Messaging::ExchangeManager & aExchangeMgr, const SessionHandle & aSession) override
+    {
+        detail::ReportAttributeParams<DecodableType> params(aSession);
+        params.mOnReportCb = [this, aNodeIndex](const app::ConcreteDataAttributePath & aPath, const DecodableType & aData) {
+            if (mOnSuccess)
+            {
+                mOnSuccess(mInteraction.GetNodeId(aNodeIndex), aPath, aData);
+            }
+        };
+        // The read always ends with its done callback, which completes the node.
+        params.mOnErrorCb = [this, aNodeIndex](const app::ConcreteDataAttributePath *, CHIP_ERROR aError) {
+            mInteraction.SetNodeError(aNodeIndex, aError);
+        };
+        params.mOnDoneCb         = [this, aNodeIndex]() { mInteraction.OnNodeInteractionDone(aNodeIndex); };
+        params.mIsFabricFiltered = mFabricFiltered;
+
+        return detail::ReportAttribute(&aExchangeMgr, mEndpointId, AttributeTypeInfo::GetClusterId(),
+                                       AttributeTypeInfo::GetAttributeId(), std::move(params), NullOptional);
+    }
+
+    void OnNodeDone(MultiNodeInteraction & aInteraction, size_t aNodeIndex, CHIP_ERROR aError) override
+    {
+        if (aError != CHIP_NO_ERROR && mOnError)
+        {
+            mOnError(aInteraction.GetNodeId(aNodeIndex), aError);
+        }
+    }
+
+    void OnDone(MultiNodeInteraction & aInteraction) override
+    {
+        if (mOnDone)
+        {
+            mOnDone(aInteraction.GetResult());
+        }
+    }
+
+    MultiNodeInteraction mInteraction;
+    EndpointId mEndpointId;
+    bool mFabricFiltered;
+    OnSuccessCallbackType mOnSuccess;
+    OnErrorCallbackType mOnError;
+    OnDoneCallbackType mOnDone;
+};
+
+} // namespace Controller
+} // namespace chip
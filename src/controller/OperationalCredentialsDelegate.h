@@ -21,6 +21,7 @@
 #include <app/util/basic-types.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/CHIPCallback.h>
+#include <lib/core/NodeId.h>
 #include <lib/core/PeerId.h>
 #include <lib/support/DLLUtil.h>
 #include <lib/support/Span.h>
@@ -67,6 +68,61 @@ public:
                                         const ByteSpan & DAC, const ByteSpan & PAI,
                                         Callback::Callback<OnNOCChainGeneration> * onCompletion) = 0;
 
+    /**
+     * A request of GenerateNOCChains, with the arguments of GenerateNOCChain for one device.
+     */
+    struct NOCChainRequest
+    {
+        ByteSpan csrElements;
+        ByteSpan csrNonce;
+        ByteSpan attestationSignature;
+        ByteSpan attestationChallenge;
+        ByteSpan DAC;
+        ByteSpan PAI;
+        NodeId nodeId                                           = kUndefinedNodeId; // Hint, as for SetNodeIdForNextNOCRequest
+        Callback::Callback<OnNOCChainGeneration> * onCompletion = nullptr;
+    };
+
+    /**
+     * @brief
+     *   This function generates the operational certificate chains of many devices at once, e.g. when commissioning
+     *   devices in volume.
+     *
+     *   The outcome of every request is reported to its `onCompletion` callback, with the error that prevented generating
+     *   its chain if any. Callbacks may be called before this function returns, in any order.
+     *
+     *   The default implementation generates the chains one by one with `GenerateNOCChain()`. Delegates that can share work
+     *   between requests, e.g. loading their issuer certificates once, should override it.
+     *
+     * @param[in] requests  The requests, which must all have an `onCompletion` callback.
+     *
+     * @return CHIP_ERROR_INVALID_ARGUMENT if a request has no callback, in which case no callback is called.
+     */
+    virtual CHIP_ERROR GenerateNOCChains(Span<const NOCChainRequest> requests)
+    {
+        for (const auto & request : requests)
+        {
+            VerifyOrReturnError(request.onCompletion != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        }
+
+        for (const auto & request : requests)
+        {
+            if (request.nodeId != kUndefinedNodeId)
+            {
+                SetNodeIdForNextNOCRequest(request.nodeId);
+            }
+
+            CHIP_ERROR err = GenerateNOCChain(request.csrElements, request.csrNonce, request.attestationSignature,
+                                              request.attestationChallenge, request.DAC, request.PAI, request.onCompletion);
+            if (err != CHIP_NO_ERROR)
+            {
+                request.onCompletion->mCall(request.onCompletion->mContext, err, ByteSpan(), ByteSpan(), ByteSpan(), NullOptional,
+                                            NullOptional);
+            }
+        }
+        return CHIP_NO_ERROR;
+    }
+
     /**
      *   This function sets the node ID for which the next NOC Chain would be requested. The node ID is
      *   provided as a hint, and the delegate implementation may chose to ignore it and pick node ID of
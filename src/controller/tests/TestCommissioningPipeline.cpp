@@ -0,0 +1,331 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <controller/CHIPDeviceController.h>
+#include <controller/CommissioningPipeline.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Controller;
+
+namespace {
+
+using Phase = CommissioningPipeline::Phase;
+using Lane  = CommissioningPipeline::Lane;
+
+// Simulated commissionees: a Thread device and how long each step takes, in milliseconds.
+constexpr uint32_t kPairingMs = 2500;
+
+struct SimulatedStep
+{
+    CommissioningStage stage;
+    uint32_t durationMs;
+};
+
+constexpr SimulatedStep kSteps[] = {
+    { CommissioningStage::kReadCommissioningInfo, 300 },
+    { CommissioningStage::kArmFailsafe, 100 },
+    { CommissioningStage::kConfigRegulatory, 100 },
+    { CommissioningStage::kSendPAICertificateRequest, 200 },
+    { CommissioningStage::kSendDACCertificateRequest, 200 },
+    { CommissioningStage::kSendAttestationRequest, 300 },
+    { CommissioningStage::kAttestationVerification, 400 },
+    { CommissioningStage::kSendOpCertSigningRequest, 800 },
+    { CommissioningStage::kValidateCSR, 50 },
+    { CommissioningStage::kGenerateNOCChain, 300 },
+    { CommissioningStage::kSendTrustedRootCert, 100 },
+    { CommissioningStage::kSendNOC, 200 },
+    { CommissioningStage::kThreadNetworkSetup, 200 },
+    { CommissioningStage::kFailsafeBeforeThreadEnable, 100 },
+    { CommissioningStage::kThreadNetworkEnable, 8000 },
+    { CommissioningStage::kFindOperationalForCommissioningComplete, 2000 },
+    { CommissioningStage::kSendComplete, 200 },
+    { CommissioningStage::kCleanup, 10 },
+};
+
+bool FailsPairing(NodeId nodeId)
+{
+    return nodeId % 11 == 0;
+}
+
+bool FailsAttestation(NodeId nodeId)
+{
+    return !FailsPairing(nodeId) && nodeId % 13 == 0;
+}
+
+// Runs the commissioning steps against simulated commissionees, on a simulated clock.
+class SimulatedPipeline : public CommissioningPipeline
+{
+public:
+    SimulatedPipeline(Delegate * aDelegate, const Params & aParams) : CommissioningPipeline(aDelegate), mLimits(aParams) {}
+
+    void RunEvents()
+    {
+        while (!mEvents.empty())
+        {
+            auto event = mEvents.begin();
+            mNow       = event->first;
+            auto run   = std::move(event->second);
+            mEvents.erase(event);
+            run();
+        }
+    }
+
+    uint64_t mNow                   = 0;
+    size_t mMaxInPhase[kPhaseCount] = {};
+
+protected:
+    CHIP_ERROR StartPairing(Lane & aLane, const Device & aDevice) override
+    {
+        SetPhase(aLane, Phase::kPairing);
+        const NodeId nodeId = aDevice.nodeId;
+        At(kPairingMs, [this, &aLane, nodeId] {
+            mLanePhases.erase(&aLane);
+            if (FailsPairing(nodeId))
+            {
+                aLane.OnPairingComplete(CHIP_ERROR_TIMEOUT);
+                return;
+            }
+            aLane.OnPairingComplete(CHIP_NO_ERROR);
+            // The commissioner performs the first step without going through its commissioning delegate.
+            PerformStep(aLane, kSteps[0].stage);
+        });
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR PerformStep(Lane & aLane, CommissioningStage aStage) override
+    {
+        SetPhase(aLane, PhaseOf(aStage));
+
+        const NodeId nodeId = GetDevice(aLane.GetDeviceIndex()).nodeId;
+        const size_t step   = StepIndex(aStage);
+        At(kSteps[step].durationMs, [this, &aLane, nodeId, step] {
+            mLanePhases.erase(&aLane);
+            if (kSteps[step].stage == CommissioningStage::kCleanup)
+            {
+                aLane.OnCommissioningComplete(nodeId,
+                                              FailsAttestation(nodeId) ? CHIP_ERROR_INTEGRITY_CHECK_FAILED : CHIP_NO_ERROR);
+                return;
+            }
+            // As AutoCommissioner moves on to the next stage once a step is finished.
+            const bool failed = kSteps[step].stage == CommissioningStage::kAttestationVerification && FailsAttestation(nodeId);
+            EXPECT_EQ(aLane.PerformStep(failed ? CommissioningStage::kCleanup : kSteps[step + 1].stage), CHIP_NO_ERROR);
+        });
+        return CHIP_NO_ERROR;
+    }
+
+    void ScheduleDispatch() override { At(0, [this] { Dispatch(); }); }
+
+private:
+    static size_t StepIndex(CommissioningStage aStage)
+    {
+        for (size_t i = 0; i < ArraySize(kSteps); i++)
+        {
+            if (kSteps[i].stage == aStage)
+            {
+                return i;
+            }
+        }
+        return ArraySize(kSteps) - 1;
+    }
+
+    size_t GetLimit(Phase aPhase) const
+    {
+        switch (aPhase)
+        {
+        case Phase::kPairing:
+            return mLimits.maxPairing;
+        case Phase::kAttestation:
+            return mLimits.maxAttestation;
+        case Phase::kCredentials:
+            return mLimits.maxCredentials;
+        case Phase::kNetworkSetup:
+            return mLimits.maxNetworkSetup;
+        default:
+            return SIZE_MAX;
+        }
+    }
+
+    // Tracks the phase of the steps being performed, independently of the pipeline, and checks it against the limits.
+    void SetPhase(Lane & aLane, Phase aPhase)
+    {
+        mLanePhases[&aLane] = aPhase;
+        const size_t count =
+            static_cast<size_t>(std::count_if(mLanePhases.begin(), mLanePhases.end(), [aPhase](const auto & lanePhase) {
+                return lanePhase.second == aPhase;
+            }));
+        EXPECT_LE(count, GetLimit(aPhase));
+        EXPECT_LE(count, GetDevicesInPhase(aPhase));
+        mMaxInPhase[static_cast<size_t>(aPhase)] = std::max(mMaxInPhase[static_cast<size_t>(aPhase)], count);
+    }
+
+    void At(uint32_t aDelayMs, std::function<void()> aEvent) { mEvents.emplace(mNow + aDelayMs, std::move(aEvent)); }
+
+    Params mLimits;
+    std::multimap<uint64_t, std::function<void()>> mEvents;
+    std::map<Lane *, Phase> mLanePhases;
+};
+
+class MockDelegate : public CommissioningPipeline::Delegate
+{
+public:
+    void OnDeviceDone(CommissioningPipeline & aPipeline, size_t aDeviceIndex, CHIP_ERROR aError) override
+    {
+        const NodeId nodeId = aPipeline.GetDevice(aDeviceIndex).nodeId;
+        EXPECT_EQ(aError != CHIP_NO_ERROR, FailsPairing(nodeId) || FailsAttestation(nodeId));
+        mDevicesDone++;
+    }
+
+    void OnDone(CommissioningPipeline & aPipeline) override { mDone = true; }
+
+    size_t mDevicesDone = 0;
+    bool mDone          = false;
+};
+
+class TestCommissioningPipeline : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    static constexpr size_t kDeviceCount = 100;
+
+    TestCommissioningPipeline()
+    {
+        for (size_t i = 0; i < kDeviceCount; i++)
+        {
+            mDevices.push_back({ static_cast<NodeId>(i + 1), "MT:-24J0AFN00KA0648G00" });
+        }
+    }
+
+    // Commissions all devices with aLaneCount commissioners, returns the number of devices commissioned per minute.
+    unsigned Commission(size_t aLaneCount, const CommissioningPipeline::Params & aParams)
+    {
+        std::vector<std::unique_ptr<DeviceCommissioner>> commissioners;
+        MockDelegate delegate;
+        SimulatedPipeline pipeline(&delegate, aParams);
+        for (size_t i = 0; i < aLaneCount; i++)
+        {
+            commissioners.push_back(std::make_unique<DeviceCommissioner>());
+            EXPECT_EQ(pipeline.AddCommissioner(commissioners.back().get()), CHIP_NO_ERROR);
+        }
+
+        EXPECT_EQ(pipeline.Start(Span<const CommissioningPipeline::Device>(mDevices.data(), mDevices.size()), aParams),
+                  CHIP_NO_ERROR);
+        EXPECT_TRUE(pipeline.IsInProgress());
+        pipeline.RunEvents();
+
+        EXPECT_TRUE(delegate.mDone);
+        EXPECT_FALSE(pipeline.IsInProgress());
+        EXPECT_EQ(delegate.mDevicesDone, kDeviceCount);
+
+        const size_t pairingFailures = static_cast<size_t>(std::count_if(
+            mDevices.begin(), mDevices.end(), [](const auto & device) { return FailsPairing(device.nodeId); }));
+        const size_t attestationFailures = static_cast<size_t>(std::count_if(
+            mDevices.begin(), mDevices.end(), [](const auto & device) { return FailsAttestation(device.nodeId); }));
+        EXPECT_EQ(pipeline.GetResult().pairingFailures, pairingFailures);
+        EXPECT_EQ(pipeline.GetResult().failed, pairingFailures + attestationFailures);
+        EXPECT_EQ(pipeline.GetResult().succeeded, kDeviceCount - pairingFailures - attestationFailures);
+
+        if (aLaneCount > 1)
+        {
+            // Every limited phase was used up to its limit.
+            EXPECT_EQ(pipeline.mMaxInPhase[static_cast<size_t>(Phase::kPairing)], aParams.maxPairing);
+            EXPECT_EQ(pipeline.mMaxInPhase[static_cast<size_t>(Phase::kNetworkSetup)], aParams.maxNetworkSetup);
+        }
+
+        const unsigned devicesPerMinute = static_cast<unsigned>(kDeviceCount * 60000 / pipeline.mNow);
+        ChipLogProgress(Controller, "Commissioned %u devices in %u s with %u commissioners: %u devices/minute",
+                        static_cast<unsigned>(kDeviceCount), static_cast<unsigned>(pipeline.mNow / 1000),
+                        static_cast<unsigned>(aLaneCount), devicesPerMinute);
+        return devicesPerMinute;
+    }
+
+    std::vector<CommissioningPipeline::Device> mDevices;
+};
+
+TEST_F(TestCommissioningPipeline, OverlapsCommissionings)
+{
+    CommissioningPipeline::Params params;
+    params.maxPairing      = 2;
+    params.maxAttestation  = 4;
+    params.maxCredentials  = 1;
+    params.maxNetworkSetup = 4;
+
+    const unsigned serial    = Commission(1, params);
+    const unsigned pipelined = Commission(8, params);
+
+    // The network setup phase, with up to 4 devices joining at once, is the bottleneck.
+    EXPECT_GT(pipelined, 4 * serial);
+}
+
+TEST_F(TestCommissioningPipeline, StartErrors)
+{
+    DeviceCommissioner commissioner;
+    MockDelegate delegate;
+    CommissioningPipeline::Params params;
+    SimulatedPipeline pipeline(&delegate, params);
+    Span<const CommissioningPipeline::Device> devices(mDevices.data(), mDevices.size());
+
+    EXPECT_EQ(pipeline.Start(devices, params), CHIP_ERROR_INCORRECT_STATE);
+
+    EXPECT_EQ(pipeline.AddCommissioner(&commissioner), CHIP_NO_ERROR);
+
+    params.maxCredentials = 0;
+    EXPECT_EQ(pipeline.Start(devices, params), CHIP_ERROR_INVALID_ARGUMENT);
+
+    params.maxCredentials = 1;
+    EXPECT_EQ(pipeline.Start(Span<const CommissioningPipeline::Device>(), params), CHIP_NO_ERROR);
+    EXPECT_TRUE(delegate.mDone);
+    EXPECT_FALSE(pipeline.IsInProgress());
+}
+
+TEST_F(TestCommissioningPipeline, RestoresCommissioners)
+{
+    class : public DevicePairingDelegate
+    {
+    } pairingDelegate;
+    AutoCommissioner autoCommissioner;
+
+    DeviceCommissioner commissioner;
+    commissioner.RegisterPairingDelegate(&pairingDelegate);
+    commissioner.SetDefaultCommissioner(&autoCommissioner);
+
+    {
+        MockDelegate delegate;
+        CommissioningPipeline pipeline(&delegate);
+        EXPECT_EQ(pipeline.AddCommissioner(&commissioner), CHIP_NO_ERROR);
+        EXPECT_NE(commissioner.GetPairingDelegate(), &pairingDelegate);
+        EXPECT_NE(commissioner.GetDefaultCommissioner(), &autoCommissioner);
+    }
+
+    EXPECT_EQ(commissioner.GetPairingDelegate(), &pairingDelegate);
+    EXPECT_EQ(commissioner.GetDefaultCommissioner(), &autoCommissioner);
+}
+
+} // namespace
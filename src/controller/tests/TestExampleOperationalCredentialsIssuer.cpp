@@ -0,0 +1,297 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <controller/ExampleOperationalCredentialsIssuer.h>
+#include <credentials/CHIPCert.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Controller;
+using namespace chip::Credentials;
+using namespace chip::Crypto;
+
+namespace {
+
+struct IssuedChain
+{
+    CHIP_ERROR status;
+    std::vector<uint8_t> noc;
+    std::vector<uint8_t> icac;
+    std::vector<uint8_t> rcac;
+};
+
+void OnNOCChain(void * context, CHIP_ERROR status, const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                Optional<IdentityProtectionKeySpan> ipk, Optional<NodeId> adminSubject)
+{
+    static_cast<std::vector<IssuedChain> *>(context)->push_back(
+        { status, std::vector<uint8_t>(noc.begin(), noc.end()), std::vector<uint8_t>(icac.begin(), icac.end()),
+          std::vector<uint8_t>(rcac.begin(), rcac.end()) });
+}
+
+// NOCSR elements holding a CSR for the key of a commissionee.
+struct Commissionee
+{
+    P256Keypair keypair;
+    uint8_t nocsrElements[kMIN_CSR_Buffer_Size + 64];
+    size_t nocsrElementsLength = 0;
+
+    CHIP_ERROR Init()
+    {
+        ReturnErrorOnFailure(keypair.Initialize(ECPKeyTarget::ECDSA));
+
+        uint8_t csr[kMIN_CSR_Buffer_Size];
+        size_t csrLength = sizeof(csr);
+        ReturnErrorOnFailure(keypair.NewCertificateSigningRequest(csr, csrLength));
+
+        uint8_t nonce[kCSRNonceLength] = {};
+        TLV::TLVWriter writer;
+        writer.Init(nocsrElements);
+        TLV::TLVType outerType;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(1), ByteSpan(csr, csrLength)));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(2), ByteSpan(nonce)));
+        ReturnErrorOnFailure(writer.EndContainer(outerType));
+        ReturnErrorOnFailure(writer.Finalize());
+        nocsrElementsLength = writer.GetLengthWritten();
+        return CHIP_NO_ERROR;
+    }
+
+    ByteSpan GetNOCSRElements() const { return ByteSpan(nocsrElements, nocsrElementsLength); }
+};
+
+NodeId GetNodeId(const std::vector<uint8_t> & x509Noc)
+{
+    uint8_t chipCert[kMaxCHIPCertLength];
+    MutableByteSpan chipCertSpan(chipCert);
+    NodeId nodeId     = kUndefinedNodeId;
+    FabricId fabricId = kUndefinedFabricId;
+    EXPECT_EQ(ConvertX509CertToChipCert(ByteSpan(x509Noc.data(), x509Noc.size()), chipCertSpan), CHIP_NO_ERROR);
+    EXPECT_EQ(ExtractNodeIdFabricIdFromOpCert(chipCertSpan, &nodeId, &fabricId), CHIP_NO_ERROR);
+    return nodeId;
+}
+
+class TestExampleOperationalCredentialsIssuer : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+        ASSERT_EQ(mIssuer.Initialize(mStorage), CHIP_NO_ERROR);
+#pragma GCC diagnostic pop
+    }
+
+    void MakeCommissionees(size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            mCommissionees.push_back(std::make_unique<Commissionee>());
+            ASSERT_EQ(mCommissionees.back()->Init(), CHIP_NO_ERROR);
+        }
+    }
+
+    std::vector<OperationalCredentialsDelegate::NOCChainRequest> MakeRequests(Callback::Callback<OnNOCChainGeneration> * callback)
+    {
+        std::vector<OperationalCredentialsDelegate::NOCChainRequest> requests(mCommissionees.size());
+        for (size_t i = 0; i < requests.size(); i++)
+        {
+            requests[i].csrElements  = mCommissionees[i]->GetNOCSRElements();
+            requests[i].onCompletion = callback;
+        }
+        return requests;
+    }
+
+    TestPersistentStorageDelegate mStorage;
+    ExampleOperationalCredentialsIssuer mIssuer;
+    std::vector<std::unique_ptr<Commissionee>> mCommissionees;
+};
+
+TEST_F(TestExampleOperationalCredentialsIssuer, GenerateNOCChains)
+{
+    constexpr size_t kCount = 40;
+    MakeCommissionees(kCount);
+
+    std::vector<IssuedChain> chains;
+    Callback::Callback<OnNOCChainGeneration> callback(OnNOCChain, &chains);
+
+    // A single chain, to compare the issuer certificates with.
+    EXPECT_EQ(mIssuer.GenerateNOCChain(mCommissionees[0]->GetNOCSRElements(), ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(),
+                                       ByteSpan(), &callback),
+              CHIP_NO_ERROR);
+    ASSERT_EQ(chains.size(), 1u);
+    const IssuedChain single = chains[0];
+    chains.clear();
+
+    auto requests = MakeRequests(&callback);
+    for (size_t i = 0; i < kCount; i += 2)
+    {
+        requests[i].nodeId = 0x2000 + i;
+    }
+    // A request whose CSR does not verify.
+    uint8_t badElements[kMIN_CSR_Buffer_Size + 64];
+    memcpy(badElements, mCommissionees[3]->nocsrElements, mCommissionees[3]->nocsrElementsLength);
+    badElements[mCommissionees[3]->nocsrElementsLength - 50] ^= 0xFF;
+    requests[3].csrElements = ByteSpan(badElements, mCommissionees[3]->nocsrElementsLength);
+
+    mIssuer.SetBatchVerificationThreads(4);
+    EXPECT_EQ(mIssuer.GenerateNOCChains(Span<const OperationalCredentialsDelegate::NOCChainRequest>(requests.data(), kCount)),
+              CHIP_NO_ERROR);
+    ASSERT_EQ(chains.size(), kCount);
+
+    // Requests without a hint get the next available node ids, in order, even when they fail.
+    NodeId lastAvailableNodeId = GetNodeId(single.noc);
+    for (size_t i = 0; i < kCount; i++)
+    {
+        if (i == 3)
+        {
+            lastAvailableNodeId++;
+            EXPECT_NE(chains[i].status, CHIP_NO_ERROR);
+            EXPECT_TRUE(chains[i].noc.empty());
+            continue;
+        }
+
+        ASSERT_EQ(chains[i].status, CHIP_NO_ERROR);
+        EXPECT_EQ(chains[i].rcac, single.rcac);
+        EXPECT_EQ(chains[i].icac, single.icac);
+
+        P256PublicKey pubkey;
+        EXPECT_EQ(ExtractPubkeyFromX509Cert(ByteSpan(chains[i].noc.data(), chains[i].noc.size()), pubkey), CHIP_NO_ERROR);
+        EXPECT_TRUE(pubkey.Matches(mCommissionees[i]->keypair.Pubkey()));
+
+        const NodeId nodeId = GetNodeId(chains[i].noc);
+        if (requests[i].nodeId != kUndefinedNodeId)
+        {
+            EXPECT_EQ(nodeId, requests[i].nodeId);
+        }
+        else
+        {
+            EXPECT_EQ(nodeId, ++lastAvailableNodeId);
+        }
+    }
+
+    // Requests must all have a callback.
+    chains.clear();
+    requests[kCount - 1].onCompletion = nullptr;
+    EXPECT_EQ(mIssuer.GenerateNOCChains(Span<const OperationalCredentialsDelegate::NOCChainRequest>(requests.data(), kCount)),
+              CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_TRUE(chains.empty());
+}
+
+// A delegate relying on the default implementation of GenerateNOCChains.
+class SingleNOCDelegate : public OperationalCredentialsDelegate
+{
+public:
+    CHIP_ERROR GenerateNOCChain(const ByteSpan & csrElements, const ByteSpan & csrNonce, const ByteSpan & attestationSignature,
+                                const ByteSpan & attestationChallenge, const ByteSpan & DAC, const ByteSpan & PAI,
+                                Callback::Callback<OnNOCChainGeneration> * onCompletion) override
+    {
+        VerifyOrReturnError(!csrElements.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+        mNodeIds.push_back(mNextNodeId);
+        mNextNodeId = kUndefinedNodeId;
+        onCompletion->mCall(onCompletion->mContext, CHIP_NO_ERROR, csrElements, ByteSpan(), ByteSpan(), NullOptional,
+                            NullOptional);
+        return CHIP_NO_ERROR;
+    }
+
+    void SetNodeIdForNextNOCRequest(NodeId nodeId) override { mNextNodeId = nodeId; }
+
+    NodeId mNextNodeId = kUndefinedNodeId;
+    std::vector<NodeId> mNodeIds;
+};
+
+TEST_F(TestExampleOperationalCredentialsIssuer, DefaultGenerateNOCChains)
+{
+    const uint8_t csrElements[] = { 1, 2, 3 };
+    std::vector<IssuedChain> chains;
+    Callback::Callback<OnNOCChainGeneration> callback(OnNOCChain, &chains);
+
+    OperationalCredentialsDelegate::NOCChainRequest requests[3];
+    requests[0].csrElements = ByteSpan(csrElements);
+    requests[0].nodeId      = 42;
+    requests[1].csrElements = ByteSpan(csrElements);
+    for (auto & request : requests)
+    {
+        request.onCompletion = &callback;
+    }
+
+    SingleNOCDelegate delegate;
+    EXPECT_EQ(delegate.GenerateNOCChains(Span<const OperationalCredentialsDelegate::NOCChainRequest>(requests)), CHIP_NO_ERROR);
+    ASSERT_EQ(chains.size(), 3u);
+    EXPECT_EQ(chains[0].status, CHIP_NO_ERROR);
+    EXPECT_EQ(chains[1].status, CHIP_NO_ERROR);
+    // A failure to start generating a chain is reported through the callback.
+    EXPECT_EQ(chains[2].status, CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(delegate.mNodeIds, (std::vector<NodeId>{ 42, kUndefinedNodeId }));
+}
+
+TEST_F(TestExampleOperationalCredentialsIssuer, BatchThroughput)
+{
+    constexpr size_t kCount = 64;
+    MakeCommissionees(kCount);
+
+    std::vector<IssuedChain> chains;
+    chains.reserve(kCount);
+    Callback::Callback<OnNOCChainGeneration> callback(OnNOCChain, &chains);
+    auto requests = MakeRequests(&callback);
+
+    auto certsPerSecond = [](std::chrono::steady_clock::time_point start) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        return static_cast<unsigned>(kCount * 1000000 / static_cast<size_t>(std::max<int64_t>(elapsed.count(), 1)));
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    for (const auto & request : requests)
+    {
+        ASSERT_EQ(mIssuer.GenerateNOCChain(request.csrElements, ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(), ByteSpan(),
+                                           &callback),
+                  CHIP_NO_ERROR);
+    }
+    const unsigned single = certsPerSecond(start);
+
+    for (size_t threads : { 1, 4 })
+    {
+        mIssuer.SetBatchVerificationThreads(threads);
+        start = std::chrono::steady_clock::now();
+        ASSERT_EQ(mIssuer.GenerateNOCChains(Span<const OperationalCredentialsDelegate::NOCChainRequest>(requests.data(), kCount)),
+                  CHIP_NO_ERROR);
+        ChipLogProgress(Controller, "NOC issuance: %u certs/s one by one, %u certs/s in a batch verified on %u threads", single,
+                        certsPerSecond(start), static_cast<unsigned>(threads));
+    }
+
+    ASSERT_EQ(chains.size(), 3 * kCount);
+    for (const auto & chain : chains)
+    {
+        EXPECT_EQ(chain.status, CHIP_NO_ERROR);
+    }
+}
+
+} // namespace
@@ -0,0 +1,301 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/InteractionModelEngine.h>
+#include <app/tests/AppTestContext.h>
+#include <controller/MultiNodeInteraction.h>
+#include <data-model-providers/codegen/Instance.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/ErrorStr.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <protocols/interaction_model/Constants.h>
+#include <transport/Session.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app::Clusters;
+
+namespace {
+
+constexpr EndpointId kTestEndpointId = 1;
+
+// Nodes whose session cannot be established.
+bool IsUnreachable(NodeId nodeId)
+{
+    return nodeId % 7 == 0;
+}
+
+// Hands out the sessions of simulated nodes: nodes with an even id already have a session, the others get theirs once the
+// test completes their lookup.
+class MockDeviceController : public Controller::DeviceController
+{
+public:
+    struct Lookup
+    {
+        NodeId nodeId;
+        Callback::Callback<OnDeviceConnected> * onConnection;
+        Callback::Callback<OnDeviceConnectionFailure> * onFailure;
+    };
+
+    CHIP_ERROR
+    GetConnectedDevice(NodeId peerNodeId, Callback::Callback<OnDeviceConnected> * onConnection,
+                       Callback::Callback<OnDeviceConnectionFailure> * onFailure,
+                       TransportPayloadCapability transportPayloadCapability = TransportPayloadCapability::kMRPPayload) override
+    {
+        mLookups++;
+        if (peerNodeId % 2 == 0)
+        {
+            Complete({ peerNodeId, onConnection, onFailure });
+        }
+        else
+        {
+            mPending.push_back({ peerNodeId, onConnection, onFailure });
+            mMaxPending = std::max(mMaxPending, mPending.size());
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    // Completes the oldest pending lookup, returns false if there is none.
+    bool CompleteOne()
+    {
+        if (mPending.empty())
+        {
+            return false;
+        }
+        Lookup lookup = mPending.front();
+        mPending.erase(mPending.begin());
+        Complete(lookup);
+        return true;
+    }
+
+    void Complete(const Lookup & lookup)
+    {
+        if (IsUnreachable(lookup.nodeId))
+        {
+            lookup.onFailure->mCall(lookup.onFailure->mContext, ScopedNodeId(lookup.nodeId, 1), CHIP_ERROR_TIMEOUT);
+            return;
+        }
+
+        if (mSession != nullptr)
+        {
+            lookup.onConnection->mCall(lookup.onConnection->mContext, *mExchangeManager, *mSession);
+            return;
+        }
+
+        Transport::OutgoingGroupSession session(1, 1);
+        lookup.onConnection->mCall(lookup.onConnection->mContext, mLocalExchangeManager, SessionHandle(session));
+    }
+
+    // Session and exchange manager handed out for every node, by default a placeholder session.
+    const SessionHandle * mSession                = nullptr;
+    Messaging::ExchangeManager * mExchangeManager = nullptr;
+
+    Messaging::ExchangeManager mLocalExchangeManager;
+    std::vector<Lookup> mPending;
+    size_t mMaxPending = 0;
+    size_t mLookups    = 0;
+};
+
+// Interactions that complete when the test says so.
+class MockDelegate : public Controller::MultiNodeInteraction::Delegate
+{
+public:
+    CHIP_ERROR StartNodeInteraction(Controller::MultiNodeInteraction & aInteraction, size_t aNodeIndex,
+                                    Messaging::ExchangeManager & aExchangeMgr, const SessionHandle & aSession) override
+    {
+        // Nodes with an id multiple of 5 answer right away.
+        if (aInteraction.GetNodeId(aNodeIndex) % 5 == 0)
+        {
+            aInteraction.OnNodeInteractionDone(aNodeIndex);
+            return CHIP_NO_ERROR;
+        }
+        mInteracting.push_back(aNodeIndex);
+        mMaxInteracting = std::max(mMaxInteracting, mInteracting.size());
+        return CHIP_NO_ERROR;
+    }
+
+    void OnNodeDone(Controller::MultiNodeInteraction & aInteraction, size_t aNodeIndex, CHIP_ERROR aError) override
+    {
+        mNodesDone++;
+        EXPECT_EQ(aError != CHIP_NO_ERROR, IsUnreachable(aInteraction.GetNodeId(aNodeIndex)));
+    }
+
+    void OnDone(Controller::MultiNodeInteraction & aInteraction) override { mDone = true; }
+
+    bool CompleteOne(Controller::MultiNodeInteraction & aInteraction)
+    {
+        if (mInteracting.empty())
+        {
+            return false;
+        }
+        size_t nodeIndex = mInteracting.front();
+        mInteracting.erase(mInteracting.begin());
+        aInteraction.OnNodeInteractionDone(nodeIndex);
+        // A second completion is ignored.
+        aInteraction.OnNodeInteractionDone(nodeIndex, CHIP_ERROR_INTERNAL);
+        return true;
+    }
+
+    std::vector<size_t> mInteracting;
+    size_t mMaxInteracting = 0;
+    size_t mNodesDone      = 0;
+    bool mDone             = false;
+};
+
+class TestMultiNodeInteraction : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestMultiNodeInteraction, LimitsConcurrency)
+{
+    constexpr size_t kNodeCount = 200;
+    NodeId nodes[kNodeCount];
+    for (size_t i = 0; i < kNodeCount; i++)
+    {
+        nodes[i] = static_cast<NodeId>(i + 1);
+    }
+
+    MockDeviceController controller;
+    MockDelegate delegate;
+    Controller::MultiNodeInteraction interaction(&controller, &delegate);
+
+    Controller::MultiNodeInteraction::Params params;
+    params.maxConcurrentNodes = 8;
+    params.maxSessionSetups   = 3;
+    EXPECT_EQ(interaction.Start(Span<const NodeId>(nodes), params), CHIP_NO_ERROR);
+    EXPECT_TRUE(interaction.IsInProgress());
+    EXPECT_EQ(interaction.Start(Span<const NodeId>(nodes), params), CHIP_ERROR_INCORRECT_STATE);
+
+    // Alternate between sessions and interactions completing, as they would over the network.
+    bool progress = true;
+    while (progress)
+    {
+        const bool lookupDone      = controller.CompleteOne();
+        const bool interactionDone = delegate.CompleteOne(interaction);
+        progress                   = lookupDone || interactionDone;
+        EXPECT_LE(controller.mPending.size() + delegate.mInteracting.size(), params.maxConcurrentNodes);
+    }
+
+    EXPECT_TRUE(delegate.mDone);
+    EXPECT_FALSE(interaction.IsInProgress());
+    EXPECT_EQ(controller.mLookups, kNodeCount);
+    EXPECT_LE(controller.mMaxPending, params.maxSessionSetups);
+    EXPECT_LE(delegate.mMaxInteracting, params.maxConcurrentNodes);
+    EXPECT_EQ(delegate.mNodesDone, kNodeCount);
+
+    const size_t unreachable = static_cast<size_t>(std::count_if(nodes, nodes + kNodeCount, IsUnreachable));
+    EXPECT_EQ(interaction.GetResult().succeeded, kNodeCount - unreachable);
+    EXPECT_EQ(interaction.GetResult().failed, unreachable);
+    EXPECT_EQ(interaction.GetResult().sessionFailures, unreachable);
+}
+
+TEST_F(TestMultiNodeInteraction, EmptyNodeList)
+{
+    MockDeviceController controller;
+    MockDelegate delegate;
+    Controller::MultiNodeInteraction interaction(&controller, &delegate);
+
+    Controller::MultiNodeInteraction::Params params;
+    params.maxSessionSetups = 0;
+    EXPECT_EQ(interaction.Start(Span<const NodeId>(), params), CHIP_ERROR_INVALID_ARGUMENT);
+
+    EXPECT_EQ(interaction.Start(Span<const NodeId>()), CHIP_NO_ERROR);
+    EXPECT_TRUE(delegate.mDone);
+    EXPECT_FALSE(interaction.IsInProgress());
+    EXPECT_EQ(controller.mLookups, 0u);
+}
+
+class TestMultiNodeLoopback : public chip::Test::AppContext
+{
+};
+
+// Sends a command to many simulated nodes, all served by the loopback node. The loopback node has no handler for the
+// command, so every reachable node answers with an UnsupportedEndpoint status.
+TEST_F(TestMultiNodeLoopback, InvokeOnManyNodes)
+{
+    constexpr size_t kNodeCount = 50;
+    NodeId nodes[kNodeCount];
+    for (size_t i = 0; i < kNodeCount; i++)
+    {
+        nodes[i] = static_cast<NodeId>(i + 1);
+    }
+
+    app::InteractionModelEngine::GetInstance()->SetDataModelProvider(app::CodegenDataModelProviderInstance(nullptr /* delegate */));
+
+    SessionHandle session = GetSessionBobToAlice();
+    MockDeviceController controller;
+    controller.mSession         = &session;
+    controller.mExchangeManager = &GetExchangeManager();
+
+    size_t unsupportedEndpoint = 0;
+    size_t unreachable         = 0;
+    bool done                  = false;
+    Controller::MultiNodeInteraction::Result result;
+
+    UnitTesting::Commands::TestSimpleArgumentRequest::Type request;
+    request.arg1 = true;
+
+    Controller::MultiNodeCommandInvoker<UnitTesting::Commands::TestSimpleArgumentRequest::Type> invoker(
+        &controller, kTestEndpointId, request,
+        [](NodeId, const app::ConcreteCommandPath &, const app::StatusIB &, const auto &) { FAIL(); },
+        [&](NodeId nodeId, CHIP_ERROR error) {
+            if (IsUnreachable(nodeId))
+            {
+                EXPECT_EQ(error, CHIP_ERROR_TIMEOUT);
+                unreachable++;
+            }
+            else if (error.IsIMStatus() && app::StatusIB(error).mStatus == Protocols::InteractionModel::Status::UnsupportedEndpoint)
+            {
+                unsupportedEndpoint++;
+            }
+        },
+        [&](const Controller::MultiNodeInteraction::Result & aResult) {
+            result = aResult;
+            done   = true;
+        });
+
+    Controller::MultiNodeInteraction::Params params;
+    params.maxConcurrentNodes = 4;
+    params.maxSessionSetups   = 2;
+    EXPECT_EQ(invoker.Start(Span<const NodeId>(nodes), params), CHIP_NO_ERROR);
+
+    while (!done)
+    {
+        DrainAndServiceIO();
+        if (!controller.CompleteOne())
+        {
+            DrainAndServiceIO();
+            ASSERT_TRUE(done || !controller.mPending.empty());
+        }
+    }
+
+    EXPECT_EQ(result.failed, kNodeCount);
+    EXPECT_EQ(result.sessionFailures, unreachable);
+    EXPECT_EQ(unreachable + unsupportedEndpoint, kNodeCount);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
+} // namespace
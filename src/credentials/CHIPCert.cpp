@@ -27,6 +27,7 @@
 
 #include <stddef.h>
 
+#include <credentials/CHIPCertDecodeCache.h>
 #include <credentials/CHIPCert_Internal.h>
 #include <credentials/CHIPCertificateSet.h>
 #include <lib/asn1/ASN1.h>
@@ -127,17 +128,29 @@ void ChipCertificateSet::Clear()
 
 CHIP_ERROR ChipCertificateSet::LoadCert(const ByteSpan chipCert, BitFlags<CertDecodeFlags> decodeFlags)
 {
-    TLVReader reader;
+    ChipCertificateDecodeCache * decodeCache = GetChipCertificateDecodeCache();
+    if (decodeCache == nullptr)
+    {
+        TLVReader reader;
+
+        reader.Init(chipCert);
+        return LoadCert(reader, decodeFlags, chipCert);
+    }
 
-    reader.Init(chipCert);
-    return LoadCert(reader, decodeFlags, chipCert);
+    ChipCertificateData cert;
+    ReturnErrorOnFailure(decodeCache->Decode(chipCert, cert, decodeFlags));
+    return AddCert(cert);
 }
 
 CHIP_ERROR ChipCertificateSet::LoadCert(TLVReader & reader, BitFlags<CertDecodeFlags> decodeFlags, ByteSpan chipCert)
 {
     ChipCertificateData cert;
     ReturnErrorOnFailure(DecodeChipCert(reader, cert, decodeFlags));
+    return AddCert(cert);
+}
 
+CHIP_ERROR ChipCertificateSet::AddCert(const ChipCertificateData & cert)
+{
     // Verify the cert has both the Subject Key Id and Authority Key Id extensions present.
     // Only certs with both these extensions are supported for the purposes of certificate validation.
     VerifyOrReturnError(cert.mCertFlags.HasAll(CertFlags::kExtPresent_SubjectKeyId, CertFlags::kExtPresent_AuthKeyId),
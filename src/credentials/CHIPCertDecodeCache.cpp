@@ -0,0 +1,289 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a cache of decoded CHIP certificates.
+ *
+ */
+
+#include <credentials/CHIPCertDecodeCache.h>
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+namespace Credentials {
+
+using namespace chip::Crypto;
+
+namespace {
+
+ChipCertificateDecodeCache * gDecodeCache = nullptr;
+
+#if CHIP_CONFIG_CERT_DECODE_CACHE_SIZE > 0
+struct SharedDecodeCache
+{
+    ChipCertificateDecodeCache cache;
+    ChipCertificateDecodeCache::Entry entries[CHIP_CONFIG_CERT_DECODE_CACHE_SIZE];
+};
+
+SharedDecodeCache * gSharedDecodeCache = nullptr;
+size_t gSharedDecodeCacheRefCount      = 0;
+#endif // CHIP_CONFIG_CERT_DECODE_CACHE_SIZE > 0
+
+// Moves a span decoded from the `length` bytes at `from` to the same offset in the buffer at `to`.
+// Returns false if the span does not lie within the buffer it was decoded from.
+bool RebasePointer(const void * data, size_t size, uintptr_t from, size_t length, const uint8_t * to, const uint8_t *& outData)
+{
+    outData = nullptr;
+    VerifyOrReturnValue(data != nullptr, true);
+
+    const uintptr_t address = reinterpret_cast<uintptr_t>(data);
+    VerifyOrReturnValue(address >= from && address - from <= length && size <= length - (address - from), false);
+    outData = to + (address - from);
+    return true;
+}
+
+template <typename T>
+bool RebaseSpan(Span<const T> & span, uintptr_t from, size_t length, const uint8_t * to)
+{
+    const uint8_t * data;
+    VerifyOrReturnValue(RebasePointer(span.data(), span.size() * sizeof(T), from, length, to, data), false);
+    span = (data != nullptr) ? Span<const T>(reinterpret_cast<const T *>(data), span.size()) : Span<const T>();
+    return true;
+}
+
+template <size_t N>
+bool RebaseSpan(FixedByteSpan<N> & span, uintptr_t from, size_t length, const uint8_t * to)
+{
+    const uint8_t * data;
+    VerifyOrReturnValue(RebasePointer(span.data(), N, from, length, to, data), false);
+    span = (data != nullptr) ? FixedByteSpan<N>(data) : FixedByteSpan<N>();
+    return true;
+}
+
+bool RebaseDN(ChipDN & dn, uintptr_t from, size_t length, const uint8_t * to)
+{
+    for (auto & rdn : dn.rdn)
+    {
+        VerifyOrReturnValue(RebaseSpan(rdn.mString, from, length, to), false);
+    }
+    return true;
+}
+
+// Points all the spans of certData, decoded from the `length` bytes at `from`, into the buffer at `to`.
+bool RebaseCertData(ChipCertificateData & certData, uintptr_t from, size_t length, const uint8_t * to)
+{
+    return RebaseSpan(certData.mSerialNumber, from, length, to) && RebaseDN(certData.mSubjectDN, from, length, to) &&
+        RebaseDN(certData.mIssuerDN, from, length, to) && RebaseSpan(certData.mSubjectKeyId, from, length, to) &&
+        RebaseSpan(certData.mAuthKeyId, from, length, to) && RebaseSpan(certData.mPublicKey, from, length, to) &&
+        RebaseSpan(certData.mSignature, from, length, to);
+}
+
+} // namespace
+
+CHIP_ERROR ChipCertificateDecodeCache::Init(Entry * entries, size_t entryCount)
+{
+    VerifyOrReturnError(entries != nullptr && entryCount > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    ReturnErrorOnFailure(System::Mutex::Init(mLock));
+
+    mEntries    = entries;
+    mEntryCount = entryCount;
+    Clear();
+
+    return CHIP_NO_ERROR;
+}
+
+void ChipCertificateDecodeCache::Clear()
+{
+    mLock.Lock();
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        mEntries[i].mLength  = 0;
+        mEntries[i].mLastUse = 0;
+        mEntries[i].mCertData.Clear();
+    }
+    mUseCount  = 0;
+    mHitCount  = 0;
+    mMissCount = 0;
+    mLock.Unlock();
+}
+
+CHIP_ERROR ChipCertificateDecodeCache::Decode(const ByteSpan & chipCert, ChipCertificateData & certData,
+                                              BitFlags<CertDecodeFlags> decodeFlags)
+{
+    uint8_t contentHash[kSHA256_Hash_Length];
+    if (mEntries == nullptr || chipCert.empty() || Hash_SHA256(chipCert.data(), chipCert.size(), contentHash) != CHIP_NO_ERROR)
+    {
+        return DecodeChipCert(chipCert, certData, decodeFlags);
+    }
+
+    if (Lookup(contentHash, chipCert, decodeFlags, certData))
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    ReturnErrorOnFailure(DecodeChipCert(chipCert, certData, decodeFlags));
+    Store(contentHash, chipCert, certData);
+    return CHIP_NO_ERROR;
+}
+
+bool ChipCertificateDecodeCache::Lookup(const uint8_t (&contentHash)[kSHA256_Hash_Length], const ByteSpan & chipCert,
+                                        BitFlags<CertDecodeFlags> decodeFlags, ChipCertificateData & certData)
+{
+    bool found     = false;
+    uintptr_t base = 0;
+
+    mLock.Lock();
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        Entry & entry = mEntries[i];
+        if (entry.mLength != chipCert.size() || memcmp(entry.mContentHash, contentHash, sizeof(contentHash)) != 0)
+        {
+            continue;
+        }
+
+        // A certificate decoded without its TBS hash is decoded again when the hash is needed.
+        if (!decodeFlags.Has(CertDecodeFlags::kGenerateTBSHash) || entry.mCertData.mCertFlags.Has(CertFlags::kTBSHashPresent))
+        {
+            certData       = entry.mCertData;
+            base           = entry.mBase;
+            entry.mLastUse = ++mUseCount;
+            found          = true;
+        }
+        break;
+    }
+    if (found)
+    {
+        mHitCount++;
+    }
+    else
+    {
+        mMissCount++;
+    }
+    mLock.Unlock();
+
+    VerifyOrReturnValue(found, false);
+
+    // Cannot fail, the spans of cached entries were checked to lie within the certificate when stored.
+    VerifyOrDie(RebaseCertData(certData, base, chipCert.size(), chipCert.data()));
+
+    // Hand out the same data as DecodeChipCert() with these flags.
+    if (!decodeFlags.Has(CertDecodeFlags::kGenerateTBSHash))
+    {
+        certData.mCertFlags.Clear(CertFlags::kTBSHashPresent);
+        memset(certData.mTBSHash, 0, sizeof(certData.mTBSHash));
+    }
+    if (decodeFlags.Has(CertDecodeFlags::kIsTrustAnchor))
+    {
+        certData.mCertFlags.Set(CertFlags::kIsTrustAnchor);
+    }
+    return true;
+}
+
+void ChipCertificateDecodeCache::Store(const uint8_t (&contentHash)[kSHA256_Hash_Length], const ByteSpan & chipCert,
+                                       const ChipCertificateData & certData)
+{
+    const uintptr_t base = reinterpret_cast<uintptr_t>(chipCert.data());
+
+    // Only cache data that refers to the certificate buffer, which the offsets of its spans can be taken from.
+    ChipCertificateData checked = certData;
+    VerifyOrReturn(RebaseCertData(checked, base, chipCert.size(), chipCert.data()));
+
+    mLock.Lock();
+    // Replace the entry of this certificate if there is one, the least recently used one otherwise (free entries first).
+    Entry * slot = &mEntries[0];
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        Entry & entry = mEntries[i];
+        if (entry.mLength == chipCert.size() && memcmp(entry.mContentHash, contentHash, sizeof(contentHash)) == 0)
+        {
+            slot = &entry;
+            break;
+        }
+        if (entry.mLastUse < slot->mLastUse)
+        {
+            slot = &entry;
+        }
+    }
+
+    memcpy(slot->mContentHash, contentHash, sizeof(contentHash));
+    slot->mBase     = base;
+    slot->mLength   = chipCert.size();
+    slot->mLastUse  = ++mUseCount;
+    slot->mCertData = certData;
+    slot->mCertData.mCertFlags.Clear(CertFlags::kIsTrustAnchor);
+    mLock.Unlock();
+}
+
+void SetChipCertificateDecodeCache(ChipCertificateDecodeCache * cache)
+{
+    gDecodeCache = cache;
+}
+
+ChipCertificateDecodeCache * GetChipCertificateDecodeCache()
+{
+    return gDecodeCache;
+}
+
+CHIP_ERROR RetainSharedChipCertificateDecodeCache()
+{
+#if CHIP_CONFIG_CERT_DECODE_CACHE_SIZE > 0
+    if (gSharedDecodeCache == nullptr)
+    {
+        // An application provided cache takes precedence.
+        VerifyOrReturnError(gDecodeCache == nullptr, CHIP_NO_ERROR);
+
+        SharedDecodeCache * shared = Platform::New<SharedDecodeCache>();
+        VerifyOrReturnError(shared != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        CHIP_ERROR err = shared->cache.Init(shared->entries, ArraySize(shared->entries));
+        if (err != CHIP_NO_ERROR)
+        {
+            Platform::Delete(shared);
+            return err;
+        }
+
+        gSharedDecodeCache = shared;
+        SetChipCertificateDecodeCache(&shared->cache);
+    }
+    gSharedDecodeCacheRefCount++;
+#endif // CHIP_CONFIG_CERT_DECODE_CACHE_SIZE > 0
+    return CHIP_NO_ERROR;
+}
+
+void ReleaseSharedChipCertificateDecodeCache()
+{
+#if CHIP_CONFIG_CERT_DECODE_CACHE_SIZE > 0
+    VerifyOrReturn(gSharedDecodeCacheRefCount > 0);
+    VerifyOrReturn(--gSharedDecodeCacheRefCount == 0);
+
+    if (gDecodeCache == &gSharedDecodeCache->cache)
+    {
+        SetChipCertificateDecodeCache(nullptr);
+    }
+    Platform::Delete(gSharedDecodeCache);
+    gSharedDecodeCache = nullptr;
+#endif // CHIP_CONFIG_CERT_DECODE_CACHE_SIZE > 0
+}
+
+} // namespace Credentials
+} // namespace chip
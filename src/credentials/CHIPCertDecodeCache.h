@@ -0,0 +1,145 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a cache of decoded CHIP certificates, used when
+ *      loading certificates into a ChipCertificateSet.
+ *
+ */
+
+#pragma once
+
+#include <credentials/CHIPCert.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+#include <system/SystemMutex.h>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ *  @class ChipCertificateDecodeCache
+ *
+ *  @brief
+ *    Cache of decoded CHIP certificates, keyed by the SHA-256 hash of their TLV encoding.
+ *
+ *    Decoding a certificate for validation converts its to-be-signed portion to X.509 DER to hash it, which is
+ *    most of the cost of loading a certificate. Operational credentials verification loads the same RCAC and ICAC
+ *    on every CASE establishment, so the decoded data of recently loaded certificates is kept here and handed out
+ *    again when the same certificate bytes are loaded, whatever buffer they are in.
+ *
+ *    The decoded data of a cached certificate refers to the buffer it was first decoded from only through offsets:
+ *    on a hit, the spans of the returned ChipCertificateData point into the buffer passed by the caller, with the
+ *    same lifetime requirements as DecodeChipCert().
+ *
+ *    The cache is shared by all ChipCertificateSet instances once installed with SetChipCertificateDecodeCache(),
+ *    and may be used from several threads (e.g. CASE certificate validation runs as background work).
+ */
+class DLL_EXPORT ChipCertificateDecodeCache
+{
+public:
+    struct Entry
+    {
+        uint8_t mContentHash[Crypto::kSHA256_Hash_Length];
+        uintptr_t mBase   = 0; // Address of the buffer the certificate was decoded from, for span offsets
+        size_t mLength    = 0; // 0 when the entry is free
+        uint32_t mLastUse = 0;
+        ChipCertificateData mCertData;
+    };
+
+    ChipCertificateDecodeCache() = default;
+
+    ChipCertificateDecodeCache(const ChipCertificateDecodeCache &)             = delete;
+    ChipCertificateDecodeCache & operator=(const ChipCertificateDecodeCache &) = delete;
+
+    /**
+     * @brief Initialize the cache with externally allocated entries.
+     *
+     * @param entries     A pointer to the array of cache entries.
+     * @param entryCount  Number of entries in the array.
+     *
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR Init(Entry * entries, size_t entryCount);
+
+    /**
+     * @brief Drop all cached certificates.
+     **/
+    void Clear();
+
+    /**
+     * @brief Decode CHIP certificate, from the cache when the same certificate was decoded before.
+     *        Same contract as DecodeChipCert(): the CHIP certificate in the chipCert buffer must stay valid while
+     *        the certData is used.
+     *
+     * @param chipCert     Buffer containing CHIP certificate.
+     * @param certData     Structure containing data extracted from the CHIP certificate.
+     * @param decodeFlags  Certificate decoding option flags.
+     *
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR Decode(const ByteSpan & chipCert, ChipCertificateData & certData, BitFlags<CertDecodeFlags> decodeFlags);
+
+    size_t GetHitCount() const { return mHitCount; }
+    size_t GetMissCount() const { return mMissCount; }
+
+private:
+    bool Lookup(const uint8_t (&contentHash)[Crypto::kSHA256_Hash_Length], const ByteSpan & chipCert,
+                BitFlags<CertDecodeFlags> decodeFlags, ChipCertificateData & certData);
+    void Store(const uint8_t (&contentHash)[Crypto::kSHA256_Hash_Length], const ByteSpan & chipCert,
+               const ChipCertificateData & certData);
+
+    Entry * mEntries   = nullptr;
+    size_t mEntryCount = 0;
+    uint32_t mUseCount = 0;
+    size_t mHitCount   = 0;
+    size_t mMissCount  = 0;
+    System::Mutex mLock;
+};
+
+/**
+ * @brief Install the decode cache used by ChipCertificateSet::LoadCert(). nullptr, the default, disables caching.
+ *        The cache must stay valid until it is uninstalled.
+ **/
+void SetChipCertificateDecodeCache(ChipCertificateDecodeCache * cache);
+
+/**
+ * @return The decode cache used by ChipCertificateSet::LoadCert(), or nullptr if none is installed.
+ **/
+ChipCertificateDecodeCache * GetChipCertificateDecodeCache();
+
+/**
+ * @brief Install the decode cache of CHIP_CONFIG_CERT_DECODE_CACHE_SIZE entries shared by the Server and the
+ *        device controllers of the process, allocating it on first use. Does nothing if another cache was
+ *        installed with SetChipCertificateDecodeCache(), or if CHIP_CONFIG_CERT_DECODE_CACHE_SIZE is 0.
+ *
+ *        Each successful call must be balanced by ReleaseSharedChipCertificateDecodeCache(). Must be called
+ *        with the CHIP stack lock held.
+ *
+ * @return Returns CHIP_ERROR_NO_MEMORY if the cache could not be allocated, CHIP_NO_ERROR otherwise
+ **/
+CHIP_ERROR RetainSharedChipCertificateDecodeCache();
+
+/**
+ * @brief Balance a RetainSharedChipCertificateDecodeCache() call. The last release uninstalls and frees the cache.
+ **/
+void ReleaseSharedChipCertificateDecodeCache();
+
+} // namespace Credentials
+} // namespace chip
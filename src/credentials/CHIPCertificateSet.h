@@ -164,6 +164,7 @@ public:
      *        It is required that the CHIP certificate in the chipCert buffer stays valid while
      *        the certificate data in the set is used.
      *        In case of an error the certificate set is left in the same state as prior to this call.
+     *        The certificate is decoded through the ChipCertificateDecodeCache, if one is installed.
      *
      * @param chipCert     Buffer containing certificate encoded in CHIP format.
      * @param decodeFlags  Certificate decoding option flags.
@@ -261,6 +262,16 @@ private:
     uint8_t mMaxCerts;            /**< Length of mCerts array. */
     bool mMemoryAllocInternal;    /**< Indicates whether temporary memory buffers are allocated internally. */
 
+    /**
+     * @brief Add decoded certificate data to the set, unless the certificate is already in it.
+     *        Only certificates supported for the purposes of certificate validation are accepted.
+     *
+     * @param cert  Decoded certificate data.
+     *
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR AddCert(const ChipCertificateData & cert);
+
     /**
      * @brief Find and validate CHIP certificate.
      *
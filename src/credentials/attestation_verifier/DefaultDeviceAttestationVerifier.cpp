@@ -41,6 +41,37 @@ namespace {
 // As per specifications section 11.22.5.1. Constant RESP_MAX
 constexpr size_t kMaxResponseLength = 900;
 
+constexpr System::Clock::Seconds32 kVerificationCacheLifetime(CHIP_CONFIG_DAC_VERIFIER_CACHE_LIFETIME_SECS);
+
+// Unexpired entry of a verification cache for the given hash, nullptr if there is none.
+template <typename Entry, size_t N>
+Entry * FindCachedResult(std::array<Entry, N> & cache, const uint8_t * hash, System::Clock::Timestamp now)
+{
+    for (auto & entry : cache)
+    {
+        if (entry.expiry > now && memcmp(entry.hash, hash, sizeof(entry.hash)) == 0)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+// Entry of a verification cache to store a new result in: an unused or expired one, else the one expiring first.
+template <typename Entry, size_t N>
+Entry * AllocateCachedResult(std::array<Entry, N> & cache)
+{
+    Entry * candidate = nullptr;
+    for (auto & entry : cache)
+    {
+        if (candidate == nullptr || entry.expiry < candidate->expiry)
+        {
+            candidate = &entry;
+        }
+    }
+    return candidate;
+}
+
 // Test CD Signing Key from `credentials/test/certification-declaration/Chip-Test-CD-Signing-Cert.pem`
 // used to verify any in-SDK development CDs. The associated keypair to do actual signing is in
 // `credentials/test/certification-declaration/Chip-Test-CD-Signing-Key.pem`.
@@ -320,6 +351,7 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
     AttestationCertVidPid dacVidPid;
     AttestationCertVidPid paiVidPid;
     AttestationCertVidPid paaVidPid;
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
 
     VerifyOrExit(!info.attestationElementsBuffer.empty() && !info.attestationChallengeBuffer.empty() &&
                      !info.attestationSignatureBuffer.empty() && !info.dacDerBuffer.empty() &&
@@ -451,8 +483,36 @@ void DefaultDACVerifier::VerifyAttestationInformation(const DeviceAttestationVer
         VerifyOrExit(attestationNonceSpan.data_equal(info.attestationNonceBuffer),
                      attestationError = AttestationVerificationResult::kAttestationNonceMismatch);
 
-        attestationError = ValidateCertificationDeclarationSignature(certificationDeclarationSpan, certificationDeclarationPayload);
-        VerifyOrExit(attestationError == AttestationVerificationResult::kSuccess, attestationError = attestationError);
+        uint8_t cdHash[kSHA256_Hash_Length];
+        VerifyOrExit(Hash_SHA256(certificationDeclarationSpan.data(), certificationDeclarationSpan.size(), cdHash) == CHIP_NO_ERROR,
+                     attestationError = AttestationVerificationResult::kInternalError);
+
+        CachedCdResult * cachedCd = FindCachedResult(mCachedCdResults, cdHash, now);
+        P256PublicKey cdVerifyingKey;
+        if (cachedCd != nullptr &&
+            (LookupCdVerifyingKey(certificationDeclarationSpan, cdVerifyingKey) != AttestationVerificationResult::kSuccess ||
+             !cdVerifyingKey.Matches(cachedCd->verifyingKey)))
+        {
+            // The signing key is no longer trusted, or was replaced: check the signature again.
+            cachedCd->expiry = System::Clock::kZero;
+            cachedCd->cdPayload.Free();
+            cachedCd = nullptr;
+        }
+
+        if (cachedCd != nullptr)
+        {
+            certificationDeclarationPayload = ByteSpan(cachedCd->cdPayload.Get(), cachedCd->cdPayload.AllocatedSize());
+        }
+        else
+        {
+            attestationError =
+                ValidateCertificationDeclarationSignature(certificationDeclarationSpan, certificationDeclarationPayload);
+            VerifyOrExit(attestationError == AttestationVerificationResult::kSuccess, attestationError = attestationError);
+            if (LookupCdVerifyingKey(certificationDeclarationSpan, cdVerifyingKey) == AttestationVerificationResult::kSuccess)
+            {
+                CacheVerifiedCd(cdHash, certificationDeclarationPayload, cdVerifyingKey, now);
+            }
+        }
 
         attestationError = ValidateCertificateDeclarationPayload(certificationDeclarationPayload, firmwareInfoSpan, deviceInfo);
         VerifyOrExit(attestationError == AttestationVerificationResult::kSuccess, attestationError = attestationError);
@@ -462,14 +522,38 @@ exit:
     onCompletion->mCall(onCompletion->mContext, info, attestationError);
 }
 
-AttestationVerificationResult DefaultDACVerifier::ValidateCertificationDeclarationSignature(const ByteSpan & cmsEnvelopeBuffer,
-                                                                                            ByteSpan & certDeclBuffer)
+void DefaultDACVerifier::CacheVerifiedCd(const uint8_t * cdHash, const ByteSpan & cdPayload, const P256PublicKey & verifyingKey,
+                                         System::Clock::Timestamp now)
+{
+    CachedCdResult * entry = AllocateCachedResult(mCachedCdResults);
+    VerifyOrReturn(entry != nullptr);
+
+    entry->expiry = System::Clock::kZero;
+    entry->cdPayload.Free();
+    VerifyOrReturn(entry->cdPayload.Alloc(cdPayload.size()).Get() != nullptr);
+
+    memcpy(entry->cdPayload.Get(), cdPayload.data(), cdPayload.size());
+    memcpy(entry->hash, cdHash, sizeof(entry->hash));
+    entry->verifyingKey = verifyingKey;
+    entry->expiry       = now + kVerificationCacheLifetime;
+}
+
+void DefaultDACVerifier::ClearVerificationCache()
+{
+    for (auto & entry : mCachedCdResults)
+    {
+        entry.expiry = System::Clock::kZero;
+        entry.cdPayload.Free();
+    }
+}
+
+AttestationVerificationResult DefaultDACVerifier::LookupCdVerifyingKey(const ByteSpan & cmsEnvelopeBuffer,
+                                                                       P256PublicKey & verifyingKey) const
 {
     ByteSpan kid;
     VerifyOrReturnError(CMS_ExtractKeyId(cmsEnvelopeBuffer, kid) == CHIP_NO_ERROR,
                         AttestationVerificationResult::kCertificationDeclarationNoKeyId);
 
-    Crypto::P256PublicKey verifyingKey;
     CHIP_ERROR err = mCdKeysTrustStore.LookupVerifyingKey(kid, verifyingKey);
     VerifyOrReturnError(err == CHIP_NO_ERROR, AttestationVerificationResult::kCertificationDeclarationNoCertificateFound);
 
@@ -479,6 +563,16 @@ AttestationVerificationResult DefaultDACVerifier::ValidateCertificationDeclarati
         return AttestationVerificationResult::kCertificationDeclarationNoCertificateFound;
     }
 
+    return AttestationVerificationResult::kSuccess;
+}
+
+AttestationVerificationResult DefaultDACVerifier::ValidateCertificationDeclarationSignature(const ByteSpan & cmsEnvelopeBuffer,
+                                                                                            ByteSpan & certDeclBuffer)
+{
+    Crypto::P256PublicKey verifyingKey;
+    AttestationVerificationResult result = LookupCdVerifyingKey(cmsEnvelopeBuffer, verifyingKey);
+    VerifyOrReturnError(result == AttestationVerificationResult::kSuccess, result);
+
     VerifyOrReturnError(CMS_Verify(cmsEnvelopeBuffer, verifyingKey, certDeclBuffer) == CHIP_NO_ERROR,
                         AttestationVerificationResult::kCertificationDeclarationInvalidSignature);
 
@@ -21,8 +21,10 @@
 #include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/Span.h>
 #include <stdlib.h>
+#include <system/SystemClock.h>
 
 namespace chip {
 namespace Credentials {
@@ -88,12 +90,40 @@ public:
         mRevocationDelegate = revocationDelegate;
     }
 
+    /**
+     * @brief Forget the certification declarations checked for previous devices.
+     *
+     * Cached results are only used while the trust store still holds the CD signing key they were checked
+     * against, so this is not needed for trust store changes to take effect. It frees the memory held by
+     * the cache.
+     */
+    void ClearVerificationCache();
+
 protected:
     DefaultDACVerifier() {}
 
+    // Certification declaration whose signature was successfully validated, with its payload.
+    struct CachedCdResult
+    {
+        // SHA-256 of the CMS envelope of the certification declaration.
+        uint8_t hash[Crypto::kSHA256_Hash_Length];
+        System::Clock::Timestamp expiry = System::Clock::kZero;
+        Crypto::P256PublicKey verifyingKey;
+        Platform::ScopedMemoryBufferWithSize<uint8_t> cdPayload;
+    };
+
+    void CacheVerifiedCd(const uint8_t * cdHash, const ByteSpan & cdPayload, const Crypto::P256PublicKey & verifyingKey,
+                         System::Clock::Timestamp now);
+
+    // Trusted key to verify the signature of the given certification declaration with.
+    AttestationVerificationResult LookupCdVerifyingKey(const ByteSpan & cmsEnvelopeBuffer,
+                                                       Crypto::P256PublicKey & verifyingKey) const;
+
     CsaCdKeysTrustStore mCdKeysTrustStore;
     const AttestationTrustStore * mAttestationTrustStore;
     DeviceAttestationRevocationDelegate * mRevocationDelegate = nullptr;
+
+    std::array<CachedCdResult, CHIP_CONFIG_DAC_VERIFIER_CACHE_SIZE> mCachedCdResults;
 };
 
 /**
@@ -17,6 +17,8 @@
 #include "FileAttestationTrustStore.h"
 
 #include <crypto/CHIPCryptoPAL.h>
+
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <string>
@@ -38,19 +40,58 @@ const char * GetFilenameExtension(const char * filename)
     }
     return dot + 1;
 }
+
+int CompareSKID(const uint8_t * a, const uint8_t * b)
+{
+    return memcmp(a, b, Crypto::kSubjectKeyIdentifierLength);
+}
 } // namespace
 
 FileAttestationTrustStore::FileAttestationTrustStore(const char * paaTrustStorePath)
 {
     VerifyOrReturn(paaTrustStorePath != nullptr);
 
-    if (paaTrustStorePath != nullptr)
+    mPAATrustStorePath = paaTrustStorePath;
+    Reload();
+}
+
+CHIP_ERROR FileAttestationTrustStore::Reload()
+{
+    VerifyOrReturnError(!mPAATrustStorePath.empty(), CHIP_ERROR_INCORRECT_STATE);
+
+    std::vector<std::vector<uint8_t>> certs = LoadAllX509DerCerts(mPAATrustStorePath.c_str());
+    VerifyOrReturnError(!certs.empty(), CHIP_ERROR_CA_CERT_NOT_FOUND);
+
+    mPAADerCerts = std::move(certs);
+    UpdatePAAIndex();
+    mIsInitialized = true;
+
+    ChipLogProgress(NotSpecified, "Loaded %u PAA certificates from %s", static_cast<unsigned>(paaCount()),
+                    mPAATrustStorePath.c_str());
+    return CHIP_NO_ERROR;
+}
+
+void FileAttestationTrustStore::UpdatePAAIndex()
+{
+    mPAAIndex.clear();
+    mPAAIndex.reserve(mPAADerCerts.size());
+
+    for (size_t i = 0; i < mPAADerCerts.size(); i++)
     {
-        mPAADerCerts = LoadAllX509DerCerts(paaTrustStorePath);
-        VerifyOrReturn(paaCount());
+        PAAIndexEntry entry;
+        MutableByteSpan skidSpan{ entry.skid };
+        ByteSpan certSpan{ mPAADerCerts[i].data(), mPAADerCerts[i].size() };
+        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(certSpan, skidSpan) || skidSpan.size() != entry.skid.size())
+        {
+            continue;
+        }
+        entry.certIndex = i;
+        mPAAIndex.push_back(entry);
     }
 
-    mIsInitialized = true;
+    std::stable_sort(mPAAIndex.begin(), mPAAIndex.end(), [](const PAAIndexEntry & a, const PAAIndexEntry & b) {
+        return CompareSKID(a.skid.data(), b.skid.data()) < 0;
+    });
 }
 
 std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePath, CertificateValidationMode validationMode)
@@ -121,7 +162,7 @@ std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePat
 
                     if (isValid)
                     {
-                        certs.push_back(certificate);
+                        certs.push_back(std::move(certificate));
                     }
                 }
                 fclose(file);
@@ -141,6 +182,7 @@ FileAttestationTrustStore::~FileAttestationTrustStore()
 void FileAttestationTrustStore::Cleanup()
 {
     mPAADerCerts.clear();
+    mPAAIndex.clear();
     mIsInitialized = false;
 }
 
@@ -158,20 +200,14 @@ CHIP_ERROR FileAttestationTrustStore::GetProductAttestationAuthorityCert(const B
     VerifyOrReturnError(!skid.empty() && (skid.data() != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(skid.size() == Crypto::kSubjectKeyIdentifierLength, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto candidate : mPAADerCerts)
+    auto entry =
+        std::lower_bound(mPAAIndex.begin(), mPAAIndex.end(), skid, [](const PAAIndexEntry & candidate, const ByteSpan & key) {
+            return CompareSKID(candidate.skid.data(), key.data()) < 0;
+        });
+    if (entry != mPAAIndex.end() && CompareSKID(entry->skid.data(), skid.data()) == 0)
     {
-        uint8_t skidBuf[Crypto::kSubjectKeyIdentifierLength] = { 0 };
-        MutableByteSpan candidateSkidSpan{ skidBuf };
-        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(ByteSpan{ candidate.data(), candidate.size() }, candidateSkidSpan))
-        {
-            continue;
-        }
-
-        if (skid.data_equal(candidateSkidSpan))
-        {
-            // Found a match
-            return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDerBuffer);
-        }
+        const std::vector<uint8_t> & paaCert = mPAADerCerts[entry->certIndex];
+        return CopySpanToMutableSpan(ByteSpan{ paaCert.data(), paaCert.size() }, outPaaDerBuffer);
     }
 
     return CHIP_ERROR_CA_CERT_NOT_FOUND;
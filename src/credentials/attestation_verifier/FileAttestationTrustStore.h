@@ -20,6 +20,7 @@
 #include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
 
 #include <array>
+#include <string>
 #include <vector>
 
 namespace chip {
@@ -49,6 +50,12 @@ enum class CertificateValidationMode
 std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePath,
                                                       CertificateValidationMode validationMode = CertificateValidationMode::kPAA);
 
+/**
+ * @brief Attestation trust store backed by the PAA certificates found in a directory.
+ *
+ * The certificates are loaded once and indexed by subject key identifier, so that a lookup neither scans nor
+ * re-parses them. Reload() picks up certificates added to or removed from the directory afterwards.
+ */
 class FileAttestationTrustStore : public AttestationTrustStore
 {
 public:
@@ -57,13 +64,37 @@ public:
 
     CHIP_ERROR GetProductAttestationAuthorityCert(const ByteSpan & skid, MutableByteSpan & outPaaDerBuffer) const override;
 
+    /**
+     * @brief Load the PAA certificates from the trust store path again, replacing the ones loaded before.
+     *
+     * Must not be called concurrently with lookups. If no certificate can be loaded, the ones loaded before are kept.
+     *
+     * @return CHIP_ERROR_INCORRECT_STATE if the trust store has no path, CHIP_ERROR_CA_CERT_NOT_FOUND if no valid PAA
+     *         certificate was found at the path.
+     */
+    CHIP_ERROR Reload();
+
     bool IsInitialized() const { return mIsInitialized; }
     size_t paaCount() const { return mPAADerCerts.size(); };
 
 protected:
+    /**
+     * @brief Rebuild the SKID index of mPAADerCerts, to be called by derived classes that change mPAADerCerts.
+     */
+    void UpdatePAAIndex();
+
     std::vector<std::vector<uint8_t>> mPAADerCerts;
 
 private:
+    struct PAAIndexEntry
+    {
+        std::array<uint8_t, Crypto::kSubjectKeyIdentifierLength> skid;
+        size_t certIndex;
+    };
+
+    std::string mPAATrustStorePath;
+    // Sorted by SKID, certificates with the same SKID in the order they were loaded.
+    std::vector<PAAIndexEntry> mPAAIndex;
     bool mIsInitialized = false;
 
     void Cleanup();
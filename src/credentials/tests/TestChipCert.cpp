@@ -27,6 +27,7 @@
 #include <pw_unit_test/framework.h>
 
 #include <credentials/CHIPCert.h>
+#include <credentials/CHIPCertDecodeCache.h>
 #include <credentials/examples/LastKnownGoodTimeCertificateValidityPolicyExample.h>
 #include <credentials/examples/StrictCertificateValidityPolicyExample.h>
 #include <crypto/CHIPCryptoPAL.h>
@@ -2197,3 +2198,107 @@ TEST_F(TestChipCert, TestChipCert_KeypairConversion)
     // but both our code and standard tools include them, so we can just compare.
     EXPECT_TRUE(keypairDer.data_equal(sTestCert_PDCID01_KeypairDER));
 }
+
+TEST_F(TestChipCert, TestChipCert_DecodeCache)
+{
+    ChipCertificateDecodeCache::Entry entries[2];
+    ChipCertificateDecodeCache cache;
+    EXPECT_EQ(cache.Init(entries, 0), CHIP_ERROR_INVALID_ARGUMENT);
+    ASSERT_EQ(cache.Init(entries, ArraySize(entries)), CHIP_NO_ERROR);
+
+    ByteSpan root;
+    ByteSpan ica;
+    ByteSpan noc;
+    ASSERT_EQ(GetTestCert(TestCert::kRoot01, sNullLoadFlag, root), CHIP_NO_ERROR);
+    ASSERT_EQ(GetTestCert(TestCert::kICA01, sNullLoadFlag, ica), CHIP_NO_ERROR);
+    ASSERT_EQ(GetTestCert(TestCert::kNode01_01, sNullLoadFlag, noc), CHIP_NO_ERROR);
+
+    // Decoding through the cache gives the same data as decoding the certificate, pointing into the given buffer.
+    auto expectDecode = [&cache](const ByteSpan & cert, BitFlags<CertDecodeFlags> decodeFlags) {
+        uint8_t copy[kMaxCHIPCertLength];
+        ASSERT_LE(cert.size(), sizeof(copy));
+        memcpy(copy, cert.data(), cert.size());
+        const ByteSpan copySpan(copy, cert.size());
+
+        ChipCertificateData expected;
+        ChipCertificateData certData;
+        EXPECT_EQ(DecodeChipCert(copySpan, expected, decodeFlags), CHIP_NO_ERROR);
+        EXPECT_EQ(cache.Decode(copySpan, certData, decodeFlags), CHIP_NO_ERROR);
+        EXPECT_TRUE(certData.IsEqual(expected));
+        EXPECT_EQ(certData.mPublicKey.data(), expected.mPublicKey.data());
+        EXPECT_EQ(certData.mSubjectDN.rdn[0].mString.data(), expected.mSubjectDN.rdn[0].mString.data());
+        EXPECT_EQ(certData.mSignature.data(), expected.mSignature.data());
+    };
+
+    expectDecode(root, sTrustAnchorFlag);
+    expectDecode(root, sNullDecodeFlag);
+    expectDecode(root, sTrustAnchorFlag);
+    EXPECT_EQ(cache.GetMissCount(), 1u);
+    EXPECT_EQ(cache.GetHitCount(), 2u);
+
+    // Entries decoded without the TBS hash are decoded again when it is needed.
+    expectDecode(ica, sNullDecodeFlag);
+    expectDecode(ica, sGenTBSHashFlag);
+    expectDecode(ica, sNullDecodeFlag);
+    expectDecode(ica, sGenTBSHashFlag);
+    EXPECT_EQ(cache.GetMissCount(), 3u);
+    EXPECT_EQ(cache.GetHitCount(), 4u);
+
+    // The least recently used certificate (the root) is replaced.
+    expectDecode(noc, sGenTBSHashFlag);
+    expectDecode(ica, sGenTBSHashFlag);
+    EXPECT_EQ(cache.GetMissCount(), 4u);
+    EXPECT_EQ(cache.GetHitCount(), 5u);
+    expectDecode(root, sTrustAnchorFlag);
+    EXPECT_EQ(cache.GetMissCount(), 5u);
+
+    // Invalid certificates are not cached.
+    uint8_t invalid[] = { 0x15, 0x18 };
+    ChipCertificateData certData;
+    EXPECT_NE(cache.Decode(ByteSpan(invalid), certData, sNullDecodeFlag), CHIP_NO_ERROR);
+    EXPECT_NE(cache.Decode(ByteSpan(invalid), certData, sNullDecodeFlag), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.GetMissCount(), 7u);
+
+    // Certificate sets load certificates through the installed cache.
+    ChipCertificateDecodeCache::Entry setEntries[kStandardCertsCount];
+    ChipCertificateDecodeCache setCache;
+    ASSERT_EQ(setCache.Init(setEntries, ArraySize(setEntries)), CHIP_NO_ERROR);
+    SetChipCertificateDecodeCache(&setCache);
+    for (int i = 0; i < 2; i++)
+    {
+        ChipCertificateSet certSet;
+        ASSERT_EQ(certSet.Init(kStandardCertsCount), CHIP_NO_ERROR);
+        EXPECT_EQ(LoadTestCertSet01(certSet), CHIP_NO_ERROR);
+
+        ValidationContext validContext;
+        validContext.Reset();
+        validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+        validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+        EXPECT_EQ(certSet.ValidateCert(certSet.GetLastCert(), validContext), CHIP_NO_ERROR);
+        EXPECT_EQ(validContext.mTrustAnchor, &certSet.GetCertSet()[0]);
+    }
+    SetChipCertificateDecodeCache(nullptr);
+    EXPECT_EQ(setCache.GetMissCount(), 3u);
+    EXPECT_EQ(setCache.GetHitCount(), 3u);
+
+    // The shared cache stays installed until its last user, e.g. a Server and a controller, releases it.
+    ASSERT_EQ(RetainSharedChipCertificateDecodeCache(), CHIP_NO_ERROR);
+    ChipCertificateDecodeCache * shared = GetChipCertificateDecodeCache();
+#if CHIP_CONFIG_CERT_DECODE_CACHE_SIZE > 0
+    EXPECT_NE(shared, nullptr);
+#endif
+    ASSERT_EQ(RetainSharedChipCertificateDecodeCache(), CHIP_NO_ERROR);
+    EXPECT_EQ(GetChipCertificateDecodeCache(), shared);
+    ReleaseSharedChipCertificateDecodeCache();
+    EXPECT_EQ(GetChipCertificateDecodeCache(), shared);
+    ReleaseSharedChipCertificateDecodeCache();
+    EXPECT_EQ(GetChipCertificateDecodeCache(), nullptr);
+
+    // A cache installed by the application is left in place.
+    SetChipCertificateDecodeCache(&setCache);
+    ASSERT_EQ(RetainSharedChipCertificateDecodeCache(), CHIP_NO_ERROR);
+    EXPECT_EQ(GetChipCertificateDecodeCache(), &setCache);
+    ReleaseSharedChipCertificateDecodeCache();
+    EXPECT_EQ(GetChipCertificateDecodeCache(), &setCache);
+    SetChipCertificateDecodeCache(nullptr);
+}
@@ -38,6 +38,7 @@
 
 #include "CHIPAttCert_test_vectors.h"
 
+#include <chrono>
 #include <fstream>
 
 using namespace chip;
@@ -50,6 +51,22 @@ namespace {
 static const ByteSpan kExpectedDacPublicKey = DevelopmentCerts::kDacPublicKey;
 static const ByteSpan kExpectedPaiPublicKey = DevelopmentCerts::kPaiPublicKey;
 
+// Test PAA roots, all of which can be removed at once.
+class RemovablePaaTrustStore : public AttestationTrustStore
+{
+public:
+    CHIP_ERROR GetProductAttestationAuthorityCert(const ByteSpan & skid, MutableByteSpan & outPaaDerBuffer) const override
+    {
+        VerifyOrReturnError(!mRemoved, CHIP_ERROR_CA_CERT_NOT_FOUND);
+        return GetTestAttestationTrustStore()->GetProductAttestationAuthorityCert(skid, outPaaDerBuffer);
+    }
+
+    void RemovePaas() { mRemoved = true; }
+
+private:
+    bool mRemoved = false;
+};
+
 } // namespace
 
 struct TestDeviceAttestationCredentials : public ::testing::Test
@@ -227,6 +244,59 @@ TEST_F(TestDeviceAttestationCredentials, TestDACVerifierExample_AttestationInfoV
     default_verifier->VerifyAttestationInformation(info, &attestationInformationVerificationCallback);
 
     EXPECT_EQ(attestationResult, AttestationVerificationResult::kSuccess);
+
+    // Devices sharing the CD of a device verified before skip its signature check, but not their own checks.
+    DefaultDACVerifier cachingVerifier(GetTestAttestationTrustStore());
+
+    constexpr int kVerifications = 20;
+    auto start                   = std::chrono::steady_clock::now();
+    for (int i = 0; i < kVerifications; i++)
+    {
+        attestationResult = AttestationVerificationResult::kNotImplemented;
+        cachingVerifier.VerifyAttestationInformation(info, &attestationInformationVerificationCallback);
+        EXPECT_EQ(attestationResult, AttestationVerificationResult::kSuccess);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    ChipLogProgress(Crypto, "Attestation verification: %u us on average", static_cast<unsigned>(elapsed.count() / kVerifications));
+
+    uint8_t wrongNonce[sizeof(attestationNonceTestVector)];
+    memcpy(wrongNonce, attestationNonceTestVector, sizeof(wrongNonce));
+    wrongNonce[0] ^= 0xFF;
+    Credentials::DeviceAttestationVerifier::AttestationInfo wrongNonceInfo(
+        ByteSpan(attestationElementsTestVector), ByteSpan(attestationChallengeTestVector), ByteSpan(attestationSignatureTestVector),
+        TestCerts::sTestCert_PAI_FFF1_8000_Cert, TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert, ByteSpan(wrongNonce),
+        static_cast<VendorId>(0xFFF1), 0x8000);
+    cachingVerifier.VerifyAttestationInformation(wrongNonceInfo, &attestationInformationVerificationCallback);
+    EXPECT_EQ(attestationResult, AttestationVerificationResult::kAttestationNonceMismatch);
+
+    uint8_t wrongSignature[sizeof(attestationSignatureTestVector)];
+    memcpy(wrongSignature, attestationSignatureTestVector, sizeof(wrongSignature));
+    wrongSignature[10] ^= 0xFF;
+    Credentials::DeviceAttestationVerifier::AttestationInfo wrongSignatureInfo(
+        ByteSpan(attestationElementsTestVector), ByteSpan(attestationChallengeTestVector), ByteSpan(wrongSignature),
+        TestCerts::sTestCert_PAI_FFF1_8000_Cert, TestCerts::sTestCert_DAC_FFF1_8000_0004_Cert, ByteSpan(attestationNonceTestVector),
+        static_cast<VendorId>(0xFFF1), 0x8000);
+    cachingVerifier.VerifyAttestationInformation(wrongSignatureInfo, &attestationInformationVerificationCallback);
+    EXPECT_EQ(attestationResult, AttestationVerificationResult::kAttestationSignatureInvalid);
+
+    cachingVerifier.ClearVerificationCache();
+    cachingVerifier.VerifyAttestationInformation(info, &attestationInformationVerificationCallback);
+    EXPECT_EQ(attestationResult, AttestationVerificationResult::kSuccess);
+
+    // Cached results are not used once the CD signing key they were checked against is no longer trusted, and the
+    // PAA is looked up for every device.
+    RemovablePaaTrustStore removablePaaStore;
+    DefaultDACVerifier trustStoreVerifier(&removablePaaStore);
+    trustStoreVerifier.VerifyAttestationInformation(info, &attestationInformationVerificationCallback);
+    EXPECT_EQ(attestationResult, AttestationVerificationResult::kSuccess);
+
+    trustStoreVerifier.EnableCdTestKeySupport(false);
+    trustStoreVerifier.VerifyAttestationInformation(info, &attestationInformationVerificationCallback);
+    EXPECT_EQ(attestationResult, AttestationVerificationResult::kCertificationDeclarationNoCertificateFound);
+
+    removablePaaStore.RemovePaas();
+    trustStoreVerifier.VerifyAttestationInformation(info, &attestationInformationVerificationCallback);
+    EXPECT_EQ(attestationResult, AttestationVerificationResult::kPaaNotFound);
 }
 
 TEST_F(TestDeviceAttestationCredentials, TestDACVerifierExample_CertDeclarationVerification)
@@ -0,0 +1,170 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <credentials/CHIPCert.h>
+#include <credentials/attestation_verifier/FileAttestationTrustStore.h>
+#include <credentials/attestation_verifier/TestPAAStore.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include "CHIPAttCert_test_vectors.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::TestCerts;
+
+namespace {
+
+struct TestFileAttestationTrustStore : public ::testing::Test
+{
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        char dirTemplate[] = "/tmp/paa-trust-store-XXXXXX";
+        ASSERT_NE(mkdtemp(dirTemplate), nullptr);
+        mDir = dirTemplate;
+    }
+
+    void TearDown() override
+    {
+        for (const auto & file : mFiles)
+        {
+            unlink(file.c_str());
+        }
+        rmdir(mDir.c_str());
+    }
+
+    void WriteFile(const char * name, const ByteSpan & contents)
+    {
+        std::string path = mDir + "/" + name;
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(contents.data()), static_cast<std::streamsize>(contents.size()));
+        mFiles.push_back(path);
+    }
+
+    void RemoveFiles()
+    {
+        for (const auto & file : mFiles)
+        {
+            unlink(file.c_str());
+        }
+        mFiles.clear();
+    }
+
+    static void ExpectFound(const FileAttestationTrustStore & store, const ByteSpan & skid, const ByteSpan & expectedCert)
+    {
+        uint8_t buf[kMaxDERCertLength];
+        MutableByteSpan paaCert(buf);
+        EXPECT_EQ(store.GetProductAttestationAuthorityCert(skid, paaCert), CHIP_NO_ERROR);
+        EXPECT_TRUE(paaCert.data_equal(expectedCert));
+    }
+
+    static void ExpectNotFound(const FileAttestationTrustStore & store, const ByteSpan & skid)
+    {
+        uint8_t buf[kMaxDERCertLength];
+        MutableByteSpan paaCert(buf);
+        EXPECT_EQ(store.GetProductAttestationAuthorityCert(skid, paaCert), CHIP_ERROR_CA_CERT_NOT_FOUND);
+    }
+
+    std::string mDir;
+    std::vector<std::string> mFiles;
+};
+
+TEST_F(TestFileAttestationTrustStore, TestLookup)
+{
+    const uint8_t notACert[] = { 0x30, 0x03, 0x02, 0x01, 0x00 };
+
+    WriteFile("Chip-Test-PAA-FFF1-Cert.der", sTestCert_PAA_FFF1_Cert);
+    WriteFile("Chip-Test-PAA-NoVID-Cert.der", sTestCert_PAA_NoVID_Cert);
+    WriteFile("Not-A-Cert.der", ByteSpan(notACert));
+    WriteFile("Chip-Test-PAA-FFF2-Cert.pem", sTestCert_PAA_FFF2_ValInFuture_Cert);
+
+    FileAttestationTrustStore store(mDir.c_str());
+    EXPECT_TRUE(store.IsInitialized());
+    EXPECT_EQ(store.paaCount(), 2u);
+
+    ExpectFound(store, sTestCert_PAA_FFF1_SKID, sTestCert_PAA_FFF1_Cert);
+    ExpectFound(store, sTestCert_PAA_NoVID_SKID, sTestCert_PAA_NoVID_Cert);
+    ExpectNotFound(store, sTestCert_PAA_FFF2_ValInFuture_SKID);
+
+    uint8_t buf[kMaxDERCertLength];
+    MutableByteSpan paaCert(buf);
+    EXPECT_EQ(store.GetProductAttestationAuthorityCert(ByteSpan(), paaCert), CHIP_ERROR_INVALID_ARGUMENT);
+
+    MutableByteSpan smallBuffer(buf, 10);
+    EXPECT_EQ(store.GetProductAttestationAuthorityCert(sTestCert_PAA_FFF1_SKID, smallBuffer), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    // Lookups go through the SKID index rather than re-parsing every certificate.
+    constexpr int kLookups = 10000;
+    auto start             = std::chrono::steady_clock::now();
+    for (int i = 0; i < kLookups; i++)
+    {
+        paaCert = MutableByteSpan(buf);
+        ASSERT_EQ(store.GetProductAttestationAuthorityCert((i % 2) ? sTestCert_PAA_FFF1_SKID : sTestCert_PAA_NoVID_SKID, paaCert),
+                  CHIP_NO_ERROR);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    ChipLogProgress(NotSpecified, "PAA lookup: %u ns on average", static_cast<unsigned>(elapsed.count() / kLookups));
+}
+
+TEST_F(TestFileAttestationTrustStore, TestReload)
+{
+    FileAttestationTrustStore noPathStore;
+    EXPECT_FALSE(noPathStore.IsInitialized());
+    EXPECT_EQ(noPathStore.Reload(), CHIP_ERROR_INCORRECT_STATE);
+
+    // Nothing to load yet.
+    FileAttestationTrustStore store(mDir.c_str());
+    EXPECT_FALSE(store.IsInitialized());
+    EXPECT_EQ(store.Reload(), CHIP_ERROR_CA_CERT_NOT_FOUND);
+
+    WriteFile("Chip-Test-PAA-FFF1-Cert.der", sTestCert_PAA_FFF1_Cert);
+    EXPECT_EQ(store.Reload(), CHIP_NO_ERROR);
+    EXPECT_TRUE(store.IsInitialized());
+    EXPECT_EQ(store.paaCount(), 1u);
+    ExpectFound(store, sTestCert_PAA_FFF1_SKID, sTestCert_PAA_FFF1_Cert);
+    ExpectNotFound(store, sTestCert_PAA_FFF2_ValInFuture_SKID);
+
+    WriteFile("Chip-Test-PAA-FFF2-Cert.der", sTestCert_PAA_FFF2_ValInFuture_Cert);
+    EXPECT_EQ(store.Reload(), CHIP_NO_ERROR);
+    EXPECT_EQ(store.paaCount(), 2u);
+    ExpectFound(store, sTestCert_PAA_FFF1_SKID, sTestCert_PAA_FFF1_Cert);
+    ExpectFound(store, sTestCert_PAA_FFF2_ValInFuture_SKID, sTestCert_PAA_FFF2_ValInFuture_Cert);
+
+    // Certificates loaded before are kept when none can be loaded.
+    RemoveFiles();
+    EXPECT_EQ(store.Reload(), CHIP_ERROR_CA_CERT_NOT_FOUND);
+    EXPECT_EQ(store.paaCount(), 2u);
+    ExpectFound(store, sTestCert_PAA_FFF2_ValInFuture_SKID, sTestCert_PAA_FFF2_ValInFuture_Cert);
+}
+
+} // namespace
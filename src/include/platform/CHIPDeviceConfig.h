@@ -127,6 +127,17 @@
 #define CHIP_DEVICE_CONFIG_BG_TASK_PRIORITY 1
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+ *
+ * The number of threads processing background events, on platforms running several of them
+ * (POSIX). Background work, such as the cryptographic steps of CASE session establishment,
+ * is then spread over this many threads.
+ */
+#ifndef CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+#define CHIP_DEVICE_CONFIG_BG_TASK_COUNT 1
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE
  *
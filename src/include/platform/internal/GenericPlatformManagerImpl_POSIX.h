@@ -36,6 +36,10 @@
 #include <pthread.h>
 #include <queue>
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && CHIP_SYSTEM_CONFIG_USE_LIBEV
+#error "Background event processing posts events from other threads, which the libev main loop does not support"
+#endif
+
 namespace chip {
 namespace DeviceLayer {
 namespace Internal {
@@ -97,6 +101,13 @@ protected:
     bool _IsChipStackLockedByCurrentThread() const;
 #endif
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    CHIP_ERROR _PostBackgroundEvent(const ChipDeviceEvent * event);
+    void _RunBackgroundEventLoop();
+    CHIP_ERROR _StartBackgroundEventLoopTask();
+    CHIP_ERROR _StopBackgroundEventLoopTask();
+#endif
+
     // ===== Methods available to the implementation subclass.
 
 private:
@@ -113,6 +124,25 @@ private:
     static void * EventLoopTaskMain(void * arg);
 #endif
     void ProcessDeviceEvents();
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    static void * BackgroundEventLoopTaskMain(void * arg);
+
+    // Stops the background threads from picking up work and hands the work they did not start over to the CHIP
+    // thread, without waiting for the work in progress.
+    void StopBackgroundEventLoop();
+    void JoinBackgroundEventLoopTasks();
+
+    // Background events are shared by a pool of CHIP_DEVICE_CONFIG_BG_TASK_COUNT threads. The queue
+    // and the run flag are guarded by mBackgroundEventQueueLock.
+    std::queue<ChipDeviceEvent> mBackgroundEventQueue;
+    pthread_mutex_t mBackgroundEventQueueLock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t mBackgroundEventQueueCond  = PTHREAD_COND_INITIALIZER;
+    bool mShouldRunBackgroundEventLoop        = false;
+
+    pthread_t mBackgroundTasks[CHIP_DEVICE_CONFIG_BG_TASK_COUNT];
+    size_t mBackgroundTaskCount = 0;
+#endif
 };
 
 // Instruct the compiler to instantiate the template only when explicitly told to do so.
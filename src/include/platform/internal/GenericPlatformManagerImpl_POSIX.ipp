@@ -40,8 +40,11 @@
 #include <fcntl.h>
 #include <poll.h>
 #include <sched.h>
+#include <string.h>
 #include <unistd.h>
 
+#include <utility>
+
 namespace chip {
 namespace DeviceLayer {
 namespace Internal {
@@ -72,6 +75,10 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_InitChipStack()
     VerifyOrReturnError(ret == 0, CHIP_ERROR_POSIX(ret));
 #endif
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    ReturnErrorOnFailure(_StartBackgroundEventLoopTask());
+#endif
+
     return CHIP_NO_ERROR;
 }
 
@@ -211,6 +218,11 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunEventLoop()
 
     pthread_mutex_unlock(&mStateLock);
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    // The background threads are stopped with the event loop, start them again if the loop is restarted.
+    LogErrorOnFailure(_StartBackgroundEventLoopTask());
+#endif
+
     Impl()->LockChipStack();
 
     SystemLayerSocketsLoop().EventLoopBegins();
@@ -226,6 +238,11 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunEventLoop()
 
         ProcessDeviceEvents();
     } while (mShouldRunEventLoop.load(std::memory_order_relaxed));
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    // Background work handed over by StopEventLoopTask() may have been posted after the last pass of the loop.
+    ProcessDeviceEvents();
+#endif
     SystemLayerSocketsLoop().EventLoopEnds();
 
     Impl()->UnlockChipStack();
@@ -320,6 +337,13 @@ template <class ImplClass>
 CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StopEventLoopTask()
 {
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    // Stop the background threads while the event loop still runs, so that the work they did not start is processed
+    // before the loop exits. They are joined by Shutdown(): the work in progress may be waiting for the CHIP stack
+    // lock, which the caller can hold.
+    StopBackgroundEventLoop();
+#endif
+
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
     // with libev, the mainloop is set up and managed externally
     mState.store(State::kStopping, std::memory_order_relaxed);
@@ -383,6 +407,147 @@ exit:
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 }
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostBackgroundEvent(const ChipDeviceEvent * event)
+{
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+    if (!mShouldRunBackgroundEventLoop)
+    {
+        pthread_mutex_unlock(&mBackgroundEventQueueLock);
+        // Without background threads, process the event on the CHIP thread.
+        return Impl()->PostEvent(event);
+    }
+    mBackgroundEventQueue.push(*event);
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+
+    pthread_cond_signal(&mBackgroundEventQueueCond);
+    return CHIP_NO_ERROR;
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunBackgroundEventLoop()
+{
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+    if (!mShouldRunBackgroundEventLoop)
+    {
+        pthread_mutex_unlock(&mBackgroundEventQueueLock);
+        ChipLogError(DeviceLayer, "Background event loop must be started with StartBackgroundEventLoopTask()");
+        return;
+    }
+
+    while (true)
+    {
+        while (mShouldRunBackgroundEventLoop && mBackgroundEventQueue.empty())
+        {
+            pthread_cond_wait(&mBackgroundEventQueueCond, &mBackgroundEventQueueLock);
+        }
+        if (!mShouldRunBackgroundEventLoop)
+        {
+            break;
+        }
+
+        const ChipDeviceEvent event = mBackgroundEventQueue.front();
+        mBackgroundEventQueue.pop();
+
+        // Several threads dispatch background events concurrently, none of them holds the CHIP stack lock.
+        pthread_mutex_unlock(&mBackgroundEventQueueLock);
+        Impl()->DispatchEvent(&event);
+        pthread_mutex_lock(&mBackgroundEventQueueLock);
+    }
+
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+}
+
+template <class ImplClass>
+void * GenericPlatformManagerImpl_POSIX<ImplClass>::BackgroundEventLoopTaskMain(void * arg)
+{
+    ChipLogDetail(DeviceLayer, "CHIP background task running");
+    static_cast<GenericPlatformManagerImpl_POSIX<ImplClass> *>(arg)->Impl()->RunBackgroundEventLoop();
+    return nullptr;
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartBackgroundEventLoopTask()
+{
+    int err = 0;
+
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+    bool alreadyRunning           = mShouldRunBackgroundEventLoop;
+    mShouldRunBackgroundEventLoop = true;
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+    VerifyOrReturnError(!alreadyRunning, CHIP_NO_ERROR);
+
+    // Threads of a pool stopped with the event loop are only exiting, reclaim them before starting new ones.
+    JoinBackgroundEventLoopTasks();
+
+    for (mBackgroundTaskCount = 0; mBackgroundTaskCount < CHIP_DEVICE_CONFIG_BG_TASK_COUNT; mBackgroundTaskCount++)
+    {
+        err = pthread_create(&mBackgroundTasks[mBackgroundTaskCount], nullptr, BackgroundEventLoopTaskMain, this);
+        if (err != 0)
+        {
+            break;
+        }
+    }
+
+    if (err != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to start background task: %s", strerror(err));
+        _StopBackgroundEventLoopTask();
+    }
+
+    return CHIP_ERROR_POSIX(err);
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StopBackgroundEventLoopTask()
+{
+    StopBackgroundEventLoop();
+    JoinBackgroundEventLoopTasks();
+    return CHIP_NO_ERROR;
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::StopBackgroundEventLoop()
+{
+    std::queue<ChipDeviceEvent> pendingEvents;
+
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+    mShouldRunBackgroundEventLoop = false;
+    std::swap(pendingEvents, mBackgroundEventQueue);
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+    pthread_cond_broadcast(&mBackgroundEventQueueCond);
+
+    // Work scheduled but not yet picked up still has to run, hand it over to the CHIP thread.
+    while (!pendingEvents.empty())
+    {
+        if (Impl()->PostEvent(&pendingEvents.front()) != CHIP_NO_ERROR)
+        {
+            ChipLogError(DeviceLayer, "Failed to hand over background event type %d", pendingEvents.front().Type);
+        }
+        pendingEvents.pop();
+    }
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::JoinBackgroundEventLoopTasks()
+{
+    for (size_t i = 0; i < mBackgroundTaskCount; i++)
+    {
+        // A background task stopping the pool cannot wait for itself.
+        if (pthread_equal(pthread_self(), mBackgroundTasks[i]))
+        {
+            pthread_detach(mBackgroundTasks[i]);
+            continue;
+        }
+        pthread_join(mBackgroundTasks[i], nullptr);
+    }
+    mBackgroundTaskCount = 0;
+}
+
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
 {
@@ -393,6 +558,10 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
     //
     VerifyOrDie(mState.load(std::memory_order_relaxed) == State::kStopped);
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    _StopBackgroundEventLoopTask();
+#endif
+
 #if !CHIP_SYSTEM_CONFIG_USE_LIBEV
     pthread_mutex_destroy(&mStateLock);
     pthread_cond_destroy(&mEventQueueStoppedCond);
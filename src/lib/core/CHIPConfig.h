@@ -769,6 +769,17 @@
 #define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + 2)
 #endif // CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_PEER_RESOURCE_STATS_RETAINED_PEERS
+ *
+ * @brief Number of peers whose resource usage counters are kept once all
+ * their secure sessions are released (see SessionManager::GetPeerResourceStats).
+ * The peer whose counters were updated the least recently is forgotten first.
+ */
+#ifndef CHIP_CONFIG_PEER_RESOURCE_STATS_RETAINED_PEERS
+#define CHIP_CONFIG_PEER_RESOURCE_STATS_RETAINED_PEERS 8
+#endif // CHIP_CONFIG_PEER_RESOURCE_STATS_RETAINED_PEERS
+
 /**
  *  @def CHIP_CONFIG_MAX_GROUP_DATA_PEERS
  *
@@ -904,6 +915,19 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_REPORTS_IN_FLIGHT 4
 #endif
 
+/**
+ * @def CHIP_IM_MAX_REPORTS_IN_FLIGHT_PER_PEER
+ *
+ * @brief Defines the maximum number of Reports in flight to a single peer, out of CHIP_IM_MAX_REPORTS_IN_FLIGHT, so that a
+ * peer slow to acknowledge reports cannot hold every report slot. Reports of the peer beyond the limit are sent once one of its
+ * reports is acknowledged.
+ *
+ * The default value does not limit peers any further than CHIP_IM_MAX_REPORTS_IN_FLIGHT.
+ */
+#ifndef CHIP_IM_MAX_REPORTS_IN_FLIGHT_PER_PEER
+#define CHIP_IM_MAX_REPORTS_IN_FLIGHT_PER_PEER CHIP_IM_MAX_REPORTS_IN_FLIGHT
+#endif
+
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS
  *
@@ -1032,6 +1056,26 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CONTROLLER_MAX_ACTIVE_CASE_CLIENTS 16
 #endif
 
+/**
+ * @def CHIP_CONFIG_CONTROLLER_MAX_MULTI_NODE_INTERACTIONS
+ *
+ * @brief Number of nodes a MultiNodeInteraction can simultaneously work with,
+ * from looking up their session until their interaction completes.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_MAX_MULTI_NODE_INTERACTIONS
+#define CHIP_CONFIG_CONTROLLER_MAX_MULTI_NODE_INTERACTIONS 16
+#endif
+
+/**
+ * @def CHIP_CONFIG_CONTROLLER_MAX_COMMISSIONING_PIPELINE_LANES
+ *
+ * @brief Number of commissioners a CommissioningPipeline can use, each
+ * commissioning one device at a time.
+ */
+#ifndef CHIP_CONFIG_CONTROLLER_MAX_COMMISSIONING_PIPELINE_LANES
+#define CHIP_CONFIG_CONTROLLER_MAX_COMMISSIONING_PIPELINE_LANES 16
+#endif
+
 /**
  * @def CHIP_CONFIG_DEVICE_MAX_ACTIVE_CASE_CLIENTS
  *
@@ -1237,6 +1281,21 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE (3 * CHIP_CONFIG_MAX_FABRICS)
 #endif
 
+/**
+ * @def CHIP_CONFIG_ENABLE_CASE_DESTINATION_ID_CACHE
+ *
+ * @brief
+ *   Enable caching, in the CASE server, of the per-fabric IPKs and root public
+ *   keys used to match the destination identifier of incoming Sigma1 messages.
+ *
+ *   This avoids reading the IPK key set of every fabric from storage on every
+ *   Sigma1, which matters on nodes joined to many fabrics, at the cost of about
+ *   130 bytes of RAM per fabric.
+ */
+#ifndef CHIP_CONFIG_ENABLE_CASE_DESTINATION_ID_CACHE
+#define CHIP_CONFIG_ENABLE_CASE_DESTINATION_ID_CACHE 0
+#endif
+
 /**
  * @def CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD
  *
@@ -1337,6 +1396,32 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_RESUBSCRIBE_WAIT_TIME_MULTIPLIER_MS 10000
 #endif
 
+/**
+ *  @def CHIP_CONFIG_IM_MAX_READ_CLIENT_INDEX_BUCKETS
+ *
+ *  @brief
+ *    Upper bound on the number of hash buckets used by the interaction model engine to look up
+ *    active subscriptions (ReadClients) by peer. The index starts small and doubles as subscriptions
+ *    are added, so this only bounds the memory spent on controllers holding very many subscriptions.
+ *    Must be a power of two.
+ */
+#ifndef CHIP_CONFIG_IM_MAX_READ_CLIENT_INDEX_BUCKETS
+#define CHIP_CONFIG_IM_MAX_READ_CLIENT_INDEX_BUCKETS 65536
+#endif
+
+/**
+ *  @def CHIP_CONFIG_DATA_MODEL_INDEXED_STRUCT_DECODE
+ *
+ *  @brief
+ *    When enabled, DataModel::DecodeStruct, which decodes cluster structs, commands and events, looks fields up
+ *    in a table of their tags, trying the field following the last decoded one first, and dispatches on the
+ *    field index. When disabled, each element's tag is compared with every field in turn, which may produce
+ *    slightly smaller code.
+ */
+#ifndef CHIP_CONFIG_DATA_MODEL_INDEXED_STRUCT_DECODE
+#define CHIP_CONFIG_DATA_MODEL_INDEXED_STRUCT_DECODE 1
+#endif
+
 /*
  * @def CHIP_CONFIG_MAX_ATTRIBUTE_STORE_ELEMENT_SIZE
  *
@@ -1459,6 +1544,42 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_NUM_CD_KEY_SLOTS 5
 #endif // CHIP_CONFIG_NUM_CD_KEY_SLOTS
 
+/**
+ * @def CHIP_CONFIG_DAC_VERIFIER_CACHE_SIZE
+ *
+ * @brief Number of certification declarations for which the default device attestation verifier
+ *        remembers a successful signature check, so that it is not repeated for the next devices
+ *        sharing them. 0 disables the cache.
+ *
+ */
+#ifndef CHIP_CONFIG_DAC_VERIFIER_CACHE_SIZE
+#define CHIP_CONFIG_DAC_VERIFIER_CACHE_SIZE 4
+#endif // CHIP_CONFIG_DAC_VERIFIER_CACHE_SIZE
+
+/**
+ * @def CHIP_CONFIG_DAC_VERIFIER_CACHE_LIFETIME_SECS
+ *
+ * @brief Time after which the default device attestation verifier checks a cached
+ *        certification declaration again.
+ *
+ */
+#ifndef CHIP_CONFIG_DAC_VERIFIER_CACHE_LIFETIME_SECS
+#define CHIP_CONFIG_DAC_VERIFIER_CACHE_LIFETIME_SECS 3600
+#endif // CHIP_CONFIG_DAC_VERIFIER_CACHE_LIFETIME_SECS
+
+/**
+ * @def CHIP_CONFIG_CERT_DECODE_CACHE_SIZE
+ *
+ * @brief Number of decoded CHIP certificates kept by the decode cache that the Server and the
+ *        device controllers share, see RetainSharedChipCertificateDecodeCache(). Each entry
+ *        holds a ChipCertificateData, allocated while a Server or controller is running.
+ *        0 disables the cache.
+ *
+ */
+#ifndef CHIP_CONFIG_CERT_DECODE_CACHE_SIZE
+#define CHIP_CONFIG_CERT_DECODE_CACHE_SIZE 4
+#endif // CHIP_CONFIG_CERT_DECODE_CACHE_SIZE
+
 /**
  * @def CHIP_CONFIG_MAX_SUBSCRIPTION_RESUMPTION_STORAGE_CONCURRENT_ITERATORS
  *
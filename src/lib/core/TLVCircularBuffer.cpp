@@ -106,6 +106,30 @@ void TLVCircularBuffer::Init(uint8_t * inBuffer, uint32_t inBufferLength)
     mImplicitProfileId = kCommonProfileId;
 }
 
+/**
+ * @brief
+ *   Resume a TLVCircularBuffer whose backing store already holds TLV data
+ *
+ * The buffer must have been initialized with the backing store, e.g. a store which outlived a restart. Only the bounds of the
+ * queue are checked; the caller is responsible for validating the TLV data itself.
+ *
+ * @param[in] inHeadOffset   Offset of the oldest element within the backing store
+ *
+ * @param[in] inDataLength   Length, in bytes, of the data held in the queue
+ *
+ * @retval #CHIP_NO_ERROR               On success.
+ * @retval #CHIP_ERROR_INVALID_ARGUMENT If the queue does not fit within the backing store.
+ */
+CHIP_ERROR TLVCircularBuffer::Resume(uint32_t inHeadOffset, uint32_t inDataLength)
+{
+    VerifyOrReturnError(mQueue != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(inHeadOffset < mQueueSize && inDataLength <= mQueueSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mQueueHead   = mQueue + inHeadOffset;
+    mQueueLength = inDataLength;
+    return CHIP_NO_ERROR;
+}
+
 /**
  * @brief
  *   Evicts the oldest top-level TLV element in the TLVCircularBuffer
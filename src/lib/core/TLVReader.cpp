@@ -769,18 +769,29 @@ CHIP_ERROR TLVReader::ReadElement()
 
     // 17 = 1 control byte + 8 tag bytes + 8 length/value bytes
     uint8_t stagingBuf[17];
+    const uint8_t * p;
 
-    // Odd workaround: clang-tidy claims garbage value otherwise as it does not
-    // understand that ReadData initializes stagingBuf
-    stagingBuf[1] = 0;
+    if (static_cast<size_t>(mBufEnd - mReadPoint) >= elemHeadBytes)
+    {
+        // The head of the element is within the current input buffer, which is always the
+        // case for contiguous inputs: parse it in place.  +1 to skip over the control byte.
+        p = mReadPoint + 1;
+        mReadPoint += elemHeadBytes;
+        mLenRead += elemHeadBytes;
+    }
+    else
+    {
+        // Odd workaround: clang-tidy claims garbage value otherwise as it does not
+        // understand that ReadData initializes stagingBuf
+        stagingBuf[1] = 0;
 
-    // If the head of the element goes past the end of the current input buffer,
-    // we need to read it into the staging buffer to parse it.  Just do that unconditionally,
-    // even if the head does not go past end of current buffer, to save codesize.
-    ReturnErrorOnFailure(ReadData(stagingBuf, elemHeadBytes));
+        // The head of the element goes past the end of the current input buffer, so
+        // we need to read it into the staging buffer to parse it.
+        ReturnErrorOnFailure(ReadData(stagingBuf, elemHeadBytes));
 
-    // +1 to skip over the control byte
-    const uint8_t * p = stagingBuf + 1;
+        // +1 to skip over the control byte
+        p = stagingBuf + 1;
+    }
 
     // Read the tag field, if present.
     mElemTag      = ReadTag(tagControl, p);
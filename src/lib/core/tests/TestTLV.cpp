@@ -43,6 +43,7 @@
 
 #include <system/TLVPacketBufferBackingStore.h>
 
+#include <algorithm>
 #include <stdlib.h>
 #include <string.h>
 
@@ -3815,6 +3816,117 @@ void TestTLVReader_SkipOverContainer()
     ForEachElement(reader, nullptr, TestTLVReader_SkipOverContainer_ProcessElement);
 }
 
+/**
+ * Backing store handing out its data in chunks of a fixed size, so that elements straddle buffers.
+ */
+class ChunkedBackingStore : public TLVBackingStore
+{
+public:
+    ChunkedBackingStore(const uint8_t * data, uint32_t dataLen, uint32_t chunkLen) :
+        mData(data), mDataLen(dataLen), mChunkLen(chunkLen)
+    {}
+
+    CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        mOffset = 0;
+        return GetNextBuffer(reader, bufStart, bufLen);
+    }
+
+    CHIP_ERROR GetNextBuffer(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = mData + mOffset;
+        bufLen   = std::min(mChunkLen, mDataLen - mOffset);
+        mOffset += bufLen;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnInit(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR GetNewBuffer(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    const uint8_t * mData;
+    uint32_t mDataLen;
+    uint32_t mChunkLen;
+    uint32_t mOffset = 0;
+};
+
+void TestTLVReaderCompareElements(TLVReader & expected, TLVReader & reader)
+{
+    while (true)
+    {
+        CHIP_ERROR err = expected.Next();
+        EXPECT_EQ(reader.Next(), err);
+        if (err != CHIP_NO_ERROR)
+        {
+            return;
+        }
+
+        EXPECT_EQ(reader.GetTag(), expected.GetTag());
+        EXPECT_EQ(reader.GetType(), expected.GetType());
+        EXPECT_EQ(reader.GetLength(), expected.GetLength());
+        EXPECT_EQ(reader.GetLengthRead(), expected.GetLengthRead());
+
+        switch (expected.GetType())
+        {
+        case kTLVType_SignedInteger: {
+            int64_t expectedValue = 0, value = 0;
+            EXPECT_EQ(expected.Get(expectedValue), CHIP_NO_ERROR);
+            EXPECT_EQ(reader.Get(value), CHIP_NO_ERROR);
+            EXPECT_EQ(value, expectedValue);
+            break;
+        }
+        case kTLVType_UnsignedInteger: {
+            uint64_t expectedValue = 0, value = 0;
+            EXPECT_EQ(expected.Get(expectedValue), CHIP_NO_ERROR);
+            EXPECT_EQ(reader.Get(value), CHIP_NO_ERROR);
+            EXPECT_EQ(value, expectedValue);
+            break;
+        }
+        case kTLVType_Structure:
+        case kTLVType_Array:
+        case kTLVType_List: {
+            TLVType expectedOuter, outer;
+            EXPECT_EQ(expected.EnterContainer(expectedOuter), CHIP_NO_ERROR);
+            EXPECT_EQ(reader.EnterContainer(outer), CHIP_NO_ERROR);
+            TestTLVReaderCompareElements(expected, reader);
+            EXPECT_EQ(expected.ExitContainer(expectedOuter), CHIP_NO_ERROR);
+            EXPECT_EQ(reader.ExitContainer(outer), CHIP_NO_ERROR);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+/**
+ * Test that elements whose head straddles input buffers read the same as contiguous ones.
+ */
+void TestTLVReaderSplitBuffers()
+{
+    for (uint32_t chunkLen = 1; chunkLen <= 17; chunkLen++)
+    {
+        ChunkedBackingStore backingStore(Encoding1, sizeof(Encoding1), chunkLen);
+        TLVReader expected;
+        TLVReader reader;
+
+        expected.Init(Encoding1);
+        expected.ImplicitProfileId = TestProfile_2;
+        EXPECT_EQ(reader.Init(backingStore, sizeof(Encoding1)), CHIP_NO_ERROR);
+        reader.ImplicitProfileId = TestProfile_2;
+
+        TestTLVReaderCompareElements(expected, reader);
+        EXPECT_EQ(reader.GetLengthRead(), static_cast<uint32_t>(sizeof(Encoding1)));
+    }
+}
+
 /**
  * Tests using an uninitialized TLVReader.
  */
@@ -3858,6 +3970,8 @@ TEST_F(TestTLV, CheckTLVReader)
     TestTLVReader_SkipOverContainer();
 
     TestTLVReaderUninitialized();
+
+    TestTLVReaderSplitBuffers();
 }
 
 /**
@@ -20,6 +20,20 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/Pool.h>
 
+#include <algorithm>
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#if __SANITIZE_ADDRESS__
+#include <sanitizer/asan_interface.h>
+// Objects released to a heap pool stay poisoned until allocated again, for ASAN to catch their use after free.
+#define CHIP_POOL_POISON(address, size) ASAN_POISON_MEMORY_REGION(address, size)
+#define CHIP_POOL_UNPOISON(address, size) ASAN_UNPOISON_MEMORY_REGION(address, size)
+#else // __SANITIZE_ADDRESS__
+#define CHIP_POOL_POISON(address, size)
+#define CHIP_POOL_UNPOISON(address, size)
+#endif // __SANITIZE_ADDRESS__
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
 namespace chip {
 
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
@@ -169,60 +183,213 @@ size_t StaticAllocatorBitmap::NextActiveIndexAfter(size_t start)
 
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
-HeapObjectListNode * HeapObjectList::FindNode(void * object) const
+namespace {
+
+constexpr uint64_t kSlotBit1 = 1;
+
+constexpr size_t RoundUp(size_t value, size_t alignment)
 {
-    for (HeapObjectListNode * p = mNext; p != this; p = p->mNext)
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// Slots start after the slab header, aligned for any object.
+constexpr size_t kSlabHeaderSize = RoundUp(sizeof(HeapSlab), alignof(std::max_align_t));
+
+} // namespace
+
+HeapSlabAllocator::HeapSlabAllocator(size_t objectSize, size_t objectAlignment) :
+    mObjectSize(objectSize), mObjectOffset(RoundUp(sizeof(HeapSlab *), objectAlignment)),
+    mSlotSize(RoundUp(mObjectOffset + objectSize, std::max(objectAlignment, alignof(HeapSlab *))))
+{}
+
+HeapSlabAllocator::~HeapSlabAllocator()
+{
+    // Slabs still holding objects are only left when leaks are ignored on exit: keep them, the objects may still be used.
+    HeapSlab * slab = mFirst;
+    while (slab != nullptr)
     {
-        if (p->mObject == object)
+        HeapSlab * next = slab->mNext;
+        if (slab->mUsage == 0)
         {
-            return p;
+            ReleaseSlab(slab);
         }
+        slab = next;
+    }
+}
+
+uint8_t * HeapSlabAllocator::SlotsOf(HeapSlab * slab)
+{
+    return reinterpret_cast<uint8_t *>(slab) + kSlabHeaderSize;
+}
+
+bool HeapSlabAllocator::IsFull(const HeapSlab * slab)
+{
+    const uint64_t all = (slab->mCapacity == kMaxSlabObjects) ? ~uint64_t(0) : ((kSlotBit1 << slab->mCapacity) - 1);
+    return slab->mUsage == all;
+}
+
+HeapSlab * HeapSlabAllocator::AllocateSlab()
+{
+    // Grow the pool geometrically, keeping slabs of large objects small.
+    size_t capacity = std::min(std::max(mCapacity, kMinSlabObjects), kMaxSlabObjects);
+    capacity        = std::max<size_t>(std::min(capacity, (kMaxSlabSize - kSlabHeaderSize) / mSlotSize), 1);
+
+    void * memory = Platform::MemoryAlloc(kSlabHeaderSize + capacity * mSlotSize);
+    if (memory == nullptr)
+    {
+        return nullptr;
+    }
+
+    HeapSlab * slab = new (memory) HeapSlab{ nullptr, mLast, this, 0, capacity };
+    for (size_t index = 0; index < capacity; index++)
+    {
+        new (SlotsOf(slab) + mSlotSize * index) HeapSlab *(slab);
+        CHIP_POOL_POISON(At(slab, index), mObjectSize);
+    }
+
+    if (mLast != nullptr)
+    {
+        mLast->mNext = slab;
+    }
+    else
+    {
+        mFirst = slab;
+    }
+    mLast = slab;
+    mCapacity += capacity;
+    return slab;
+}
+
+void HeapSlabAllocator::ReleaseSlab(HeapSlab * slab)
+{
+    (slab->mPrev != nullptr ? slab->mPrev->mNext : mFirst) = slab->mNext;
+    (slab->mNext != nullptr ? slab->mNext->mPrev : mLast)  = slab->mPrev;
+    mCapacity -= slab->mCapacity;
+
+    CHIP_POOL_UNPOISON(slab, kSlabHeaderSize + slab->mCapacity * mSlotSize);
+    Platform::MemoryFree(slab);
+}
+
+void * HeapSlabAllocator::Allocate()
+{
+    HeapSlab * slab = mFirst;
+    while (slab != nullptr && IsFull(slab))
+    {
+        slab = slab->mNext;
+    }
+    if (slab == nullptr)
+    {
+        slab = AllocateSlab();
+        if (slab == nullptr)
+        {
+            return nullptr;
+        }
+    }
+
+    size_t index = 0;
+    while ((slab->mUsage & (kSlotBit1 << index)) != 0)
+    {
+        index++;
+    }
+    slab->mUsage |= kSlotBit1 << index;
+
+    void * object = At(slab, index);
+    CHIP_POOL_UNPOISON(object, mObjectSize);
+    return object;
+}
+
+HeapSlab * HeapSlabAllocator::SlabOf(void * object, size_t & index) const
+{
+    uint8_t * slot  = static_cast<uint8_t *>(object) - mObjectOffset;
+    HeapSlab * slab = *reinterpret_cast<HeapSlab * const *>(slot);
+    // Releasing an object that is not allocated indicates likely memory
+    // corruption; better to safe-crash than proceed at this point.
+    VerifyOrDie(slab != nullptr && slab->mAllocator == this);
+
+    std::ptrdiff_t diff = slot - SlotsOf(slab);
+    VerifyOrDie(diff >= 0 && static_cast<size_t>(diff) % mSlotSize == 0);
+    index = static_cast<size_t>(diff) / mSlotSize;
+    VerifyOrDie(index < slab->mCapacity && (slab->mUsage & (kSlotBit1 << index)) != 0);
+    return slab;
+}
+
+void HeapSlabAllocator::Deallocate(HeapSlab * slab, size_t index)
+{
+    slab->mUsage &= ~(kSlotBit1 << index);
+    CHIP_POOL_POISON(At(slab, index), mObjectSize);
+
+    // The first slab is kept for the lifetime of the pool. Other slabs are released once empty, immediately if we are not in
+    // the middle of iteration, otherwise once all iteration on this pool completes.
+    if (slab->mUsage != 0 || slab == mFirst)
+    {
+        return;
+    }
+    if (mIterationDepth == 0)
+    {
+        ReleaseSlab(slab);
+    }
+    else
+    {
+        mHaveDeferredSlabReleases = true;
+    }
+}
+
+void HeapSlabAllocator::SeekActive(HeapSlab *& slab, size_t & index) const
+{
+    while (slab != nullptr)
+    {
+        for (; index < slab->mCapacity; index++)
+        {
+            if ((slab->mUsage & (kSlotBit1 << index)) != 0)
+            {
+                return;
+            }
+        }
+        slab  = slab->mNext;
+        index = 0;
     }
-    return nullptr;
 }
 
-Loop HeapObjectList::ForEachNode(void * context, Lambda lambda)
+Loop HeapSlabAllocator::ForEachObject(void * context, Lambda lambda)
 {
     ++mIterationDepth;
-    Loop result            = Loop::Finish;
-    HeapObjectListNode * p = mNext;
-    while (p != this)
+    Loop result = Loop::Finish;
+    for (HeapSlab * slab = mFirst; slab != nullptr && result == Loop::Finish; slab = slab->mNext)
     {
-        if (p->mObject != nullptr)
+        // Usage is read again after each call, which may release objects.
+        for (size_t index = 0; index < slab->mCapacity && (slab->mUsage >> index) != 0; index++)
         {
-            if (lambda(context, p->mObject) == Loop::Break)
+            if ((slab->mUsage & (kSlotBit1 << index)) != 0 && lambda(context, At(slab, index)) == Loop::Break)
             {
                 result = Loop::Break;
                 break;
             }
         }
-        p = p->mNext;
     }
     --mIterationDepth;
     CleanupDeferredReleases();
     return result;
 }
 
-void HeapObjectList::CleanupDeferredReleases()
+void HeapSlabAllocator::CleanupDeferredReleases()
 {
-    if (mIterationDepth != 0 || !mHaveDeferredNodeRemovals)
+    if (mIterationDepth != 0 || !mHaveDeferredSlabReleases)
     {
         return;
     }
-    // Remove nodes for released objects.
-    HeapObjectListNode * p = mNext;
-    while (p != this)
+    // Release slabs emptied during iteration.
+    HeapSlab * slab = mFirst->mNext;
+    while (slab != nullptr)
     {
-        HeapObjectListNode * next = p->mNext;
-        if (p->mObject == nullptr)
+        HeapSlab * next = slab->mNext;
+        if (slab->mUsage == 0)
         {
-            p->Remove();
-            Platform::Delete(p);
+            ReleaseSlab(slab);
         }
-        p = next;
+        slab = next;
     }
 
-    mHaveDeferredNodeRemovals = false;
+    mHaveDeferredSlabReleases = false;
 }
 
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
@@ -30,6 +30,7 @@
 #include <lib/support/Iterators.h>
 
 #include <atomic>
+#include <cstddef>
 #include <limits>
 #include <new>
 #include <stddef.h>
@@ -142,45 +143,81 @@ private:
 
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
-struct HeapObjectListNode
-{
-    void Remove()
-    {
-        mNext->mPrev = mPrev;
-        mPrev->mNext = mNext;
-    }
+class HeapSlabAllocator;
 
-    void * mObject             = nullptr;
-    HeapObjectListNode * mNext = nullptr;
-    HeapObjectListNode * mPrev = nullptr;
+/**
+ * A chunk of heap memory holding objects of a HeapObjectPool.
+ *
+ * The header is followed by mCapacity slots, each made of a pointer back to the slab and the storage of one object, so that
+ * objects are allocated and released without a heap allocation of their own and without searching for them.
+ */
+struct HeapSlab
+{
+    HeapSlab * mNext;
+    HeapSlab * mPrev;
+    HeapSlabAllocator * mAllocator; // allocator owning the slab
+    uint64_t mUsage;                // bit i is set while slot i holds an object
+    size_t mCapacity;
 };
 
-struct HeapObjectList : HeapObjectListNode
+/**
+ * Manages the slabs of a HeapObjectPool, independently of the type of its objects.
+ *
+ * Slabs are kept in a list and grow with the pool, up to kMaxSlabObjects objects or about kMaxSlabSize bytes each. Freeing
+ * a slab that became empty is deferred while the pool is being iterated, so that iterators never point into freed memory.
+ */
+class HeapSlabAllocator
 {
-    HeapObjectList() { mNext = mPrev = this; }
+public:
+    static constexpr size_t kMinSlabObjects = 4;
+    static constexpr size_t kMaxSlabObjects = std::numeric_limits<uint64_t>::digits;
+    static constexpr size_t kMaxSlabSize    = 4096;
 
-    void Append(HeapObjectListNode * node)
-    {
-        node->mNext  = this;
-        node->mPrev  = mPrev;
-        mPrev->mNext = node;
-        mPrev        = node;
-    }
+    HeapSlabAllocator(size_t objectSize, size_t objectAlignment);
+    ~HeapSlabAllocator();
+
+    /// Returns storage for an object, or nullptr if no memory is available.
+    void * Allocate();
 
-    HeapObjectListNode * FindNode(void * object) const;
+    /// Returns the slab holding an object allocated from this allocator, and its index in that slab. Dies if the object is
+    /// not allocated, which indicates likely memory corruption.
+    HeapSlab * SlabOf(void * object, size_t & index) const;
+
+    /// Returns the storage of an object, after its destructor ran.
+    void Deallocate(HeapSlab * slab, size_t index);
+
+    HeapSlab * FirstSlab() const { return mFirst; }
+    void * At(HeapSlab * slab, size_t index) const { return SlotsOf(slab) + mSlotSize * index + mObjectOffset; }
+
+    /// Moves slab/index to the first allocated object at or after them. slab is nullptr if there is none.
+    void SeekActive(HeapSlab *& slab, size_t & index) const;
 
     using Lambda = Loop (*)(void *, void *);
-    Loop ForEachNode(void * context, Lambda lambda);
-    Loop ForEachNode(void * context, Loop lambda(void * context, const void * object)) const
+    Loop ForEachObject(void * context, Lambda lambda);
+    Loop ForEachObject(void * context, Loop lambda(void * context, const void * object)) const
     {
-        return const_cast<HeapObjectList *>(this)->ForEachNode(context, reinterpret_cast<Lambda>(lambda));
+        return const_cast<HeapSlabAllocator *>(this)->ForEachObject(context, reinterpret_cast<Lambda>(lambda));
     }
 
     /// Cleans up any deferred releases IFF iteration depth is 0
     void CleanupDeferredReleases();
 
     size_t mIterationDepth         = 0;
-    bool mHaveDeferredNodeRemovals = false;
+    bool mHaveDeferredSlabReleases = false;
+
+private:
+    static uint8_t * SlotsOf(HeapSlab * slab);
+    static bool IsFull(const HeapSlab * slab);
+
+    HeapSlab * AllocateSlab();
+    void ReleaseSlab(HeapSlab * slab);
+
+    const size_t mObjectSize;
+    const size_t mObjectOffset; // offset of the object in its slot
+    const size_t mSlotSize;
+    size_t mCapacity  = 0; // number of slots in all slabs
+    HeapSlab * mFirst = nullptr;
+    HeapSlab * mLast  = nullptr;
 };
 
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
@@ -381,7 +418,9 @@ template <class T>
 class HeapObjectPool : public internal::Statistics, public HeapObjectPoolExitHandling
 {
 public:
-    HeapObjectPool() {}
+    static_assert(alignof(T) <= alignof(std::max_align_t), "HeapObjectPool does not support over-aligned types");
+
+    HeapObjectPool() : mObjects(sizeof(T), alignof(T)) {}
     ~HeapObjectPool()
     {
 #ifndef __SANITIZE_ADDRESS__
@@ -413,7 +452,7 @@ public:
     ///       active while still allowing to advance the iterator.
     ///       This is done by flagging an iteration depth whenever an active
     ///       iterator exists. This also means that while a pool iterator exists, releasing
-    ///       of tracking memory objects may be deferred until the last active iterator is
+    ///       of slabs that became empty may be deferred until the last active iterator is
     ///       released.
     class ActiveObjectIterator
     {
@@ -423,91 +462,95 @@ public:
         using reference  = T &;
 
         ActiveObjectIterator() {}
-        ActiveObjectIterator(const ActiveObjectIterator & other) : mCurrent(other.mCurrent), mEnd(other.mEnd)
+        ActiveObjectIterator(const ActiveObjectIterator & other) :
+            mAllocator(other.mAllocator), mSlab(other.mSlab), mIndex(other.mIndex)
         {
-            if (mEnd != nullptr)
+            if (mAllocator != nullptr)
             {
                 // Iteration depth is used to support `Release` while an iterator is active.
                 //
                 // Code was historically using this functionality, so we support it here
                 // as well: while iteration is active, iteration depth is > 0. When it
                 // goes to 0, then any deferred `Release()` calls are executed.
-                mEnd->mIterationDepth++;
+                mAllocator->mIterationDepth++;
             }
         }
 
         ActiveObjectIterator & operator=(const ActiveObjectIterator & other)
         {
-            if (mEnd != nullptr)
+            if (other.mAllocator != nullptr)
             {
-                mEnd->mIterationDepth--;
-                mEnd->CleanupDeferredReleases();
+                other.mAllocator->mIterationDepth++;
             }
-            mCurrent = other.mCurrent;
-            mEnd     = other.mEnd;
-            mEnd->mIterationDepth++;
+            if (mAllocator != nullptr)
+            {
+                mAllocator->mIterationDepth--;
+                mAllocator->CleanupDeferredReleases();
+            }
+            mAllocator = other.mAllocator;
+            mSlab      = other.mSlab;
+            mIndex     = other.mIndex;
+            return *this;
         }
 
         ~ActiveObjectIterator()
         {
-            if (mEnd != nullptr)
+            if (mAllocator != nullptr)
             {
-                mEnd->mIterationDepth--;
-                mEnd->CleanupDeferredReleases();
+                mAllocator->mIterationDepth--;
+                mAllocator->CleanupDeferredReleases();
             }
         }
 
         bool operator==(const ActiveObjectIterator & other) const
         {
-            // extra current/end compare is to have all "end iterators"
-            // compare as equal (in particular default active object iterator is the end
+            // all "end iterators" compare as equal (in particular default active object iterator is the end
             // of an iterator)
-            return (mCurrent == other.mCurrent) || ((mCurrent == mEnd) && (other.mCurrent == other.mEnd));
+            return (mSlab == other.mSlab) && ((mSlab == nullptr) || (mIndex == other.mIndex));
         }
         bool operator!=(const ActiveObjectIterator & other) const { return !(*this == other); }
         ActiveObjectIterator & operator++()
         {
-            do
-            {
-                mCurrent = mCurrent->mNext;
-            } while ((mCurrent != mEnd) && (mCurrent->mObject == nullptr));
+            mIndex++;
+            mAllocator->SeekActive(mSlab, mIndex);
             return *this;
         }
-        T * operator*() const { return static_cast<T *>(mCurrent->mObject); }
+        T * operator*() const { return static_cast<T *>(mAllocator->At(mSlab, mIndex)); }
 
     protected:
         friend class HeapObjectPool<T>;
 
-        explicit ActiveObjectIterator(internal::HeapObjectListNode * current, internal::HeapObjectList * end) :
-            mCurrent(current), mEnd(end)
+        explicit ActiveObjectIterator(internal::HeapSlabAllocator * allocator, internal::HeapSlab * slab, size_t index) :
+            mAllocator(allocator), mSlab(slab), mIndex(index)
         {
-            mEnd->mIterationDepth++;
+            mAllocator->mIterationDepth++;
         }
 
     private:
-        internal::HeapObjectListNode * mCurrent = nullptr;
-        internal::HeapObjectList * mEnd         = nullptr;
+        internal::HeapSlabAllocator * mAllocator = nullptr;
+        internal::HeapSlab * mSlab               = nullptr; // nullptr at the end of the iteration
+        size_t mIndex                            = 0;
     };
 
-    ActiveObjectIterator begin() { return ActiveObjectIterator(mObjects.mNext, &mObjects); }
-    ActiveObjectIterator end() { return ActiveObjectIterator(&mObjects, &mObjects); }
+    ActiveObjectIterator begin()
+    {
+        internal::HeapSlab * slab = mObjects.FirstSlab();
+        size_t index              = 0;
+        mObjects.SeekActive(slab, index);
+        return ActiveObjectIterator(&mObjects, slab, index);
+    }
+    ActiveObjectIterator end() { return ActiveObjectIterator(&mObjects, nullptr, 0); }
 
     template <typename... Args>
     T * CreateObject(Args &&... args)
     {
-        T * object = Platform::New<T>(std::forward<Args>(args)...);
-        if (object != nullptr)
+        void * storage = mObjects.Allocate();
+        if (storage == nullptr)
         {
-            auto node = Platform::New<internal::HeapObjectListNode>();
-            if (node != nullptr)
-            {
-                node->mObject = object;
-                mObjects.Append(node);
-                IncreaseUsage();
-                return object;
-            }
+            return nullptr;
         }
-        return nullptr;
+        IncreaseUsage();
+        return new (storage) T(std::forward<Args>(args)...);
     }
 
     /*
@@ -526,31 +569,16 @@ public:
     {
         if (object != nullptr)
         {
-            internal::HeapObjectListNode * node = mObjects.FindNode(object);
-            // Releasing an object that is not allocated indicates likely memory
-            // corruption; better to safe-crash than proceed at this point.
-            VerifyOrDie(node != nullptr);
-
-            node->mObject = nullptr;
-            Platform::Delete(object);
-
-            // The node needs to be released immediately if we are not in the middle of iteration.
-            // Otherwise cleanup is deferred until all iteration on this pool completes and it's safe to release nodes.
-            if (mObjects.mIterationDepth == 0)
-            {
-                node->Remove();
-                Platform::Delete(node);
-            }
-            else
-            {
-                mObjects.mHaveDeferredNodeRemovals = true;
-            }
+            size_t index;
+            internal::HeapSlab * slab = mObjects.SlabOf(object, index);
 
+            object->~T();
+            mObjects.Deallocate(slab, index);
             DecreaseUsage();
         }
     }
 
-    void ReleaseAll() { mObjects.ForEachNode(this, ReleaseObject); }
+    void ReleaseAll() { mObjects.ForEachObject(this, ReleaseObject); }
 
     /**
      * @brief
@@ -572,7 +600,7 @@ public:
         static_assert(std::is_same<Loop, decltype(function(std::declval<T *>()))>::value,
                       "The function must take T* and return Loop");
         internal::LambdaProxy<T, Function> proxy(std::forward<Function>(function));
-        return mObjects.ForEachNode(&proxy, &internal::LambdaProxy<T, Function>::Call);
+        return mObjects.ForEachObject(&proxy, &internal::LambdaProxy<T, Function>::Call);
     }
     template <typename Function>
     Loop ForEachActiveObject(Function && function) const
@@ -580,7 +608,7 @@ public:
         static_assert(std::is_same<Loop, decltype(function(std::declval<const T *>()))>::value,
                       "The function must take const T* and return Loop");
         internal::LambdaProxy<const T, Function> proxy(std::forward<Function>(function));
-        return mObjects.ForEachNode(&proxy, &internal::LambdaProxy<const T, Function>::ConstCall);
+        return mObjects.ForEachObject(&proxy, &internal::LambdaProxy<const T, Function>::ConstCall);
     }
 
     void DumpToLog() const
@@ -602,7 +630,7 @@ private:
         return Loop::Continue;
     }
 
-    internal::HeapObjectList mObjects;
+    internal::HeapSlabAllocator mObjects;
 };
 
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
@@ -16,15 +16,18 @@
  */
 
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <algorithm>
 #include <charconv>
-#include <sstream>
+#include <cmath>
+#include <limits>
 #include <string>
 #include <vector>
 
-#include <json/json.h>
 #include <lib/support/Base64.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/jsontlv/ElementTypes.h>
 #include <lib/support/jsontlv/JsonToTlv.h>
@@ -38,61 +41,77 @@ namespace {
 // This profile, but will be used for deciding what binary values to encode.
 constexpr uint32_t kTemporaryImplicitProfileId = 0xFF01;
 
-std::vector<std::string> SplitIntoFieldsBySeparator(const std::string & input, char separator)
+// Values nested deeper than this are rejected, as they are by jsoncpp, which bounds the recursion of the converter.
+constexpr size_t kMaxJsonNestingDepth = 1000;
+
+// Splits the input at each separator the way std::getline() does: a trailing separator does not start an empty field.
+// Returns the number of fields, of which at most maxFields are stored in fields.
+size_t SplitIntoFieldsBySeparator(const CharSpan & input, char separator, CharSpan * fields, size_t maxFields)
 {
-    std::vector<std::string> substrings;
-    std::stringstream ss(input);
-    std::string substring;
+    size_t count = 0;
+    size_t start = 0;
 
-    while (std::getline(ss, substring, separator))
+    while (start < input.size())
     {
-        substrings.push_back(std::move(substring));
+        size_t end = start;
+        while (end < input.size() && input.data()[end] != separator)
+        {
+            end++;
+        }
+        if (count < maxFields)
+        {
+            fields[count] = input.SubSpan(start, end - start);
+        }
+        count++;
+        start = end + 1;
     }
 
-    return substrings;
+    return count;
 }
 
-CHIP_ERROR JsonTypeStrToTlvType(const char * elementType, ElementTypeContext & type)
+CHIP_ERROR JsonTypeStrToTlvType(const CharSpan & elementType, ElementTypeContext & type)
 {
-    if (strcmp(elementType, kElementTypeInt) == 0)
+    constexpr size_t kArrayPrefixLength = sizeof(kElementTypeArray) - 1;
+
+    if (elementType.data_equal(CharSpan::fromCharString(kElementTypeInt)))
     {
         type.tlvType = TLV::kTLVType_SignedInteger;
     }
-    else if (strcmp(elementType, kElementTypeUInt) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeUInt)))
     {
         type.tlvType = TLV::kTLVType_UnsignedInteger;
     }
-    else if (strcmp(elementType, kElementTypeBool) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeBool)))
     {
         type.tlvType = TLV::kTLVType_Boolean;
     }
-    else if (strcmp(elementType, kElementTypeFloat) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeFloat)))
     {
         type.tlvType  = TLV::kTLVType_FloatingPointNumber;
         type.isDouble = false;
     }
-    else if (strcmp(elementType, kElementTypeDouble) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeDouble)))
     {
         type.tlvType  = TLV::kTLVType_FloatingPointNumber;
         type.isDouble = true;
     }
-    else if (strcmp(elementType, kElementTypeBytes) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeBytes)))
     {
         type.tlvType = TLV::kTLVType_ByteString;
     }
-    else if (strcmp(elementType, kElementTypeString) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeString)))
     {
         type.tlvType = TLV::kTLVType_UTF8String;
     }
-    else if (strcmp(elementType, kElementTypeNull) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeNull)))
     {
         type.tlvType = TLV::kTLVType_Null;
     }
-    else if (strcmp(elementType, kElementTypeStruct) == 0)
+    else if (elementType.data_equal(CharSpan::fromCharString(kElementTypeStruct)))
     {
         type.tlvType = TLV::kTLVType_Structure;
     }
-    else if (strncmp(elementType, kElementTypeArray, strlen(kElementTypeArray)) == 0)
+    else if (elementType.size() >= kArrayPrefixLength && memcmp(elementType.data(), kElementTypeArray, kArrayPrefixLength) == 0)
     {
         type.tlvType = TLV::kTLVType_Array;
     }
@@ -106,21 +125,33 @@ CHIP_ERROR JsonTypeStrToTlvType(const char * elementType, ElementTypeContext & t
 
 struct ElementContext
 {
-    std::string jsonName;
     TLV::Tag tag = TLV::AnonymousTag();
     ElementTypeContext type;
     ElementTypeContext subType;
 };
 
-bool CompareByTag(const ElementContext & a, const ElementContext & b)
+/*
+ * A member of a JSON object, collected so that the members can be encoded in tag order.
+ */
+struct MemberContext
+{
+    ElementContext element;
+    // Unescaped name of the member, in the storage for the names of the objects being converted.
+    size_t nameOffset = 0;
+    size_t nameLength = 0;
+    // Start of the value of the member in the document.
+    const char * value = nullptr;
+};
+
+bool CompareByTag(const MemberContext & a, const MemberContext & b)
 {
     // If tags are of the same type compare by tag number
-    if (IsContextTag(a.tag) == IsContextTag(b.tag))
+    if (IsContextTag(a.element.tag) == IsContextTag(b.element.tag))
     {
-        return TLV::TagNumFromTag(a.tag) < TLV::TagNumFromTag(b.tag);
+        return TLV::TagNumFromTag(a.element.tag) < TLV::TagNumFromTag(b.element.tag);
     }
     // Otherwise, compare by tag type: context tags first followed by common profile tags
-    return IsContextTag(a.tag);
+    return IsContextTag(a.element.tag);
 }
 
 // The profileId parameter is used when encoding a tag for a TLV element to specify the profile that the tag belongs to.
@@ -149,7 +180,7 @@ CHIP_ERROR InternalConvertTlvTag(uint32_t tagNumber, TLV::Tag & tag, const uint3
 }
 
 template <typename T>
-CHIP_ERROR ParseNumericalField(const std::string & decimalString, T & outValue)
+CHIP_ERROR ParseNumericalField(const CharSpan & decimalString, T & outValue)
 {
     const char * start_ptr       = decimalString.data();
     const char * end_ptr         = decimalString.data() + decimalString.size();
@@ -158,142 +189,1037 @@ CHIP_ERROR ParseNumericalField(const std::string & decimalString, T & outValue)
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR ParseJsonName(const std::string & name, ElementContext & elementCtx, uint32_t implicitProfileId)
+CHIP_ERROR ParseJsonName(const CharSpan & name, ElementContext & elementCtx, uint32_t implicitProfileId)
 {
-    uint32_t tagNumber                  = 0;
-    const char * elementType            = nullptr;
-    std::vector<std::string> nameFields = SplitIntoFieldsBySeparator(name, ':');
-    TLV::Tag tag                        = TLV::AnonymousTag();
+    uint32_t tagNumber = 0;
+    CharSpan elementType;
+    CharSpan nameFields[3];
+    TLV::Tag tag = TLV::AnonymousTag();
     ElementTypeContext type;
     ElementTypeContext subType;
 
-    if (nameFields.size() == 2)
+    size_t nameFieldCount = SplitIntoFieldsBySeparator(name, ':', nameFields, ArraySize(nameFields));
+    if (nameFieldCount == 2)
     {
         ReturnErrorOnFailure(ParseNumericalField(nameFields[0], tagNumber));
-        elementType = nameFields[1].c_str();
+        elementType = nameFields[1];
     }
-    else if (nameFields.size() == 3)
+    else if (nameFieldCount == 3)
     {
         ReturnErrorOnFailure(ParseNumericalField(nameFields[1], tagNumber));
-        elementType = nameFields[2].c_str();
+        elementType = nameFields[2];
     }
     else
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
+    // The element type has always been compared as a C string, ending at any NUL character in it.
+    const char * nul = static_cast<const char *>(memchr(elementType.data(), '\0', elementType.size()));
+    if (nul != nullptr)
+    {
+        elementType.reduce_size(static_cast<size_t>(nul - elementType.data()));
+    }
+
     ReturnErrorOnFailure(InternalConvertTlvTag(tagNumber, tag, implicitProfileId));
     ReturnErrorOnFailure(JsonTypeStrToTlvType(elementType, type));
 
     if (type.tlvType == TLV::kTLVType_Array)
     {
-        std::vector<std::string> arrayFields = SplitIntoFieldsBySeparator(elementType, '-');
-        VerifyOrReturnError(arrayFields.size() == 2, CHIP_ERROR_INVALID_ARGUMENT);
+        CharSpan arrayFields[2];
+        VerifyOrReturnError(SplitIntoFieldsBySeparator(elementType, '-', arrayFields, ArraySize(arrayFields)) == 2,
+                            CHIP_ERROR_INVALID_ARGUMENT);
 
-        if (strcmp(arrayFields[1].c_str(), kElementTypeEmpty) == 0)
+        if (arrayFields[1].data_equal(CharSpan::fromCharString(kElementTypeEmpty)))
         {
             subType.tlvType = TLV::kTLVType_NotSpecified;
         }
         else
         {
-            ReturnErrorOnFailure(JsonTypeStrToTlvType(arrayFields[1].c_str(), subType));
+            ReturnErrorOnFailure(JsonTypeStrToTlvType(arrayFields[1], subType));
         }
     }
 
-    elementCtx.jsonName = name;
-    elementCtx.tag      = tag;
-    elementCtx.type     = type;
-    elementCtx.subType  = subType;
+    elementCtx.tag     = tag;
+    elementCtx.type    = type;
+    elementCtx.subType = subType;
 
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, const ElementContext & elementCtx)
+bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+bool ParseHex4(const char * in, uint32_t & value)
+{
+    value = 0;
+    for (size_t i = 0; i < 4; i++)
+    {
+        char c = in[i];
+        value <<= 4;
+        if (IsDigit(c))
+        {
+            value |= static_cast<uint32_t>(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            value |= static_cast<uint32_t>(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            value |= static_cast<uint32_t>(c - 'A' + 10);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool IsHighSurrogate(uint32_t codePoint)
+{
+    return codePoint >= 0xD800 && codePoint <= 0xDBFF;
+}
+
+// Parses a number token as a double, the whole of which must be a number within the range of doubles.
+bool ParseDouble(const CharSpan & token, double & value)
+{
+    // strtod() needs a terminated string, so the token is copied, which only allocates for unusually long numbers.
+    char buffer[64];
+    std::string longToken;
+    const char * str = buffer;
+    if (token.size() < sizeof(buffer))
+    {
+        memcpy(buffer, token.data(), token.size());
+        buffer[token.size()] = '\0';
+    }
+    else
+    {
+        longToken.assign(token.data(), token.size());
+        str = longToken.c_str();
+    }
+
+    char * end;
+    value = strtod(str, &end);
+    return end == str + token.size() && !std::isinf(value);
+}
+
+/*
+ * A JSON number, typed the way jsoncpp stores them: integers that fit in 64 bits are kept exact, anything else becomes
+ * a double.
+ */
+struct JsonNumber
+{
+    enum class Type : uint8_t
+    {
+        kInt,
+        kUInt,
+        kReal,
+    };
+
+    // Returns false if the token is not a number, or is out of the range of doubles.
+    bool Parse(const CharSpan & token)
+    {
+        bool isNegative    = token.size() > 0 && token.data()[0] == '-';
+        CharSpan magnitude = isNegative ? token.SubSpan(1) : token;
+        uint64_t value     = 0;
+        bool isIntegral    = true;
+
+        // As with jsoncpp, a lone minus sign has no digits to add up and is zero.
+        for (char c : magnitude)
+        {
+            uint64_t digit = static_cast<uint64_t>(c - '0');
+            if (!IsDigit(c) || value > (std::numeric_limits<uint64_t>::max() - digit) / 10)
+            {
+                isIntegral = false;
+                break;
+            }
+            value = value * 10 + digit;
+        }
+
+        if (isIntegral && (!isNegative || value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1))
+        {
+            if (isNegative)
+            {
+                type     = Type::kInt;
+                intValue = static_cast<int64_t>(0 - value);
+            }
+            else if (value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+            {
+                type     = Type::kInt;
+                intValue = static_cast<int64_t>(value);
+            }
+            else
+            {
+                type      = Type::kUInt;
+                uintValue = value;
+            }
+            return true;
+        }
+
+        // Fractions, exponents and integers too large for 64 bits.
+        type = Type::kReal;
+        return ParseDouble(token, realValue);
+    }
+
+    bool IsUInt64() const
+    {
+        switch (type)
+        {
+        case Type::kInt:
+            return intValue >= 0;
+        case Type::kUInt:
+            return true;
+        default:
+            return realValue >= 0 && realValue < 18446744073709551616.0 && IsIntegral();
+        }
+    }
+
+    bool IsInt64() const
+    {
+        switch (type)
+        {
+        case Type::kInt:
+            return true;
+        case Type::kUInt:
+            return uintValue <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+        default:
+            return realValue >= -9223372036854775808.0 && realValue < 9223372036854775808.0 && IsIntegral();
+        }
+    }
+
+    uint64_t AsUInt64() const
+    {
+        switch (type)
+        {
+        case Type::kInt:
+            return static_cast<uint64_t>(intValue);
+        case Type::kUInt:
+            return uintValue;
+        default:
+            return static_cast<uint64_t>(realValue);
+        }
+    }
+
+    int64_t AsInt64() const
+    {
+        switch (type)
+        {
+        case Type::kInt:
+            return intValue;
+        case Type::kUInt:
+            return static_cast<int64_t>(uintValue);
+        default:
+            return static_cast<int64_t>(realValue);
+        }
+    }
+
+    double AsDouble() const
+    {
+        switch (type)
+        {
+        case Type::kInt:
+            return static_cast<double>(intValue);
+        case Type::kUInt:
+            return static_cast<double>(uintValue);
+        default:
+            return realValue;
+        }
+    }
+
+    float AsFloat() const
+    {
+        switch (type)
+        {
+        case Type::kInt:
+            return static_cast<float>(intValue);
+        case Type::kUInt:
+            return static_cast<float>(uintValue);
+        default:
+            return static_cast<float>(realValue);
+        }
+    }
+
+    bool IsIntegral() const
+    {
+        double integralPart;
+        return std::modf(realValue, &integralPart) == 0.0;
+    }
+
+    Type type          = Type::kInt;
+    int64_t intValue   = 0;
+    uint64_t uintValue = 0;
+    double realValue   = 0;
+};
+
+// Checks the escapes in the contents of a string token, which are not checked when reading the token.
+bool IsValidJsonString(const CharSpan & raw)
+{
+    const char * in  = raw.data();
+    const char * end = raw.data() + raw.size();
+
+    while (in < end)
+    {
+        if (*in++ != '\\')
+        {
+            continue;
+        }
+
+        // A string token never ends with a lone backslash.
+        char escape = *in++;
+        if (escape == 'u')
+        {
+            uint32_t codePoint;
+            VerifyOrReturnValue(end - in >= 4 && ParseHex4(in, codePoint), false);
+            in += 4;
+            if (IsHighSurrogate(codePoint))
+            {
+                // The second half of the surrogate pair must follow, though it is not checked to be a low surrogate.
+                VerifyOrReturnValue(end - in >= 6 && in[0] == '\\' && in[1] == 'u' && ParseHex4(in + 2, codePoint), false);
+                in += 6;
+            }
+        }
+        else
+        {
+            VerifyOrReturnValue(escape != '\0' && strchr("\"\\/bfnrt", escape) != nullptr, false);
+        }
+    }
+    return true;
+}
+
+void AppendUtf8(std::string & out, uint32_t codePoint)
 {
+    if (codePoint < 0x80)
+    {
+        out += static_cast<char>(codePoint);
+    }
+    else if (codePoint < 0x800)
+    {
+        out += static_cast<char>(0xC0 | (codePoint >> 6));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    else if (codePoint < 0x10000)
+    {
+        out += static_cast<char>(0xE0 | (codePoint >> 12));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    else
+    {
+        out += static_cast<char>(0xF0 | (codePoint >> 18));
+        out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+}
+
+// Appends the unescaped contents of a string token previously checked by IsValidJsonString().
+void AppendUnescapedJsonString(const CharSpan & raw, std::string & out)
+{
+    const char * in  = raw.data();
+    const char * end = raw.data() + raw.size();
+
+    while (in < end)
+    {
+        if (*in != '\\')
+        {
+            out += *in++;
+            continue;
+        }
+
+        in++;
+        switch (char escape = *in++)
+        {
+        case 'b':
+            out += '\b';
+            break;
+        case 'f':
+            out += '\f';
+            break;
+        case 'n':
+            out += '\n';
+            break;
+        case 'r':
+            out += '\r';
+            break;
+        case 't':
+            out += '\t';
+            break;
+        case 'u': {
+            uint32_t codePoint;
+            uint32_t lowSurrogate;
+            ParseHex4(in, codePoint);
+            in += 4;
+            if (IsHighSurrogate(codePoint))
+            {
+                ParseHex4(in + 2, lowSurrogate);
+                in += 6;
+                codePoint = 0x10000 + ((codePoint & 0x3FF) << 10) + (lowSurrogate & 0x3FF);
+            }
+            AppendUtf8(out, codePoint);
+            break;
+        }
+        default:
+            out += escape;
+            break;
+        }
+    }
+}
+
+/*
+ * Pull parser walking a JSON document in place, with the tokens and grammar of the Json::Reader of jsoncpp that
+ * documents have always been parsed with. That includes its leniencies:
+ *   - comments are allowed before values, before member names, and after values, but not in an empty array or before
+ *     the ':' of a member;
+ *   - after a comment that follows the value of a member, any token other than '}' is taken for the ',';
+ *   - after a member with an empty name, a ',' may precede the closing '}';
+ *   - anything past the root value is ignored.
+ *
+ * Syntax errors are reported as CHIP_ERROR_INTERNAL, which is what a document that fails to parse has always been
+ * reported as.
+ */
+class JsonCursor
+{
+public:
+    enum class TokenType : uint8_t
+    {
+        kEndOfStream,
+        kObjectBegin,
+        kObjectEnd,
+        kArrayBegin,
+        kArrayEnd,
+        kString,
+        kNumber,
+        kTrue,
+        kFalse,
+        kNull,
+        kArraySeparator,
+        kMemberSeparator,
+        kComment,
+        kError,
+    };
+
+    struct Token
+    {
+        TokenType type     = TokenType::kError;
+        const char * start = nullptr;
+        const char * end   = nullptr;
+
+        CharSpan Text() const { return CharSpan(start, static_cast<size_t>(end - start)); }
+        // Contents of a string token, still escaped.
+        CharSpan StringContents() const { return CharSpan(start + 1, static_cast<size_t>(end - start) - 2); }
+    };
+
+    JsonCursor(const char * begin, const char * end) : mPos(begin), mEnd(end) {}
+
+    const char * GetPosition() const { return mPos; }
+
+    // Reads the token starting the value at the given nesting depth, after any comments.
+    CHIP_ERROR ReadValueToken(Token & token, size_t depth);
+
+    // Within an object, reads the name of the next member and the ':' following it, unless isEnd is set because the
+    // closing '}' was read instead. previousNameEmpty is whether the name of the member before, if any, was empty.
+    CHIP_ERROR ReadMemberName(Token & name, bool & isEnd, bool previousNameEmpty);
+
+    // Reads what follows the value of a member, setting isEnd if it ends the object.
+    CHIP_ERROR ReadMemberEnd(bool & isEnd);
+
+    // Right after the '[' of an array, reads the closing ']' if the array is empty.
+    bool ReadEmptyArrayEnd();
+
+    // Reads what follows an element of an array, setting isEnd if it ends the array.
+    CHIP_ERROR ReadElementEnd(bool & isEnd);
+
+    // Moves past the value at the given nesting depth, checking that it is well formed.
+    CHIP_ERROR SkipValue(size_t depth);
+
+private:
+    // Returns false for an invalid token, which is typed kError.
+    bool ReadToken(Token & token);
+    bool ReadTokenAfterComments(Token & token);
+    void SkipWhitespace();
+    char GetNextChar() { return (mPos == mEnd) ? '\0' : *mPos++; }
+    bool Match(const char * pattern, size_t length);
+    bool SkipString();
+    bool SkipComment();
+    void SkipNumber();
+    void SkipDigits();
+
+    const char * mPos;
+    const char * mEnd;
+};
+
+void JsonCursor::SkipWhitespace()
+{
+    while (mPos != mEnd && (*mPos == ' ' || *mPos == '\t' || *mPos == '\r' || *mPos == '\n'))
+    {
+        mPos++;
+    }
+}
+
+bool JsonCursor::Match(const char * pattern, size_t length)
+{
+    VerifyOrReturnValue(static_cast<size_t>(mEnd - mPos) >= length && memcmp(mPos, pattern, length) == 0, false);
+    mPos += length;
+    return true;
+}
+
+bool JsonCursor::SkipString()
+{
+    // Only the end of the string is looked for here, its escapes are checked when it is used.
+    char c = '\0';
+    while (mPos != mEnd)
+    {
+        c = GetNextChar();
+        if (c == '\\')
+        {
+            GetNextChar();
+        }
+        else if (c == '"')
+        {
+            break;
+        }
+    }
+    return c == '"';
+}
+
+bool JsonCursor::SkipComment()
+{
+    char c = GetNextChar();
+    if (c == '*')
+    {
+        while (mEnd - mPos > 1)
+        {
+            if (GetNextChar() == '*' && *mPos == '/')
+            {
+                break;
+            }
+        }
+        return GetNextChar() == '/';
+    }
+
+    VerifyOrReturnValue(c == '/', false);
+    while (mPos != mEnd)
+    {
+        c = GetNextChar();
+        if (c == '\n')
+        {
+            break;
+        }
+        if (c == '\r')
+        {
+            if (mPos != mEnd && *mPos == '\n')
+            {
+                mPos++;
+            }
+            break;
+        }
+    }
+    return true;
+}
+
+void JsonCursor::SkipDigits()
+{
+    while (mPos != mEnd && IsDigit(*mPos))
+    {
+        mPos++;
+    }
+}
+
+void JsonCursor::SkipNumber()
+{
+    // The first character, a digit or a minus sign, was read. Whether the token is a valid number is only checked when
+    // it is used.
+    SkipDigits();
+    if (mPos != mEnd && *mPos == '.')
+    {
+        mPos++;
+        SkipDigits();
+    }
+    if (mPos != mEnd && (*mPos == 'e' || *mPos == 'E'))
+    {
+        mPos++;
+        if (mPos != mEnd && (*mPos == '+' || *mPos == '-'))
+        {
+            mPos++;
+        }
+        SkipDigits();
+    }
+}
+
+bool JsonCursor::ReadToken(Token & token)
+{
+    SkipWhitespace();
+    token.start = mPos;
+
+    bool ok = true;
+    switch (GetNextChar())
+    {
+    case '{':
+        token.type = TokenType::kObjectBegin;
+        break;
+    case '}':
+        token.type = TokenType::kObjectEnd;
+        break;
+    case '[':
+        token.type = TokenType::kArrayBegin;
+        break;
+    case ']':
+        token.type = TokenType::kArrayEnd;
+        break;
+    case '"':
+        token.type = TokenType::kString;
+        ok         = SkipString();
+        break;
+    case '/':
+        token.type = TokenType::kComment;
+        ok         = SkipComment();
+        break;
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+    case '-':
+        token.type = TokenType::kNumber;
+        SkipNumber();
+        break;
+    case 't':
+        token.type = TokenType::kTrue;
+        ok         = Match("rue", 3);
+        break;
+    case 'f':
+        token.type = TokenType::kFalse;
+        ok         = Match("alse", 4);
+        break;
+    case 'n':
+        token.type = TokenType::kNull;
+        ok         = Match("ull", 3);
+        break;
+    case ',':
+        token.type = TokenType::kArraySeparator;
+        break;
+    case ':':
+        token.type = TokenType::kMemberSeparator;
+        break;
+    case '\0':
+        // Also for a NUL character within the document.
+        token.type = TokenType::kEndOfStream;
+        break;
+    default:
+        ok = false;
+        break;
+    }
+
+    if (!ok)
+    {
+        token.type = TokenType::kError;
+    }
+    token.end = mPos;
+    return ok;
+}
+
+bool JsonCursor::ReadTokenAfterComments(Token & token)
+{
+    bool ok;
+    do
+    {
+        ok = ReadToken(token);
+    } while (ok && token.type == TokenType::kComment);
+    return ok;
+}
+
+CHIP_ERROR JsonCursor::ReadValueToken(Token & token, size_t depth)
+{
+    VerifyOrReturnError(depth < kMaxJsonNestingDepth, CHIP_ERROR_INTERNAL);
+
+    ReadTokenAfterComments(token);
+    switch (token.type)
+    {
+    case TokenType::kObjectBegin:
+    case TokenType::kArrayBegin:
+    case TokenType::kString:
+    case TokenType::kNumber:
+    case TokenType::kTrue:
+    case TokenType::kFalse:
+    case TokenType::kNull:
+        return CHIP_NO_ERROR;
+    default:
+        return CHIP_ERROR_INTERNAL;
+    }
+}
+
+CHIP_ERROR JsonCursor::ReadMemberName(Token & name, bool & isEnd, bool previousNameEmpty)
+{
+    VerifyOrReturnError(ReadTokenAfterComments(name), CHIP_ERROR_INTERNAL);
+
+    isEnd = (name.type == TokenType::kObjectEnd && previousNameEmpty);
+    VerifyOrReturnError(!isEnd, CHIP_NO_ERROR);
+    VerifyOrReturnError(name.type == TokenType::kString, CHIP_ERROR_INTERNAL);
+
+    Token colon;
+    VerifyOrReturnError(ReadToken(colon) && colon.type == TokenType::kMemberSeparator, CHIP_ERROR_INTERNAL);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR JsonCursor::ReadMemberEnd(bool & isEnd)
+{
+    Token token;
+    VerifyOrReturnError(ReadToken(token) &&
+                            (token.type == TokenType::kObjectEnd || token.type == TokenType::kArraySeparator ||
+                             token.type == TokenType::kComment),
+                        CHIP_ERROR_INTERNAL);
+
+    // Past comments, whatever token follows is taken for the separator, even an invalid one.
+    bool ok = true;
+    while (ok && token.type == TokenType::kComment)
+    {
+        ok = ReadToken(token);
+    }
+    isEnd = (token.type == TokenType::kObjectEnd);
+    return CHIP_NO_ERROR;
+}
+
+bool JsonCursor::ReadEmptyArrayEnd()
+{
+    SkipWhitespace();
+    VerifyOrReturnValue(mPos != mEnd && *mPos == ']', false);
+    mPos++;
+    return true;
+}
+
+CHIP_ERROR JsonCursor::ReadElementEnd(bool & isEnd)
+{
+    Token token;
+    VerifyOrReturnError(ReadTokenAfterComments(token) &&
+                            (token.type == TokenType::kArraySeparator || token.type == TokenType::kArrayEnd),
+                        CHIP_ERROR_INTERNAL);
+    isEnd = (token.type == TokenType::kArrayEnd);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR JsonCursor::SkipValue(size_t depth)
+{
+    Token token;
+    bool isEnd = false;
+    JsonNumber number;
+
+    ReturnErrorOnFailure(ReadValueToken(token, depth));
+    switch (token.type)
+    {
+    case TokenType::kObjectBegin: {
+        bool previousNameEmpty = true;
+        while (true)
+        {
+            ReturnErrorOnFailure(ReadMemberName(token, isEnd, previousNameEmpty));
+            VerifyOrReturnError(!isEnd, CHIP_NO_ERROR);
+            VerifyOrReturnError(IsValidJsonString(token.StringContents()), CHIP_ERROR_INTERNAL);
+            previousNameEmpty = token.StringContents().empty();
+
+            ReturnErrorOnFailure(SkipValue(depth + 1));
+            ReturnErrorOnFailure(ReadMemberEnd(isEnd));
+            VerifyOrReturnError(!isEnd, CHIP_NO_ERROR);
+        }
+    }
+
+    case TokenType::kArrayBegin:
+        VerifyOrReturnError(!ReadEmptyArrayEnd(), CHIP_NO_ERROR);
+        while (!isEnd)
+        {
+            ReturnErrorOnFailure(SkipValue(depth + 1));
+            ReturnErrorOnFailure(ReadElementEnd(isEnd));
+        }
+        return CHIP_NO_ERROR;
+
+    case TokenType::kString:
+        VerifyOrReturnError(IsValidJsonString(token.StringContents()), CHIP_ERROR_INTERNAL);
+        return CHIP_NO_ERROR;
+
+    case TokenType::kNumber:
+        VerifyOrReturnError(number.Parse(token.Text()), CHIP_ERROR_INTERNAL);
+        return CHIP_NO_ERROR;
+
+    default:
+        return CHIP_NO_ERROR;
+    }
+}
+
+/*
+ * Converts a JSON document to TLV in a single walk, writing each element as soon as it is reached.
+ *
+ * The only buffering needed is for the members of each object, which are collected and sorted by tag before being
+ * encoded, since TLV requires structure members in tag order while JSON objects are unordered. A single vector holds
+ * the members of all the objects being converted, and a single string their names, so that the number of allocations
+ * does not grow with the size of the document.
+ */
+class JsonToTlvConverter
+{
+public:
+    JsonToTlvConverter(const std::string & json, TLV::TLVWriter & writer) :
+        mJsonBegin(json.data()), mJsonEnd(json.data() + json.size()), mWriter(writer)
+    {}
+
+    CHIP_ERROR Convert();
+
+private:
+    CHIP_ERROR EncodeTlvElement(JsonCursor & cursor, const ElementContext & elementCtx, size_t depth);
+    CHIP_ERROR EncodeStructure(JsonCursor & cursor, TLV::Tag tag, size_t depth);
+    CHIP_ERROR EncodeArray(JsonCursor & cursor, const ElementContext & elementCtx, size_t depth);
+    CharSpan GetString(const JsonCursor::Token & token);
+    CharSpan GetName(const MemberContext & member) const;
+    bool IsNameLess(const MemberContext & a, const MemberContext & b) const;
+
+    const char * const mJsonBegin;
+    const char * const mJsonEnd;
+    TLV::TLVWriter & mWriter;
+    std::vector<MemberContext> mMembers;
+    std::string mNames;
+    std::string mUnescaped;
+    std::vector<uint8_t> mBytes;
+};
+
+CHIP_ERROR JsonToTlvConverter::Convert()
+{
+    // The whole document is checked first, so that malformed JSON is reported as such rather than as whatever
+    // conversion error its valid prefix runs into. Anything past the root value is ignored.
+    JsonCursor cursor(mJsonBegin, mJsonEnd);
+    ReturnErrorOnFailure(cursor.SkipValue(0));
+
+    ElementContext elementCtx;
+    elementCtx.type = { TLV::kTLVType_Structure, false };
+
+    cursor = JsonCursor(mJsonBegin, mJsonEnd);
+    return EncodeTlvElement(cursor, elementCtx, 0);
+}
+
+CharSpan JsonToTlvConverter::GetString(const JsonCursor::Token & token)
+{
+    CharSpan raw = token.StringContents();
+    VerifyOrReturnValue(memchr(raw.data(), '\\', raw.size()) != nullptr, raw);
+
+    mUnescaped.clear();
+    AppendUnescapedJsonString(raw, mUnescaped);
+    return CharSpan(mUnescaped.data(), mUnescaped.size());
+}
+
+CharSpan JsonToTlvConverter::GetName(const MemberContext & member) const
+{
+    return CharSpan(mNames.data() + member.nameOffset, member.nameLength);
+}
+
+bool JsonToTlvConverter::IsNameLess(const MemberContext & a, const MemberContext & b) const
+{
+    // Compared byte by byte, as done for the keys of a Json::Value.
+    CharSpan aName = GetName(a);
+    CharSpan bName = GetName(b);
+    int comp       = memcmp(aName.data(), bName.data(), std::min(aName.size(), bName.size()));
+    return (comp != 0) ? (comp < 0) : (aName.size() < bName.size());
+}
+
+CHIP_ERROR JsonToTlvConverter::EncodeStructure(JsonCursor & cursor, TLV::Tag tag, size_t depth)
+{
+    TLV::TLVType containerType;
+    ReturnErrorOnFailure(mWriter.StartContainer(tag, TLV::kTLVType_Structure, containerType));
+
+    // Members of nested objects are collected past the end of these ranges while they are being encoded.
+    const size_t begin      = mMembers.size();
+    const size_t namesBegin = mNames.size();
+
+    JsonCursor::Token name;
+    bool isEnd             = false;
+    bool previousNameEmpty = true;
+    while (true)
+    {
+        ReturnErrorOnFailure(cursor.ReadMemberName(name, isEnd, previousNameEmpty));
+        if (isEnd)
+        {
+            break;
+        }
+
+        MemberContext member;
+        member.nameOffset = mNames.size();
+        AppendUnescapedJsonString(name.StringContents(), mNames);
+        member.nameLength = mNames.size() - member.nameOffset;
+        previousNameEmpty = (member.nameLength == 0);
+
+        member.value = cursor.GetPosition();
+        ReturnErrorOnFailure(cursor.SkipValue(depth + 1));
+        mMembers.push_back(member);
+
+        ReturnErrorOnFailure(cursor.ReadMemberEnd(isEnd));
+        if (isEnd)
+        {
+            break;
+        }
+    }
+
+    // Members are put in the order of their names, and of members with the same name only the last one is kept, as
+    // in a Json::Value.
+    auto first = mMembers.begin() + static_cast<ptrdiff_t>(begin);
+    std::sort(first, mMembers.end(), [this](const MemberContext & a, const MemberContext & b) {
+        return IsNameLess(a, b) || (!IsNameLess(b, a) && a.value < b.value);
+    });
+    auto last = first;
+    for (auto it = first; it != mMembers.end(); ++it)
+    {
+        if (it + 1 == mMembers.end() || IsNameLess(*it, *(it + 1)))
+        {
+            *last++ = *it;
+        }
+    }
+    mMembers.erase(last, mMembers.end());
+    const size_t end = mMembers.size();
+
+    for (size_t i = begin; i < end; i++)
+    {
+        ReturnErrorOnFailure(ParseJsonName(GetName(mMembers[i]), mMembers[i].element, mWriter.ImplicitProfileId));
+    }
+
+    // Sort Json object elements by Tag number (low to high).
+    // Note that all sorted Context Tags will appear first followed by all sorted Common Tags.
+    std::sort(mMembers.begin() + static_cast<ptrdiff_t>(begin), mMembers.end(), CompareByTag);
+
+    for (size_t i = begin; i < end; i++)
+    {
+        // Copied, as encoding nested objects may grow the vector.
+        const MemberContext member = mMembers[i];
+        JsonCursor valueCursor(member.value, mJsonEnd);
+        ReturnErrorOnFailure(EncodeTlvElement(valueCursor, member.element, depth + 1));
+    }
+    mMembers.resize(begin);
+    mNames.resize(namesBegin);
+
+    return mWriter.EndContainer(containerType);
+}
+
+CHIP_ERROR JsonToTlvConverter::EncodeArray(JsonCursor & cursor, const ElementContext & elementCtx, size_t depth)
+{
+    TLV::TLVType containerType;
+    ReturnErrorOnFailure(mWriter.StartContainer(elementCtx.tag, TLV::kTLVType_Array, containerType));
+
+    if (!cursor.ReadEmptyArrayEnd())
+    {
+        VerifyOrReturnError(elementCtx.subType.tlvType != TLV::kTLVType_NotSpecified, CHIP_ERROR_INVALID_ARGUMENT);
+
+        ElementContext nestedElementCtx;
+        nestedElementCtx.tag  = TLV::AnonymousTag();
+        nestedElementCtx.type = elementCtx.subType;
+
+        bool isEnd = false;
+        while (!isEnd)
+        {
+            ReturnErrorOnFailure(EncodeTlvElement(cursor, nestedElementCtx, depth + 1));
+            ReturnErrorOnFailure(cursor.ReadElementEnd(isEnd));
+        }
+    }
+
+    return mWriter.EndContainer(containerType);
+}
+
+CHIP_ERROR JsonToTlvConverter::EncodeTlvElement(JsonCursor & cursor, const ElementContext & elementCtx, size_t depth)
+{
+    using TokenType = JsonCursor::TokenType;
+
     TLV::Tag tag = elementCtx.tag;
+    JsonCursor::Token token;
+    JsonNumber number;
+    CharSpan str;
+
+    ReturnErrorOnFailure(cursor.ReadValueToken(token, depth));
 
     switch (elementCtx.type.tlvType)
     {
     case TLV::kTLVType_UnsignedInteger: {
         uint64_t v = 0;
-        if (val.isUInt64())
+        if (token.type == TokenType::kNumber)
         {
-            v = val.asUInt64();
+            VerifyOrReturnError(number.Parse(token.Text()) && number.IsUInt64(), CHIP_ERROR_INVALID_ARGUMENT);
+            v = number.AsUInt64();
         }
-        else if (val.isString())
+        else if (token.type == TokenType::kString)
         {
-            ReturnErrorOnFailure(ParseNumericalField(val.asString(), v));
+            ReturnErrorOnFailure(ParseNumericalField(GetString(token), v));
         }
         else
         {
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
-        ReturnErrorOnFailure(writer.Put(tag, v));
+        ReturnErrorOnFailure(mWriter.Put(tag, v));
         break;
     }
 
     case TLV::kTLVType_SignedInteger: {
         int64_t v = 0;
-        if (val.isInt64())
+        if (token.type == TokenType::kNumber)
         {
-            v = val.asInt64();
+            VerifyOrReturnError(number.Parse(token.Text()) && number.IsInt64(), CHIP_ERROR_INVALID_ARGUMENT);
+            v = number.AsInt64();
         }
-        else if (val.isString())
+        else if (token.type == TokenType::kString)
         {
-            ReturnErrorOnFailure(ParseNumericalField(val.asString(), v));
+            ReturnErrorOnFailure(ParseNumericalField(GetString(token), v));
         }
         else
         {
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
-        ReturnErrorOnFailure(writer.Put(tag, v));
+        ReturnErrorOnFailure(mWriter.Put(tag, v));
         break;
     }
 
     case TLV::kTLVType_Boolean: {
-        VerifyOrReturnError(val.isBool(), CHIP_ERROR_INVALID_ARGUMENT);
-        ReturnErrorOnFailure(writer.Put(tag, val.asBool()));
+        VerifyOrReturnError(token.type == TokenType::kTrue || token.type == TokenType::kFalse, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(mWriter.Put(tag, token.type == TokenType::kTrue));
         break;
     }
 
     case TLV::kTLVType_FloatingPointNumber: {
-        if (val.isNumeric())
+        if (token.type == TokenType::kNumber)
         {
+            VerifyOrReturnError(number.Parse(token.Text()), CHIP_ERROR_INVALID_ARGUMENT);
             if (elementCtx.type.isDouble)
             {
-                ReturnErrorOnFailure(writer.Put(tag, val.asDouble()));
+                ReturnErrorOnFailure(mWriter.Put(tag, number.AsDouble()));
             }
             else
             {
-                ReturnErrorOnFailure(writer.Put(tag, val.asFloat()));
+                ReturnErrorOnFailure(mWriter.Put(tag, number.AsFloat()));
             }
         }
-        else if (val.isString())
+        else if (token.type == TokenType::kString)
         {
-            const std::string valAsString = val.asString();
-            bool isPositiveInfinity       = (valAsString == kFloatingPointPositiveInfinity);
-            bool isNegativeInfinity       = (valAsString == kFloatingPointNegativeInfinity);
+            str                     = GetString(token);
+            bool isPositiveInfinity = str.data_equal(CharSpan::fromCharString(kFloatingPointPositiveInfinity));
+            bool isNegativeInfinity = str.data_equal(CharSpan::fromCharString(kFloatingPointNegativeInfinity));
             VerifyOrReturnError(isPositiveInfinity || isNegativeInfinity, CHIP_ERROR_INVALID_ARGUMENT);
             if (elementCtx.type.isDouble)
             {
                 if (isPositiveInfinity)
                 {
-                    ReturnErrorOnFailure(writer.Put(tag, std::numeric_limits<double>::infinity()));
+                    ReturnErrorOnFailure(mWriter.Put(tag, std::numeric_limits<double>::infinity()));
                 }
                 else
                 {
-                    ReturnErrorOnFailure(writer.Put(tag, -std::numeric_limits<double>::infinity()));
+                    ReturnErrorOnFailure(mWriter.Put(tag, -std::numeric_limits<double>::infinity()));
                 }
             }
             else
             {
                 if (isPositiveInfinity)
                 {
-                    ReturnErrorOnFailure(writer.Put(tag, std::numeric_limits<float>::infinity()));
+                    ReturnErrorOnFailure(mWriter.Put(tag, std::numeric_limits<float>::infinity()));
                 }
                 else
                 {
-                    ReturnErrorOnFailure(writer.Put(tag, -std::numeric_limits<float>::infinity()));
+                    ReturnErrorOnFailure(mWriter.Put(tag, -std::numeric_limits<float>::infinity()));
                 }
             }
         }
@@ -305,88 +1231,41 @@ CHIP_ERROR EncodeTlvElement(const Json::Value & val, TLV::TLVWriter & writer, co
     }
 
     case TLV::kTLVType_ByteString: {
-        VerifyOrReturnError(val.isString(), CHIP_ERROR_INVALID_ARGUMENT);
-        const std::string valAsString = val.asString();
-        size_t encodedLen             = valAsString.length();
+        VerifyOrReturnError(token.type == TokenType::kString, CHIP_ERROR_INVALID_ARGUMENT);
+        str               = GetString(token);
+        size_t encodedLen = str.size();
         VerifyOrReturnError(CanCastTo<uint16_t>(encodedLen), CHIP_ERROR_INVALID_ARGUMENT);
 
         // Check if the length is a multiple of 4 as strict padding is required.
         VerifyOrReturnError(encodedLen % 4 == 0, CHIP_ERROR_INVALID_ARGUMENT);
 
-        Platform::ScopedMemoryBuffer<uint8_t> byteString;
-        byteString.Alloc(BASE64_MAX_DECODED_LEN(static_cast<uint16_t>(encodedLen)));
-        VerifyOrReturnError(byteString.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-
-        auto decodedLen = Base64Decode(valAsString.c_str(), static_cast<uint16_t>(encodedLen), byteString.Get());
+        mBytes.resize(std::max(mBytes.size(), static_cast<size_t>(BASE64_MAX_DECODED_LEN(encodedLen))));
+        auto decodedLen = Base64Decode(str.data(), static_cast<uint16_t>(encodedLen), mBytes.data());
         VerifyOrReturnError(decodedLen < UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
-        ReturnErrorOnFailure(writer.PutBytes(tag, byteString.Get(), decodedLen));
+        ReturnErrorOnFailure(mWriter.PutBytes(tag, mBytes.data(), decodedLen));
         break;
     }
 
     case TLV::kTLVType_UTF8String: {
-        VerifyOrReturnError(val.isString(), CHIP_ERROR_INVALID_ARGUMENT);
-        const std::string valAsString = val.asString();
-        ReturnErrorOnFailure(writer.PutString(tag, valAsString.data(), static_cast<uint32_t>(valAsString.size())));
+        VerifyOrReturnError(token.type == TokenType::kString, CHIP_ERROR_INVALID_ARGUMENT);
+        str = GetString(token);
+        ReturnErrorOnFailure(mWriter.PutString(tag, str.data(), static_cast<uint32_t>(str.size())));
         break;
     }
 
     case TLV::kTLVType_Null: {
-        VerifyOrReturnError(val.isNull(), CHIP_ERROR_INVALID_ARGUMENT);
-        ReturnErrorOnFailure(writer.PutNull(tag));
+        VerifyOrReturnError(token.type == TokenType::kNull, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(mWriter.PutNull(tag));
         break;
     }
 
-    case TLV::kTLVType_Structure: {
-        TLV::TLVType containerType;
-        VerifyOrReturnError(val.isObject(), CHIP_ERROR_INVALID_ARGUMENT);
-        ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, containerType));
+    case TLV::kTLVType_Structure:
+        VerifyOrReturnError(token.type == TokenType::kObjectBegin, CHIP_ERROR_INVALID_ARGUMENT);
+        return EncodeStructure(cursor, tag, depth);
 
-        std::vector<std::string> jsonNames = val.getMemberNames();
-        std::vector<ElementContext> nestedElementsCtx;
-
-        for (size_t i = 0; i < jsonNames.size(); i++)
-        {
-            ElementContext ctx;
-            ReturnErrorOnFailure(ParseJsonName(jsonNames[i], ctx, writer.ImplicitProfileId));
-            nestedElementsCtx.push_back(ctx);
-        }
-
-        // Sort Json object elements by Tag number (low to high).
-        // Note that all sorted Context Tags will appear first followed by all sorted Common Tags.
-        std::sort(nestedElementsCtx.begin(), nestedElementsCtx.end(), CompareByTag);
-
-        for (auto & ctx : nestedElementsCtx)
-        {
-            ReturnErrorOnFailure(EncodeTlvElement(val[ctx.jsonName], writer, ctx));
-        }
-
-        ReturnErrorOnFailure(writer.EndContainer(containerType));
-        break;
-    }
-
-    case TLV::kTLVType_Array: {
-        TLV::TLVType containerType;
-        VerifyOrReturnError(val.isArray(), CHIP_ERROR_INVALID_ARGUMENT);
-        ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Array, containerType));
-
-        if (elementCtx.subType.tlvType == TLV::kTLVType_NotSpecified)
-        {
-            VerifyOrReturnError(val.size() == 0, CHIP_ERROR_INVALID_ARGUMENT);
-        }
-        else
-        {
-            ElementContext nestedElementCtx;
-            nestedElementCtx.tag  = TLV::AnonymousTag();
-            nestedElementCtx.type = elementCtx.subType;
-            for (Json::ArrayIndex i = 0; i < val.size(); i++)
-            {
-                ReturnErrorOnFailure(EncodeTlvElement(val[i], writer, nestedElementCtx));
-            }
-        }
-
-        ReturnErrorOnFailure(writer.EndContainer(containerType));
-        break;
-    }
+    case TLV::kTLVType_Array:
+        VerifyOrReturnError(token.type == TokenType::kArrayBegin, CHIP_ERROR_INVALID_ARGUMENT);
+        return EncodeArray(cursor, elementCtx, depth);
 
     default:
         return CHIP_ERROR_INVALID_TLV_ELEMENT;
@@ -411,14 +1290,6 @@ CHIP_ERROR JsonToTlv(const std::string & jsonString, MutableByteSpan & tlv)
 
 CHIP_ERROR JsonToTlv(const std::string & jsonString, TLV::TLVWriter & writer)
 {
-    Json::Reader reader;
-    Json::Value json;
-    bool result = reader.parse(jsonString, json);
-    VerifyOrReturnError(result, CHIP_ERROR_INTERNAL);
-
-    ElementContext elementCtx;
-    elementCtx.type = { TLV::kTLVType_Structure, false };
-
     // Use kTemporaryImplicitProfileId as the default value for cases where no explicit implicit profile ID is provided by
     // the caller. This allows for the encoding of tags that are not vendor-specific or context-specific but are instead
     // associated with a temporary implicit profile ID (0xFF01).
@@ -427,7 +1298,7 @@ CHIP_ERROR JsonToTlv(const std::string & jsonString, TLV::TLVWriter & writer)
         writer.ImplicitProfileId = kTemporaryImplicitProfileId;
     }
 
-    return EncodeTlvElement(json, writer, elementCtx);
+    return JsonToTlvConverter(jsonString, writer).Convert();
 }
 
 CHIP_ERROR ConvertTlvTag(uint32_t tagNumber, TLV::Tag & tag)
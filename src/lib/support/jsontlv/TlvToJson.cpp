@@ -15,11 +15,19 @@
  *    limitations under the License.
  */
 
-#include "lib/support/CHIPMemString.h"
-#include "lib/support/ScopedBuffer.h"
-#include <json/json.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <charconv>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/Base64.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/jsontlv/ElementTypes.h>
 #include <lib/support/jsontlv/TlvToJson.h>
@@ -35,6 +43,12 @@ namespace {
 // and this value is never stored.
 constexpr uint32_t kTemporaryImplicitProfileId = 0xFF01;
 
+// Number of spaces each nesting level is indented by.
+constexpr size_t kJsonIndentSize = 3;
+
+// Length of a line past which an array is not written on a single line.
+constexpr size_t kJsonRightMargin = 74;
+
 /// RAII to switch the implicit profile id for a reader
 class ImplicitProfileIdChange
 {
@@ -77,95 +91,295 @@ const char * GetJsonElementStrFromType(const ElementTypeContext & ctx)
     }
 };
 
+ElementTypeContext GetElementType(TLV::TLVReader & reader)
+{
+    ElementTypeContext type;
+    type.tlvType = reader.GetType();
+    if (type.tlvType == TLV::kTLVType_FloatingPointNumber)
+    {
+        type.isDouble = reader.IsElementDouble();
+    }
+    return type;
+}
+
+template <typename T>
+void AppendDecimal(std::string & out, T value)
+{
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+void AppendIndent(std::string & out, size_t depth)
+{
+    out += '\n';
+    out.append(depth * kJsonIndentSize, ' ');
+}
+
+void AppendEscapedCodeUnit(std::string & out, uint32_t codeUnit)
+{
+    static constexpr char kHexDigits[] = "0123456789abcdef";
+
+    out += "\\u";
+    out += kHexDigits[(codeUnit >> 12) & 0xF];
+    out += kHexDigits[(codeUnit >> 8) & 0xF];
+    out += kHexDigits[(codeUnit >> 4) & 0xF];
+    out += kHexDigits[codeUnit & 0xF];
+}
+
 /*
- * Encapsulates the element information required to construct a JSON element name string in a JSON object.
- *
- * The generated JSON element name string is constructed as:
- *     'TagNumber:ElementType-SubElementType'.
+ * Decodes the UTF-8 sequence starting at pos, leaving pos on its last byte. As done by jsoncpp, continuation bytes are
+ * not checked, and truncated or overlong sequences, as well as encoded surrogates, decode as U+FFFD.
  */
-struct JsonObjectElementContext
+uint32_t DecodeUtf8(const char *& pos, const char * end)
 {
-    JsonObjectElementContext(TLV::TLVReader & reader)
+    constexpr uint32_t kReplacementCharacter = 0xFFFD;
+
+    uint32_t codePoint = static_cast<uint8_t>(pos[0]);
+    if (codePoint < 0x80)
     {
-        tag               = reader.GetTag();
-        implicitProfileId = reader.ImplicitProfileId;
-        type.tlvType      = reader.GetType();
-        if (type.tlvType == TLV::kTLVType_FloatingPointNumber)
-        {
-            type.isDouble = reader.IsElementDouble();
-        }
+        return codePoint;
     }
 
-    std::string GenerateJsonElementName() const
+    if (codePoint < 0xE0)
     {
-        std::string str = "???";
-        if (TLV::IsContextTag(tag))
-        {
-            // common case for context tags: raw value
-            str = std::to_string(TLV::TagNumFromTag(tag));
-        }
-        else if (TLV::IsProfileTag(tag))
+        VerifyOrReturnValue(end - pos >= 2, kReplacementCharacter);
+        codePoint = ((codePoint & 0x1F) << 6) | (static_cast<uint8_t>(pos[1]) & 0x3F);
+        pos += 1;
+        return (codePoint < 0x80) ? kReplacementCharacter : codePoint;
+    }
+
+    if (codePoint < 0xF0)
+    {
+        VerifyOrReturnValue(end - pos >= 3, kReplacementCharacter);
+        codePoint = ((codePoint & 0x0F) << 12) | ((static_cast<uint8_t>(pos[1]) & 0x3F) << 6) |
+            (static_cast<uint8_t>(pos[2]) & 0x3F);
+        pos += 2;
+        return (codePoint < 0x800 || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) ? kReplacementCharacter : codePoint;
+    }
+
+    if (codePoint < 0xF8)
+    {
+        VerifyOrReturnValue(end - pos >= 4, kReplacementCharacter);
+        codePoint = ((codePoint & 0x07) << 18) | ((static_cast<uint8_t>(pos[1]) & 0x3F) << 12) |
+            ((static_cast<uint8_t>(pos[2]) & 0x3F) << 6) | (static_cast<uint8_t>(pos[3]) & 0x3F);
+        pos += 3;
+        return (codePoint < 0x10000) ? kReplacementCharacter : codePoint;
+    }
+
+    return kReplacementCharacter;
+}
+
+/*
+ * Appends a quoted JSON string. Besides the usual escapes, characters outside of ASCII are written as escaped UTF-16
+ * code units, so that the text is plain ASCII, as Json::StyledWriter writes strings.
+ */
+void AppendQuotedString(std::string & out, const CharSpan & str)
+{
+    const char * end = str.data() + str.size();
+
+    out += '"';
+    for (const char * pos = str.data(); pos < end; pos++)
+    {
+        switch (*pos)
         {
-            if (TLV::ProfileIdFromTag(tag) == implicitProfileId)
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\b':
+            out += "\\b";
+            break;
+        case '\f':
+            out += "\\f";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\r':
+            out += "\\r";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default: {
+            uint32_t codePoint = DecodeUtf8(pos, end);
+            if (codePoint < 0x20 || (codePoint >= 0x80 && codePoint < 0x10000))
+            {
+                AppendEscapedCodeUnit(out, codePoint);
+            }
+            else if (codePoint < 0x80)
             {
-                str = std::to_string(TLV::TagNumFromTag(tag));
+                out += static_cast<char>(codePoint);
             }
             else
             {
-                uint32_t tagNumber = (static_cast<uint32_t>(TLV::VendorIdFromTag(tag)) << 16) | TLV::TagNumFromTag(tag);
-                str                = std::to_string(tagNumber);
+                // Outside of the Basic Multilingual Plane, written as a surrogate pair.
+                codePoint -= 0x10000;
+                AppendEscapedCodeUnit(out, 0xD800 + ((codePoint >> 10) & 0x3FF));
+                AppendEscapedCodeUnit(out, 0xDC00 + (codePoint & 0x3FF));
             }
+            break;
         }
-        str = str + ":" + GetJsonElementStrFromType(type);
-        if (type.tlvType == TLV::kTLVType_Array)
-        {
-            str = str + "-" + GetJsonElementStrFromType(subType);
         }
-        return str;
     }
+    out += '"';
+}
 
-    TLV::Tag tag;
-    uint32_t implicitProfileId;
-    ElementTypeContext type;
-    ElementTypeContext subType;
-};
+void AppendDouble(std::string & out, double value)
+{
+    if (value == std::numeric_limits<double>::infinity())
+    {
+        AppendQuotedString(out, CharSpan::fromCharString(kFloatingPointPositiveInfinity));
+        return;
+    }
+    if (value == -std::numeric_limits<double>::infinity())
+    {
+        AppendQuotedString(out, CharSpan::fromCharString(kFloatingPointNegativeInfinity));
+        return;
+    }
+    if (std::isnan(value))
+    {
+        // JSON has no representation for NaN.
+        out += "null";
+        return;
+    }
+
+    // 17 significant digits, enough to read back the exact same double.
+    char buffer[32];
+    int length = snprintf(buffer, sizeof(buffer), "%.17g", value);
+    VerifyOrReturn(length > 0 && static_cast<size_t>(length) < sizeof(buffer));
+    out.append(buffer, static_cast<size_t>(length));
+    if (strpbrk(buffer, ".e") == nullptr)
+    {
+        // Keep integral values recognizable as floating point numbers.
+        out += ".0";
+    }
+}
 
 /*
- * This templated function inserts a name/value pair into the Json object.
- * The value is templated to be of type T and accepts any of the following types:
- *
- *      bool, uint*_t, int*_t, char *, float, double, std::string, Json::Value
+ * Appends the JSON element name for the element the reader is positioned on to the output.
  *
- * This method uses the provided element context to generate Json name string.
+ * The generated JSON element name string is constructed as:
+ *     'TagNumber:ElementType-SubElementType'.
  */
-template <typename T>
-void InsertJsonElement(Json::Value & json, const JsonObjectElementContext & ctx, T val)
+void AppendJsonElementName(std::string & out, TLV::TLVReader & reader, const ElementTypeContext & type,
+                           const ElementTypeContext & subType)
 {
-    if (json.isArray())
+    TLV::Tag tag = reader.GetTag();
+
+    if (TLV::IsContextTag(tag))
     {
-        json.append(val);
+        // common case for context tags: raw value
+        AppendDecimal(out, TLV::TagNumFromTag(tag));
+    }
+    else if (TLV::IsProfileTag(tag))
+    {
+        if (TLV::ProfileIdFromTag(tag) == reader.ImplicitProfileId)
+        {
+            AppendDecimal(out, TLV::TagNumFromTag(tag));
+        }
+        else
+        {
+            uint32_t tagNumber = (static_cast<uint32_t>(TLV::VendorIdFromTag(tag)) << 16) | TLV::TagNumFromTag(tag);
+            AppendDecimal(out, tagNumber);
+        }
     }
     else
     {
-        json[ctx.GenerateJsonElementName()] = val;
+        out += "???";
+    }
+    out += ':';
+    out += GetJsonElementStrFromType(type);
+    if (type.tlvType == TLV::kTLVType_Array)
+    {
+        out += '-';
+        out += GetJsonElementStrFromType(subType);
     }
 }
 
-static CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj);
+/*
+ * Determines the element type of the array the reader is positioned on from its first element, without moving the
+ * reader. The element type of an empty array is kTLVType_NotSpecified.
+ */
+CHIP_ERROR PeekArrayElementType(const TLV::TLVReader & reader, ElementTypeContext & subType)
+{
+    TLV::TLVReader arrayReader;
+    TLV::TLVType containerType;
+
+    arrayReader.Init(reader);
+    ReturnErrorOnFailure(arrayReader.EnterContainer(containerType));
+
+    CHIP_ERROR err = arrayReader.Next();
+    if (err == CHIP_END_OF_TLV)
+    {
+        subType = ElementTypeContext();
+        return CHIP_NO_ERROR;
+    }
+    ReturnErrorOnFailure(err);
+
+    subType = GetElementType(arrayReader);
+    return CHIP_NO_ERROR;
+}
 
 /*
- * Given a TLVReader positioned at TLV structure this function:
- *   - enters structure
- *   - converts all elements of a structure into JSON object representation
- *   - exits structure
+ * Writes the JSON text for a TLV payload as the TLV is read, in the layout of the Json::StyledWriter of jsoncpp that
+ * the text has always been written with:
+ *   - object members are in lexicographic order of their names, and of members with the same name only the last one
+ *     is kept;
+ *   - each nesting level is indented by three spaces;
+ *   - arrays of a few short values are written on a single line.
+ *
+ * The position of each member and array element in the output is kept until its object or array is complete, so that
+ * members can then be reordered, and arrays folded, in place. A single vector holds the positions for all the
+ * containers being converted.
  */
-CHIP_ERROR TlvStructToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
+class TlvToJsonConverter
+{
+public:
+    TlvToJsonConverter(std::string & out) : mOut(out) {}
+
+    /*
+     * Given a TLVReader positioned at TLV structure this function:
+     *   - enters structure
+     *   - converts all elements of a structure into JSON object representation
+     *   - exits structure
+     */
+    CHIP_ERROR ConvertStruct(TLV::TLVReader & reader, size_t depth);
+
+private:
+    // Position of a member or array element in the output.
+    struct OutputRange
+    {
+        size_t begin = 0;
+        size_t end   = 0;
+        // Position of the name of a member, past its opening quote.
+        size_t nameBegin  = 0;
+        size_t nameLength = 0;
+    };
+
+    CHIP_ERROR ConvertArray(TLV::TLVReader & reader, size_t depth);
+    CHIP_ERROR ConvertElement(TLV::TLVReader & reader, size_t depth);
+    bool IsNameLess(const OutputRange & a, const OutputRange & b) const;
+    void SortMembers(size_t first);
+    void FoldArray(size_t arrayBegin, size_t first);
+
+    std::string & mOut;
+    std::vector<OutputRange> mRanges;
+    std::string mScratch;
+};
+
+CHIP_ERROR TlvToJsonConverter::ConvertStruct(TLV::TLVReader & reader, size_t depth)
 {
     CHIP_ERROR err;
     TLV::TLVType containerType;
+    const size_t first = mRanges.size();
 
     ReturnErrorOnFailure(reader.EnterContainer(containerType));
 
+    mOut += '{';
     while ((err = reader.Next()) == CHIP_NO_ERROR)
     {
         TLV::Tag tag = reader.GetTag();
@@ -176,18 +390,179 @@ CHIP_ERROR TlvStructToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
             VerifyOrReturnError(TLV::TagNumFromTag(tag) > UINT8_MAX, CHIP_ERROR_INVALID_TLV_TAG);
         }
 
+        if (mRanges.size() > first)
+        {
+            mOut += ',';
+        }
+
+        OutputRange member;
+        member.begin = mOut.size();
+        AppendIndent(mOut, depth + 1);
+
+        ElementTypeContext type = GetElementType(reader);
+        ElementTypeContext subType;
+        if (type.tlvType == TLV::kTLVType_Array)
+        {
+            ReturnErrorOnFailure(PeekArrayElementType(reader, subType));
+        }
+        mOut += '"';
+        member.nameBegin = mOut.size();
+        AppendJsonElementName(mOut, reader, type, subType);
+        member.nameLength = mOut.size() - member.nameBegin;
+        mOut += "\" : ";
+
         // Recursively convert to JSON the item within the struct.
-        ReturnErrorOnFailure(TlvToJson(reader, jsonObj));
+        ReturnErrorOnFailure(ConvertElement(reader, depth + 1));
+        member.end = mOut.size();
+        mRanges.push_back(member);
     }
 
     VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    if (mRanges.size() > first)
+    {
+        SortMembers(first);
+        AppendIndent(mOut, depth);
+    }
+    mOut += '}';
+    mRanges.resize(first);
     return reader.ExitContainer(containerType);
 }
 
-CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
+/*
+ * Given a TLVReader positioned at a TLV array, converts its elements into a JSON array. Elements must all be of the
+ * same type, anything but another array.
+ */
+CHIP_ERROR TlvToJsonConverter::ConvertArray(TLV::TLVReader & reader, size_t depth)
 {
-    JsonObjectElementContext context(reader);
+    CHIP_ERROR err;
+    ElementTypeContext prevSubType;
+    TLV::TLVType containerType;
+    const size_t arrayBegin = mOut.size();
+    const size_t first      = mRanges.size();
+
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+    mOut += '[';
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
+        VerifyOrReturnError(reader.GetType() != TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+        ElementTypeContext nextSubType = GetElementType(reader);
+        if (mRanges.size() == first)
+        {
+            prevSubType = nextSubType;
+        }
+        else
+        {
+            VerifyOrReturnError(prevSubType.tlvType == nextSubType.tlvType && prevSubType.isDouble == nextSubType.isDouble,
+                                CHIP_ERROR_INVALID_TLV_ELEMENT);
+            mOut += ',';
+        }
+        AppendIndent(mOut, depth + 1);
+
+        // Recursively convert to JSON the encompassing item within the array.
+        OutputRange element;
+        element.begin = mOut.size();
+        ReturnErrorOnFailure(ConvertElement(reader, depth + 1));
+        element.end = mOut.size();
+        mRanges.push_back(element);
+    }
+
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    if (mRanges.size() > first)
+    {
+        AppendIndent(mOut, depth);
+    }
+    mOut += ']';
+    FoldArray(arrayBegin, first);
+    mRanges.resize(first);
+    return reader.ExitContainer(containerType);
+}
+
+bool TlvToJsonConverter::IsNameLess(const OutputRange & a, const OutputRange & b) const
+{
+    // Compared byte by byte, as done for the keys of a Json::Value.
+    int comp = memcmp(&mOut[a.nameBegin], &mOut[b.nameBegin], std::min(a.nameLength, b.nameLength));
+    return (comp != 0) ? (comp < 0) : (a.nameLength < b.nameLength);
+}
+
+/*
+ * Puts the members of the object just written, the positions of which start at first, in the order of their names.
+ */
+void TlvToJsonConverter::SortMembers(size_t first)
+{
+    auto begin = mRanges.begin() + static_cast<ptrdiff_t>(first);
+    auto end   = mRanges.end();
+
+    // Members are often written in order already, such as those with tags below 10.
+    auto isNotBefore = [this](const OutputRange & a, const OutputRange & b) { return !IsNameLess(a, b); };
+    VerifyOrReturn(std::adjacent_find(begin, end, isNotBefore) != end);
+
+    const size_t regionBegin = begin->begin;
+    const size_t regionEnd   = (end - 1)->end;
+
+    // Members with the same name are kept in the order they were written in.
+    std::sort(begin, end, [this](const OutputRange & a, const OutputRange & b) {
+        return IsNameLess(a, b) || (!IsNameLess(b, a) && a.begin < b.begin);
+    });
+
+    mScratch.clear();
+    for (auto it = begin; it != end; ++it)
+    {
+        if (it + 1 != end && !IsNameLess(*it, *(it + 1)))
+        {
+            // Overridden by the member with the same name written after it.
+            continue;
+        }
+        if (!mScratch.empty())
+        {
+            mScratch += ',';
+        }
+        mScratch.append(mOut, it->begin, it->end - it->begin);
+    }
+    mOut.replace(regionBegin, regionEnd - regionBegin, mScratch);
+}
 
+/*
+ * Rewrites the array just written at arrayBegin, the positions of the elements of which start at first, onto a single
+ * line if it is short. As decided by Json::StyledWriter, that is when it has fewer than 25 elements, none of them a
+ * non-empty object, and the line without its indentation is shorter than the right margin.
+ */
+void TlvToJsonConverter::FoldArray(size_t arrayBegin, size_t first)
+{
+    const size_t count = mRanges.size() - first;
+    VerifyOrReturn(count > 0 && count * 3 < kJsonRightMargin);
+
+    // Room for "[ ", " ]" and the ", " between elements.
+    size_t lineLength = 4 + (count - 1) * 2;
+    for (size_t i = first; i < mRanges.size(); i++)
+    {
+        const OutputRange & element = mRanges[i];
+        // Array elements are never arrays, and only objects with members span several lines.
+        VerifyOrReturn(mOut[element.begin] != '{' || element.end - element.begin == 2);
+        lineLength += element.end - element.begin;
+    }
+    VerifyOrReturn(lineLength < kJsonRightMargin);
+
+    mScratch = "[ ";
+    for (size_t i = first; i < mRanges.size(); i++)
+    {
+        if (i > first)
+        {
+            mScratch += ", ";
+        }
+        mScratch.append(mOut, mRanges[i].begin, mRanges[i].end - mRanges[i].begin);
+    }
+    mScratch += " ]";
+    mOut.replace(arrayBegin, mOut.size() - arrayBegin, mScratch);
+}
+
+/*
+ * Appends the JSON value for the element the reader is positioned on to the output, at the given nesting depth.
+ */
+CHIP_ERROR TlvToJsonConverter::ConvertElement(TLV::TLVReader & reader, size_t depth)
+{
     switch (reader.GetType())
     {
     case TLV::kTLVType_UnsignedInteger: {
@@ -195,11 +570,13 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
         ReturnErrorOnFailure(reader.Get(v));
         if (CanCastTo<uint32_t>(v))
         {
-            InsertJsonElement(jsonObj, context, v);
+            AppendDecimal(mOut, v);
         }
         else
         {
-            InsertJsonElement(jsonObj, context, std::to_string(v));
+            mOut += '"';
+            AppendDecimal(mOut, v);
+            mOut += '"';
         }
         break;
     }
@@ -209,11 +586,13 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
         ReturnErrorOnFailure(reader.Get(v));
         if (CanCastTo<int32_t>(v))
         {
-            InsertJsonElement(jsonObj, context, v);
+            AppendDecimal(mOut, v);
         }
         else
         {
-            InsertJsonElement(jsonObj, context, std::to_string(v));
+            mOut += '"';
+            AppendDecimal(mOut, v);
+            mOut += '"';
         }
         break;
     }
@@ -221,105 +600,46 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, Json::Value & jsonObj)
     case TLV::kTLVType_Boolean: {
         bool v;
         ReturnErrorOnFailure(reader.Get(v));
-        InsertJsonElement(jsonObj, context, v);
+        mOut += v ? "true" : "false";
         break;
     }
 
     case TLV::kTLVType_FloatingPointNumber: {
         double v;
         ReturnErrorOnFailure(reader.Get(v));
-        if (v == std::numeric_limits<double>::infinity())
-        {
-            InsertJsonElement(jsonObj, context, kFloatingPointPositiveInfinity);
-        }
-        else if (v == -std::numeric_limits<double>::infinity())
-        {
-            InsertJsonElement(jsonObj, context, kFloatingPointNegativeInfinity);
-        }
-        else
-        {
-            InsertJsonElement(jsonObj, context, v);
-        }
+        AppendDouble(mOut, v);
         break;
     }
 
     case TLV::kTLVType_ByteString: {
         ByteSpan span;
         ReturnErrorOnFailure(reader.Get(span));
+        VerifyOrReturnError(CanCastTo<uint32_t>(span.size()), CHIP_ERROR_INVALID_TLV_ELEMENT);
 
-        Platform::ScopedMemoryBuffer<char> byteString;
-        byteString.Alloc(BASE64_ENCODED_LEN(span.size()) + 1);
-        VerifyOrReturnError(byteString.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-
-        auto encodedLen              = Base64Encode(span.data(), static_cast<uint16_t>(span.size()), byteString.Get());
-        byteString.Get()[encodedLen] = '\0';
-
-        InsertJsonElement(jsonObj, context, byteString.Get());
+        // Encoded straight into the output.
+        size_t start = mOut.size() + 1;
+        mOut.append(BASE64_ENCODED_LEN(span.size()) + 2, '"');
+        Base64Encode32(span.data(), static_cast<uint32_t>(span.size()), &mOut[start]);
         break;
     }
 
     case TLV::kTLVType_UTF8String: {
         CharSpan span;
         ReturnErrorOnFailure(reader.Get(span));
-
-        std::string str(span.data(), span.size());
-        InsertJsonElement(jsonObj, context, str);
+        AppendQuotedString(mOut, span);
         break;
     }
 
     case TLV::kTLVType_Null: {
-        InsertJsonElement(jsonObj, context, Json::Value());
-        break;
-    }
-
-    case TLV::kTLVType_Structure: {
-        Json::Value jsonStruct(Json::objectValue);
-        ReturnErrorOnFailure(TlvStructToJson(reader, jsonStruct));
-        InsertJsonElement(jsonObj, context, jsonStruct);
+        mOut += "null";
         break;
     }
 
-    case TLV::kTLVType_Array: {
-        CHIP_ERROR err;
-        Json::Value jsonArray(Json::arrayValue);
-        ElementTypeContext prevSubType;
-        ElementTypeContext nextSubType;
-        TLV::TLVType containerType;
-
-        ReturnErrorOnFailure(reader.EnterContainer(containerType));
-
-        while ((err = reader.Next()) == CHIP_NO_ERROR)
-        {
-            VerifyOrReturnError(reader.GetTag() == TLV::AnonymousTag(), CHIP_ERROR_INVALID_TLV_TAG);
-            VerifyOrReturnError(reader.GetType() != TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
-
-            nextSubType.tlvType = reader.GetType();
-            if (nextSubType.tlvType == TLV::kTLVType_FloatingPointNumber)
-            {
-                nextSubType.isDouble = reader.IsElementDouble();
-            }
-
-            if (jsonArray.empty())
-            {
-                prevSubType = nextSubType;
-            }
-            else
-            {
-                VerifyOrReturnError(prevSubType.tlvType == nextSubType.tlvType && prevSubType.isDouble == nextSubType.isDouble,
-                                    CHIP_ERROR_INVALID_TLV_ELEMENT);
-            }
-
-            // Recursively convert to JSON the encompassing item within the array.
-            ReturnErrorOnFailure(TlvToJson(reader, jsonArray));
-        }
-
-        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-        ReturnErrorOnFailure(reader.ExitContainer(containerType));
+    case TLV::kTLVType_Structure:
+        return ConvertStruct(reader, depth);
 
-        context.subType = prevSubType;
-        InsertJsonElement(jsonObj, context, jsonArray);
-        break;
-    }
+    case TLV::kTLVType_Array:
+        return ConvertArray(reader, depth);
 
     default:
         return CHIP_ERROR_INVALID_TLV_ELEMENT;
@@ -350,11 +670,14 @@ CHIP_ERROR TlvToJson(TLV::TLVReader & reader, std::string & jsonString)
     // During json conversion, a implicit profile ID is required
     ImplicitProfileIdChange implicitProfileIdChange(reader, kTemporaryImplicitProfileId);
 
-    Json::Value jsonObject(Json::objectValue);
-    ReturnErrorOnFailure(TlvStructToJson(reader, jsonObject));
+    // The JSON text is written as the TLV is read, in the layout of a styled JSON writer, and only handed out once the
+    // whole payload converted.
+    std::string json;
+    TlvToJsonConverter converter(json);
+    ReturnErrorOnFailure(converter.ConvertStruct(reader, 0));
+    json += '\n';
 
-    Json::StyledWriter writer;
-    jsonString = writer.write(jsonObject);
+    jsonString = std::move(json);
     return CHIP_NO_ERROR;
 }
 } // namespace chip
@@ -0,0 +1,710 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <lib/support/logging/deferred/DeferredLogging.h>
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/BufferReader.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/EnforceFormat.h>
+#include <lib/support/TypeTraits.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/logging/LogV.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <type_traits>
+
+namespace chip {
+namespace Logging {
+namespace Deferred {
+
+namespace {
+
+using namespace Format;
+
+constexpr auto kDrainInterval = std::chrono::milliseconds(10);
+
+// Longest conversion specification that is recorded, e.g. "%-08.*llX".
+constexpr size_t kMaxSpecLength = 16;
+
+const char kNullString[] = "(null)";
+
+std::atomic<DeferredLogger *> gActiveLogger{ nullptr };
+
+uint64_t NowUs()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+enum class LengthModifier : uint8_t
+{
+    kNone,
+    kChar,       // hh
+    kShort,      // h
+    kLong,       // l
+    kLongLong,   // ll
+    kIntMax,     // j
+    kSize,       // z
+    kPtrDiff,    // t
+    kLongDouble, // L
+};
+
+struct Conversion
+{
+    const char * begin;    // the '%'
+    const char * end;      // one past the conversion character
+    char type;             // conversion character, '\0' if the format ends within the specification
+    LengthModifier length; // length modifier of the argument
+    uint8_t starCount;     // '*' width and precision, each taking an int argument
+    bool starPrecision;    // the precision is the last '*' argument
+    int precision;         // explicit precision, -1 if none
+};
+
+// Finds the first conversion specification at or after p. Returns false if there is none.
+bool NextConversion(const char * p, Conversion & conversion)
+{
+    p = strchr(p, '%');
+    VerifyOrReturnValue(p != nullptr, false);
+
+    conversion.begin         = p++;
+    conversion.starCount     = 0;
+    conversion.starPrecision = false;
+    conversion.precision     = -1;
+    conversion.length        = LengthModifier::kNone;
+
+    while (*p != '\0' && strchr("-+ #0'", *p) != nullptr)
+    {
+        p++;
+    }
+    if (*p == '*')
+    {
+        conversion.starCount++;
+        p++;
+    }
+    while (*p >= '0' && *p <= '9')
+    {
+        p++;
+    }
+    if (*p == '.')
+    {
+        p++;
+        if (*p == '*')
+        {
+            conversion.starCount++;
+            conversion.starPrecision = true;
+            p++;
+        }
+        else
+        {
+            conversion.precision = 0;
+            for (; *p >= '0' && *p <= '9'; p++)
+            {
+                conversion.precision = std::min(conversion.precision * 10 + (*p - '0'), UINT16_MAX);
+            }
+        }
+    }
+
+    switch (*p)
+    {
+    case 'h':
+        conversion.length = (*++p == 'h') ? (p++, LengthModifier::kChar) : LengthModifier::kShort;
+        break;
+    case 'l':
+        conversion.length = (*++p == 'l') ? (p++, LengthModifier::kLongLong) : LengthModifier::kLong;
+        break;
+    case 'j':
+        conversion.length = LengthModifier::kIntMax;
+        p++;
+        break;
+    case 'z':
+        conversion.length = LengthModifier::kSize;
+        p++;
+        break;
+    case 't':
+        conversion.length = LengthModifier::kPtrDiff;
+        p++;
+        break;
+    case 'L':
+        conversion.length = LengthModifier::kLongDouble;
+        p++;
+        break;
+    default:
+        break;
+    }
+
+    conversion.type = *p;
+    conversion.end  = (*p != '\0') ? p + 1 : p;
+    return true;
+}
+
+// The argument readers below take the va_list by reference, which is only valid for a
+// va_list object (not a parameter, which may have decayed to a pointer).
+bool ReadSigned(LengthModifier length, va_list & args, int64_t & value)
+{
+    switch (length)
+    {
+    case LengthModifier::kNone:
+    case LengthModifier::kChar:
+    case LengthModifier::kShort:
+        value = va_arg(args, int);
+        return true;
+    case LengthModifier::kLong:
+        value = va_arg(args, long);
+        return true;
+    case LengthModifier::kLongLong:
+        value = va_arg(args, long long);
+        return true;
+    case LengthModifier::kIntMax:
+        value = va_arg(args, intmax_t);
+        return true;
+    case LengthModifier::kSize:
+        value = va_arg(args, std::make_signed_t<size_t>);
+        return true;
+    case LengthModifier::kPtrDiff:
+        value = va_arg(args, ptrdiff_t);
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool ReadUnsigned(LengthModifier length, va_list & args, uint64_t & value)
+{
+    switch (length)
+    {
+    case LengthModifier::kNone:
+    case LengthModifier::kChar:
+    case LengthModifier::kShort:
+        value = va_arg(args, unsigned int);
+        return true;
+    case LengthModifier::kLong:
+        value = va_arg(args, unsigned long);
+        return true;
+    case LengthModifier::kLongLong:
+        value = va_arg(args, unsigned long long);
+        return true;
+    case LengthModifier::kIntMax:
+        value = va_arg(args, uintmax_t);
+        return true;
+    case LengthModifier::kSize:
+        value = va_arg(args, size_t);
+        return true;
+    case LengthModifier::kPtrDiff:
+        value = va_arg(args, std::make_unsigned_t<ptrdiff_t>);
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Records the arguments of format into payload as laid out in Format. Returns false if
+// an argument cannot be recorded, leaving args untouched.
+bool EncodeArguments(const char * format, va_list args, uint8_t * payload, size_t payloadSize, uint16_t & payloadLength)
+{
+    Encoding::LittleEndian::BufferWriter writer(payload, payloadSize);
+    bool encoded = true;
+
+    va_list copy;
+    va_copy(copy, args);
+
+    Conversion conversion;
+    for (const char * p = format; encoded && NextConversion(p, conversion); p = conversion.end)
+    {
+        if (conversion.type == '%')
+        {
+            encoded = (conversion.end == conversion.begin + 2);
+            continue;
+        }
+        VerifyOrExit(static_cast<size_t>(conversion.end - conversion.begin) <= kMaxSpecLength, encoded = false);
+
+        int precision = conversion.precision;
+        for (uint8_t i = 0; i < conversion.starCount; i++)
+        {
+            precision = va_arg(copy, int);
+            writer.Put64(static_cast<uint64_t>(static_cast<int64_t>(precision)));
+        }
+        if (!conversion.starPrecision && conversion.starCount > 0)
+        {
+            precision = conversion.precision;
+        }
+
+        switch (conversion.type)
+        {
+        case 'd':
+        case 'i': {
+            int64_t value;
+            VerifyOrExit(ReadSigned(conversion.length, copy, value), encoded = false);
+            writer.Put64(static_cast<uint64_t>(value));
+            break;
+        }
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X': {
+            uint64_t value;
+            VerifyOrExit(ReadUnsigned(conversion.length, copy, value), encoded = false);
+            writer.Put64(value);
+            break;
+        }
+        case 'c':
+            VerifyOrExit(conversion.length == LengthModifier::kNone, encoded = false);
+            writer.Put64(static_cast<uint64_t>(static_cast<int64_t>(va_arg(copy, int))));
+            break;
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A': {
+            double value;
+            if (conversion.length == LengthModifier::kLongDouble)
+            {
+                value = static_cast<double>(va_arg(copy, long double));
+            }
+            else
+            {
+                VerifyOrExit(conversion.length == LengthModifier::kNone || conversion.length == LengthModifier::kLong,
+                             encoded = false);
+                value = va_arg(copy, double);
+            }
+            uint64_t bits;
+            static_assert(sizeof(bits) == sizeof(value), "Doubles are recorded as binary64");
+            memcpy(&bits, &value, sizeof(bits));
+            writer.Put64(bits);
+            break;
+        }
+        case 's': {
+            VerifyOrExit(conversion.length == LengthModifier::kNone, encoded = false);
+            const char * str = va_arg(copy, const char *);
+            if (str == nullptr)
+            {
+                str = kNullString;
+            }
+            // A precision bounds strings that are not null-terminated, e.g. "%.*s" of a span.
+            const size_t limit  = (precision >= 0) ? static_cast<size_t>(precision) : kMaxStringLen;
+            const size_t length = strnlen(str, std::min(limit, payloadSize));
+            writer.Put16(static_cast<uint16_t>(length)).Put(str, length);
+            break;
+        }
+        case 'p':
+            writer.Put64(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(va_arg(copy, void *))));
+            break;
+        default:
+            // %n, unknown conversions, or a format ending within a specification.
+            encoded = false;
+            break;
+        }
+    }
+
+exit:
+    va_end(copy);
+
+    VerifyOrReturnValue(encoded && writer.Fit(), false);
+    payloadLength = static_cast<uint16_t>(writer.Needed());
+    return true;
+}
+
+// Text being built from a record, cut at the end of the buffer like snprintf.
+class TextBuilder
+{
+public:
+    TextBuilder(char * buffer, size_t size) : mBuffer(buffer), mSize(size) { mBuffer[0] = '\0'; }
+
+    void Add(const char * str, size_t length)
+    {
+        length = std::min(length, mSize - 1 - mLength);
+        memcpy(mBuffer + mLength, str, length);
+        mLength += length;
+        mBuffer[mLength] = '\0';
+    }
+
+// The conversion specifications replayed here come from format strings that were checked by
+// the compiler at their log call (ChipLog* formats are literals), with the recorded arguments
+// converted back to the types the specifications expect.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+    template <typename T>
+    void AddConversion(const char * spec, const int * stars, uint8_t starCount, T value)
+    {
+        char * dest        = mBuffer + mLength;
+        const size_t space = mSize - mLength;
+        int written;
+        switch (starCount)
+        {
+        case 0:
+            written = snprintf(dest, space, spec, value);
+            break;
+        case 1:
+            written = snprintf(dest, space, spec, stars[0], value);
+            break;
+        default:
+            written = snprintf(dest, space, spec, stars[0], stars[1], value);
+            break;
+        }
+        if (written > 0)
+        {
+            mLength += std::min(static_cast<size_t>(written), space - 1);
+        }
+    }
+#pragma GCC diagnostic pop
+
+    size_t Length() const { return mLength; }
+
+private:
+    char * mBuffer;
+    size_t mSize;
+    size_t mLength = 0;
+};
+
+template <typename T>
+void AddSigned(TextBuilder & text, const char * spec, const int * stars, uint8_t starCount, uint64_t value)
+{
+    text.AddConversion(spec, stars, starCount, static_cast<T>(static_cast<int64_t>(value)));
+}
+
+template <typename T>
+void AddUnsigned(TextBuilder & text, const char * spec, const int * stars, uint8_t starCount, uint64_t value)
+{
+    text.AddConversion(spec, stars, starCount, static_cast<T>(value));
+}
+
+// Formats the arguments recorded by EncodeArguments.
+void DecodeArguments(const char * format, const uint8_t * payload, size_t payloadLength, TextBuilder & text)
+{
+    Encoding::LittleEndian::Reader reader(payload, payloadLength);
+    const char * p = format;
+
+    Conversion conversion;
+    while (reader.IsSuccess() && NextConversion(p, conversion))
+    {
+        text.Add(p, static_cast<size_t>(conversion.begin - p));
+        p = conversion.end;
+
+        if (conversion.type == '%')
+        {
+            text.Add("%", 1);
+            continue;
+        }
+
+        char spec[kMaxSpecLength + 1];
+        const size_t specLength = static_cast<size_t>(conversion.end - conversion.begin);
+        memcpy(spec, conversion.begin, specLength);
+        spec[specLength] = '\0';
+
+        int stars[2];
+        for (uint8_t i = 0; i < conversion.starCount; i++)
+        {
+            uint64_t star = 0;
+            VerifyOrReturn(reader.Read64(&star).IsSuccess());
+            stars[i] = static_cast<int>(static_cast<int64_t>(star));
+        }
+
+        if (conversion.type == 's')
+        {
+            uint16_t length = 0;
+            char str[DeferredLogger::kRecordSize];
+            VerifyOrReturn(reader.Read16(&length).IsSuccess() && length < sizeof(str));
+            VerifyOrReturn(reader.ReadBytes(reinterpret_cast<uint8_t *>(str), length).IsSuccess());
+            str[length] = '\0';
+            text.AddConversion(spec, stars, conversion.starCount, static_cast<const char *>(str));
+            continue;
+        }
+
+        uint64_t value = 0;
+        VerifyOrReturn(reader.Read64(&value).IsSuccess());
+
+        switch (conversion.type)
+        {
+        case 'd':
+        case 'i':
+            switch (conversion.length)
+            {
+            case LengthModifier::kLong:
+                AddSigned<long>(text, spec, stars, conversion.starCount, value);
+                break;
+            case LengthModifier::kLongLong:
+                AddSigned<long long>(text, spec, stars, conversion.starCount, value);
+                break;
+            case LengthModifier::kIntMax:
+                AddSigned<intmax_t>(text, spec, stars, conversion.starCount, value);
+                break;
+            case LengthModifier::kSize:
+                AddSigned<std::make_signed_t<size_t>>(text, spec, stars, conversion.starCount, value);
+                break;
+            case LengthModifier::kPtrDiff:
+                AddSigned<ptrdiff_t>(text, spec, stars, conversion.starCount, value);
+                break;
+            default:
+                AddSigned<int>(text, spec, stars, conversion.starCount, value);
+                break;
+            }
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            switch (conversion.length)
+            {
+            case LengthModifier::kLong:
+                AddUnsigned<unsigned long>(text, spec, stars, conversion.starCount, value);
+                break;
+            case LengthModifier::kLongLong:
+                AddUnsigned<unsigned long long>(text, spec, stars, conversion.starCount, value);
+                break;
+            case LengthModifier::kIntMax:
+                AddUnsigned<uintmax_t>(text, spec, stars, conversion.starCount, value);
+                break;
+            case LengthModifier::kSize:
+                AddUnsigned<size_t>(text, spec, stars, conversion.starCount, value);
+                break;
+            case LengthModifier::kPtrDiff:
+                AddUnsigned<std::make_unsigned_t<ptrdiff_t>>(text, spec, stars, conversion.starCount, value);
+                break;
+            default:
+                AddUnsigned<unsigned int>(text, spec, stars, conversion.starCount, value);
+                break;
+            }
+            break;
+        case 'c':
+            AddSigned<int>(text, spec, stars, conversion.starCount, value);
+            break;
+        case 'p':
+            text.AddConversion(spec, stars, conversion.starCount, reinterpret_cast<void *>(static_cast<uintptr_t>(value)));
+            break;
+        default: {
+            double number;
+            memcpy(&number, &value, sizeof(number));
+            if (conversion.length == LengthModifier::kLongDouble)
+            {
+                text.AddConversion(spec, stars, conversion.starCount, static_cast<long double>(number));
+            }
+            else
+            {
+                text.AddConversion(spec, stars, conversion.starCount, number);
+            }
+            break;
+        }
+        }
+    }
+
+    if (reader.IsSuccess())
+    {
+        text.Add(p, strlen(p));
+    }
+}
+
+void ENFORCE_FORMAT(3, 4) PlatformLog(const char * module, uint8_t category, const char * msg, ...)
+{
+    va_list args;
+    va_start(args, msg);
+    Platform::LogV(module, category, msg, args);
+    va_end(args);
+}
+
+void PlatformSink(uint64_t timestampUs, uint32_t threadIndex, const char * module, uint8_t category, const char * text)
+{
+    PlatformLog(module, category, "[%" PRIu64 ".%06u][T%u] %s", timestampUs / 1000000,
+                static_cast<unsigned>(timestampUs % 1000000), static_cast<unsigned>(threadIndex), text);
+}
+
+} // namespace
+
+DeferredLogger::DeferredLogger() = default;
+
+DeferredLogger::~DeferredLogger()
+{
+    Stop();
+}
+
+CHIP_ERROR DeferredLogger::StartText(TextSink sink)
+{
+    Stop();
+
+    mOutput.SetSink((sink != nullptr) ? sink : PlatformSink);
+    return Start();
+}
+
+CHIP_ERROR DeferredLogger::StartFile(const char * path)
+{
+    Stop();
+
+    ReturnErrorOnFailure(mOutput.OpenFile(path));
+
+    CHIP_ERROR err = Start();
+    if (err != CHIP_NO_ERROR)
+    {
+        mOutput.CloseFile();
+    }
+    return err;
+}
+
+CHIP_ERROR DeferredLogger::Start()
+{
+    DeferredLogger * expected = nullptr;
+    VerifyOrReturnError(gActiveLogger.compare_exchange_strong(expected, this), CHIP_ERROR_INCORRECT_STATE);
+
+    mRings.Start(mOutput, kDrainInterval);
+    SetLogRedirectCallback(Redirect);
+    return CHIP_NO_ERROR;
+}
+
+void DeferredLogger::Stop()
+{
+    VerifyOrReturn(mRings.IsRunning());
+
+    SetLogRedirectCallback(nullptr);
+    mRings.Stop();
+    mOutput.CloseFile();
+    gActiveLogger.store(nullptr);
+}
+
+uint64_t DeferredLogger::GetDroppedCount()
+{
+    return mRings.GetDroppedCount();
+}
+
+void DeferredLogger::Redirect(const char * module, uint8_t category, const char * msg, va_list args)
+{
+    DeferredLogger * logger = gActiveLogger.load(std::memory_order_acquire);
+    if (logger != nullptr)
+    {
+        logger->Log(module, category, msg, args);
+    }
+    else
+    {
+        Platform::LogV(module, category, msg, args);
+    }
+}
+
+void DeferredLogger::Log(const char * module, uint8_t category, const char * msg, va_list args)
+{
+    mRings.Append([&](Record & record) {
+        record.timestampUs = NowUs();
+        record.format      = msg;
+        record.module      = module;
+        record.category    = category;
+        record.flags       = 0;
+
+        if (!EncodeArguments(msg, args, record.payload, sizeof(record.payload), record.payloadLength))
+        {
+            // Fall back to formatting here, which the drain thread passes on as is.
+            const int length = vsnprintf(reinterpret_cast<char *>(record.payload), sizeof(record.payload), msg, args);
+            record.format    = nullptr;
+            record.flags     = to_underlying(RecordFlags::kPreformatted);
+            if (length < 0)
+            {
+                record.payloadLength = 0;
+            }
+            else if (static_cast<size_t>(length) >= sizeof(record.payload))
+            {
+                record.payloadLength = static_cast<uint16_t>(sizeof(record.payload) - 1);
+                record.flags |= to_underlying(RecordFlags::kTruncated);
+            }
+            else
+            {
+                record.payloadLength = static_cast<uint16_t>(length);
+            }
+        }
+    });
+}
+
+CHIP_ERROR DeferredLogger::Output::OpenFile(const char * path)
+{
+    ReturnErrorOnFailure(OpenDrainOutputFile(mFile, path));
+
+    uint8_t header[kHeaderSize];
+    Encoding::LittleEndian::BufferWriter writer(header, sizeof(header));
+    writer.Put(kMagic, sizeof(kMagic)).Put16(kVersion).Put16(0);
+    mFile.write(reinterpret_cast<const char *>(header), static_cast<std::streamsize>(writer.Needed()));
+
+    mStrings.Clear();
+    return CHIP_NO_ERROR;
+}
+
+void DeferredLogger::Output::OnRecord(uint32_t threadIndex, const Record & record)
+{
+    if (!mFile.is_open())
+    {
+        char text[CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE];
+        TextBuilder builder(text, sizeof(text));
+        if (record.flags & to_underlying(RecordFlags::kPreformatted))
+        {
+            builder.Add(reinterpret_cast<const char *>(record.payload), record.payloadLength);
+        }
+        else
+        {
+            DecodeArguments(record.format, record.payload, record.payloadLength, builder);
+        }
+        mSink(record.timestampUs, threadIndex, record.module, record.category, text);
+        return;
+    }
+
+    const uint32_t formatId = mStrings.GetId(mFile, record.format);
+    const uint32_t moduleId = mStrings.GetId(mFile, record.module);
+
+    uint8_t entry[kLogSize];
+    Encoding::LittleEndian::BufferWriter writer(entry, sizeof(entry));
+    writer.Put8(to_underlying(EntryType::kLog))
+        .Put32(threadIndex)
+        .Put64(record.timestampUs)
+        .Put32(moduleId)
+        .Put8(record.category)
+        .Put8(record.flags)
+        .Put32(formatId)
+        .Put16(record.payloadLength);
+    mFile.write(reinterpret_cast<const char *>(entry), static_cast<std::streamsize>(writer.Needed()));
+    mFile.write(reinterpret_cast<const char *>(record.payload), record.payloadLength);
+}
+
+void DeferredLogger::Output::OnDropped(uint32_t threadIndex, uint64_t dropped, uint64_t total)
+{
+    if (!mFile.is_open())
+    {
+        char text[64];
+        snprintf(text, sizeof(text), "Dropped %llu log messages of thread %u", static_cast<unsigned long long>(dropped),
+                 static_cast<unsigned>(threadIndex));
+        mSink(NowUs(), threadIndex, GetModuleName(kLogModule_Support), kLogCategory_Error, text);
+        return;
+    }
+
+    uint8_t entry[kDroppedSize];
+    Encoding::LittleEndian::BufferWriter writer(entry, sizeof(entry));
+    writer.Put8(to_underlying(EntryType::kDropped)).Put32(threadIndex).Put64(dropped);
+    mFile.write(reinterpret_cast<const char *>(entry), static_cast<std::streamsize>(writer.Needed()));
+}
+
+void DeferredLogger::Output::OnDrained()
+{
+    if (mFile.is_open())
+    {
+        mFile.flush();
+    }
+}
+
+} // namespace Deferred
+} // namespace Logging
+} // namespace chip
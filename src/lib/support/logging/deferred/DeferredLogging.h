@@ -0,0 +1,180 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/TypeTraits.h>
+#include <lib/support/thread_rings/PerThreadRings.h>
+
+#include <cstdarg>
+#include <fstream>
+
+namespace chip {
+namespace Logging {
+namespace Deferred {
+
+/// Layout of the files written by DeferredLogger::StartFile. All integers are little endian.
+///
+/// The file starts with a header:
+///     - kMagic (4 bytes), kVersion (uint16), reserved (uint16)
+///
+/// followed by entries, each starting with an EntryType byte:
+///     - kString:  id (uint32), length (uint16), UTF-8 bytes. Defines a string
+///                 referenced by later entries. Id 0 is the null string.
+///     - kLog:     thread (uint32), timestamp in microseconds since the epoch (uint64),
+///                 module id (uint32), category (uint8), flags (uint8, RecordFlags),
+///                 format id (uint32), payload length (uint16), payload.
+///     - kDropped: thread (uint32), messages dropped by that thread since its previous
+///                 kDropped entry (uint64).
+///
+/// The payload of a log entry holds the arguments of its printf-style format, in order,
+/// including the int arguments of '*' widths and precisions:
+///     - integers, characters and pointers as 8 bytes (two's complement for signed values)
+///     - floating point values as IEEE 754 binary64
+///     - strings as length (uint16) followed by the bytes printed, already cut to the precision
+///
+/// With kPreformatted set, the payload is instead the formatted UTF-8 text and the format id is 0.
+namespace Format {
+
+inline constexpr char kMagic[4]       = { 'M', 'T', 'R', 'L' };
+inline constexpr uint16_t kVersion    = 1;
+inline constexpr size_t kHeaderSize   = 8;
+inline constexpr size_t kLogSize      = 1 + 4 + 8 + 4 + 1 + 1 + 4 + 2; // without the payload
+inline constexpr size_t kDroppedSize  = 1 + 4 + 8;
+inline constexpr size_t kMaxStringLen = UINT16_MAX;
+
+enum class EntryType : uint8_t
+{
+    kString  = 1,
+    kLog     = 2,
+    kDropped = 3,
+};
+
+enum class RecordFlags : uint8_t
+{
+    kPreformatted = 0x01, // payload is text formatted by the logging thread
+    kTruncated    = 0x02, // the arguments or text did not fit the payload and were cut
+};
+
+} // namespace Format
+
+/// A logging backend that defers formatting of log messages.
+///
+/// Once started, all CHIP logging is redirected here (see SetLogRedirectCallback). A log
+/// call only records the address of its format string and the raw values of its arguments
+/// into a lock-free ring owned by the calling thread, which costs a copy of the string
+/// arguments instead of a vsnprintf and a write to the console.
+///
+/// A background thread drains the rings every few milliseconds and either:
+///    - formats the messages and passes them to a sink (Platform::LogV by default), or
+///    - writes them unformatted to a compact file (see Format), which
+///      `scripts/tools/deferred_log_decode.py` turns back into text.
+///
+/// Messages using conversions that cannot be recorded (%n, wide characters and strings)
+/// or whose arguments do not fit a record are formatted by the logging thread instead.
+///
+/// When a ring is full, new messages of that thread are dropped and counted rather than
+/// blocking the logging thread. Messages are only ordered per thread.
+///
+/// Each thread that logs holds a ring of kRingCapacity * kRecordSize bytes (256 KB) until
+/// the logger is destroyed, see PerThreadRings.
+///
+/// Format strings and module names MUST outlive the logger: only their address is recorded
+/// until the messages are formatted. This holds for ChipLog* calls, which pass literals.
+///
+/// THREAD SAFETY:
+///    Log may be called from any thread. Start/Stop must not be called concurrently with
+///    each other, and the logger must not be destroyed while other threads may still log.
+class DeferredLogger
+{
+public:
+    /// Receives formatted messages on the drain thread, with the time they were logged in microseconds
+    /// since the epoch and the index of the thread that logged them (in the order threads first logged).
+    using TextSink = void (*)(uint64_t timestampUs, uint32_t threadIndex, const char * module, uint8_t category, const char * text);
+
+    /// Number of messages each thread can buffer before the drain thread catches up.
+    static constexpr uint32_t kRingCapacity = 1024;
+
+    /// Size of each buffered message, including its recorded arguments.
+    static constexpr size_t kRecordSize = 256;
+
+    DeferredLogger();
+    ~DeferredLogger();
+
+    // Redirect logging here, passing formatted messages to sink. If null, they go to Platform::LogV
+    // prefixed with the time they were logged and their thread, as the platform adds the time they are drained.
+    CHIP_ERROR StartText(TextSink sink = nullptr);
+
+    // Redirect logging here, writing unformatted messages to the given file
+    CHIP_ERROR StartFile(const char * path);
+
+    // Restore the default logging, after handing out any buffered messages
+    void Stop();
+
+    /// Records a log message. Matches LogRedirectCallback_t.
+    void Log(const char * module, uint8_t category, const char * msg, va_list args);
+
+    /// Total messages dropped because the ring of their thread was full.
+    uint64_t GetDroppedCount();
+
+private:
+    static constexpr size_t kPayloadSize = kRecordSize - 8 - sizeof(const char *) * 2 - 4;
+
+    struct alignas(64) Record
+    {
+        uint64_t timestampUs;
+        const char * format;
+        const char * module;
+        uint16_t payloadLength;
+        uint8_t category;
+        uint8_t flags;
+        uint8_t payload[kPayloadSize];
+    };
+
+    static_assert(sizeof(Record) == kRecordSize, "Records must fill kRecordSize");
+
+    using Rings = PerThreadRings<Record, kRingCapacity>;
+
+    /// Formats the drained records for a sink, or writes them to the output file.
+    class Output : public Rings::Delegate
+    {
+    public:
+        void SetSink(TextSink sink) { mSink = sink; }
+        CHIP_ERROR OpenFile(const char * path);
+        void CloseFile() { mFile.close(); }
+
+        void OnRecord(uint32_t threadIndex, const Record & record) override;
+        void OnDropped(uint32_t threadIndex, uint64_t dropped, uint64_t total) override;
+        void OnDrained() override;
+
+    private:
+        TextSink mSink = nullptr;
+        std::ofstream mFile;
+        DrainFileStrings mStrings{ to_underlying(Format::EntryType::kString) };
+    };
+
+    static void Redirect(const char * module, uint8_t category, const char * msg, va_list args);
+
+    CHIP_ERROR Start();
+
+    Output mOutput; // only used by the drain thread while it runs, and by Stop once it stopped
+    Rings mRings;
+};
+
+} // namespace Deferred
+} // namespace Logging
+} // namespace chip
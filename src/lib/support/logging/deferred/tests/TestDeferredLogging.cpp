@@ -0,0 +1,367 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <lib/support/BufferReader.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <lib/support/logging/deferred/DeferredLogging.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Logging;
+using namespace chip::Logging::Deferred;
+
+namespace {
+
+struct Origin
+{
+    uint64_t timestampUs;
+    uint32_t threadIndex;
+};
+
+std::mutex gTextsMutex;
+std::vector<std::string> gTexts;
+std::vector<Origin> gOrigins;
+FILE * gDevNull = nullptr;
+
+void CaptureSink(uint64_t timestampUs, uint32_t threadIndex, const char * module, uint8_t category, const char * text)
+{
+    std::lock_guard<std::mutex> lock(gTextsMutex);
+    gTexts.emplace_back(text);
+    gOrigins.push_back({ timestampUs, threadIndex });
+}
+
+void DevNullSink(uint64_t timestampUs, uint32_t threadIndex, const char * module, uint8_t category, const char * text)
+{
+    fputs(text, gDevNull);
+}
+
+uint64_t NowUs()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+// Formats and writes each message on the logging thread, as the platform logging does.
+void SynchronousRedirect(const char * module, uint8_t category, const char * msg, va_list args)
+{
+    char text[CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE];
+    vsnprintf(text, sizeof(text), msg, args);
+    flockfile(gDevNull);
+    fputs(text, gDevNull);
+    funlockfile(gDevNull);
+}
+
+double PerSecond(size_t count, std::chrono::steady_clock::time_point start)
+{
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    return static_cast<double>(count) * 1e6 / static_cast<double>(std::max<int64_t>(elapsed.count(), 1));
+}
+
+void LogValue(int value, const char * name)
+{
+    Log(kLogModule_Support, kLogCategory_Error, "value %d, name %s", value, name);
+}
+
+// Logs a message and records the text snprintf produces for it.
+#define LOG_AND_EXPECT(expected, ...)                                                                                              \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        char text[CHIP_CONFIG_LOG_MESSAGE_MAX_SIZE];                                                                               \
+        snprintf(text, sizeof(text), __VA_ARGS__);                                                                                 \
+        (expected).emplace_back(text);                                                                                             \
+        Log(kLogModule_Support, kLogCategory_Progress, __VA_ARGS__);                                                               \
+    } while (0)
+
+class TestDeferredLogging : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { gDevNull = fopen("/dev/null", "w"); }
+    static void TearDownTestSuite() { fclose(gDevNull); }
+
+protected:
+    void SetUp() override
+    {
+        std::lock_guard<std::mutex> lock(gTextsMutex);
+        gTexts.clear();
+        gOrigins.clear();
+    }
+
+    void TearDown() override
+    {
+        mLogger.Stop();
+        SetLogRedirectCallback(nullptr);
+    }
+
+    DeferredLogger mLogger;
+};
+
+TEST_F(TestDeferredLogging, TestFormatsLikeSnprintf)
+{
+    ASSERT_EQ(mLogger.StartText(CaptureSink), CHIP_NO_ERROR);
+
+    const char unterminated[] = { 's', 'p', 'a', 'n' };
+    const wchar_t wide[]      = L"wide";
+    int object;
+    std::vector<std::string> expected;
+
+    LOG_AND_EXPECT(expected, "no arguments, 100%% literal");
+    LOG_AND_EXPECT(expected, "%d %i %u %x %X %o", -5, 7, 42u, 0xabcu, 0xABCu, 8u);
+    LOG_AND_EXPECT(expected, "%hhd %hd %ld %lld %zu %jd %td %hhu", -1, -300, -70000L, -(1LL << 40), sizeof(object),
+                   static_cast<intmax_t>(-9), static_cast<ptrdiff_t>(-3), 255);
+    LOG_AND_EXPECT(expected, "0x" ChipLogFormatX64 " counter " ChipLogFormatMessageCounter " on " ChipLogFormatExchangeId,
+                   ChipLogValueX64(0x0123456789ABCDEFull), static_cast<uint32_t>(123456), 17u, 'i');
+    LOG_AND_EXPECT(expected, "[%-8s|%8.3s|%.*s|%s]", "left", "truncate", static_cast<int>(sizeof(unterminated)), unterminated,
+                   "");
+    LOG_AND_EXPECT(expected, "%5.2f %e %g %a %Lf %c", 3.14159, 1e-3, 2.5, 0.75, 1.25L, 'z');
+    LOG_AND_EXPECT(expected, "%*d|%-*.*f|%8.3x|%+d|% d|%#o", 6, 42, 8, 2, 1.5, 0x2au, 1, 2, 8u);
+    LOG_AND_EXPECT(expected, "%p", static_cast<void *>(&object));
+    // Not recorded, formatted by the logging thread instead
+    LOG_AND_EXPECT(expected, "%ls", wide);
+
+    mLogger.Stop();
+
+    ASSERT_EQ(gTexts.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_EQ(gTexts[i], expected[i]);
+    }
+    EXPECT_EQ(mLogger.GetDroppedCount(), 0u);
+}
+
+TEST_F(TestDeferredLogging, TestArgumentsLargerThanRecord)
+{
+    ASSERT_EQ(mLogger.StartText(CaptureSink), CHIP_NO_ERROR);
+
+    const std::string large(DeferredLogger::kRecordSize, 'x');
+    Log(kLogModule_Support, kLogCategory_Progress, "<%s>", large.c_str());
+    mLogger.Stop();
+
+    // Formatted by the logging thread and cut to what fits the record
+    ASSERT_EQ(gTexts.size(), 1u);
+    EXPECT_GT(gTexts[0].size(), DeferredLogger::kRecordSize / 2);
+    EXPECT_LT(gTexts[0].size(), large.size());
+    EXPECT_EQ(gTexts[0], ("<" + large).substr(0, gTexts[0].size()));
+}
+
+TEST_F(TestDeferredLogging, TestRedirectRestoredOnStop)
+{
+    ASSERT_EQ(mLogger.StartText(CaptureSink), CHIP_NO_ERROR);
+
+    // A single logger can take over logging at a time
+    DeferredLogger other;
+    EXPECT_EQ(other.StartText(CaptureSink), CHIP_ERROR_INCORRECT_STATE);
+
+    Log(kLogModule_Support, kLogCategory_Progress, "deferred %d", 1);
+    mLogger.Stop();
+    ASSERT_EQ(gTexts.size(), 1u);
+
+    // Not deferred anymore, nor while a logger is being restarted
+    Log(kLogModule_Support, kLogCategory_Progress, "direct %d", 2);
+    ASSERT_EQ(mLogger.StartText(CaptureSink), CHIP_NO_ERROR);
+    Log(kLogModule_Support, kLogCategory_Progress, "deferred %d", 3);
+    mLogger.Stop();
+
+    ASSERT_EQ(gTexts.size(), 2u);
+    EXPECT_EQ(gTexts[0], "deferred 1");
+    EXPECT_EQ(gTexts[1], "deferred 3");
+}
+
+TEST_F(TestDeferredLogging, TestTextKeepsLoggingTimeAndThread)
+{
+    ASSERT_EQ(mLogger.StartText(CaptureSink), CHIP_NO_ERROR);
+
+    const uint64_t start = NowUs();
+    Log(kLogModule_Support, kLogCategory_Progress, "main %d", 1);
+    std::thread([] { Log(kLogModule_Support, kLogCategory_Progress, "other %d", 2); }).join();
+    const uint64_t end = NowUs();
+    mLogger.Stop();
+
+    // The sink gets the time of the log calls rather than of the drain, and the thread that logged.
+    ASSERT_EQ(gTexts.size(), 2u);
+    EXPECT_EQ(gTexts[0], "main 1");
+    EXPECT_EQ(gTexts[1], "other 2");
+    for (const auto & origin : gOrigins)
+    {
+        EXPECT_GE(origin.timestampUs, start);
+        EXPECT_LE(origin.timestampUs, end);
+    }
+    EXPECT_NE(gOrigins[0].threadIndex, gOrigins[1].threadIndex);
+}
+
+TEST_F(TestDeferredLogging, TestFileOutput)
+{
+    char path[] = "/tmp/deferred_log_XXXXXX";
+    const int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    close(fd);
+
+    ASSERT_EQ(mLogger.StartFile(path), CHIP_NO_ERROR);
+    LogValue(-2, "abc");
+    LogValue(3, "de");
+    mLogger.Stop();
+
+    std::ifstream file(path, std::ios_base::binary);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    unlink(path);
+
+    Encoding::LittleEndian::Reader reader(data.data(), data.size());
+    uint8_t magic[4];
+    uint16_t version;
+    uint16_t reserved;
+    ASSERT_TRUE(reader.ReadBytes(magic, sizeof(magic)).IsSuccess());
+    ASSERT_TRUE(reader.Read16(&version).Read16(&reserved).IsSuccess());
+    EXPECT_EQ(memcmp(magic, Format::kMagic, sizeof(magic)), 0);
+    EXPECT_EQ(version, Format::kVersion);
+
+    std::vector<std::string> strings(1);
+    std::vector<std::vector<uint8_t>> payloads;
+    while (reader.Remaining() > 0)
+    {
+        uint8_t type;
+        ASSERT_TRUE(reader.Read8(&type).IsSuccess());
+        if (type == to_underlying(Format::EntryType::kString))
+        {
+            uint32_t id;
+            uint16_t length;
+            ASSERT_TRUE(reader.Read32(&id).Read16(&length).IsSuccess());
+            ASSERT_EQ(id, strings.size());
+            std::string str(length, '\0');
+            ASSERT_TRUE(reader.ReadBytes(reinterpret_cast<uint8_t *>(str.data()), length).IsSuccess());
+            strings.push_back(str);
+            continue;
+        }
+
+        ASSERT_EQ(type, to_underlying(Format::EntryType::kLog));
+        uint32_t thread, moduleId, formatId;
+        uint64_t timestamp;
+        uint8_t category, flags;
+        uint16_t length;
+        ASSERT_TRUE(reader.Read32(&thread)
+                        .Read64(&timestamp)
+                        .Read32(&moduleId)
+                        .Read8(&category)
+                        .Read8(&flags)
+                        .Read32(&formatId)
+                        .Read16(&length)
+                        .IsSuccess());
+        ASSERT_LT(moduleId, strings.size());
+        ASSERT_LT(formatId, strings.size());
+        EXPECT_EQ(strings[moduleId], GetModuleName(kLogModule_Support));
+        EXPECT_EQ(strings[formatId], "value %d, name %s");
+        EXPECT_EQ(category, kLogCategory_Error);
+        EXPECT_EQ(flags, 0);
+        EXPECT_GT(timestamp, 0u);
+
+        std::vector<uint8_t> payload(length);
+        ASSERT_TRUE(reader.ReadBytes(payload.data(), length).IsSuccess());
+        payloads.push_back(payload);
+    }
+
+    // Format, module and the two messages, which share the strings
+    EXPECT_EQ(strings.size(), 3u);
+    ASSERT_EQ(payloads.size(), 2u);
+    const std::vector<uint8_t> first  = { 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 3, 0, 'a', 'b', 'c' };
+    const std::vector<uint8_t> second = { 3, 0, 0, 0, 0, 0, 0, 0, 2, 0, 'd', 'e' };
+    EXPECT_EQ(payloads[0], first);
+    EXPECT_EQ(payloads[1], second);
+}
+
+// Compares the cost of logging on the logging threads with formatting done synchronously
+// and deferred to the drain thread. Only reports rates: they depend on the host.
+TEST_F(TestDeferredLogging, TestThroughput)
+{
+    constexpr size_t kThreads        = 4;
+    constexpr size_t kCallsPerThread = 20000;
+    constexpr size_t kLogsPerMessage = 2;
+
+    // A message being processed: some work on its payload, and the logs of its processing.
+    auto processMessages = [](size_t messageCount) {
+        uint8_t payload[512];
+        uint32_t checksum = 0;
+        for (size_t i = 0; i < messageCount; i++)
+        {
+            memset(payload, static_cast<int>(i), sizeof(payload));
+            for (uint8_t byte : payload)
+            {
+                checksum = (checksum ^ byte) * 16777619u;
+            }
+            Log(kLogModule_ExchangeManager, kLogCategory_Progress,
+                "Received message of type 0x%02x with protocolId (%u, %u) and MessageCounter:" ChipLogFormatMessageCounter
+                " on exchange " ChipLogFormatExchangeId,
+                0x05u, 0u, 1u, static_cast<uint32_t>(i), static_cast<unsigned>(i & 0xFFFF), 'r');
+            Log(kLogModule_DataManagement, kLogCategory_Detail, "Checksum %08" PRIx32 " of %s", checksum, "payload");
+        }
+    };
+
+    auto runThreads = [&](size_t messagesPerThread) {
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < kThreads; i++)
+        {
+            threads.emplace_back(processMessages, messagesPerThread);
+        }
+        for (auto & thread : threads)
+        {
+            thread.join();
+        }
+        return PerSecond(kThreads * messagesPerThread, start);
+    };
+
+    SetLogRedirectCallback(SynchronousRedirect);
+    const double syncMessages = runThreads(kCallsPerThread / kLogsPerMessage);
+    SetLogRedirectCallback(nullptr);
+
+    ASSERT_EQ(mLogger.StartText(DevNullSink), CHIP_NO_ERROR);
+    const double deferredMessages = runThreads(kCallsPerThread / kLogsPerMessage);
+    mLogger.Stop();
+    const uint64_t deferredDropped = mLogger.GetDroppedCount();
+
+    // Every message is either handed out or counted as dropped
+    ASSERT_EQ(mLogger.StartText(CaptureSink), CHIP_NO_ERROR);
+    runThreads(kCallsPerThread / kLogsPerMessage);
+    mLogger.Stop();
+    const uint64_t dropped = mLogger.GetDroppedCount() - deferredDropped;
+    size_t delivered       = 0;
+    for (const auto & text : gTexts)
+    {
+        delivered += (text.rfind("Dropped ", 0) == 0) ? 0 : 1;
+    }
+    EXPECT_EQ(delivered + dropped, kThreads * kCallsPerThread);
+
+    ChipLogProgress(Support,
+                    "Logging on %u threads: %.0f log calls/s synchronous, %.0f log calls/s deferred (%" PRIu64
+                    " dropped); %.0f messages/s synchronous, %.0f messages/s deferred",
+                    static_cast<unsigned>(kThreads), syncMessages * kLogsPerMessage, deferredMessages * kLogsPerMessage,
+                    deferredDropped, syncMessages, deferredMessages);
+}
+
+} // namespace
@@ -24,8 +24,8 @@
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
 #include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/jsontlv/JsonToTlv.h>
-#include <lib/support/jsontlv/TextFormat.h>
 #include <lib/support/jsontlv/TlvToJson.h>
 
 namespace {
@@ -76,15 +76,14 @@ void CheckValidConversion(const std::string & jsonOriginal, const ByteSpan & tlv
     err = TlvToJson(tlvEncoding, generatedJsonString);
     EXPECT_EQ(err, CHIP_NO_ERROR);
 
-    auto compactExpectedString  = PrettyPrintJsonString(jsonExpected);
-    auto compactGeneratedString = PrettyPrintJsonString(generatedJsonString);
-    match                       = (compactGeneratedString == compactExpectedString);
+    // Compared as is, as the exact layout of the text is part of the format.
+    match = (generatedJsonString == jsonExpected);
     EXPECT_TRUE(match);
     if (!match)
     {
         printf("ERROR: Json String Doesn't Match!\n");
-        printf("Expected  Json String:\n%s\n", compactExpectedString.c_str());
-        printf("Generated Json String:\n%s\n", compactGeneratedString.c_str());
+        printf("Expected  Json String:\n%s\n", jsonExpected.c_str());
+        printf("Generated Json String:\n%s\n", generatedJsonString.c_str());
     }
 
     // Verify that Expected Json String Converts to the Same TLV Encoding
@@ -610,7 +609,7 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Structure_TopLevelEmpty)
     EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType));
     EXPECT_EQ(CHIP_NO_ERROR, writer.Finalize());
 
-    std::string jsonString = "{ }";
+    std::string jsonString = "{}\n";
 
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
     CheckValidConversion(jsonString, tlvSpan, jsonString);
@@ -633,7 +632,7 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Structure_NestedEmpty)
     EXPECT_EQ(CHIP_NO_ERROR, writer.Finalize());
 
     std::string jsonString = "{\n"
-                             "   \"1:STRUCT\" : { }\n"
+                             "   \"1:STRUCT\" : {}\n"
                              "}\n";
 
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
@@ -797,13 +796,7 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Array_Ints)
     EXPECT_EQ(CHIP_NO_ERROR, writer.Finalize());
 
     std::string jsonString = "{\n"
-                             "   \"0:ARRAY-INT\" : [\n"
-                             "      0,\n"
-                             "      1,\n"
-                             "      2,\n"
-                             "      3,\n"
-                             "      4\n"
-                             "   ]\n"
+                             "   \"0:ARRAY-INT\" : [ 0, 1, 2, 3, 4 ]\n"
                              "}\n";
 
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
@@ -831,12 +824,7 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Array_Ints2)
     EXPECT_EQ(CHIP_NO_ERROR, writer.Finalize());
 
     std::string jsonString = "{\n"
-                             "   \"0:ARRAY-INT\" : [\n"
-                             "      42,\n"
-                             "      -17,\n"
-                             "      -170000,\n"
-                             "      \"40000000000\"\n"
-                             "   ]\n"
+                             "   \"0:ARRAY-INT\" : [ 42, -17, -170000, \"40000000000\" ]\n"
                              "}\n";
 
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
@@ -916,11 +904,7 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Array_UInts)
     EXPECT_EQ(CHIP_NO_ERROR, writer.Finalize());
 
     std::string jsonString = "{\n"
-                             "   \"0:ARRAY-UINT\" : [\n"
-                             "      42,\n"
-                             "      170000,\n"
-                             "      \"40000000000\"\n"
-                             "   ]\n"
+                             "   \"0:ARRAY-UINT\" : [ 42, 170000, \"40000000000\" ]\n"
                              "}\n";
 
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
@@ -957,12 +941,7 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Array_UIntsMax)
                                  "   ]\n"
                                  "}\n";
     std::string expectedString = "{\n"
-                                 "   \"0:ARRAY-UINT\" : [\n"
-                                 "      255,\n"
-                                 "      65535,\n"
-                                 "      4294967295,\n"
-                                 "      \"18446744073709551615\"\n"
-                                 "   ]\n"
+                                 "   \"0:ARRAY-UINT\" : [ 255, 65535, 4294967295, \"18446744073709551615\" ]\n"
                                  "}\n";
 
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
@@ -996,11 +975,7 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Array_Doubles)
                                  "   ]\n"
                                  "}\n";
     std::string expectedString = "{\n"
-                                 "   \"0:ARRAY-DOUBLE\" : [\n"
-                                 "      1.1000000000000001,\n"
-                                 "      134.27629999999999,\n"
-                                 "      -12345.870000000001\n"
-                                 "   ]\n"
+                                 "   \"0:ARRAY-DOUBLE\" : [ 1.1000000000000001, 134.27629999999999, -12345.870000000001 ]\n"
                                  "}\n";
 
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
@@ -1036,11 +1011,7 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Array_Floats)
                                  "   ]\n"
                                  "}\n";
     std::string expectedString = "{\n"
-                                 "   \"1000:ARRAY-FLOAT\" : [\n"
-                                 "      1.1000000238418579,\n"
-                                 "      134.27630615234375,\n"
-                                 "      -12345.8701171875\n"
-                                 "   ]\n"
+                                 "   \"1000:ARRAY-FLOAT\" : [ 1.1000000238418579, 134.27630615234375, -12345.8701171875 ]\n"
                                  "}\n";
 
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
@@ -1071,11 +1042,7 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Array_Strings)
     EXPECT_EQ(CHIP_NO_ERROR, writer.Finalize());
 
     std::string jsonString = "{\n"
-                             "   \"100000:ARRAY-STRING\" : [\n"
-                             "      \"ABC\",\n"
-                             "      \"Options\",\n"
-                             "      \"more\"\n"
-                             "   ]\n"
+                             "   \"100000:ARRAY-STRING\" : [ \"ABC\", \"Options\", \"more\" ]\n"
                              "}\n";
 
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
@@ -1102,11 +1069,7 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Array_Booleans)
     EXPECT_EQ(CHIP_NO_ERROR, writer.Finalize());
 
     std::string jsonString = "{\n"
-                             "   \"255:ARRAY-BOOL\" : [\n"
-                             "      true,\n"
-                             "      false,\n"
-                             "      false\n"
-                             "   ]\n"
+                             "   \"255:ARRAY-BOOL\" : [ true, false, false ]\n"
                              "}\n";
 
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
@@ -1132,10 +1095,7 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Array_Nulls)
     EXPECT_EQ(CHIP_NO_ERROR, writer.Finalize());
 
     std::string jsonString = "{\n"
-                             "   \"1:ARRAY-NULL\" : [\n"
-                             "      null,\n"
-                             "      null\n"
-                             "   ]\n"
+                             "   \"1:ARRAY-NULL\" : [ null, null ]\n"
                              "}\n";
 
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
@@ -1202,9 +1162,9 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Struct_MixedTags)
                              "   \"0:STRUCT\" : {\n"
                              "      \"255:UINT\" : 42,\n"
                              "      \"256:UINT\" : 17000,\n"
+                             "      \"4294967295:UINT\" : \"500000000000\",\n"
                              "      \"65535:UINT\" : 1,\n"
-                             "      \"65536:UINT\" : 345678,\n"
-                             "      \"4294967295:UINT\" : \"500000000000\"\n"
+                             "      \"65536:UINT\" : 345678\n"
                              "   }\n"
                              "}\n";
 
@@ -1335,7 +1295,7 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Array_Structures)
                                  "   ]\n"
                                  "}\n";
     std::string expectedString = "{\n"
-                                 "   \"1000:ARRAY-STRUCT\": [\n"
+                                 "   \"1000:ARRAY-STRUCT\" : [\n"
                                  "      {\n"
                                  "         \"0:INT\" : 20,\n"
                                  "         \"1:BOOL\" : true,\n"
@@ -1437,33 +1397,21 @@ TEST_F(TestJsonToTlvToJson, TestConverter_TopLevel_MixedElements)
                                "   \"value:7:FLOAT\": 0.0\n"
                                "}\n";
     std::string jsonExpected = "{\n"
-                               "   \"0:INT\": 42,\n"
-                               "   \"1:BYTES\": \"VGVzdCBhcnJheSBtZW1iZXIgMA==\",\n"
-                               "   \"2:DOUBLE\": 156.398,\n"
-                               "   \"3:UINT\": \"73709551615\",\n"
-                               "   \"4:BOOL\": true,\n"
-                               "   \"5:NULL\": null,\n"
-                               "   \"6:STRUCT\": {\n"
-                               "      \"1:STRING\": \"John\",\n"
-                               "      \"2:UINT\": 34,\n"
-                               "      \"3:BOOL\": true,\n"
-                               "      \"4:ARRAY-INT\": [\n"
-                               "         5,\n"
-                               "         9,\n"
-                               "         10\n"
-                               "      ],\n"
-                               "      \"5:ARRAY-STRING\": [\n"
-                               "         \"Ammy\",\n"
-                               "         \"David\",\n"
-                               "         \"Larry\"\n"
-                               "      ],\n"
-                               "      \"6:ARRAY-BOOL\": [\n"
-                               "         true,\n"
-                               "         false,\n"
-                               "         true\n"
-                               "      ]\n"
+                               "   \"0:INT\" : 42,\n"
+                               "   \"1:BYTES\" : \"VGVzdCBhcnJheSBtZW1iZXIgMA==\",\n"
+                               "   \"2:DOUBLE\" : 156.398,\n"
+                               "   \"3:UINT\" : \"73709551615\",\n"
+                               "   \"4:BOOL\" : true,\n"
+                               "   \"5:NULL\" : null,\n"
+                               "   \"6:STRUCT\" : {\n"
+                               "      \"1:STRING\" : \"John\",\n"
+                               "      \"2:UINT\" : 34,\n"
+                               "      \"3:BOOL\" : true,\n"
+                               "      \"4:ARRAY-INT\" : [ 5, 9, 10 ],\n"
+                               "      \"5:ARRAY-STRING\" : [ \"Ammy\", \"David\", \"Larry\" ],\n"
+                               "      \"6:ARRAY-BOOL\" : [ true, false, true ]\n"
                                "   },\n"
-                               "   \"7:FLOAT\": 0.0\n"
+                               "   \"7:FLOAT\" : 0.0\n"
                                "}\n";
 
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
@@ -1581,10 +1529,17 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Structure_FromReadme)
                                "         \"1:BOOL\" : true\n"
                                "      }\n"
                                "   ],\n"
+                               "   \"10:FLOAT\" : \"-Infinity\",\n"
+                               "   \"11:STRUCT\" : {\n"
+                               "      \"1:STRING\" : \"John\",\n"
+                               "      \"2:UINT\" : 34,\n"
+                               "      \"3:BOOL\" : true,\n"
+                               "      \"4:ARRAY-INT\" : [ 5, 9, 10 ]\n"
+                               "   },\n"
                                "   \"1:STRUCT\" : {\n"
-                               "       \"0:INT\" : 12,\n"
-                               "       \"1:BOOL\" : false,\n"
-                               "       \"2:STRING\" : \"example\"\n"
+                               "      \"0:INT\" : 12,\n"
+                               "      \"1:BOOL\" : false,\n"
+                               "      \"2:STRING\" : \"example\"\n"
                                "   },\n"
                                "   \"2:INT\" : \"40000000000\",\n"
                                "   \"3:BOOL\" : true,\n"
@@ -1597,25 +1552,10 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Structure_FromReadme)
                                "      62534.0,\n"
                                "      -62534.0\n"
                                "   ],\n"
-                               "   \"6:ARRAY-BYTES\" : [\n"
-                               "      \"AAECAwQ=\",\n"
-                               "      \"/w==\",\n"
-                               "      \"Su+I\"\n"
-                               "   ],\n"
+                               "   \"6:ARRAY-BYTES\" : [ \"AAECAwQ=\", \"/w==\", \"Su+I\" ],\n"
                                "   \"7:BYTES\" : \"VGVzdCBCeXRlcw==\",\n"
                                "   \"8:DOUBLE\" : 17.899999999999999,\n"
-                               "   \"9:FLOAT\" : 17.899999618530273,\n"
-                               "   \"10:FLOAT\" : \"-Infinity\",\n"
-                               "   \"11:STRUCT\" : {\n"
-                               "      \"1:STRING\" : \"John\",\n"
-                               "      \"2:UINT\" : 34,\n"
-                               "      \"3:BOOL\" : true,\n"
-                               "      \"4:ARRAY-INT\" : [\n"
-                               "         5,\n"
-                               "         9,\n"
-                               "         10\n"
-                               "      ]\n"
-                               "   }\n"
+                               "   \"9:FLOAT\" : 17.899999618530273\n"
                                "}\n";
 
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
@@ -1853,13 +1793,176 @@ TEST_F(TestJsonToTlvToJson, TestConverter_Struct_MEITags)
 
     std::string jsonString = "{\n"
                              "   \"0:STRUCT\" : {\n"
-                             "      \"65536:UINT\" : 42,\n"
                              "      \"4294901760:UINT\" : 17000,\n"
-                             "      \"4294967295:UINT\" : \"500000000000\"\n"
+                             "      \"4294967295:UINT\" : \"500000000000\",\n"
+                             "      \"65536:UINT\" : 42\n"
                              "   }\n"
                              "}\n";
 
     ByteSpan tlvSpan(buf, writer.GetLengthWritten());
     CheckValidConversion(jsonString, tlvSpan, jsonString);
 }
+
+// Members out of tag order, duplicate names, comments and escapes in the Json input.
+TEST_F(TestJsonToTlvToJson, TestConverter_JsonToTlv_UnorderedMembers)
+{
+    uint8_t buf[256];
+    TLV::TLVWriter writer;
+    TLV::TLVType containerType;
+    TLV::TLVType containerType2;
+
+    writer.Init(buf);
+    writer.ImplicitProfileId = kImplicitProfileId;
+
+    EXPECT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containerType));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.Put(TLV::ContextTag(1), static_cast<uint64_t>(2)));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::ContextTag(2), TLV::kTLVType_Structure, containerType2));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.PutString(TLV::ContextTag(0), "tab\t\"caf\xc3\xa9\" \xf0\x9f\x98\x80"));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.Put(TLV::ContextTag(3), static_cast<int64_t>(-1000)));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType2));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.Put(TLV::ContextTag(10), true));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.Put(TLV::ProfileTag(kImplicitProfileId, 300), static_cast<uint64_t>(1000)));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.Finalize());
+
+    std::string jsonString = "{\n"
+                             "   \"300:UINT\" : 1e3,\n"
+                             "   // the last of duplicate members wins\n"
+                             "   \"1:UINT\" : 1,\n"
+                             "   \"10:BOOL\" : true,\n"
+                             "   \"2:STRUCT\" : { \"3:INT\" : -1000, \"0:STRING\" : \"tab\\t\\\"caf\\u00e9\\\" \\ud83d\\ude00\" },\n"
+                             "   \"1:UINT\" : /* as a string */ \"2\"\n"
+                             "}\n";
+
+    uint8_t jsonBuf[256];
+    MutableByteSpan tlvSpan(jsonBuf);
+    EXPECT_EQ(JsonToTlv(jsonString, tlvSpan), CHIP_NO_ERROR);
+    EXPECT_TRUE(tlvSpan.data_equal(ByteSpan(buf, writer.GetLengthWritten())));
+
+    // Text after the top level value is ignored, and so is a comment before the closing brace.
+    tlvSpan = MutableByteSpan(jsonBuf);
+    EXPECT_EQ(JsonToTlv("{ \"1:UINT\" : 1 } trailing", tlvSpan), CHIP_NO_ERROR);
+    tlvSpan = MutableByteSpan(jsonBuf);
+    EXPECT_EQ(JsonToTlv("{ \"1:UINT\" : 1 /* c */ }", tlvSpan), CHIP_NO_ERROR);
+
+    // A separator before the closing brace is only accepted after an empty name, which is not a valid element name.
+    tlvSpan = MutableByteSpan(jsonBuf);
+    EXPECT_EQ(JsonToTlv("{ \"\" : 1, }", tlvSpan), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Malformed documents are rejected before anything is converted.
+    tlvSpan = MutableByteSpan(jsonBuf);
+    EXPECT_EQ(JsonToTlv("{ \"1:UINT\" : 1, }", tlvSpan), CHIP_ERROR_INTERNAL);
+    tlvSpan = MutableByteSpan(jsonBuf);
+    EXPECT_EQ(JsonToTlv("{ \"1:UINT\" /* c */ : 1 }", tlvSpan), CHIP_ERROR_INTERNAL);
+    tlvSpan = MutableByteSpan(jsonBuf);
+    EXPECT_EQ(JsonToTlv("{ \"1:ARRAY-?\" : [ /* c */ ] }", tlvSpan), CHIP_ERROR_INTERNAL);
+    tlvSpan = MutableByteSpan(jsonBuf);
+    EXPECT_EQ(JsonToTlv("{ \"1:UINT\" : \"x\", \"2:UINT\" : }", tlvSpan), CHIP_ERROR_INTERNAL);
+    tlvSpan = MutableByteSpan(jsonBuf);
+    EXPECT_EQ(JsonToTlv("{ \"1:DOUBLE\" : 1e400 }", tlvSpan), CHIP_ERROR_INTERNAL);
+    tlvSpan = MutableByteSpan(jsonBuf);
+    EXPECT_EQ(JsonToTlv("{ \"1:STRING\" : \"\\ud83d\" }", tlvSpan), CHIP_ERROR_INTERNAL);
+}
+
+// Members written in name order, short arrays of scalars folded on one line and non-ASCII text escaped.
+TEST_F(TestJsonToTlvToJson, TestConverter_TlvToJson_Layout)
+{
+    uint8_t buf[512];
+    TLV::TLVWriter writer;
+    TLV::TLVType containerType;
+    TLV::TLVType containerType2;
+    TLV::TLVType containerType3;
+
+    writer.Init(buf);
+    EXPECT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containerType));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::ContextTag(2), TLV::kTLVType_Array, containerType2));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containerType3));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.Put(TLV::ContextTag(1), 2.0));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType3));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containerType3));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType3));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType2));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::ContextTag(3), TLV::kTLVType_Array, containerType2));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.PutString(TLV::AnonymousTag(), "short"));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.PutString(TLV::AnonymousTag(), "caf\xc3\xa9 \xf0\x9f\x98\x80"));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType2));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::ContextTag(4), TLV::kTLVType_Array, containerType2));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.PutString(TLV::AnonymousTag(), "a string that is long enough"));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.PutString(TLV::AnonymousTag(), "to keep this array"));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.PutString(TLV::AnonymousTag(), "on several lines"));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType2));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::ContextTag(10), TLV::kTLVType_Array, containerType2));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType2));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.PutString(TLV::ContextTag(11), "a\"\\\x01"));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.Finalize());
+
+    std::string jsonString;
+    EXPECT_EQ(TlvToJson(ByteSpan(buf, writer.GetLengthWritten()), jsonString), CHIP_NO_ERROR);
+    EXPECT_EQ(jsonString,
+              "{\n"
+              "   \"10:ARRAY-?\" : [],\n"
+              "   \"11:STRING\" : \"a\\\"\\\\\\u0001\",\n"
+              "   \"2:ARRAY-STRUCT\" : [\n"
+              "      {\n"
+              "         \"1:DOUBLE\" : 2.0\n"
+              "      },\n"
+              "      {}\n"
+              "   ],\n"
+              "   \"3:ARRAY-STRING\" : [ \"short\", \"caf\\u00e9 \\ud83d\\ude00\" ],\n"
+              "   \"4:ARRAY-STRING\" : [\n"
+              "      \"a string that is long enough\",\n"
+              "      \"to keep this array\",\n"
+              "      \"on several lines\"\n"
+              "   ]\n"
+              "}\n");
+}
+
+// A payload too large for the usual test buffers, such as a long ACL list, survives a round trip.
+TEST_F(TestJsonToTlvToJson, TestConverter_LargePayloadRoundTrip)
+{
+    constexpr size_t kEntryCount = 200;
+    constexpr size_t kBufferSize = 32 * 1024;
+
+    Platform::ScopedMemoryBuffer<uint8_t> buf;
+    Platform::ScopedMemoryBuffer<uint8_t> roundTripBuf;
+    ASSERT_TRUE(buf.Alloc(kBufferSize));
+    ASSERT_TRUE(roundTripBuf.Alloc(kBufferSize));
+
+    TLV::TLVWriter writer;
+    TLV::TLVType containerType;
+    TLV::TLVType containerType2;
+    TLV::TLVType containerType3;
+    TLV::TLVType containerType4;
+
+    writer.Init(buf.Get(), kBufferSize);
+    EXPECT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containerType));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::ContextTag(0), TLV::kTLVType_Array, containerType2));
+    for (size_t i = 0; i < kEntryCount; i++)
+    {
+        EXPECT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containerType3));
+        EXPECT_EQ(CHIP_NO_ERROR, writer.Put(TLV::ContextTag(1), static_cast<uint8_t>(i % 5)));
+        EXPECT_EQ(CHIP_NO_ERROR, writer.Put(TLV::ContextTag(2), static_cast<uint8_t>(2)));
+        EXPECT_EQ(CHIP_NO_ERROR, writer.StartContainer(TLV::ContextTag(3), TLV::kTLVType_Array, containerType4));
+        EXPECT_EQ(CHIP_NO_ERROR, writer.Put(TLV::AnonymousTag(), static_cast<uint64_t>(0xFFFFFFFB00000000 + i)));
+        EXPECT_EQ(CHIP_NO_ERROR, writer.Put(TLV::AnonymousTag(), static_cast<uint64_t>(i)));
+        EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType4));
+        EXPECT_EQ(CHIP_NO_ERROR, writer.PutNull(TLV::ContextTag(4)));
+        EXPECT_EQ(CHIP_NO_ERROR, writer.PutString(TLV::ContextTag(5), "entry"));
+        EXPECT_EQ(CHIP_NO_ERROR, writer.PutBytes(TLV::ContextTag(6), buf.Get(), static_cast<uint32_t>(i % 16)));
+        EXPECT_EQ(CHIP_NO_ERROR, writer.Put(TLV::ContextTag(254), static_cast<uint8_t>(1)));
+        EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType3));
+    }
+    EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType2));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.EndContainer(containerType));
+    EXPECT_EQ(CHIP_NO_ERROR, writer.Finalize());
+    ByteSpan tlvSpan(buf.Get(), writer.GetLengthWritten());
+
+    std::string jsonString;
+    EXPECT_EQ(TlvToJson(tlvSpan, jsonString), CHIP_NO_ERROR);
+
+    MutableByteSpan roundTripSpan(roundTripBuf.Get(), kBufferSize);
+    EXPECT_EQ(JsonToTlv(jsonString, roundTripSpan), CHIP_NO_ERROR);
+    EXPECT_TRUE(roundTripSpan.data_equal(tlvSpan));
+}
 } // namespace
@@ -23,7 +23,9 @@
  *
  */
 
+#include <cstddef>
 #include <set>
+#include <string.h>
 
 #include <pw_unit_test/framework.h>
 
@@ -544,6 +546,124 @@ TEST_F(TestPool, TestPoolInterfaceDynamic)
 {
     TestPoolInterface<ObjectPoolMem::kHeap>();
 }
+
+TEST_F(TestPool, TestHeapPoolManyObjects)
+{
+    // Enough objects to span many slabs.
+    constexpr size_t kSize = 1000;
+    HeapObjectPool<size_t> pool;
+    size_t * objs[kSize];
+
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        objs[i] = pool.CreateObject(i);
+        ASSERT_NE(objs[i], nullptr);
+    }
+    EXPECT_EQ(pool.Allocated(), kSize);
+
+    // Nothing was released, objects are visited in creation order.
+    size_t count = 0;
+    for (size_t * object : pool)
+    {
+        EXPECT_EQ(*object, count);
+        ++count;
+    }
+    EXPECT_EQ(count, kSize);
+
+    // Release every other object, then the others in reverse order, emptying slabs in between.
+    for (size_t i = 0; i < kSize; i += 2)
+    {
+        pool.ReleaseObject(objs[i]);
+    }
+    EXPECT_EQ(GetNumObjectsInUse(pool), kSize / 2);
+    for (size_t i = kSize - 1; i < kSize; i -= 2)
+    {
+        pool.ReleaseObject(objs[i]);
+    }
+    EXPECT_EQ(GetNumObjectsInUse(pool), 0u);
+    EXPECT_EQ(pool.begin(), pool.end());
+
+    // The storage of released objects is reused.
+    size_t * object = pool.CreateObject(kSize);
+    EXPECT_EQ(object, objs[0]);
+    pool.ReleaseObject(object);
+    EXPECT_EQ(pool.Allocated(), 0u);
+    EXPECT_EQ(pool.HighWaterMark(), kSize);
+}
+
+TEST_F(TestPool, TestHeapPoolReleaseAllWhileIterating)
+{
+    // Slabs emptied during iteration are released once it completes.
+    constexpr size_t kSize = 300;
+    HeapObjectPool<size_t> pool;
+
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        ASSERT_NE(pool.CreateObject(i), nullptr);
+    }
+    size_t count = 0;
+    pool.ForEachActiveObject([&](size_t * object) {
+        EXPECT_EQ(*object, count++);
+        pool.ReleaseObject(object);
+        return Loop::Continue;
+    });
+    EXPECT_EQ(count, kSize);
+    EXPECT_EQ(pool.Allocated(), 0u);
+
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        ASSERT_NE(pool.CreateObject(i), nullptr);
+    }
+    count = 0;
+    for (auto it = pool.begin(); it != pool.end(); ++it)
+    {
+        EXPECT_EQ(**it, count++);
+        pool.ReleaseObject(*it);
+    }
+    EXPECT_EQ(count, kSize);
+    EXPECT_EQ(pool.Allocated(), 0u);
+    EXPECT_EQ(GetNumObjectsInUse(pool), 0u);
+}
+
+TEST_F(TestPool, TestHeapPoolObjectLayout)
+{
+    struct alignas(alignof(std::max_align_t)) AlignedObject
+    {
+        uint8_t mValue;
+    };
+    struct LargeObject
+    {
+        uint8_t mData[3000];
+    };
+
+    constexpr size_t kSize = 100;
+    HeapObjectPool<AlignedObject> alignedPool;
+    HeapObjectPool<LargeObject> largePool;
+    AlignedObject * aligned[kSize];
+    LargeObject * large[kSize];
+
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        aligned[i] = alignedPool.CreateObject();
+        ASSERT_NE(aligned[i], nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned[i]) % alignof(std::max_align_t), 0u);
+        aligned[i]->mValue = static_cast<uint8_t>(i);
+
+        large[i] = largePool.CreateObject();
+        ASSERT_NE(large[i], nullptr);
+        memset(large[i]->mData, static_cast<uint8_t>(i), sizeof(large[i]->mData));
+    }
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        EXPECT_EQ(aligned[i]->mValue, static_cast<uint8_t>(i));
+        EXPECT_EQ(large[i]->mData[0], static_cast<uint8_t>(i));
+        EXPECT_EQ(large[i]->mData[sizeof(large[i]->mData) - 1], static_cast<uint8_t>(i));
+    }
+    alignedPool.ReleaseAll();
+    largePool.ReleaseAll();
+    EXPECT_EQ(GetNumObjectsInUse(alignedPool), 0u);
+    EXPECT_EQ(GetNumObjectsInUse(largePool), 0u);
+}
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 } // namespace
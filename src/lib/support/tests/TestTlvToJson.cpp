@@ -23,7 +23,6 @@
 #include <app/data-model/Decode.h>
 #include <app/data-model/Encode.h>
 #include <lib/core/StringBuilderAdapters.h>
-#include <lib/support/jsontlv/TextFormat.h>
 #include <lib/support/jsontlv/TlvToJson.h>
 #include <system/SystemPacketBuffer.h>
 #include <system/TLVPacketBufferBackingStore.h>
@@ -68,19 +67,17 @@ CHIP_ERROR SetupReader()
 
 bool Matches(const std::string & referenceString, const std::string & generatedString)
 {
-    auto compactReferenceString = PrettyPrintJsonString(referenceString);
-    auto compactGeneratedString = PrettyPrintJsonString(generatedString);
-
-    auto matches = (compactGeneratedString == compactReferenceString);
+    // Compared as is, as the exact layout of the text is part of the format.
+    auto matches = (generatedString == referenceString);
 
     if (!matches)
     {
         printf("Didn't match!\n");
         printf("Reference:\n");
-        printf("%s\n", compactReferenceString.c_str());
+        printf("%s\n", referenceString.c_str());
 
         printf("Generated:\n");
-        printf("%s\n", compactGeneratedString.c_str());
+        printf("%s\n", generatedString.c_str());
     }
 
     return matches;
@@ -204,7 +201,7 @@ TEST_F(TestTlvToJson, TestConverter)
 
     int8uList  = {};
     jsonString = "{\n"
-                 "   \"1:ARRAY-?\" : [ ]\n"
+                 "   \"1:ARRAY-?\" : []\n"
                  "}\n";
     EncodeAndValidate(int8uList, jsonString);
 
@@ -0,0 +1,74 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <lib/support/thread_rings/PerThreadRings.h>
+
+#include <lib/support/BufferWriter.h>
+#include <system/SystemError.h>
+
+#include <errno.h>
+#include <string.h>
+
+#include <filesystem>
+
+namespace chip {
+
+namespace {
+
+constexpr size_t kMaxStringLen = UINT16_MAX;
+
+} // namespace
+
+CHIP_ERROR OpenDrainOutputFile(std::ofstream & file, const char * path)
+{
+    std::error_code ec;
+    std::filesystem::path directory = std::filesystem::path(path).parent_path();
+    // Create directories if they don't exist
+    if (!directory.empty())
+    {
+        std::filesystem::create_directories(directory, ec);
+        VerifyOrReturnError(!ec, CHIP_ERROR_POSIX(ec.value()));
+    }
+
+    file.open(path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    VerifyOrReturnError(file, CHIP_ERROR_POSIX(errno));
+    return CHIP_NO_ERROR;
+}
+
+uint32_t DrainFileStrings::GetId(std::ofstream & file, const char * str)
+{
+    VerifyOrReturnValue(str != nullptr, 0);
+
+    auto it = mIds.find(str);
+    if (it != mIds.end())
+    {
+        return it->second;
+    }
+
+    const uint32_t id     = static_cast<uint32_t>(mIds.size() + 1);
+    const uint16_t length = static_cast<uint16_t>(strnlen(str, kMaxStringLen));
+    mIds.emplace(str, id);
+
+    uint8_t entry[1 + 4 + 2];
+    Encoding::LittleEndian::BufferWriter writer(entry, sizeof(entry));
+    writer.Put8(mEntryType).Put32(id).Put16(length);
+    file.write(reinterpret_cast<const char *>(entry), static_cast<std::streamsize>(writer.Needed()));
+    file.write(str, length);
+
+    return id;
+}
+
+} // namespace chip
@@ -0,0 +1,298 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/CodeUtils.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace chip {
+
+/// Buffers fixed size records per thread until a background thread drains them.
+///
+/// Each thread appending records gets its own single producer, single consumer ring, so
+/// appending costs a few stores and never blocks: when the ring of a thread is full, the
+/// record is dropped and counted instead. While started, a drain thread periodically hands
+/// the records of every ring, in the order each thread appended them, to a Delegate.
+///
+/// MEMORY:
+///    A ring of kCapacity records is allocated on the first record of each thread and only
+///    freed with the PerThreadRings. The ring of a thread that exited is reused by a later
+///    thread getting the same std::thread::id, which glibc usually hands out again, but is
+///    otherwise kept: memory grows with the number of distinct threads that appended
+///    records during the lifetime of the object.
+///
+/// THREAD SAFETY:
+///    Append may be called from any thread. Start and Stop must not be called concurrently
+///    with each other, and the object must not be destroyed while other threads may still
+///    append. The Delegate is called on the drain thread, and by Stop once it stopped.
+template <typename Record, uint32_t kCapacity>
+class PerThreadRings
+{
+public:
+    static_assert((kCapacity & (kCapacity - 1)) == 0, "Ring capacity must be a power of two");
+
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() = default;
+
+        /// Called for each record of the thread with the given index.
+        virtual void OnRecord(uint32_t threadIndex, const Record & record) = 0;
+
+        /// Called when records of a thread were dropped: `dropped` since the previous call for
+        /// that thread, `total` since the thread appended its first record.
+        virtual void OnDropped(uint32_t threadIndex, uint64_t dropped, uint64_t total) = 0;
+
+        /// Called after each pass over all the rings.
+        virtual void OnDrained() {}
+    };
+
+    PerThreadRings() : mInstanceId(sNextInstanceId.fetch_add(1)) {}
+    ~PerThreadRings() { Stop(); }
+
+    /// Starts accepting records and handing them to the delegate every drainInterval.
+    /// Records that raced with the previous Stop are discarded.
+    void Start(Delegate & delegate, std::chrono::milliseconds drainInterval)
+    {
+        Stop();
+
+        {
+            std::lock_guard<std::mutex> lock(mRingsMutex);
+            for (auto & ring : mRings)
+            {
+                ring->tail.store(ring->head.load(std::memory_order_acquire), std::memory_order_release);
+                ring->droppedReported = ring->dropped.load(std::memory_order_relaxed);
+            }
+        }
+        mDelegate      = &delegate;
+        mDrainInterval = drainInterval;
+        mStopDrain     = false;
+        mDrainThread   = std::thread(&PerThreadRings::DrainLoop, this);
+        mRunning.store(true, std::memory_order_release);
+    }
+
+    /// Stops accepting records and hands the buffered ones to the delegate. Does nothing if not started.
+    void Stop()
+    {
+        VerifyOrReturn(mDrainThread.joinable());
+
+        mRunning.store(false, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(mDrainMutex);
+            mStopDrain = true;
+        }
+        mDrainWakeup.notify_one();
+        mDrainThread.join();
+
+        // Pick up anything appended between the last drain and the thread stopping.
+        DrainRings();
+        mDelegate = nullptr;
+    }
+
+    bool IsRunning() const { return mRunning.load(std::memory_order_acquire); }
+
+    /// Appends a record filled by fill(Record &) to the ring of the calling thread, or counts
+    /// it as dropped if that ring is full. Does nothing while stopped.
+    template <typename Fill>
+    void Append(Fill && fill)
+    {
+        VerifyOrReturn(IsRunning());
+
+        Ring * ring         = CurrentRing();
+        const uint32_t head = ring->head.load(std::memory_order_relaxed);
+        if (head - ring->tail.load(std::memory_order_acquire) >= kCapacity)
+        {
+            ring->dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        fill(ring->records[head & (kCapacity - 1)]);
+        ring->head.store(head + 1, std::memory_order_release);
+    }
+
+    /// Total records dropped because the ring of their thread was full.
+    uint64_t GetDroppedCount()
+    {
+        uint64_t dropped = 0;
+
+        std::lock_guard<std::mutex> lock(mRingsMutex);
+        for (auto & ring : mRings)
+        {
+            dropped += ring->dropped.load(std::memory_order_relaxed);
+        }
+        return dropped;
+    }
+
+private:
+    /// Single producer (the owning thread), single consumer (the drain thread) ring.
+    struct Ring
+    {
+        Ring(std::thread::id owner, uint32_t index) : ownerId(owner), threadIndex(index) {}
+
+        const std::thread::id ownerId;
+        const uint32_t threadIndex;
+
+        alignas(64) std::atomic<uint32_t> head{ 0 }; // written by the producer
+        alignas(64) std::atomic<uint32_t> tail{ 0 }; // written by the consumer
+        std::atomic<uint64_t> dropped{ 0 };
+        uint64_t droppedReported = 0; // consumer only
+
+        Record records[kCapacity];
+    };
+
+    /// Ring of the calling thread for the instance that last used it.
+    struct RingCache
+    {
+        uint64_t instanceId = 0;
+        Ring * ring         = nullptr;
+    };
+
+    static inline std::atomic<uint64_t> sNextInstanceId{ 1 };
+    static inline thread_local RingCache sRingCache;
+
+    /// Returns the ring of the calling thread, creating it on first use.
+    Ring * CurrentRing()
+    {
+        if (sRingCache.instanceId == mInstanceId)
+        {
+            return sRingCache.ring;
+        }
+
+        const std::thread::id self = std::this_thread::get_id();
+        Ring * ring                = nullptr;
+
+        std::lock_guard<std::mutex> lock(mRingsMutex);
+        for (auto & candidate : mRings)
+        {
+            // A thread id may be reused once its thread exited, which keeps a single producer per ring.
+            if (candidate->ownerId == self)
+            {
+                ring = candidate.get();
+                break;
+            }
+        }
+        if (ring == nullptr)
+        {
+            mRings.push_back(std::make_unique<Ring>(self, static_cast<uint32_t>(mRings.size())));
+            ring = mRings.back().get();
+        }
+
+        sRingCache.instanceId = mInstanceId;
+        sRingCache.ring       = ring;
+        return ring;
+    }
+
+    void DrainLoop()
+    {
+        std::unique_lock<std::mutex> lock(mDrainMutex);
+        while (!mStopDrain)
+        {
+            mDrainWakeup.wait_for(lock, mDrainInterval);
+
+            lock.unlock();
+            DrainRings();
+            lock.lock();
+        }
+    }
+
+    void DrainRings()
+    {
+        {
+            // Rings are never removed while the object exists, so they stay valid once the lock is released.
+            std::lock_guard<std::mutex> lock(mRingsMutex);
+            mDrainList.clear();
+            for (auto & ring : mRings)
+            {
+                mDrainList.push_back(ring.get());
+            }
+        }
+
+        for (Ring * ring : mDrainList)
+        {
+            uint32_t tail       = ring->tail.load(std::memory_order_relaxed);
+            const uint32_t head = ring->head.load(std::memory_order_acquire);
+            for (; tail != head; tail++)
+            {
+                mDelegate->OnRecord(ring->threadIndex, ring->records[tail & (kCapacity - 1)]);
+            }
+            ring->tail.store(tail, std::memory_order_release);
+
+            const uint64_t dropped = ring->dropped.load(std::memory_order_relaxed);
+            if (dropped != ring->droppedReported)
+            {
+                mDelegate->OnDropped(ring->threadIndex, dropped - ring->droppedReported, dropped);
+                ring->droppedReported = dropped;
+            }
+        }
+
+        mDelegate->OnDrained();
+    }
+
+    const uint64_t mInstanceId;
+    std::atomic<bool> mRunning{ false };
+
+    std::mutex mRingsMutex;
+    std::vector<std::unique_ptr<Ring>> mRings; // guarded by mRingsMutex, entries live until destruction
+
+    // Drain thread state
+    std::thread mDrainThread;
+    std::mutex mDrainMutex;
+    std::condition_variable mDrainWakeup;
+    bool mStopDrain = false; // guarded by mDrainMutex
+
+    // Only used by the drain thread while it runs, and by Stop once it stopped
+    Delegate * mDelegate = nullptr;
+    std::chrono::milliseconds mDrainInterval;
+    std::vector<Ring *> mDrainList;
+};
+
+/// Creates the missing parent directories of path, then opens it for writing binary
+/// data, truncating any existing content.
+CHIP_ERROR OpenDrainOutputFile(std::ofstream & file, const char * path);
+
+/// Numbers the constant strings referenced by entries of a drained file, writing a
+/// definition entry the first time each string is used:
+///     - entryType (uint8), id (uint32), length (uint16), UTF-8 bytes
+///
+/// Ids start at 1, id 0 is the null string. Strings are identified by address.
+class DrainFileStrings
+{
+public:
+    explicit DrainFileStrings(uint8_t entryType) : mEntryType(entryType) {}
+
+    /// Forgets the strings defined so far, for a new file.
+    void Clear() { mIds.clear(); }
+
+    /// Returns the id of str, writing its definition to file if it has none yet.
+    uint32_t GetId(std::ofstream & file, const char * str);
+
+private:
+    const uint8_t mEntryType;
+    std::unordered_map<const char *, uint32_t> mIds;
+};
+
+} // namespace chip
@@ -58,6 +58,11 @@ ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext
 
 ReliableMessageMgr::RetransTableEntry::~RetransTableEntry()
 {
+    // Exchanges stay on their session, so this is the session the entry was counted on, unless it was released since.
+    if (ec->HasSessionHandle() && ec->GetSessionHandle()->IsSecureSession())
+    {
+        ec->GetSessionHandle()->AsSecureSession()->OnRetransmitBufferReleased();
+    }
     ec->SetWaitingForAck(false);
 }
 
@@ -181,6 +186,10 @@ void ReliableMessageMgr::ExecuteActions()
                         entry->sendCount, ChipLogValueExchange(&entry->ec.Get()), session->SessionIdForLogging(), messageCounter,
                         Transport::GetSessionTypeString(session), fabricIndex, ChipLogValueX64(destination));
         MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRetryCount, entry->sendCount);
+        if (session->IsSecureSession())
+        {
+            session->AsSecureSession()->GetResourceStats().retransmissions++;
+        }
 
         CalculateNextRetransTime(*entry);
         SendFromRetransTable(entry);
@@ -219,6 +228,13 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
         return CHIP_ERROR_RETRANS_TABLE_FULL;
     }
 
+    ExchangeContext * ec = rc->GetExchangeContext();
+    if (ec->HasSessionHandle() && ec->GetSessionHandle()->IsSecureSession())
+    {
+        // Released by the destructor of the entry.
+        ec->GetSessionHandle()->AsSecureSession()->OnRetransmitBufferHeld();
+    }
+
     return CHIP_NO_ERROR;
 }
 
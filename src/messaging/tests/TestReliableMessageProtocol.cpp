@@ -363,6 +363,41 @@ TEST_F(TestReliableMessageProtocol, CheckAddClearRetrans)
     exchange->Close();
 }
 
+TEST_F(TestReliableMessageProtocol, CheckRetransmitBuffersHeld)
+{
+    MockAppDelegate mockAppDelegate(*this);
+    ExchangeContext * exchange1 = NewExchangeToAlice(&mockAppDelegate);
+    ExchangeContext * exchange2 = NewExchangeToAlice(&mockAppDelegate);
+    ASSERT_NE(exchange1, nullptr);
+    ASSERT_NE(exchange2, nullptr);
+
+    ReliableMessageMgr * rm            = GetExchangeManager().GetReliableMessageMgr();
+    Transport::SecureSession * session = exchange1->GetSessionHandle()->AsSecureSession();
+    ASSERT_NE(rm, nullptr);
+
+    ReliableMessageMgr::RetransTableEntry * entry1;
+    ReliableMessageMgr::RetransTableEntry * entry2;
+
+    EXPECT_EQ(rm->AddToRetransTable(exchange1->GetReliableMessageContext(), &entry1), CHIP_NO_ERROR);
+    EXPECT_EQ(rm->AddToRetransTable(exchange2->GetReliableMessageContext(), &entry2), CHIP_NO_ERROR);
+    EXPECT_EQ(session->GetRetransmitBuffersHeld(), 2u);
+    EXPECT_EQ(session->GetResourceStats().retransmitBuffersHighWater, 2u);
+
+    rm->ClearRetransTable(*entry1);
+    rm->ClearRetransTable(*entry2);
+    EXPECT_EQ(session->GetRetransmitBuffersHeld(), 0u);
+
+    // The high-water mark is kept once the buffers are released.
+    EXPECT_EQ(rm->AddToRetransTable(exchange1->GetReliableMessageContext(), &entry1), CHIP_NO_ERROR);
+    EXPECT_EQ(session->GetRetransmitBuffersHeld(), 1u);
+    EXPECT_EQ(session->GetResourceStats().retransmitBuffersHighWater, 2u);
+    rm->ClearRetransTable(*entry1);
+    EXPECT_EQ(session->GetRetransmitBuffersHeld(), 0u);
+
+    exchange1->Close();
+    exchange2->Close();
+}
+
 /**
  * Tests MRP retransmission logic with the following scenario:
  *
@@ -63,19 +63,49 @@ CHIP_ERROR OTAImageProcessorImpl::Abort()
 
 CHIP_ERROR OTAImageProcessorImpl::ProcessBlock(ByteSpan & block)
 {
-    if (!mOfs.is_open() || !mOfs.good())
     {
-        return CHIP_ERROR_INTERNAL;
+        // mOfs is owned by the writer thread while a download is in progress
+        std::unique_lock<std::mutex> lock(mWriterMutex);
+        VerifyOrReturnError(mWriterRunning && !mWriteFailed, CHIP_ERROR_INTERNAL);
+    }
+
+    // The downloader must not be re-entered from within ProcessBlock(), so both failures and
+    // requests for the next block are deferred to the Matter event loop.
+    CHIP_ERROR err = ProcessHeader(block);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "Image does not contain a valid header");
+        mEndDownloadReason = CHIP_ERROR_INVALID_FILE_IDENTIFIER;
+        DeviceLayer::PlatformMgr().ScheduleWork(HandleEndDownload, reinterpret_cast<intptr_t>(this));
+        return CHIP_NO_ERROR;
     }
 
-    // Store block data for HandleProcessBlock to access
-    CHIP_ERROR err = SetBlock(block);
+    if (mVerifyDigest && !block.empty())
+    {
+        err = mPayloadDigest.AddData(block);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(SoftwareUpdate, "Cannot update image digest: %" CHIP_ERROR_FORMAT, err.Format());
+            mVerifyDigest = false;
+        }
+    }
+
+    bool fetchNext = true;
+    err            = QueueBlock(block, fetchNext);
     if (err != CHIP_NO_ERROR)
     {
-        ChipLogError(SoftwareUpdate, "Cannot set block data: %" CHIP_ERROR_FORMAT, err.Format());
+        ChipLogError(SoftwareUpdate, "Cannot queue block data: %" CHIP_ERROR_FORMAT, err.Format());
+        mEndDownloadReason = CHIP_ERROR_WRITE_FAILED;
+        DeviceLayer::PlatformMgr().ScheduleWork(HandleEndDownload, reinterpret_cast<intptr_t>(this));
+        return CHIP_NO_ERROR;
     }
 
-    DeviceLayer::PlatformMgr().ScheduleWork(HandleProcessBlock, reinterpret_cast<intptr_t>(this));
+    mParams.downloadedBytes += block.size();
+
+    if (fetchNext)
+    {
+        DeviceLayer::PlatformMgr().ScheduleWork(HandleFetchNextData, reinterpret_cast<intptr_t>(this));
+    }
     return CHIP_NO_ERROR;
 }
 
@@ -125,10 +155,14 @@ void OTAImageProcessorImpl::HandlePrepareDownload(intptr_t context)
         return;
     }
 
+    imageProcessor->StopWriter(/* discard = */ true);
+    imageProcessor->mOfs.close();
     unlink(imageProcessor->mImageFile);
 
     imageProcessor->mParams.downloadedBytes = 0;
     imageProcessor->mParams.totalFileBytes  = 0;
+    imageProcessor->mVerifyDigest           = false;
+    imageProcessor->mDownloadStart          = System::SystemClock().GetMonotonicTimestamp();
     imageProcessor->mHeaderParser.Init();
     imageProcessor->mOfs.open(imageProcessor->mImageFile, std::ofstream::out | std::ofstream::ate | std::ofstream::app);
     if (!imageProcessor->mOfs.good())
@@ -137,6 +171,15 @@ void OTAImageProcessorImpl::HandlePrepareDownload(intptr_t context)
         return;
     }
 
+    CHIP_ERROR error = imageProcessor->StartWriter();
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "Cannot start image writer: %" CHIP_ERROR_FORMAT, error.Format());
+        imageProcessor->mOfs.close();
+        imageProcessor->mDownloader->OnPreparedForDownload(error);
+        return;
+    }
+
     imageProcessor->mDownloader->OnPreparedForDownload(CHIP_NO_ERROR);
 }
 
@@ -148,10 +191,29 @@ void OTAImageProcessorImpl::HandleFinalize(intptr_t context)
         return;
     }
 
+    // Wait for the remaining blocks to reach the file before closing it
+    imageProcessor->StopWriter(/* discard = */ false);
+    bool writeFailed = imageProcessor->mWriteFailed;
     imageProcessor->mOfs.close();
-    imageProcessor->ReleaseBlock();
+    imageProcessor->ReleaseBuffers();
+
+    CHIP_ERROR error = writeFailed ? CHIP_ERROR_WRITE_FAILED : imageProcessor->VerifyImageDigest();
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "Downloaded OTA image is invalid: %" CHIP_ERROR_FORMAT, error.Format());
+        unlink(imageProcessor->mImageFile);
 
-    ChipLogProgress(SoftwareUpdate, "OTA image downloaded to %s", imageProcessor->mImageFile);
+        OTARequestorInterface * requestor = chip::GetRequestorInstance();
+        if (requestor != nullptr)
+        {
+            requestor->CancelImageUpdate();
+        }
+        return;
+    }
+
+    System::Clock::Milliseconds64 elapsed = System::SystemClock().GetMonotonicTimestamp() - imageProcessor->mDownloadStart;
+    ChipLogProgress(SoftwareUpdate, "OTA image downloaded to %s: %" PRIu64 " bytes in %" PRIu64 " ms", imageProcessor->mImageFile,
+                    imageProcessor->mParams.downloadedBytes, elapsed.count());
 }
 
 void OTAImageProcessorImpl::HandleApply(intptr_t context)
@@ -180,12 +242,13 @@ void OTAImageProcessorImpl::HandleAbort(intptr_t context)
         return;
     }
 
+    imageProcessor->StopWriter(/* discard = */ true);
     imageProcessor->mOfs.close();
     unlink(imageProcessor->mImageFile);
-    imageProcessor->ReleaseBlock();
+    imageProcessor->ReleaseBuffers();
 }
 
-void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
+void OTAImageProcessorImpl::HandleFetchNextData(intptr_t context)
 {
     auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
     if (imageProcessor == nullptr)
@@ -199,23 +262,24 @@ void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
         return;
     }
 
-    ByteSpan block   = imageProcessor->mBlock;
-    CHIP_ERROR error = imageProcessor->ProcessHeader(block);
-    if (error != CHIP_NO_ERROR)
+    imageProcessor->mDownloader->FetchNextData();
+}
+
+void OTAImageProcessorImpl::HandleEndDownload(intptr_t context)
+{
+    auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
+    if (imageProcessor == nullptr)
     {
-        ChipLogError(SoftwareUpdate, "Image does not contain a valid header");
-        imageProcessor->mDownloader->EndDownload(CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+        ChipLogError(SoftwareUpdate, "ImageProcessor context is null");
         return;
     }
-
-    if (!imageProcessor->mOfs.write(reinterpret_cast<const char *>(block.data()), static_cast<std::streamsize>(block.size())))
+    else if (imageProcessor->mDownloader == nullptr)
     {
-        imageProcessor->mDownloader->EndDownload(CHIP_ERROR_WRITE_FAILED);
+        ChipLogError(SoftwareUpdate, "mDownloader is null");
         return;
     }
 
-    imageProcessor->mParams.downloadedBytes += block.size();
-    imageProcessor->mDownloader->FetchNextData();
+    imageProcessor->mDownloader->EndDownload(imageProcessor->mEndDownloadReason);
 }
 
 CHIP_ERROR OTAImageProcessorImpl::ProcessHeader(ByteSpan & block)
@@ -230,50 +294,174 @@ CHIP_ERROR OTAImageProcessorImpl::ProcessHeader(ByteSpan & block)
         ReturnErrorOnFailure(error);
 
         mParams.totalFileBytes = header.mPayloadSize;
+
+        // The digest span points into the parser buffer, so it must be copied before clearing the parser
+        mVerifyDigest = header.mImageDigestType == OTAImageDigestType::kSha256 &&
+            header.mImageDigest.size() == sizeof(mExpectedDigest) && mPayloadDigest.Begin() == CHIP_NO_ERROR;
+        if (mVerifyDigest)
+        {
+            memcpy(mExpectedDigest, header.mImageDigest.data(), sizeof(mExpectedDigest));
+        }
+        else
+        {
+            ChipLogProgress(SoftwareUpdate, "Image digest type %u is not verified while streaming",
+                            static_cast<unsigned>(header.mImageDigestType));
+        }
+
         mHeaderParser.Clear();
     }
 
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR OTAImageProcessorImpl::SetBlock(ByteSpan & block)
+CHIP_ERROR OTAImageProcessorImpl::VerifyImageDigest()
 {
-    if (block.empty())
+    VerifyOrReturnError(mVerifyDigest, CHIP_NO_ERROR);
+    mVerifyDigest = false;
+
+    uint8_t digest[Crypto::kSHA256_Hash_Length];
+    MutableByteSpan digestSpan(digest);
+    ReturnErrorOnFailure(mPayloadDigest.Finish(digestSpan));
+    VerifyOrReturnError(digestSpan.data_equal(ByteSpan(mExpectedDigest)), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageProcessorImpl::QueueBlock(const ByteSpan & block, bool & fetchNext)
+{
+    fetchNext = true;
+    VerifyOrReturnError(!block.empty(), CHIP_NO_ERROR);
+
+    std::unique_lock<std::mutex> lock(mWriterMutex);
+    VerifyOrReturnError(mWriterRunning && !mWriteFailed, CHIP_ERROR_INCORRECT_STATE);
+
+    // The next block is only requested while a buffer is free, so the fill buffer is never owned by the writer here
+    VerifyOrReturnError(mPendingWrites < kNumWriteBuffers, CHIP_ERROR_INCORRECT_STATE);
+
+    WriteBuffer & buffer = mWriteBuffers[mFillIndex];
+    if (buffer.mData.AllocatedSize() < block.size())
     {
-        ReleaseBlock();
-        return CHIP_NO_ERROR;
+        VerifyOrReturnError(buffer.mData.Calloc(block.size()), CHIP_ERROR_NO_MEMORY);
     }
-    if (mBlock.size() < block.size())
+    memcpy(buffer.mData.Get(), block.data(), block.size());
+    buffer.mLength = block.size();
+
+    mFillIndex = (mFillIndex + 1) % kNumWriteBuffers;
+    mPendingWrites++;
+
+    // Once both buffers are queued the writer thread has to free one before the next block is fetched
+    if (mPendingWrites == kNumWriteBuffers)
     {
-        if (!mBlock.empty())
-        {
-            ReleaseBlock();
-        }
-        uint8_t * mBlock_ptr = static_cast<uint8_t *>(chip::Platform::MemoryAlloc(block.size()));
-        if (mBlock_ptr == nullptr)
+        mFetchDeferred = true;
+        fetchNext      = false;
+    }
+
+    mWriterCondition.notify_all();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageProcessorImpl::StartWriter()
+{
+    std::unique_lock<std::mutex> lock(mWriterMutex);
+    VerifyOrReturnError(!mWriterRunning, CHIP_ERROR_INCORRECT_STATE);
+
+    mWriterStopping = false;
+    mWriteFailed    = false;
+    mFetchDeferred  = false;
+    mFillIndex      = 0;
+    mWriteIndex     = 0;
+    mPendingWrites  = 0;
+
+    int res = pthread_create(&mWriterThread, nullptr, WriterThreadMain, this);
+    VerifyOrReturnError(res == 0, CHIP_ERROR_POSIX(res));
+
+    mWriterRunning = true;
+    return CHIP_NO_ERROR;
+}
+
+void OTAImageProcessorImpl::StopWriter(bool discard)
+{
+    {
+        std::unique_lock<std::mutex> lock(mWriterMutex);
+        VerifyOrReturn(mWriterRunning);
+
+        if (discard)
         {
-            return CHIP_ERROR_NO_MEMORY;
+            mPendingWrites = 0;
         }
-        mBlock = MutableByteSpan(mBlock_ptr, block.size());
+        mWriterStopping = true;
+        mFetchDeferred  = false;
+        mWriterCondition.notify_all();
     }
-    CHIP_ERROR err = CopySpanToMutableSpan(block, mBlock);
-    if (err != CHIP_NO_ERROR)
+
+    pthread_join(mWriterThread, nullptr);
+
+    std::unique_lock<std::mutex> lock(mWriterMutex);
+    mWriterRunning = false;
+}
+
+void * OTAImageProcessorImpl::WriterThreadMain(void * context)
+{
+    static_cast<OTAImageProcessorImpl *>(context)->RunWriter();
+    return nullptr;
+}
+
+void OTAImageProcessorImpl::RunWriter()
+{
+    std::unique_lock<std::mutex> lock(mWriterMutex);
+
+    while (true)
     {
-        ChipLogError(SoftwareUpdate, "Cannot copy block data: %" CHIP_ERROR_FORMAT, err.Format());
-        return err;
+        mWriterCondition.wait(lock, [this] { return mPendingWrites > 0 || mWriterStopping; });
+        if (mPendingWrites == 0)
+        {
+            // Stopping and fully drained
+            return;
+        }
+
+        WriteBuffer & buffer = mWriteBuffers[mWriteIndex];
+
+        // The file and the buffer being written are owned by this thread until mPendingWrites is decremented
+        lock.unlock();
+        bool written = static_cast<bool>(
+            mOfs.write(reinterpret_cast<const char *>(buffer.mData.Get()), static_cast<std::streamsize>(buffer.mLength)));
+        lock.lock();
+
+        if (mPendingWrites == 0)
+        {
+            // Pending blocks were discarded while writing
+            continue;
+        }
+
+        mWriteIndex = (mWriteIndex + 1) % kNumWriteBuffers;
+        mPendingWrites--;
+
+        if (!written)
+        {
+            mWriteFailed       = true;
+            mFetchDeferred     = false;
+            mPendingWrites     = 0;
+            mEndDownloadReason = CHIP_ERROR_WRITE_FAILED;
+            DeviceLayer::PlatformMgr().ScheduleWork(HandleEndDownload, reinterpret_cast<intptr_t>(this));
+            return;
+        }
+
+        if (mFetchDeferred)
+        {
+            mFetchDeferred = false;
+            DeviceLayer::PlatformMgr().ScheduleWork(HandleFetchNextData, reinterpret_cast<intptr_t>(this));
+        }
     }
-    return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR OTAImageProcessorImpl::ReleaseBlock()
+void OTAImageProcessorImpl::ReleaseBuffers()
 {
-    if (mBlock.data() != nullptr)
+    std::unique_lock<std::mutex> lock(mWriterMutex);
+    for (auto & buffer : mWriteBuffers)
     {
-        chip::Platform::MemoryFree(mBlock.data());
+        buffer.mData.Free();
+        buffer.mLength = 0;
     }
-
-    mBlock = MutableByteSpan();
-    return CHIP_NO_ERROR;
 }
 
 } // namespace chip
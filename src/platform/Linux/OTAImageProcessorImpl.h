@@ -19,11 +19,17 @@
 #pragma once
 
 #include <app/clusters/ota-requestor/OTADownloader.h>
+#include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/OTAImageHeader.h>
+#include <lib/support/ScopedBuffer.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <platform/OTAImageProcessor.h>
+#include <system/SystemClock.h>
 
+#include <condition_variable>
 #include <fstream>
+#include <mutex>
+#include <pthread.h>
 
 namespace chip {
 
@@ -51,25 +57,74 @@ private:
     static void HandleFinalize(intptr_t context);
     static void HandleApply(intptr_t context);
     static void HandleAbort(intptr_t context);
-    static void HandleProcessBlock(intptr_t context);
+    static void HandleFetchNextData(intptr_t context);
+    static void HandleEndDownload(intptr_t context);
 
     CHIP_ERROR ProcessHeader(ByteSpan & block);
 
     /**
-     * Called to allocate memory for mBlock if necessary and set it to block
+     * Copy block into the free write buffer and hand it over to the writer thread.
+     *
+     * Two write buffers are used so that the file write of one block overlaps with the BDX
+     * fetch of the next one. Sets fetchNext to true if the next block can be requested right
+     * away; otherwise the writer thread requests it once the older buffer has been flushed.
      */
-    CHIP_ERROR SetBlock(ByteSpan & block);
+    CHIP_ERROR QueueBlock(const ByteSpan & block, bool & fetchNext);
+
+    CHIP_ERROR StartWriter();
+
+    /**
+     * Stop the writer thread. If discard is false, wait for all queued blocks to be written first.
+     */
+    void StopWriter(bool discard);
+
+    /**
+     * Called to release allocated memory for the write buffers
+     */
+    void ReleaseBuffers();
 
     /**
-     * Called to release allocated memory for mBlock
+     * Check the streamed payload digest against the one announced in the image header.
      */
-    CHIP_ERROR ReleaseBlock();
+    CHIP_ERROR VerifyImageDigest();
+
+    static void * WriterThreadMain(void * context);
+    void RunWriter();
+
+    static constexpr size_t kNumWriteBuffers = 2;
+
+    struct WriteBuffer
+    {
+        Platform::ScopedMemoryBufferWithSize<uint8_t> mData;
+        size_t mLength = 0;
+    };
 
     std::ofstream mOfs;
-    MutableByteSpan mBlock;
     OTADownloader * mDownloader;
     OTAImageHeaderParser mHeaderParser;
     const char * mImageFile = nullptr;
+
+    // Incremental payload digest, verified in Finalize() when the header carries a SHA-256 digest
+    Crypto::Hash_SHA256_stream mPayloadDigest;
+    uint8_t mExpectedDigest[Crypto::kSHA256_Hash_Length];
+    bool mVerifyDigest = false;
+
+    System::Clock::Timestamp mDownloadStart;
+    CHIP_ERROR mEndDownloadReason = CHIP_NO_ERROR;
+
+    // Writer thread state. Everything below is guarded by mWriterMutex, except for the contents
+    // of a buffer which belongs to whichever side currently holds it.
+    WriteBuffer mWriteBuffers[kNumWriteBuffers];
+    std::mutex mWriterMutex;
+    std::condition_variable mWriterCondition;
+    pthread_t mWriterThread;
+    bool mWriterRunning   = false;
+    bool mWriterStopping  = false;
+    bool mWriteFailed     = false;
+    bool mFetchDeferred   = false;
+    size_t mFillIndex     = 0;
+    size_t mWriteIndex    = 0;
+    size_t mPendingWrites = 0;
 };
 
 } // namespace chip
@@ -205,6 +205,110 @@ TEST_F(TestPlatformMgr, RunEventLoopStopBeforeSleep)
     PlatformMgr().Shutdown();
 }
 
+static std::atomic<int> sBackgroundWorkRun{ 0 };
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+static std::atomic<int> sBackgroundWorkRunOnChipThread{ 0 };
+static std::atomic<pthread_t> sChipThread;
+
+static void RecordChipThread(intptr_t)
+{
+    sChipThread = pthread_self();
+}
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
+static void CountBackgroundWork(intptr_t)
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    if (pthread_equal(pthread_self(), sChipThread.load()))
+    {
+        sBackgroundWorkRunOnChipThread++;
+    }
+#endif
+    sBackgroundWorkRun++;
+}
+
+TEST_F(TestPlatformMgr, ScheduleBackgroundWork)
+{
+    constexpr int kWorkCount = 32;
+    sBackgroundWorkRun       = 0;
+
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    EXPECT_EQ(PlatformMgr().StartEventLoopTask(), CHIP_NO_ERROR);
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    sBackgroundWorkRunOnChipThread = 0;
+    EXPECT_EQ(PlatformMgr().ScheduleWork(RecordChipThread), CHIP_NO_ERROR);
+#endif
+
+    // Background work runs on the background threads when the platform has them, on the event
+    // loop otherwise; either way every item runs exactly once.
+    for (int i = 0; i < kWorkCount; i++)
+    {
+        EXPECT_EQ(PlatformMgr().ScheduleBackgroundWork(CountBackgroundWork), CHIP_NO_ERROR);
+    }
+
+    for (size_t t = 0; sBackgroundWorkRun != kWorkCount && t < 1000; t++)
+        chip::test_utils::SleepMillis(1);
+
+    EXPECT_EQ(sBackgroundWorkRun, kWorkCount);
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    EXPECT_EQ(sBackgroundWorkRunOnChipThread, 0);
+#endif
+
+    EXPECT_EQ(PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR);
+    PlatformMgr().Shutdown();
+}
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
+// With background threads, work left queued when the event loop stops still runs, on the CHIP thread.
+static std::atomic<int> sBlockersStarted{ 0 };
+static std::atomic<bool> sReleaseBlockers{ false };
+
+static void BlockBackgroundThread(intptr_t)
+{
+    sBlockersStarted++;
+    while (!sReleaseBlockers)
+        chip::test_utils::SleepMillis(1);
+}
+
+TEST_F(TestPlatformMgr, StopEventLoopTaskRunsPendingBackgroundWork)
+{
+    constexpr int kWorkCount       = 8;
+    sBackgroundWorkRun             = 0;
+    sBackgroundWorkRunOnChipThread = 0;
+    sBlockersStarted               = 0;
+    sReleaseBlockers               = false;
+
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    EXPECT_EQ(PlatformMgr().StartEventLoopTask(), CHIP_NO_ERROR);
+    EXPECT_EQ(PlatformMgr().ScheduleWork(RecordChipThread), CHIP_NO_ERROR);
+
+    // Keep every background thread busy so that the following work stays queued.
+    for (int i = 0; i < CHIP_DEVICE_CONFIG_BG_TASK_COUNT; i++)
+    {
+        EXPECT_EQ(PlatformMgr().ScheduleBackgroundWork(BlockBackgroundThread), CHIP_NO_ERROR);
+    }
+    for (size_t t = 0; sBlockersStarted != CHIP_DEVICE_CONFIG_BG_TASK_COUNT && t < 1000; t++)
+        chip::test_utils::SleepMillis(1);
+    EXPECT_EQ(sBlockersStarted, CHIP_DEVICE_CONFIG_BG_TASK_COUNT);
+
+    for (int i = 0; i < kWorkCount; i++)
+    {
+        EXPECT_EQ(PlatformMgr().ScheduleBackgroundWork(CountBackgroundWork), CHIP_NO_ERROR);
+    }
+
+    // The queued work is handed over to the event loop, which runs it before exiting.
+    EXPECT_EQ(PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR);
+    EXPECT_EQ(sBackgroundWorkRun, kWorkCount);
+    EXPECT_EQ(sBackgroundWorkRunOnChipThread, kWorkCount);
+
+    sReleaseBlockers = true;
+    PlatformMgr().Shutdown();
+}
+
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
 TEST_F(TestPlatformMgr, TryLockChipStack)
 {
     bool locked = PlatformMgr().TryLockChipStack();
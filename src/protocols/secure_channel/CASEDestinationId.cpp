@@ -21,6 +21,7 @@
 #include <credentials/GroupDataProvider.h>
 #include <lib/core/CHIPError.h>
 #include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/Span.h>
 
 #include "CASEDestinationId.h"
@@ -29,6 +30,17 @@ namespace chip {
 
 using namespace chip::Crypto;
 
+namespace {
+
+void PutFabricMessage(Encoding::LittleEndian::BufferWriter & bbuf, const ByteSpan & rootPubKey, FabricId fabricId, NodeId nodeId)
+{
+    bbuf.Put(rootPubKey.data(), rootPubKey.size());
+    bbuf.Put64(fabricId);
+    bbuf.Put64(nodeId);
+}
+
+} // namespace
+
 CHIP_ERROR GenerateCaseDestinationId(const ByteSpan & ipk, const ByteSpan & initiatorRandom, const ByteSpan & rootPubKey,
                                      FabricId fabricId, NodeId nodeId, MutableByteSpan & outDestinationId)
 {
@@ -43,9 +55,7 @@ CHIP_ERROR GenerateCaseDestinationId(const ByteSpan & ipk, const ByteSpan & init
 
     Encoding::LittleEndian::BufferWriter bbuf(destinationMessage, sizeof(destinationMessage));
     bbuf.Put(initiatorRandom.data(), initiatorRandom.size());
-    bbuf.Put(rootPubKey.data(), rootPubKey.size());
-    bbuf.Put64(fabricId);
-    bbuf.Put64(nodeId);
+    PutFabricMessage(bbuf, rootPubKey, fabricId, nodeId);
 
     size_t written = 0;
     VerifyOrReturnError(bbuf.Fit(written), CHIP_ERROR_BUFFER_TOO_SMALL);
@@ -62,4 +72,170 @@ CHIP_ERROR GenerateCaseDestinationId(const ByteSpan & ipk, const ByteSpan & init
     return err;
 }
 
+CHIP_ERROR CASEDestinationIdCache::Init(FabricTable * fabricTable, Credentials::GroupDataProvider * groupDataProvider)
+{
+    VerifyOrReturnError(fabricTable != nullptr && groupDataProvider != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Shutdown();
+    ReturnErrorOnFailure(fabricTable->AddFabricDelegate(this));
+    mFabricTable       = fabricTable;
+    mGroupDataProvider = groupDataProvider;
+    return CHIP_NO_ERROR;
+}
+
+void CASEDestinationIdCache::Shutdown()
+{
+    if (mFabricTable != nullptr)
+    {
+        mFabricTable->RemoveFabricDelegate(this);
+    }
+    mFabricTable       = nullptr;
+    mGroupDataProvider = nullptr;
+    Invalidate();
+}
+
+void CASEDestinationIdCache::Invalidate()
+{
+    for (auto & entry : mEntries)
+    {
+        ClearEntry(entry);
+    }
+}
+
+void CASEDestinationIdCache::InvalidateFabric(FabricIndex fabricIndex)
+{
+    Entry * entry = FindEntry(fabricIndex);
+    if (entry != nullptr)
+    {
+        ClearEntry(*entry);
+    }
+}
+
+void CASEDestinationIdCache::ClearEntry(Entry & entry)
+{
+    ClearSecretData(entry.ipks[0], sizeof(entry.ipks));
+    entry.numIpks     = 0;
+    entry.fabricIndex = kUndefinedFabricIndex;
+}
+
+CASEDestinationIdCache::Entry * CASEDestinationIdCache::FindEntry(FabricIndex fabricIndex)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.fabricIndex == fabricIndex)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void CASEDestinationIdCache::LoadEntry(const FabricInfo & fabricInfo, const ByteSpan & fabricMessage, Entry & entry)
+{
+    ClearEntry(entry);
+    entry.fabricIndex = fabricInfo.GetFabricIndex();
+    memcpy(entry.fabricMessage, fabricMessage.data(), sizeof(entry.fabricMessage));
+
+    // A fabric without a valid IPK key set is kept with no candidate IPK, so that its key set is not read again until
+    // a Sigma1 fails to match.
+    Credentials::GroupDataProvider::KeySet ipkKeySet;
+    CHIP_ERROR err = mGroupDataProvider->GetIpkKeySet(fabricInfo.GetFabricIndex(), ipkKeySet);
+    if ((err == CHIP_NO_ERROR) && (ipkKeySet.num_keys_used > 0) &&
+        (ipkKeySet.num_keys_used <= Credentials::GroupDataProvider::KeySet::kEpochKeysMax))
+    {
+        for (size_t keyIdx = 0; keyIdx < ipkKeySet.num_keys_used; ++keyIdx)
+        {
+            memcpy(entry.ipks[keyIdx], ipkKeySet.epoch_keys[keyIdx].key, kIPKSize);
+        }
+        entry.numIpks = ipkKeySet.num_keys_used;
+    }
+
+    for (auto & epochKey : ipkKeySet.epoch_keys)
+    {
+        epochKey.Clear();
+    }
+}
+
+CHIP_ERROR CASEDestinationIdCache::FindLocalNode(const ByteSpan & destinationId, const ByteSpan & initiatorRandom,
+                                                 FabricIndex & outFabricIndex, NodeId & outNodeId, MutableByteSpan & outIpk)
+{
+    VerifyOrReturnError(mFabricTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(initiatorRandom.size() == kSigmaParamRandomNumberSize, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(outIpk.size() >= kIPKSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    bool usedCachedEntry = false;
+    CHIP_ERROR err       = Match(destinationId, initiatorRandom, /* reload = */ false, outFabricIndex, outNodeId, outIpk,
+                                 usedCachedEntry);
+    if (err == CHIP_ERROR_KEY_NOT_FOUND && usedCachedEntry)
+    {
+        // The IPK of a fabric may have been written without the fabric table telling us, try again with fresh entries.
+        err = Match(destinationId, initiatorRandom, /* reload = */ true, outFabricIndex, outNodeId, outIpk, usedCachedEntry);
+    }
+    return err;
+}
+
+CHIP_ERROR CASEDestinationIdCache::Match(const ByteSpan & destinationId, const ByteSpan & initiatorRandom, bool reload,
+                                         FabricIndex & outFabricIndex, NodeId & outNodeId, MutableByteSpan & outIpk,
+                                         bool & outUsedCachedEntry)
+{
+    uint8_t destinationMessage[kSigmaParamRandomNumberSize + kFabricMessageLength];
+    memcpy(destinationMessage, initiatorRandom.data(), kSigmaParamRandomNumberSize);
+
+    // Used when all entries are taken, which only happens if the fabric table failed to report a removal.
+    Entry uncachedEntry;
+    HMAC_sha hmac;
+    CHIP_ERROR err = CHIP_ERROR_KEY_NOT_FOUND;
+
+    for (const FabricInfo & fabricInfo : *mFabricTable)
+    {
+        Crypto::P256PublicKey rootPubKey;
+        CHIP_ERROR fetchErr = mFabricTable->FetchRootPubkey(fabricInfo.GetFabricIndex(), rootPubKey);
+        VerifyOrExit(fetchErr == CHIP_NO_ERROR, err = fetchErr);
+
+        uint8_t fabricMessage[kFabricMessageLength];
+        Encoding::LittleEndian::BufferWriter bbuf(fabricMessage, sizeof(fabricMessage));
+        PutFabricMessage(bbuf, ByteSpan(rootPubKey.ConstBytes(), rootPubKey.Length()), fabricInfo.GetFabricId(),
+                         fabricInfo.GetNodeId());
+        VerifyOrExit(bbuf.Fit(), err = CHIP_ERROR_BUFFER_TOO_SMALL);
+
+        Entry * entry = FindEntry(fabricInfo.GetFabricIndex());
+        if (!reload && entry != nullptr && memcmp(entry->fabricMessage, fabricMessage, sizeof(fabricMessage)) == 0)
+        {
+            outUsedCachedEntry = true;
+        }
+        else
+        {
+            if (entry == nullptr)
+            {
+                entry = FindEntry(kUndefinedFabricIndex);
+            }
+            if (entry == nullptr)
+            {
+                entry = &uncachedEntry;
+            }
+            LoadEntry(fabricInfo, ByteSpan(fabricMessage), *entry);
+        }
+
+        memcpy(destinationMessage + kSigmaParamRandomNumberSize, entry->fabricMessage, kFabricMessageLength);
+
+        // Try every IPK candidate we have for a match
+        for (size_t keyIdx = 0; keyIdx < entry->numIpks; ++keyIdx)
+        {
+            uint8_t candidateDestinationId[kSHA256_Hash_Length];
+            if ((hmac.HMAC_SHA256(entry->ipks[keyIdx], kIPKSize, destinationMessage, sizeof(destinationMessage),
+                                  candidateDestinationId, sizeof(candidateDestinationId)) == CHIP_NO_ERROR) &&
+                destinationId.data_equal(ByteSpan(candidateDestinationId)))
+            {
+                outFabricIndex = fabricInfo.GetFabricIndex();
+                outNodeId      = fabricInfo.GetNodeId();
+                ExitNow(err = CopySpanToMutableSpan(ByteSpan(entry->ipks[keyIdx]), outIpk));
+            }
+        }
+    }
+
+exit:
+    ClearEntry(uncachedEntry);
+    return err;
+}
+
 } // namespace chip
@@ -34,4 +34,76 @@ inline constexpr uint16_t kIPKSize                    = Crypto::CHIP_CRYPTO_SYMM
 CHIP_ERROR GenerateCaseDestinationId(const ByteSpan & ipk, const ByteSpan & initiatorRandom, const ByteSpan & rootPubKey,
                                      FabricId fabricId, NodeId nodeId, MutableByteSpan & outDestinationId);
 
+/**
+ * Matches the destination identifier of incoming Sigma1 messages against the local fabrics.
+ *
+ * For every fabric, the IPK epoch keys and the part of the destination message that does not depend on the initiator
+ * random are kept, so that matching a Sigma1 only costs one HMAC per candidate IPK, without reading the IPK key sets
+ * from storage.
+ *
+ * Cached entries are checked against the fabric table on every use and dropped when the fabric table reports a change.
+ * When nothing matches, the entries are reloaded once, which picks up IPKs written without a fabric table notification
+ * (e.g. the IPK of a fabric being commissioned).
+ */
+class CASEDestinationIdCache : public FabricTable::Delegate
+{
+public:
+    CASEDestinationIdCache() = default;
+    ~CASEDestinationIdCache() override { Shutdown(); }
+
+    CASEDestinationIdCache(const CASEDestinationIdCache &)             = delete;
+    CASEDestinationIdCache & operator=(const CASEDestinationIdCache &) = delete;
+
+    CHIP_ERROR Init(FabricTable * fabricTable, Credentials::GroupDataProvider * groupDataProvider);
+    void Shutdown();
+
+    /**
+     * Find the local fabric and node a Sigma1 is destined to.
+     *
+     * @param[in] destinationId    Destination identifier of the Sigma1.
+     * @param[in] initiatorRandom  Initiator random of the Sigma1.
+     * @param[out] outFabricIndex  Index of the matching fabric.
+     * @param[out] outNodeId       Local node ID on the matching fabric.
+     * @param[out] outIpk          Buffer of at least kIPKSize bytes, receives the matching IPK.
+     *
+     * @retval CHIP_ERROR_KEY_NOT_FOUND if no fabric matches.
+     */
+    CHIP_ERROR FindLocalNode(const ByteSpan & destinationId, const ByteSpan & initiatorRandom, FabricIndex & outFabricIndex,
+                             NodeId & outNodeId, MutableByteSpan & outIpk);
+
+    /**
+     * Drop all cached entries, they are reloaded on next use.
+     */
+    void Invalidate();
+
+    //// FabricTable::Delegate Implementation ////
+    void FabricWillBeRemoved(const FabricTable & fabricTable, FabricIndex fabricIndex) override { InvalidateFabric(fabricIndex); }
+    void OnFabricRemoved(const FabricTable & fabricTable, FabricIndex fabricIndex) override { InvalidateFabric(fabricIndex); }
+    void OnFabricCommitted(const FabricTable & fabricTable, FabricIndex fabricIndex) override { InvalidateFabric(fabricIndex); }
+    void OnFabricUpdated(const FabricTable & fabricTable, FabricIndex fabricIndex) override { InvalidateFabric(fabricIndex); }
+
+    // Root public key, fabric ID and node ID, as they appear at the end of the destination message.
+    static constexpr size_t kFabricMessageLength = Crypto::kP256_PublicKey_Length + sizeof(FabricId) + sizeof(NodeId);
+
+private:
+    struct Entry
+    {
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        uint8_t numIpks         = 0;
+        uint8_t ipks[Credentials::GroupDataProvider::KeySet::kEpochKeysMax][kIPKSize];
+        uint8_t fabricMessage[kFabricMessageLength];
+    };
+
+    void InvalidateFabric(FabricIndex fabricIndex);
+    static void ClearEntry(Entry & entry);
+    Entry * FindEntry(FabricIndex fabricIndex);
+    void LoadEntry(const FabricInfo & fabricInfo, const ByteSpan & fabricMessage, Entry & entry);
+    CHIP_ERROR Match(const ByteSpan & destinationId, const ByteSpan & initiatorRandom, bool reload, FabricIndex & outFabricIndex,
+                     NodeId & outNodeId, MutableByteSpan & outIpk, bool & outUsedCachedEntry);
+
+    FabricTable * mFabricTable                          = nullptr;
+    Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
+    Entry mEntries[CHIP_CONFIG_MAX_FABRICS];
+};
+
 } // namespace chip
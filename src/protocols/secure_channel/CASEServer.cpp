@@ -50,6 +50,14 @@ CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager
     // Set up the group state provider that persists across all handshakes.
     GetSession().SetGroupDataProvider(mGroupDataProvider);
 
+#if CHIP_CONFIG_ENABLE_CASE_DESTINATION_ID_CACHE
+    if (mFabrics != nullptr)
+    {
+        ReturnErrorOnFailure(mDestinationIdCache.Init(mFabrics, mGroupDataProvider));
+        GetSession().SetDestinationIdCache(&mDestinationIdCache);
+    }
+#endif // CHIP_CONFIG_ENABLE_CASE_DESTINATION_ID_CACHE
+
     ChipLogProgress(Inet, "CASE Server enabling CASE session setups");
     mExchangeManager->RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1, this);
 
@@ -50,6 +50,11 @@ public:
 
         GetSession().Clear();
         mPinnedSecureSession.ClearValue();
+
+#if CHIP_CONFIG_ENABLE_CASE_DESTINATION_ID_CACHE
+        GetSession().SetDestinationIdCache(nullptr);
+        mDestinationIdCache.Shutdown();
+#endif // CHIP_CONFIG_ENABLE_CASE_DESTINATION_ID_CACHE
     }
 
     CHIP_ERROR ListenForSessionEstablishment(Messaging::ExchangeManager * exchangeManager, SessionManager * sessionManager,
@@ -96,6 +101,10 @@ private:
     FabricTable * mFabrics                              = nullptr;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
 
+#if CHIP_CONFIG_ENABLE_CASE_DESTINATION_ID_CACHE
+    CASEDestinationIdCache mDestinationIdCache;
+#endif // CHIP_CONFIG_ENABLE_CASE_DESTINATION_ID_CACHE
+
     CHIP_ERROR InitCASEHandshake(Messaging::ExchangeContext * ec);
 
     /*
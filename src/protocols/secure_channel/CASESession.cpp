@@ -1003,6 +1003,12 @@ CHIP_ERROR CASESession::FindLocalNodeFromDestinationId(const ByteSpan & destinat
     MATTER_TRACE_SCOPE("FindLocalNodeFromDestinationId", "CASESession");
     VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
+    if (mDestinationIdCache != nullptr)
+    {
+        MutableByteSpan ipkSpan(mIPK);
+        return mDestinationIdCache->FindLocalNode(destinationId, initiatorRandom, mFabricIndex, mLocalNodeId, ipkSpan);
+    }
+
     bool found = false;
     for (const FabricInfo & fabricInfo : *mFabricsTable)
     {
@@ -118,6 +118,16 @@ public:
      */
     void SetGroupDataProvider(Credentials::GroupDataProvider * groupDataProvider) { mGroupDataProvider = groupDataProvider; }
 
+    /**
+     * @brief Set the cache used to match the destination identifier of incoming Sigma1 messages
+     *
+     * The cache MUST be initialized with the fabric table and group data provider used by this session. When no cache is
+     * set, the IPKs of every fabric are read from the group data provider for every Sigma1.
+     *
+     * @param destinationIdCache - Pointer to the cache, or nullptr to not use one.
+     */
+    void SetDestinationIdCache(CASEDestinationIdCache * destinationIdCache) { mDestinationIdCache = destinationIdCache; }
+
     /**
      * @brief
      *   Derive a secure session from the established session. The API will return error if called before session is established.
@@ -302,6 +312,10 @@ protected:
      **/
     static CHIP_ERROR EncodeSigma2Resume(System::PacketBufferHandle & outMsg, EncodeSigma2ResumeInputs & inParam);
 
+    // On success, sets locally maching mFabricInfo in internal state to the entry matched by
+    // destinationId/initiatorRandom from processing of Sigma1, and sets mIpk to the right IPK.
+    CHIP_ERROR FindLocalNodeFromDestinationId(const ByteSpan & destinationId, const ByteSpan & initiatorRandom);
+
 private:
     friend class TestCASESession;
 
@@ -321,10 +335,6 @@ private:
 
     // On success, sets mIpk to the correct value for outgoing Sigma1 based on internal state
     CHIP_ERROR RecoverInitiatorIpk();
-    // On success, sets locally maching mFabricInfo in internal state to the entry matched by
-    // destinationId/initiatorRandom from processing of Sigma1, and sets mIpk to the right IPK.
-    CHIP_ERROR FindLocalNodeFromDestinationId(const ByteSpan & destinationId, const ByteSpan & initiatorRandom);
-
     CHIP_ERROR SendSigma1();
     CHIP_ERROR HandleSigma1_and_SendSigma2(System::PacketBufferHandle && msg);
     NextStep HandleSigma1(System::PacketBufferHandle && msg);
@@ -408,6 +418,7 @@ private:
     Crypto::P256ECDHDerivedSecret mSharedSecret;
     Credentials::ValidationContext mValidContext;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
+    CASEDestinationIdCache * mDestinationIdCache        = nullptr;
 
     uint8_t mMessageDigest[Crypto::kSHA256_Hash_Length];
     uint8_t mIPK[kIPKSize];
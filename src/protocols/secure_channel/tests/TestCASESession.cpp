@@ -28,7 +28,9 @@
 #include <credentials/CHIPCert.h>
 #include <credentials/GroupDataProviderImpl.h>
 #include <credentials/PersistentStorageOpCertStore.h>
+#include <credentials/TestOnlyLocalCertificateAuthority.h>
 #include <crypto/DefaultSessionKeystore.h>
+#include <crypto/PersistentStorageOperationalKeystore.h>
 #include <errno.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPSafeCasts.h>
@@ -46,6 +48,8 @@
 
 #include "credentials/tests/CHIPCert_test_vectors.h"
 
+#include <chrono>
+
 using namespace chip;
 using namespace Credentials;
 using namespace TestCerts;
@@ -73,6 +77,7 @@ public:
     using CASESession::EncodeSigma1;
     using CASESession::EncodeSigma2;
     using CASESession::EncodeSigma2Resume;
+    using CASESession::FindLocalNodeFromDestinationId;
     using CASESession::ParseSigma1;
 };
 
@@ -702,6 +707,158 @@ TEST_F(TestCASESession, DestinationIdTest)
     EXPECT_FALSE(destinationIdSpan.data_equal(ByteSpan(kExpectedDestinationIdFromSpec)));
 }
 
+// Adds a fabric with the given IDs, issued by `certAuthority`, and its IPKs.
+static CHIP_ERROR AddFabricWithIpk(FabricTable & fabricTable, GroupDataProvider & groupDataProvider,
+                                   TestOnlyLocalCertificateAuthority & certAuthority, FabricId fabricId, NodeId nodeId,
+                                   size_t numIpks, FabricIndex & outFabricIndex)
+{
+    uint8_t csrBuf[Crypto::kMIN_CSR_Buffer_Size];
+    MutableByteSpan csrSpan(csrBuf);
+    ReturnErrorOnFailure(fabricTable.AllocatePendingOperationalKey(NullOptional, csrSpan));
+    ReturnErrorOnFailure(certAuthority.GenerateNocChain(fabricId, nodeId, csrSpan).GetStatus());
+    ReturnErrorOnFailure(fabricTable.AddNewPendingTrustedRootCert(certAuthority.GetRcac()));
+    ReturnErrorOnFailure(fabricTable.AddNewPendingFabricWithOperationalKeystore(certAuthority.GetNoc(), ByteSpan(), 0xFFF1,
+                                                                                &outFabricIndex));
+    ReturnErrorOnFailure(fabricTable.CommitPendingFabricData());
+
+    const FabricInfo * fabricInfo = fabricTable.FindFabricWithIndex(outFabricIndex);
+    VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INTERNAL);
+    return InitTestIpk(groupDataProvider, *fabricInfo, numIpks);
+}
+
+// Computes the destination identifier of a Sigma1 sent to `fabricIndex` with its IPK at `ipkIndex`.
+static CHIP_ERROR ComputeDestinationId(FabricTable & fabricTable, GroupDataProvider & groupDataProvider, FabricIndex fabricIndex,
+                                       size_t ipkIndex, const ByteSpan & initiatorRandom, MutableByteSpan & outDestinationId,
+                                       MutableByteSpan & outIpk)
+{
+    const FabricInfo * fabricInfo = fabricTable.FindFabricWithIndex(fabricIndex);
+    VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INTERNAL);
+
+    Crypto::P256PublicKey rootPubKey;
+    ReturnErrorOnFailure(fabricTable.FetchRootPubkey(fabricIndex, rootPubKey));
+
+    GroupDataProvider::KeySet ipkKeySet;
+    ReturnErrorOnFailure(groupDataProvider.GetIpkKeySet(fabricIndex, ipkKeySet));
+    VerifyOrReturnError(ipkIndex < ipkKeySet.num_keys_used, CHIP_ERROR_INVALID_ARGUMENT);
+    ReturnErrorOnFailure(CopySpanToMutableSpan(ByteSpan(ipkKeySet.epoch_keys[ipkIndex].key), outIpk));
+
+    return GenerateCaseDestinationId(outIpk, initiatorRandom, ByteSpan(rootPubKey.ConstBytes(), rootPubKey.Length()),
+                                     fabricInfo->GetFabricId(), fabricInfo->GetNodeId(), outDestinationId);
+}
+
+TEST_F(TestCASESession, DestinationIdCacheTest)
+{
+    TestPersistentStorageDelegate storage;
+    PersistentStorageOperationalKeystore opKeyStore;
+    PersistentStorageOpCertStore opCertStore;
+    FabricTable fabricTable;
+    ASSERT_EQ(opKeyStore.Init(&storage), CHIP_NO_ERROR);
+    ASSERT_EQ(InitFabricTable(fabricTable, &storage, &opKeyStore, &opCertStore), CHIP_NO_ERROR);
+
+    Crypto::DefaultSessionKeystore sessionKeystore;
+    GroupDataProviderImpl groupDataProvider;
+    groupDataProvider.SetStorageDelegate(&storage);
+    groupDataProvider.SetSessionKeystore(&sessionKeystore);
+    ASSERT_EQ(groupDataProvider.Init(), CHIP_NO_ERROR);
+
+    TestOnlyLocalCertificateAuthority certAuthority;
+    ASSERT_TRUE(certAuthority.Init().IsSuccess());
+
+    uint8_t initiatorRandom[kSigmaParamRandomNumberSize];
+    ASSERT_EQ(Crypto::DRBG_get_bytes(initiatorRandom, sizeof(initiatorRandom)), CHIP_NO_ERROR);
+
+    CASEDestinationIdCache cache;
+    ASSERT_EQ(cache.Init(&fabricTable, &groupDataProvider), CHIP_NO_ERROR);
+
+    TestCASESecurePairingDelegate delegate;
+    CASESessionAccess session;
+    session.SetGroupDataProvider(&groupDataProvider);
+    ASSERT_EQ(session.PrepareForSessionEstablishment(GetSecureSessionManager(), &fabricTable, nullptr, nullptr, &delegate,
+                                                     ScopedNodeId(), NullOptional),
+              CHIP_NO_ERROR);
+
+    // Cost of matching a Sigma1 destined to the last fabric, with and without the cache, as fabrics are added.
+    constexpr size_t kFabricCount = 8;
+    constexpr int kIterations     = 100;
+    FabricIndex fabricIndex       = kUndefinedFabricIndex;
+    uint8_t destinationIdBuf[kSHA256_Hash_Length];
+    MutableByteSpan destinationId(destinationIdBuf);
+    uint8_t expectedIpkBuf[kIPKSize];
+    MutableByteSpan expectedIpk(expectedIpkBuf);
+    for (size_t i = 0; i < kFabricCount; i++)
+    {
+        ASSERT_EQ(AddFabricWithIpk(fabricTable, groupDataProvider, certAuthority, 1000 + i, 55, 3, fabricIndex), CHIP_NO_ERROR);
+        destinationId = MutableByteSpan(destinationIdBuf);
+        expectedIpk   = MutableByteSpan(expectedIpkBuf);
+        ASSERT_EQ(ComputeDestinationId(fabricTable, groupDataProvider, fabricIndex, 2, ByteSpan(initiatorRandom), destinationId,
+                                       expectedIpk),
+                  CHIP_NO_ERROR);
+
+        std::chrono::nanoseconds elapsed[2];
+        for (bool useCache : { false, true })
+        {
+            session.SetDestinationIdCache(useCache ? &cache : nullptr);
+            auto start = std::chrono::steady_clock::now();
+            for (int iteration = 0; iteration < kIterations; iteration++)
+            {
+                ASSERT_EQ(session.FindLocalNodeFromDestinationId(destinationId, ByteSpan(initiatorRandom)), CHIP_NO_ERROR);
+            }
+            elapsed[useCache] = std::chrono::steady_clock::now() - start;
+        }
+        ChipLogProgress(SecureChannel, "Sigma1 destination matching with %u fabrics: %u ns uncached, %u ns cached",
+                        static_cast<unsigned>(i + 1), static_cast<unsigned>(elapsed[false].count() / kIterations),
+                        static_cast<unsigned>(elapsed[true].count() / kIterations));
+    }
+
+    FabricIndex matchedFabricIndex = kUndefinedFabricIndex;
+    NodeId matchedNodeId           = kUndefinedNodeId;
+    uint8_t ipkBuf[kIPKSize];
+    MutableByteSpan ipk(ipkBuf);
+    EXPECT_EQ(cache.FindLocalNode(destinationId, ByteSpan(initiatorRandom), matchedFabricIndex, matchedNodeId, ipk), CHIP_NO_ERROR);
+    EXPECT_EQ(matchedFabricIndex, fabricIndex);
+    EXPECT_EQ(matchedNodeId, 55u);
+    EXPECT_TRUE(ipk.data_equal(expectedIpk));
+
+    // Wrong initiator random
+    uint8_t otherRandom[kSigmaParamRandomNumberSize] = { 0 };
+    EXPECT_EQ(cache.FindLocalNode(destinationId, ByteSpan(otherRandom), matchedFabricIndex, matchedNodeId, ipk),
+              CHIP_ERROR_KEY_NOT_FOUND);
+
+    // IPKs written without the fabric table noticing are picked up.
+    FabricIndex firstFabricIndex   = fabricTable.cbegin()->GetFabricIndex();
+    const FabricInfo * firstFabric = fabricTable.FindFabricWithIndex(firstFabricIndex);
+    ASSERT_NE(firstFabric, nullptr);
+    {
+        GroupDataProvider::KeySet ipkKeySet(GroupDataProvider::kIdentityProtectionKeySetId,
+                                            GroupDataProvider::SecurityPolicy::kTrustFirst, 1);
+        memset(ipkKeySet.epoch_keys[0].key, 0x55, sizeof(ipkKeySet.epoch_keys[0].key));
+        uint8_t compressedId[sizeof(uint64_t)];
+        MutableByteSpan compressedIdSpan(compressedId);
+        ASSERT_EQ(firstFabric->GetCompressedFabricIdBytes(compressedIdSpan), CHIP_NO_ERROR);
+        ASSERT_EQ(groupDataProvider.SetKeySet(firstFabricIndex, compressedIdSpan, ipkKeySet), CHIP_NO_ERROR);
+    }
+    destinationId = MutableByteSpan(destinationIdBuf);
+    expectedIpk   = MutableByteSpan(expectedIpkBuf);
+    ASSERT_EQ(ComputeDestinationId(fabricTable, groupDataProvider, firstFabricIndex, 0, ByteSpan(initiatorRandom), destinationId,
+                                   expectedIpk),
+              CHIP_NO_ERROR);
+    ipk = MutableByteSpan(ipkBuf);
+    EXPECT_EQ(cache.FindLocalNode(destinationId, ByteSpan(initiatorRandom), matchedFabricIndex, matchedNodeId, ipk), CHIP_NO_ERROR);
+    EXPECT_EQ(matchedFabricIndex, firstFabricIndex);
+    EXPECT_TRUE(ipk.data_equal(expectedIpk));
+
+    // Removed fabrics no longer match.
+    EXPECT_EQ(fabricTable.Delete(firstFabricIndex), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.FindLocalNode(destinationId, ByteSpan(initiatorRandom), matchedFabricIndex, matchedNodeId, ipk),
+              CHIP_ERROR_KEY_NOT_FOUND);
+
+    session.Clear();
+    cache.Shutdown();
+    fabricTable.Shutdown();
+    opCertStore.Finish();
+    opKeyStore.Finish();
+}
+
 template <typename Params>
 static CHIP_ERROR EncodeSigma1Helper(MutableByteSpan & buf)
 {
@@ -0,0 +1,223 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <tracing/binary/binary_tracing.h>
+
+#include <lib/address_resolve/TracingStructs.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+#include <tracing/metric_event.h>
+#include <transport/TracingStructs.h>
+
+#include <chrono>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+namespace {
+
+using namespace Format;
+
+constexpr auto kDrainInterval = std::chrono::milliseconds(10);
+
+uint64_t NodeIdOrZero(const Optional<NodeId> & nodeId)
+{
+    return nodeId.ValueOr(kUndefinedNodeId);
+}
+
+template <typename MessageTypeEnum>
+void MessageValues(MessageTypeEnum type, const PayloadHeader & payloadHeader, const PacketHeader & packetHeader,
+                   const ByteSpan & payload, uint64_t (&values)[kValueCount])
+{
+    values[0] = (static_cast<uint64_t>(payloadHeader.GetProtocolID().ToFullyQualifiedSpecForm()) << 32) |
+        (static_cast<uint64_t>(payloadHeader.GetMessageType()) << 16) |
+        (static_cast<uint64_t>(payloadHeader.GetExchangeFlags()) << 8) | static_cast<uint8_t>(type);
+    values[1] = (static_cast<uint64_t>(payloadHeader.GetExchangeID()) << 48) |
+        (static_cast<uint64_t>(packetHeader.GetSessionId()) << 32) | packetHeader.GetMessageCounter();
+    values[2] = payload.size();
+}
+
+} // namespace
+
+BinaryBackend::BinaryBackend() = default;
+
+BinaryBackend::~BinaryBackend()
+{
+    CloseFile();
+}
+
+CHIP_ERROR BinaryBackend::OpenFile(const char * path)
+{
+    CloseFile();
+
+    ReturnErrorOnFailure(mWriter.Open(path));
+    mRings.Start(mWriter, kDrainInterval);
+    return CHIP_NO_ERROR;
+}
+
+void BinaryBackend::CloseFile()
+{
+    VerifyOrReturn(mWriter.IsOpen());
+
+    mRings.Stop();
+    mWriter.Close();
+}
+
+void BinaryBackend::Append(RecordKind kind, const char * label, const char * group, uint64_t v0, uint64_t v1, uint64_t v2,
+                           uint64_t v3)
+{
+    mRings.Append([&](Record & record) {
+        record.timestampUs = System::SystemClock().GetMonotonicMicroseconds64().count();
+        record.label       = label;
+        record.group       = group;
+        record.values[0]   = v0;
+        record.values[1]   = v1;
+        record.values[2]   = v2;
+        record.values[3]   = v3;
+        record.kind        = kind;
+    });
+}
+
+CHIP_ERROR BinaryBackend::FileWriter::Open(const char * path)
+{
+    ReturnErrorOnFailure(OpenDrainOutputFile(mFile, path));
+
+    uint8_t header[kHeaderSize];
+    Encoding::LittleEndian::BufferWriter writer(header, sizeof(header));
+    writer.Put(kMagic, sizeof(kMagic)).Put16(kVersion).Put16(0);
+    mFile.write(reinterpret_cast<const char *>(header), static_cast<std::streamsize>(writer.Needed()));
+
+    mStrings.Clear();
+    return CHIP_NO_ERROR;
+}
+
+void BinaryBackend::FileWriter::OnRecord(uint32_t threadIndex, const Record & record)
+{
+    const uint32_t labelId = mStrings.GetId(mFile, record.label);
+    const uint32_t groupId = mStrings.GetId(mFile, record.group);
+
+    uint8_t entry[kEventSize];
+    Encoding::LittleEndian::BufferWriter writer(entry, sizeof(entry));
+    writer.Put8(to_underlying(EntryType::kEvent))
+        .Put8(to_underlying(record.kind))
+        .Put32(threadIndex)
+        .Put64(record.timestampUs)
+        .Put32(labelId)
+        .Put32(groupId);
+    for (uint64_t value : record.values)
+    {
+        writer.Put64(value);
+    }
+    mFile.write(reinterpret_cast<const char *>(entry), static_cast<std::streamsize>(writer.Needed()));
+}
+
+void BinaryBackend::FileWriter::OnDropped(uint32_t threadIndex, uint64_t dropped, uint64_t total)
+{
+    uint8_t entry[kDroppedSize];
+    Encoding::LittleEndian::BufferWriter writer(entry, sizeof(entry));
+    writer.Put8(to_underlying(EntryType::kDropped)).Put32(threadIndex).Put64(total);
+    mFile.write(reinterpret_cast<const char *>(entry), static_cast<std::streamsize>(writer.Needed()));
+}
+
+void BinaryBackend::TraceBegin(const char * label, const char * group)
+{
+    Append(RecordKind::kTraceBegin, label, group);
+}
+
+void BinaryBackend::TraceEnd(const char * label, const char * group)
+{
+    Append(RecordKind::kTraceEnd, label, group);
+}
+
+void BinaryBackend::TraceInstant(const char * label, const char * group)
+{
+    Append(RecordKind::kTraceInstant, label, group);
+}
+
+void BinaryBackend::TraceCounter(const char * label)
+{
+    Append(RecordKind::kTraceCounter, label, nullptr);
+}
+
+void BinaryBackend::LogMessageSend(MessageSendInfo & info)
+{
+    VerifyOrReturn(mRings.IsRunning());
+
+    uint64_t values[kValueCount];
+    MessageValues(info.messageType, *info.payloadHeader, *info.packetHeader, info.payload, values);
+    values[3] = NodeIdOrZero(info.packetHeader->GetDestinationNodeId());
+    Append(RecordKind::kMessageSend, nullptr, nullptr, values[0], values[1], values[2], values[3]);
+}
+
+void BinaryBackend::LogMessageReceived(MessageReceivedInfo & info)
+{
+    VerifyOrReturn(mRings.IsRunning());
+
+    uint64_t values[kValueCount];
+    MessageValues(info.messageType, *info.payloadHeader, *info.packetHeader, info.payload, values);
+    values[3] = NodeIdOrZero(info.packetHeader->GetSourceNodeId());
+    Append(RecordKind::kMessageReceived, nullptr, nullptr, values[0], values[1], values[2], values[3]);
+}
+
+void BinaryBackend::LogNodeLookup(NodeLookupInfo & info)
+{
+    const PeerId & peerId = info.request->GetPeerId();
+    Append(RecordKind::kNodeLookup, nullptr, nullptr, peerId.GetNodeId(), peerId.GetCompressedFabricId(),
+           info.request->GetMinLookupTime().count(), info.request->GetMaxLookupTime().count());
+}
+
+void BinaryBackend::LogNodeDiscovered(NodeDiscoveredInfo & info)
+{
+    Append(RecordKind::kNodeDiscovered, nullptr, nullptr, info.peerId->GetNodeId(), info.peerId->GetCompressedFabricId(),
+           static_cast<uint64_t>(info.type));
+}
+
+void BinaryBackend::LogNodeDiscoveryFailed(NodeDiscoveryFailedInfo & info)
+{
+    Append(RecordKind::kNodeDiscoveryFailed, nullptr, nullptr, info.peerId->GetNodeId(), info.peerId->GetCompressedFabricId(),
+           info.error.AsInteger());
+}
+
+void BinaryBackend::LogMetricEvent(const MetricEvent & event)
+{
+    using ValueType = MetricEvent::Value::Type;
+
+    uint64_t value = 0;
+    switch (event.ValueType())
+    {
+    case ValueType::kInt32:
+        value = static_cast<uint32_t>(event.ValueInt32());
+        break;
+    case ValueType::kUInt32:
+        value = event.ValueUInt32();
+        break;
+    case ValueType::kChipErrorCode:
+        value = event.ValueErrorCode();
+        break;
+    default:
+        break;
+    }
+
+    Append(RecordKind::kMetricEvent, event.key(), nullptr, static_cast<uint64_t>(event.type()),
+           static_cast<uint64_t>(event.ValueType()), value);
+}
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
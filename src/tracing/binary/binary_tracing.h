@@ -0,0 +1,173 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/TypeTraits.h>
+#include <lib/support/thread_rings/PerThreadRings.h>
+#include <tracing/backend.h>
+
+#include <fstream>
+
+namespace chip {
+namespace Tracing {
+namespace Binary {
+
+/// Layout of the files written by BinaryBackend. All integers are little endian.
+///
+/// The file starts with a header:
+///     - kMagic (4 bytes), kVersion (uint16), reserved (uint16)
+///
+/// followed by entries, each starting with an EntryType byte:
+///     - kString:  id (uint32), length (uint16), UTF-8 bytes. Defines a string
+///                 referenced by later events. Id 0 is the null string.
+///     - kEvent:   kind (uint8, a RecordKind), thread (uint32), timestamp in
+///                 microseconds (uint64), label id (uint32), group id (uint32),
+///                 4 values (uint64 each).
+///     - kDropped: thread (uint32), total records dropped by that thread (uint64).
+///
+/// The meaning of the values of an event depends on its kind, see RecordKind.
+namespace Format {
+
+inline constexpr char kMagic[4]       = { 'M', 'T', 'R', 'B' };
+inline constexpr uint16_t kVersion    = 1;
+inline constexpr size_t kHeaderSize   = 8;
+inline constexpr size_t kValueCount   = 4;
+inline constexpr size_t kEventSize    = 1 + 1 + 4 + 8 + 4 + 4 + 8 * kValueCount;
+inline constexpr size_t kDroppedSize  = 1 + 4 + 8;
+inline constexpr size_t kMaxStringLen = UINT16_MAX;
+
+enum class EntryType : uint8_t
+{
+    kString  = 1,
+    kEvent   = 2,
+    kDropped = 3,
+};
+
+enum class RecordKind : uint8_t
+{
+    kTraceBegin   = 1, // label, group
+    kTraceEnd     = 2, // label, group
+    kTraceInstant = 3, // label, group
+    kTraceCounter = 4, // label. Counts are computed when converting the trace.
+
+    // values[0]: protocol id << 32 | protocol message type << 16 | exchange flags << 8 | Outgoing/IncomingMessageType
+    // values[1]: exchange id << 48 | session id << 32 | message counter
+    // values[2]: payload size
+    // values[3]: destination node id (sent) or source node id (received), 0 if absent
+    kMessageSend     = 5,
+    kMessageReceived = 6,
+
+    kNodeLookup          = 7,  // values: node id, compressed fabric id, min lookup ms, max lookup ms
+    kNodeDiscovered      = 8,  // values: node id, compressed fabric id, DiscoveryInfoType
+    kNodeDiscoveryFailed = 9,  // values: node id, compressed fabric id, CHIP_ERROR code
+    kMetricEvent         = 10, // label is the metric key. values: MetricEvent::Type, MetricEvent::Value::Type, raw value
+};
+
+} // namespace Format
+
+/// A Backend that records events as fixed size binary records.
+///
+/// Events are stored without formatting into a lock-free ring owned by the thread
+/// emitting them, so tracing costs a few stores on the traced thread. A background
+/// thread drains the rings into a compact file (see Format), which
+/// `scripts/tools/binary_trace_to_json.py` converts to a Chrome/Perfetto trace.
+///
+/// When a ring is full, new events of that thread are dropped and counted rather than
+/// blocking the traced thread. Drop counts are written to the file.
+///
+/// Each thread that traces holds a ring of kRingCapacity * kRecordSize bytes (256 KB) until
+/// the backend is destroyed, see PerThreadRings.
+///
+/// Labels, groups and metric keys MUST be constant strings (as required by
+/// `tracing/README.md`): only their address is recorded until the file is written.
+///
+/// THREAD SAFETY:
+///    Trace and Log methods may be called from any thread. OpenFile and CloseFile
+///    must not be called concurrently with each other.
+class BinaryBackend : public ::chip::Tracing::Backend
+{
+public:
+    /// Number of records each thread can buffer before the drain thread catches up.
+    static constexpr uint32_t kRingCapacity = 4096;
+
+    /// Size of each buffered record.
+    static constexpr size_t kRecordSize = 64;
+
+    BinaryBackend();
+    ~BinaryBackend();
+
+    // Start tracing output to the given file
+    CHIP_ERROR OpenFile(const char * path);
+
+    // Stop tracing, writing out any buffered events, and close the output file
+    void CloseFile();
+
+    void TraceBegin(const char * label, const char * group) override;
+    void TraceEnd(const char * label, const char * group) override;
+    void TraceInstant(const char * label, const char * group) override;
+    void TraceCounter(const char * label) override;
+    void LogMessageSend(MessageSendInfo &) override;
+    void LogMessageReceived(MessageReceivedInfo &) override;
+    void LogNodeLookup(NodeLookupInfo &) override;
+    void LogNodeDiscovered(NodeDiscoveredInfo &) override;
+    void LogNodeDiscoveryFailed(NodeDiscoveryFailedInfo &) override;
+    void LogMetricEvent(const MetricEvent &) override;
+    void Close() override { CloseFile(); }
+
+private:
+    struct alignas(64) Record
+    {
+        uint64_t timestampUs;
+        const char * label;
+        const char * group;
+        uint64_t values[Format::kValueCount];
+        Format::RecordKind kind;
+    };
+
+    static_assert(sizeof(Record) == kRecordSize, "Ring memory is documented as kRingCapacity * kRecordSize");
+
+    using Rings = PerThreadRings<Record, kRingCapacity>;
+
+    /// Writes the drained records to the output file.
+    class FileWriter : public Rings::Delegate
+    {
+    public:
+        CHIP_ERROR Open(const char * path);
+        void Close() { mFile.close(); }
+        bool IsOpen() const { return mFile.is_open(); }
+
+        void OnRecord(uint32_t threadIndex, const Record & record) override;
+        void OnDropped(uint32_t threadIndex, uint64_t dropped, uint64_t total) override;
+        void OnDrained() override { mFile.flush(); }
+
+    private:
+        std::ofstream mFile;
+        DrainFileStrings mStrings{ to_underlying(Format::EntryType::kString) };
+    };
+
+    /// Appends a record to the ring of the calling thread. Returns without effect when no file is open.
+    void Append(Format::RecordKind kind, const char * label, const char * group, uint64_t v0 = 0, uint64_t v1 = 0,
+                uint64_t v2 = 0, uint64_t v3 = 0);
+
+    FileWriter mWriter; // only used by the drain thread while the file is open
+    Rings mRings;
+};
+
+} // namespace Binary
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,312 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <lib/support/BufferReader.h>
+#include <protocols/interaction_model/Constants.h>
+#include <tracing/binary/binary_tracing.h>
+#include <transport/TracingStructs.h>
+
+#include <string.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Tracing;
+using namespace chip::Tracing::Binary;
+
+namespace {
+
+struct Event
+{
+    Format::RecordKind kind;
+    uint32_t thread;
+    uint64_t timestampUs;
+    std::string label;
+    std::string group;
+    uint64_t values[Format::kValueCount];
+};
+
+// Entries of a trace file, with string ids resolved.
+struct Trace
+{
+    std::vector<Event> events;
+    std::map<uint32_t, uint64_t> dropped; // last total reported per thread
+    size_t stringCount = 0;
+};
+
+class TestBinaryTracing : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        strcpy(mPath, "/tmp/binary_trace_XXXXXX");
+        const int fd = mkstemp(mPath);
+        ASSERT_GE(fd, 0);
+        close(fd);
+    }
+
+    void TearDown() override
+    {
+        mBackend.CloseFile();
+        unlink(mPath);
+    }
+
+    void ReadTrace(Trace & trace)
+    {
+        std::ifstream file(mPath, std::ios_base::binary);
+        std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        Encoding::LittleEndian::Reader reader(data.data(), data.size());
+        uint8_t magic[4];
+        uint16_t version;
+        uint16_t reserved;
+        ASSERT_TRUE(reader.ReadBytes(magic, sizeof(magic)).IsSuccess());
+        ASSERT_TRUE(reader.Read16(&version).Read16(&reserved).IsSuccess());
+        EXPECT_EQ(memcmp(magic, Format::kMagic, sizeof(magic)), 0);
+        EXPECT_EQ(version, Format::kVersion);
+        EXPECT_EQ(reserved, 0);
+
+        // Id 0 is the null string, others are defined once before their first use
+        std::vector<std::string> strings(1);
+        while (reader.Remaining() > 0)
+        {
+            uint8_t type;
+            ASSERT_TRUE(reader.Read8(&type).IsSuccess());
+
+            if (type == to_underlying(Format::EntryType::kString))
+            {
+                uint32_t id;
+                uint16_t length;
+                ASSERT_TRUE(reader.Read32(&id).Read16(&length).IsSuccess());
+                ASSERT_EQ(id, strings.size());
+                std::string str(length, '\0');
+                ASSERT_TRUE(reader.ReadBytes(reinterpret_cast<uint8_t *>(str.data()), length).IsSuccess());
+                strings.push_back(str);
+            }
+            else if (type == to_underlying(Format::EntryType::kEvent))
+            {
+                Event event;
+                uint8_t kind;
+                uint32_t labelId, groupId;
+                ASSERT_TRUE(reader.Read8(&kind)
+                                .Read32(&event.thread)
+                                .Read64(&event.timestampUs)
+                                .Read32(&labelId)
+                                .Read32(&groupId)
+                                .IsSuccess());
+                for (uint64_t & value : event.values)
+                {
+                    ASSERT_TRUE(reader.Read64(&value).IsSuccess());
+                }
+                ASSERT_LT(labelId, strings.size());
+                ASSERT_LT(groupId, strings.size());
+                event.kind  = static_cast<Format::RecordKind>(kind);
+                event.label = strings[labelId];
+                event.group = strings[groupId];
+                trace.events.push_back(event);
+            }
+            else
+            {
+                ASSERT_EQ(type, to_underlying(Format::EntryType::kDropped));
+                uint32_t thread;
+                uint64_t dropped;
+                ASSERT_TRUE(reader.Read32(&thread).Read64(&dropped).IsSuccess());
+                EXPECT_GT(dropped, trace.dropped[thread]);
+                trace.dropped[thread] = dropped;
+            }
+        }
+        trace.stringCount = strings.size() - 1;
+    }
+
+    BinaryBackend mBackend;
+    char mPath[32];
+};
+
+TEST_F(TestBinaryTracing, TestFileLayout)
+{
+    ASSERT_EQ(mBackend.OpenFile(mPath), CHIP_NO_ERROR);
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(Protocols::InteractionModel::MsgType::ReadRequest).SetExchangeID(0x1234).SetInitiator(true);
+    PacketHeader packetHeader;
+    packetHeader.SetSessionId(0x5678).SetMessageCounter(0x9ABCDEF0).SetDestinationNodeId(static_cast<NodeId>(0x1122334455667788));
+    const uint8_t payload[17] = {};
+    MessageSendInfo info{ OutgoingMessageType::kSecureSession, &payloadHeader, &packetHeader, ByteSpan(payload) };
+
+    mBackend.TraceBegin("Read", "IM");
+    mBackend.LogMessageSend(info);
+    mBackend.TraceCounter("Reads");
+    mBackend.TraceInstant("Sent", "IM");
+    mBackend.TraceEnd("Read", "IM");
+    mBackend.CloseFile();
+
+    // Nothing is recorded once the file is closed
+    mBackend.TraceInstant("Closed", "IM");
+
+    Trace trace;
+    ASSERT_NO_FATAL_FAILURE(ReadTrace(trace));
+    ASSERT_EQ(trace.events.size(), 5u);
+    EXPECT_TRUE(trace.dropped.empty());
+    EXPECT_EQ(trace.stringCount, 4u); // Read, IM, Reads and Sent, the message has none
+
+    const Format::RecordKind kinds[] = { Format::RecordKind::kTraceBegin, Format::RecordKind::kMessageSend,
+                                         Format::RecordKind::kTraceCounter, Format::RecordKind::kTraceInstant,
+                                         Format::RecordKind::kTraceEnd };
+    for (size_t i = 0; i < trace.events.size(); i++)
+    {
+        EXPECT_EQ(trace.events[i].kind, kinds[i]);
+        EXPECT_EQ(trace.events[i].thread, trace.events[0].thread);
+        if (i > 0)
+        {
+            EXPECT_GE(trace.events[i].timestampUs, trace.events[i - 1].timestampUs);
+        }
+    }
+
+    EXPECT_EQ(trace.events[0].label, "Read");
+    EXPECT_EQ(trace.events[0].group, "IM");
+    EXPECT_EQ(trace.events[2].label, "Reads");
+    EXPECT_EQ(trace.events[2].group, "");
+    EXPECT_EQ(trace.events[3].label, "Sent");
+    EXPECT_EQ(trace.events[4].label, "Read");
+    EXPECT_EQ(trace.events[4].group, "IM");
+
+    const Event & message = trace.events[1];
+    EXPECT_EQ(message.label, "");
+    EXPECT_EQ(message.values[0],
+              (static_cast<uint64_t>(Protocols::InteractionModel::Id.ToFullyQualifiedSpecForm()) << 32) |
+                  (static_cast<uint64_t>(to_underlying(Protocols::InteractionModel::MsgType::ReadRequest)) << 16) |
+                  (static_cast<uint64_t>(payloadHeader.GetExchangeFlags()) << 8) |
+                  static_cast<uint8_t>(OutgoingMessageType::kSecureSession));
+    EXPECT_EQ(message.values[1], 0x123456789ABCDEF0u);
+    EXPECT_EQ(message.values[2], sizeof(payload));
+    EXPECT_EQ(message.values[3], 0x1122334455667788u);
+}
+
+TEST_F(TestBinaryTracing, TestDropsWhenRingFull)
+{
+    // Emitted much faster than the drain thread wakes up, so most of them cannot fit the ring
+    constexpr size_t kEventCount = BinaryBackend::kRingCapacity * 8;
+
+    ASSERT_EQ(mBackend.OpenFile(mPath), CHIP_NO_ERROR);
+    for (size_t i = 0; i < kEventCount; i++)
+    {
+        mBackend.TraceInstant("Tick", "Test");
+    }
+    mBackend.CloseFile();
+
+    Trace trace;
+    ASSERT_NO_FATAL_FAILURE(ReadTrace(trace));
+    ASSERT_FALSE(trace.events.empty());
+    ASSERT_EQ(trace.dropped.size(), 1u);
+
+    const uint32_t thread = trace.events[0].thread;
+    EXPECT_GT(trace.dropped[thread], 0u);
+    EXPECT_EQ(trace.events.size() + trace.dropped[thread], kEventCount);
+}
+
+TEST_F(TestBinaryTracing, TestRecordsSurviveDrain)
+{
+    ASSERT_EQ(mBackend.OpenFile(mPath), CHIP_NO_ERROR);
+
+    mBackend.TraceBegin("Outer", "Test");
+
+    // Let the drain thread write the first event out
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    std::thread other([this] {
+        mBackend.TraceBegin("Inner", "Test");
+        mBackend.TraceEnd("Inner", "Test");
+    });
+    other.join();
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(Protocols::InteractionModel::MsgType::ReportData).SetExchangeID(7);
+    PacketHeader packetHeader;
+    packetHeader.SetSourceNodeId(static_cast<NodeId>(42));
+    MessageReceivedInfo info{ IncomingMessageType::kSecureUnicast, &payloadHeader, &packetHeader, nullptr, nullptr, ByteSpan() };
+    mBackend.LogMessageReceived(info);
+    mBackend.TraceEnd("Outer", "Test");
+    mBackend.CloseFile();
+
+    Trace trace;
+    ASSERT_NO_FATAL_FAILURE(ReadTrace(trace));
+    ASSERT_EQ(trace.events.size(), 5u);
+    EXPECT_TRUE(trace.dropped.empty());
+
+    // Strings written before the drain are not defined again
+    EXPECT_EQ(trace.stringCount, 3u);
+
+    // Events are ordered per thread: the file holds Outer begin, then the drained rings in turn
+    std::map<uint32_t, std::vector<const Event *>> perThread;
+    for (const Event & event : trace.events)
+    {
+        perThread[event.thread].push_back(&event);
+    }
+    ASSERT_EQ(perThread.size(), 2u);
+
+    const std::vector<const Event *> main = perThread[trace.events[0].thread];
+    perThread.erase(trace.events[0].thread);
+    const std::vector<const Event *> inner = perThread.begin()->second;
+
+    ASSERT_EQ(main.size(), 3u);
+    EXPECT_EQ(main[0]->kind, Format::RecordKind::kTraceBegin);
+    EXPECT_EQ(main[0]->label, "Outer");
+    EXPECT_EQ(main[1]->kind, Format::RecordKind::kMessageReceived);
+    EXPECT_EQ(main[1]->values[3], 42u);
+    EXPECT_EQ(main[2]->kind, Format::RecordKind::kTraceEnd);
+    EXPECT_EQ(main[2]->label, "Outer");
+    EXPECT_EQ(main[2]->group, "Test");
+
+    ASSERT_EQ(inner.size(), 2u);
+    EXPECT_EQ(inner[0]->kind, Format::RecordKind::kTraceBegin);
+    EXPECT_EQ(inner[0]->label, "Inner");
+    EXPECT_EQ(inner[1]->kind, Format::RecordKind::kTraceEnd);
+    EXPECT_EQ(inner[1]->label, "Inner");
+    EXPECT_GE(inner[0]->timestampUs, main[0]->timestampUs);
+    EXPECT_LE(inner[1]->timestampUs, main[1]->timestampUs);
+}
+
+TEST_F(TestBinaryTracing, TestReopenStartsNewFile)
+{
+    ASSERT_EQ(mBackend.OpenFile(mPath), CHIP_NO_ERROR);
+    mBackend.TraceInstant("First", "Test");
+    mBackend.CloseFile();
+
+    ASSERT_EQ(mBackend.OpenFile(mPath), CHIP_NO_ERROR);
+    mBackend.TraceInstant("Second", "Test");
+    mBackend.CloseFile();
+
+    // The file is rewritten, with its own string definitions
+    Trace trace;
+    ASSERT_NO_FATAL_FAILURE(ReadTrace(trace));
+    ASSERT_EQ(trace.events.size(), 1u);
+    EXPECT_EQ(trace.events[0].label, "Second");
+    EXPECT_EQ(trace.events[0].group, "Test");
+    EXPECT_EQ(trace.stringCount, 2u);
+}
+
+} // namespace
@@ -0,0 +1,291 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <tracing/histogram/histogram_backend.h>
+
+#include <lib/address_resolve/TracingStructs.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <protocols/interaction_model/Constants.h>
+#include <tracing/metric_event.h>
+#include <transport/TracingStructs.h>
+
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+namespace {
+
+using Protocols::InteractionModel::MsgType;
+
+System::Clock::Milliseconds64 Now()
+{
+    return System::SystemClock().GetMonotonicMilliseconds64();
+}
+
+// Histogram timing the response to a message initiating an exchange, nullptr if it is not timed.
+const char * RequestHistogram(const PayloadHeader & header)
+{
+    VerifyOrReturnValue(header.IsInitiator() && header.HasProtocol(Protocols::InteractionModel::Id), nullptr);
+
+    switch (static_cast<MsgType>(header.GetMessageType()))
+    {
+    case MsgType::ReadRequest:
+        return kReadLatency;
+    case MsgType::SubscribeRequest:
+        return kSubscribeLatency;
+    case MsgType::WriteRequest:
+        return kWriteLatency;
+    case MsgType::InvokeCommandRequest:
+        return kInvokeLatency;
+    case MsgType::ReportData:
+        return kReportLatency;
+    default:
+        return nullptr;
+    }
+}
+
+} // namespace
+
+const LatencyHistogram * HistogramBackend::Find(const char * name) const
+{
+    const size_t count = mHistogramCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (strcmp(mHistograms[i].name, name) == 0)
+        {
+            return &mHistograms[i].histogram;
+        }
+    }
+    return nullptr;
+}
+
+HistogramBackend::NamedHistogram * HistogramBackend::FindOrCreate(const char * name)
+{
+    const size_t count = mHistogramCount.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < count; i++)
+    {
+        // Names are constant strings, usually shared, so most lookups succeed on the pointer comparison.
+        if (mHistograms[i].name == name || strcmp(mHistograms[i].name, name) == 0)
+        {
+            return &mHistograms[i];
+        }
+    }
+
+    if (count == kMaxHistograms)
+    {
+        ChipLogError(Automation, "No histogram left to record %s", name);
+        return nullptr;
+    }
+
+    mHistograms[count].name = name;
+    // Publishes the name to readers on other threads.
+    mHistogramCount.store(count + 1, std::memory_order_release);
+    return &mHistograms[count];
+}
+
+void HistogramBackend::RecordDuration(const char * name, System::Clock::Milliseconds64 since)
+{
+    NamedHistogram * entry = FindOrCreate(name);
+    VerifyOrReturn(entry != nullptr);
+
+    const uint64_t elapsed = (Now() - since).count();
+    entry->histogram.Record(static_cast<uint32_t>(std::min<uint64_t>(elapsed, UINT32_MAX)));
+}
+
+void HistogramBackend::LogMessageSend(MessageSendInfo & info)
+{
+    const char * histogram = RequestHistogram(*info.payloadHeader);
+    VerifyOrReturn(histogram != nullptr);
+
+    const uint16_t exchangeId = info.payloadHeader->GetExchangeID();
+    PendingExchange * slot    = nullptr;
+    for (auto & pending : mPendingExchanges)
+    {
+        if (pending.histogram != nullptr && pending.exchangeId == exchangeId)
+        {
+            // Still waiting for the response to an earlier message of this exchange.
+            return;
+        }
+        // Use a free slot, or else the oldest one: its response is most likely never coming.
+        if (slot == nullptr || (slot->histogram != nullptr && (pending.histogram == nullptr || pending.sendTime < slot->sendTime)))
+        {
+            slot = &pending;
+        }
+    }
+
+    slot->histogram  = histogram;
+    slot->exchangeId = exchangeId;
+    slot->sendTime   = Now();
+}
+
+void HistogramBackend::LogMessageReceived(MessageReceivedInfo & info)
+{
+    const PayloadHeader & header = *info.payloadHeader;
+    // Responses come from the exchange responder. Standalone acknowledgements are not IM messages.
+    VerifyOrReturn(!header.IsInitiator() && header.HasProtocol(Protocols::InteractionModel::Id));
+
+    for (auto & pending : mPendingExchanges)
+    {
+        if (pending.histogram != nullptr && pending.exchangeId == header.GetExchangeID())
+        {
+            RecordDuration(pending.histogram, pending.sendTime);
+            pending.histogram = nullptr;
+            return;
+        }
+    }
+}
+
+void HistogramBackend::LogNodeLookup(NodeLookupInfo & info)
+{
+    const PeerId & peerId = info.request->GetPeerId();
+    PendingLookup * slot  = nullptr;
+    for (auto & pending : mPendingLookups)
+    {
+        // A lookup of a node already being resolved is timed from the first request.
+        VerifyOrReturn(!pending.inUse || pending.peerId != peerId);
+        if (slot == nullptr || (slot->inUse && (!pending.inUse || pending.lookupTime < slot->lookupTime)))
+        {
+            slot = &pending;
+        }
+    }
+
+    slot->inUse      = true;
+    slot->peerId     = peerId;
+    slot->lookupTime = Now();
+}
+
+void HistogramBackend::LogNodeDiscovered(NodeDiscoveredInfo & info)
+{
+    VerifyOrReturn(info.type == DiscoveryInfoType::kResolutionDone);
+
+    for (auto & pending : mPendingLookups)
+    {
+        if (pending.inUse && pending.peerId == *info.peerId)
+        {
+            RecordDuration(kDnssdResolveLatency, pending.lookupTime);
+            pending.inUse = false;
+            return;
+        }
+    }
+}
+
+void HistogramBackend::LogNodeDiscoveryFailed(NodeDiscoveryFailedInfo & info)
+{
+    // Failures only end the lookup, their duration is mostly the lookup timeout.
+    for (auto & pending : mPendingLookups)
+    {
+        if (pending.inUse && pending.peerId == *info.peerId)
+        {
+            pending.inUse = false;
+            return;
+        }
+    }
+}
+
+void HistogramBackend::LogMetricEvent(const MetricEvent & event)
+{
+    using ValueType = MetricEvent::Value::Type;
+
+    switch (event.type())
+    {
+    case MetricEvent::Type::kBeginEvent: {
+        NamedHistogram * entry = FindOrCreate(event.key());
+        VerifyOrReturn(entry != nullptr);
+        entry->beginTime = Now();
+        entry->begun     = true;
+        break;
+    }
+    case MetricEvent::Type::kEndEvent: {
+        NamedHistogram * entry = FindOrCreate(event.key());
+        VerifyOrReturn(entry != nullptr && entry->begun);
+        entry->begun = false;
+        // Only successful operations are timed, failures often end on a timeout.
+        VerifyOrReturn(event.ValueType() != ValueType::kChipErrorCode || event.ValueErrorCode() == CHIP_NO_ERROR.AsInteger());
+        RecordDuration(event.key(), entry->beginTime);
+        break;
+    }
+    case MetricEvent::Type::kInstantEvent:
+        // Instant values are recorded as they are, when they are magnitudes such as counts.
+        if (event.ValueType() == ValueType::kUInt32)
+        {
+            NamedHistogram * entry = FindOrCreate(event.key());
+            VerifyOrReturn(entry != nullptr);
+            entry->histogram.Record(event.ValueUInt32());
+        }
+        else if (event.ValueType() == ValueType::kInt32 && event.ValueInt32() >= 0)
+        {
+            NamedHistogram * entry = FindOrCreate(event.key());
+            VerifyOrReturn(entry != nullptr);
+            entry->histogram.Record(static_cast<uint32_t>(event.ValueInt32()));
+        }
+        break;
+    }
+}
+
+CHIP_ERROR HistogramBackend::Dump(MutableCharSpan & buffer) const
+{
+    size_t written = 0;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    ForEachHistogram([&](const char * name, const LatencyHistogram & histogram) {
+        VerifyOrReturn(err == CHIP_NO_ERROR);
+
+        const size_t available = buffer.size() - written;
+        int length = snprintf(buffer.data() + written, available, "%s count=%u min=%u p50=%u p90=%u p99=%u max=%u\n", name,
+                              static_cast<unsigned>(histogram.Count()), static_cast<unsigned>(histogram.Min()),
+                              static_cast<unsigned>(histogram.ValueAtPercentile(50)),
+                              static_cast<unsigned>(histogram.ValueAtPercentile(90)),
+                              static_cast<unsigned>(histogram.ValueAtPercentile(99)), static_cast<unsigned>(histogram.Max()));
+        if (length < 0 || static_cast<size_t>(length) >= available)
+        {
+            err = CHIP_ERROR_BUFFER_TOO_SMALL;
+            return;
+        }
+        written += static_cast<size_t>(length);
+    });
+
+    buffer.reduce_size(written);
+    return err;
+}
+
+void HistogramBackend::LogSummary() const
+{
+    ForEachHistogram([](const char * name, const LatencyHistogram & histogram) {
+        ChipLogProgress(Automation, "%s count=%u min=%u p50=%u p90=%u p99=%u max=%u", name,
+                        static_cast<unsigned>(histogram.Count()), static_cast<unsigned>(histogram.Min()),
+                        static_cast<unsigned>(histogram.ValueAtPercentile(50)),
+                        static_cast<unsigned>(histogram.ValueAtPercentile(90)),
+                        static_cast<unsigned>(histogram.ValueAtPercentile(99)), static_cast<unsigned>(histogram.Max()));
+    });
+}
+
+void HistogramBackend::Reset()
+{
+    const size_t count = mHistogramCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; i++)
+    {
+        mHistograms[i].histogram.Reset();
+    }
+}
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
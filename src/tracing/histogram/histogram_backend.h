@@ -0,0 +1,137 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/PeerId.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+#include <tracing/backend.h>
+#include <tracing/histogram/latency_histogram.h>
+
+#include <atomic>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+/// Names of the histograms derived from messages and DNS-SD events, in addition to
+/// the ones named after metric keys.
+inline constexpr const char * kReadLatency         = "im_read";       // ReadRequest to first response
+inline constexpr const char * kSubscribeLatency    = "im_subscribe";  // SubscribeRequest to first response
+inline constexpr const char * kWriteLatency        = "im_write";      // WriteRequest to response
+inline constexpr const char * kInvokeLatency       = "im_invoke";     // InvokeRequest to response
+inline constexpr const char * kReportLatency       = "im_report";     // ReportData initiating an exchange to response
+inline constexpr const char * kDnssdResolveLatency = "dnssd_resolve"; // node lookup to resolution
+
+/// A Backend that aggregates latencies into histograms, cheap enough to stay registered in production.
+///
+/// Histograms are kept for:
+///   - Interaction Model requests sent by this node, and the reports it sends to subscribers,
+///     timed from the message send to the first message received on the same exchange.
+///   - DNS-SD node lookups, from lookup to resolution.
+///   - Metric events: durations between a begin and the following end of the same key (e.g.
+///     CASE session establishment), and the values of instant events (e.g. MRP retry counts).
+///
+/// All durations are in milliseconds. Histograms are created on first use, up to kMaxHistograms.
+///
+/// Begin/end metric events are paired per key, so overlapping operations of the same key are
+/// measured from the most recent begin.
+///
+/// THREAD SAFETY:
+///    Events are expected from the Matter thread. Histograms may be read (ForEachHistogram,
+///    Dump) from any thread.
+class HistogramBackend : public ::chip::Tracing::Backend
+{
+public:
+    static constexpr size_t kMaxHistograms       = 16;
+    static constexpr size_t kMaxPendingExchanges = 16;
+    static constexpr size_t kMaxPendingLookups   = 8;
+
+    HistogramBackend() = default;
+
+    void LogMessageSend(MessageSendInfo &) override;
+    void LogMessageReceived(MessageReceivedInfo &) override;
+    void LogNodeLookup(NodeLookupInfo &) override;
+    void LogNodeDiscovered(NodeDiscoveredInfo &) override;
+    void LogNodeDiscoveryFailed(NodeDiscoveryFailedInfo &) override;
+    void LogMetricEvent(const MetricEvent &) override;
+
+    /// Histogram of the given name, nullptr if nothing was recorded for it.
+    const LatencyHistogram * Find(const char * name) const;
+
+    /// Calls callback(name, histogram) for every histogram that has been created.
+    template <typename F>
+    void ForEachHistogram(F && callback) const
+    {
+        const size_t count = mHistogramCount.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; i++)
+        {
+            callback(mHistograms[i].name, mHistograms[i].histogram);
+        }
+    }
+
+    /// Writes a line per histogram ("name count=N min=A p50=B p90=C p99=D max=E") to buffer, e.g.
+    /// to serve as the contents of a diagnostic log. buffer is reduced to the written size.
+    ///
+    /// @return CHIP_ERROR_BUFFER_TOO_SMALL if buffer cannot hold every line (lines that fit are kept)
+    CHIP_ERROR Dump(MutableCharSpan & buffer) const;
+
+    /// Logs the summary of every histogram.
+    void LogSummary() const;
+
+    /// Clears all recorded values, keeping the histograms.
+    void Reset();
+
+private:
+    struct NamedHistogram
+    {
+        const char * name = nullptr;
+        LatencyHistogram histogram;
+
+        // Most recent begin of a metric event of this name
+        System::Clock::Milliseconds64 beginTime = System::Clock::kZero;
+        bool begun                              = false;
+    };
+
+    struct PendingExchange
+    {
+        const char * histogram = nullptr; // nullptr when unused
+        uint16_t exchangeId    = 0;
+        System::Clock::Milliseconds64 sendTime;
+    };
+
+    struct PendingLookup
+    {
+        bool inUse = false;
+        PeerId peerId;
+        System::Clock::Milliseconds64 lookupTime;
+    };
+
+    NamedHistogram * FindOrCreate(const char * name);
+    void RecordDuration(const char * name, System::Clock::Milliseconds64 since);
+
+    NamedHistogram mHistograms[kMaxHistograms];
+    std::atomic<size_t> mHistogramCount{ 0 };
+
+    PendingExchange mPendingExchanges[kMaxPendingExchanges];
+    PendingLookup mPendingLookups[kMaxPendingLookups];
+};
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,74 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <tracing/histogram/latency_histogram.h>
+
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+void LatencyHistogram::Record(uint32_t value)
+{
+    mBuckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    mCount.fetch_add(1, std::memory_order_relaxed);
+
+    uint32_t current = mMin.load(std::memory_order_relaxed);
+    while (value < current && !mMin.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+    current = mMax.load(std::memory_order_relaxed);
+    while (value > current && !mMax.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+void LatencyHistogram::Reset()
+{
+    for (auto & bucket : mBuckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    mCount.store(0, std::memory_order_relaxed);
+    mMin.store(UINT32_MAX, std::memory_order_relaxed);
+    mMax.store(0, std::memory_order_relaxed);
+}
+
+uint32_t LatencyHistogram::ValueAtPercentile(uint8_t percentile) const
+{
+    const uint32_t count = Count();
+    VerifyOrReturnValue(count > 0, 0);
+
+    // Rank of the value, rounded up so that percentile 100 is the largest value.
+    const uint64_t rank = (static_cast<uint64_t>(count) * std::min<uint8_t>(percentile, 100) + 99) / 100;
+    uint64_t seen       = 0;
+    for (size_t i = 0; i < kBucketCount; i++)
+    {
+        seen += BucketCount(i);
+        if (seen >= rank && seen > 0)
+        {
+            return std::min(BucketUpperBound(i), Max());
+        }
+    }
+    return Max();
+}
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,113 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+/// A histogram of 32-bit values with a bounded relative error, in the style of HDR histograms.
+///
+/// Values below kSubBucketCount have a bucket each. Above that, every power of two range is
+/// split into kSubBucketCount buckets, so a bucket spans at most 1/kSubBucketCount (12.5%) of
+/// its values.
+///
+/// Recording is a few relaxed atomic increments and never allocates, so a histogram may be
+/// updated on one thread while being read on another. Readers see each counter atomically,
+/// though not necessarily a consistent snapshot of all of them.
+class LatencyHistogram
+{
+public:
+    static constexpr unsigned kSubBucketBits = 3;
+    static constexpr size_t kSubBucketCount  = 1u << kSubBucketBits;
+    static constexpr size_t kBucketCount     = (32 - kSubBucketBits + 1) * kSubBucketCount;
+
+    /// Index of the bucket holding the given value.
+    static constexpr size_t BucketIndex(uint32_t value)
+    {
+        if (value < kSubBucketCount)
+        {
+            return value;
+        }
+        const unsigned shift = HighestBit(value) - kSubBucketBits;
+        return (shift + 1) * kSubBucketCount + ((value >> shift) & (kSubBucketCount - 1));
+    }
+
+    /// Smallest value of the given bucket.
+    static constexpr uint32_t BucketLowerBound(size_t index)
+    {
+        if (index < kSubBucketCount)
+        {
+            return static_cast<uint32_t>(index);
+        }
+        const unsigned shift = static_cast<unsigned>(index / kSubBucketCount) - 1;
+        return static_cast<uint32_t>((kSubBucketCount + index % kSubBucketCount) << shift);
+    }
+
+    /// Largest value of the given bucket.
+    static constexpr uint32_t BucketUpperBound(size_t index)
+    {
+        return index + 1 < kBucketCount ? BucketLowerBound(index + 1) - 1 : UINT32_MAX;
+    }
+
+    void Record(uint32_t value);
+
+    void Reset();
+
+    uint32_t Count() const { return mCount.load(std::memory_order_relaxed); }
+
+    /// Smallest recorded value, 0 if empty.
+    uint32_t Min() const { return Count() == 0 ? 0 : mMin.load(std::memory_order_relaxed); }
+
+    /// Largest recorded value, 0 if empty.
+    uint32_t Max() const { return mMax.load(std::memory_order_relaxed); }
+
+    uint32_t BucketCount(size_t index) const { return mBuckets[index].load(std::memory_order_relaxed); }
+
+    /// Value at or below which the given percentage of recorded values fall, reported as the
+    /// upper bound of the bucket holding it (capped at Max()). 0 if empty.
+    uint32_t ValueAtPercentile(uint8_t percentile) const;
+
+private:
+    // Index of the highest set bit of a non-zero value, as a branch per halving of the width.
+    static constexpr unsigned HighestBit(uint32_t value)
+    {
+        unsigned bit = 0;
+        for (unsigned width = 16; width > 0; width /= 2)
+        {
+            if (value >> width)
+            {
+                value >>= width;
+                bit += width;
+            }
+        }
+        return bit;
+    }
+
+    std::atomic<uint32_t> mBuckets[kBucketCount] = {};
+    std::atomic<uint32_t> mCount{ 0 };
+    std::atomic<uint32_t> mMin{ UINT32_MAX };
+    std::atomic<uint32_t> mMax{ 0 };
+};
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
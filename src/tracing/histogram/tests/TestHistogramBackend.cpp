@@ -0,0 +1,221 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <lib/address_resolve/TracingStructs.h>
+#include <lib/support/Span.h>
+#include <protocols/interaction_model/Constants.h>
+#include <system/SystemClock.h>
+#include <tracing/histogram/histogram_backend.h>
+#include <tracing/histogram/latency_histogram.h>
+#include <tracing/metric_event.h>
+#include <transport/TracingStructs.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Tracing;
+using namespace chip::Tracing::Histogram;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+constexpr MetricKey kTestMetric = "test_metric";
+
+class TestHistogramBackend : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        mRealClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&mMockClock);
+    }
+
+    void TearDown() override { System::Clock::Internal::SetSystemClockForTesting(mRealClock); }
+
+    void Send(Protocols::InteractionModel::MsgType type, uint16_t exchangeId)
+    {
+        PayloadHeader payloadHeader;
+        payloadHeader.SetMessageType(type).SetExchangeID(exchangeId).SetInitiator(true);
+        PacketHeader packetHeader;
+        MessageSendInfo info{ OutgoingMessageType::kSecureSession, &payloadHeader, &packetHeader, ByteSpan() };
+        mBackend.LogMessageSend(info);
+    }
+
+    void Receive(Protocols::InteractionModel::MsgType type, uint16_t exchangeId)
+    {
+        PayloadHeader payloadHeader;
+        payloadHeader.SetMessageType(type).SetExchangeID(exchangeId).SetInitiator(false);
+        PacketHeader packetHeader;
+        MessageReceivedInfo info{ IncomingMessageType::kSecureUnicast, &payloadHeader, &packetHeader, nullptr, nullptr,
+                                  ByteSpan() };
+        mBackend.LogMessageReceived(info);
+    }
+
+    System::Clock::ClockBase * mRealClock;
+    System::Clock::Internal::MockClock mMockClock;
+    HistogramBackend mBackend;
+};
+
+TEST(TestLatencyHistogram, BucketsBoundValues)
+{
+    size_t previousIndex = 0;
+    for (uint64_t value = 0; value <= UINT32_MAX; value = value * 5 / 4 + 1)
+    {
+        const uint32_t v     = static_cast<uint32_t>(value);
+        const size_t index   = LatencyHistogram::BucketIndex(v);
+        const uint32_t lower = LatencyHistogram::BucketLowerBound(index);
+        const uint32_t upper = LatencyHistogram::BucketUpperBound(index);
+
+        ASSERT_LT(index, LatencyHistogram::kBucketCount);
+        EXPECT_GE(index, previousIndex);
+        EXPECT_LE(lower, v);
+        EXPECT_GE(upper, v);
+        // Buckets span at most an eighth of their values.
+        EXPECT_LE(upper - lower, lower / LatencyHistogram::kSubBucketCount);
+        previousIndex = index;
+    }
+
+    EXPECT_EQ(LatencyHistogram::BucketIndex(UINT32_MAX), LatencyHistogram::kBucketCount - 1);
+    EXPECT_EQ(LatencyHistogram::BucketUpperBound(LatencyHistogram::kBucketCount - 1), UINT32_MAX);
+}
+
+TEST(TestLatencyHistogram, Percentiles)
+{
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.ValueAtPercentile(50), 0u);
+
+    for (uint32_t value = 1; value <= 1000; value++)
+    {
+        histogram.Record(value);
+    }
+
+    EXPECT_EQ(histogram.Count(), 1000u);
+    EXPECT_EQ(histogram.Min(), 1u);
+    EXPECT_EQ(histogram.Max(), 1000u);
+    EXPECT_GE(histogram.ValueAtPercentile(50), 500u);
+    EXPECT_LE(histogram.ValueAtPercentile(50), 500u + 500u / 8);
+    EXPECT_GE(histogram.ValueAtPercentile(99), 990u);
+    EXPECT_EQ(histogram.ValueAtPercentile(100), 1000u);
+
+    histogram.Reset();
+    EXPECT_EQ(histogram.Count(), 0u);
+    EXPECT_EQ(histogram.Min(), 0u);
+    EXPECT_EQ(histogram.Max(), 0u);
+}
+
+TEST_F(TestHistogramBackend, TimesMetricEvents)
+{
+    mBackend.LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, kTestMetric));
+    mMockClock.AdvanceMonotonic(250_ms);
+    mBackend.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kTestMetric, CHIP_NO_ERROR));
+
+    // Failed operations are not timed.
+    mBackend.LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, kTestMetric));
+    mMockClock.AdvanceMonotonic(30000_ms);
+    mBackend.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kTestMetric, CHIP_ERROR_TIMEOUT));
+
+    // An end without a begin is ignored.
+    mBackend.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kTestMetric, CHIP_NO_ERROR));
+
+    const LatencyHistogram * histogram = mBackend.Find(kTestMetric);
+    ASSERT_NE(histogram, nullptr);
+    EXPECT_EQ(histogram->Count(), 1u);
+    EXPECT_EQ(histogram->Max(), 250u);
+}
+
+TEST_F(TestHistogramBackend, RecordsInstantValues)
+{
+    mBackend.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kMetricDeviceRMPRetryCount, uint8_t(1)));
+    mBackend.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kMetricDeviceRMPRetryCount, uint8_t(3)));
+    // Negative values such as signal strengths are not magnitudes.
+    mBackend.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kMetricWiFiRSSI, int8_t(-60)));
+
+    const LatencyHistogram * histogram = mBackend.Find(kMetricDeviceRMPRetryCount);
+    ASSERT_NE(histogram, nullptr);
+    EXPECT_EQ(histogram->Count(), 2u);
+    EXPECT_EQ(histogram->Min(), 1u);
+    EXPECT_EQ(histogram->Max(), 3u);
+    EXPECT_EQ(mBackend.Find(kMetricWiFiRSSI), nullptr);
+}
+
+TEST_F(TestHistogramBackend, TimesInteractionsPerExchange)
+{
+    using Protocols::InteractionModel::MsgType;
+
+    Send(MsgType::ReadRequest, 1);
+    Send(MsgType::InvokeCommandRequest, 2);
+    mMockClock.AdvanceMonotonic(20_ms);
+    Receive(MsgType::InvokeCommandResponse, 2);
+    mMockClock.AdvanceMonotonic(20_ms);
+    Receive(MsgType::ReportData, 1);
+    // Later chunks of the same response are not timed.
+    Receive(MsgType::ReportData, 1);
+
+    const LatencyHistogram * read = mBackend.Find(kReadLatency);
+    ASSERT_NE(read, nullptr);
+    EXPECT_EQ(read->Count(), 1u);
+    EXPECT_EQ(read->Max(), 40u);
+
+    const LatencyHistogram * invoke = mBackend.Find(kInvokeLatency);
+    ASSERT_NE(invoke, nullptr);
+    EXPECT_EQ(invoke->Count(), 1u);
+    EXPECT_EQ(invoke->Max(), 20u);
+
+    EXPECT_EQ(mBackend.Find(kWriteLatency), nullptr);
+}
+
+TEST_F(TestHistogramBackend, TimesNodeLookups)
+{
+    const PeerId peer(0x1234, 0xABCD);
+    AddressResolve::NodeLookupRequest request(peer);
+    AddressResolve::ResolveResult result;
+
+    NodeLookupInfo lookup{ &request };
+    mBackend.LogNodeLookup(lookup);
+    mMockClock.AdvanceMonotonic(15_ms);
+
+    NodeDiscoveredInfo intermediate{ DiscoveryInfoType::kIntermediateResult, &peer, &result };
+    mBackend.LogNodeDiscovered(intermediate);
+    mMockClock.AdvanceMonotonic(5_ms);
+
+    NodeDiscoveredInfo done{ DiscoveryInfoType::kResolutionDone, &peer, &result };
+    mBackend.LogNodeDiscovered(done);
+
+    const LatencyHistogram * histogram = mBackend.Find(kDnssdResolveLatency);
+    ASSERT_NE(histogram, nullptr);
+    EXPECT_EQ(histogram->Count(), 1u);
+    EXPECT_EQ(histogram->Max(), 20u);
+}
+
+TEST_F(TestHistogramBackend, Dump)
+{
+    mBackend.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kTestMetric, uint32_t(7)));
+
+    char buffer[128];
+    MutableCharSpan output(buffer);
+    EXPECT_EQ(mBackend.Dump(output), CHIP_NO_ERROR);
+    EXPECT_TRUE(output.data_equal(CharSpan::fromCharString("test_metric count=1 min=7 p50=7 p90=7 p99=7 max=7\n")));
+
+    MutableCharSpan tooSmall(buffer, 10);
+    EXPECT_EQ(mBackend.Dump(tooSmall), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_TRUE(tooSmall.empty());
+}
+
+} // namespace
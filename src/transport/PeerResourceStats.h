@@ -0,0 +1,82 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * Resources used by the secure sessions with a peer.
+ *
+ * Counters are updated in place on the message paths of each secure session, and
+ * summed per peer by SessionManager::GetPeerResourceStats.
+ */
+struct PeerResourceStats
+{
+    uint32_t messagesSent     = 0; ///< Transmissions, including MRP retransmissions
+    uint32_t messagesReceived = 0; ///< Messages that were successfully decrypted, including duplicates
+    uint64_t bytesSent        = 0; ///< Encrypted size of the transmissions
+    uint64_t bytesReceived    = 0; ///< Encrypted size of the received messages
+    uint32_t retransmissions  = 0; ///< MRP retransmissions
+    uint32_t decryptFailures  = 0; ///< Messages addressed to a session of the peer that failed to decrypt
+
+    /// Most messages awaiting an MRP acknowledgement at once, each holding a packet buffer
+    uint16_t retransmitBuffersHighWater = 0;
+
+    void OnMessageSent(size_t length)
+    {
+        messagesSent++;
+        bytesSent += length;
+    }
+
+    void OnMessageReceived(size_t length)
+    {
+        messagesReceived++;
+        bytesReceived += length;
+    }
+
+    void OnRetransmitBuffersHeld(size_t count)
+    {
+        if (count > retransmitBuffersHighWater)
+        {
+            retransmitBuffersHighWater = static_cast<uint16_t>(std::min<size_t>(count, UINT16_MAX));
+        }
+    }
+
+    bool IsEmpty() const { return messagesSent == 0 && messagesReceived == 0 && decryptFailures == 0; }
+
+    /// Adds the counters of other, e.g. of another session with the same peer.
+    PeerResourceStats & Accumulate(const PeerResourceStats & other)
+    {
+        messagesSent += other.messagesSent;
+        messagesReceived += other.messagesReceived;
+        bytesSent += other.bytesSent;
+        bytesReceived += other.bytesReceived;
+        retransmissions += other.retransmissions;
+        decryptFailures += other.decryptFailures;
+        retransmitBuffersHighWater = std::max(retransmitBuffersHighWater, other.retransmitBuffersHighWater);
+        return *this;
+    }
+};
+
+} // namespace Transport
+} // namespace chip
@@ -26,6 +26,7 @@
 #include <lib/core/ReferenceCounted.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <transport/CryptoContext.h>
+#include <transport/PeerResourceStats.h>
 #include <transport/Session.h>
 #include <transport/SessionMessageCounter.h>
 #include <transport/raw/PeerAddress.h>
@@ -274,6 +275,30 @@ public:
 
     SessionMessageCounter & GetSessionMessageCounter() { return mSessionMessageCounter; }
 
+    PeerResourceStats & GetResourceStats() { return mResourceStats; }
+    const PeerResourceStats & GetResourceStats() const { return mResourceStats; }
+
+    // The fabric of the session was removed while the session is still open, e.g. to send the
+    // RemoveFabric response. Its resource usage is no longer reported nor retained, as the
+    // fabric index may be reused by a new fabric.
+    void DetachResourceStats() { mResourceStatsDetached = true; }
+    bool IsResourceStatsDetached() const { return mResourceStatsDetached; }
+
+    // A message sent on this session is held for MRP retransmission until it is acknowledged.
+    void OnRetransmitBufferHeld()
+    {
+        mRetransmitBuffersHeld++;
+        mResourceStats.OnRetransmitBuffersHeld(mRetransmitBuffersHeld);
+    }
+    void OnRetransmitBufferReleased()
+    {
+        if (mRetransmitBuffersHeld > 0)
+        {
+            mRetransmitBuffersHeld--;
+        }
+    }
+    size_t GetRetransmitBuffersHeld() const { return mRetransmitBuffersHeld; }
+
     // This should be a private API, only meant to be called by SecureSessionTable
     // Session holders to this session may shift to the target session regarding SessionDelegate::GetNewSessionHandlingPolicy.
     // It requires that the target sessoin is also a CASE session, having the same peer and CATs as this session.
@@ -353,6 +378,9 @@ private:
     SessionParameters mRemoteSessionParams;
     CryptoContext mCryptoContext;
     SessionMessageCounter mSessionMessageCounter;
+    PeerResourceStats mResourceStats;
+    bool mResourceStatsDetached   = false;
+    size_t mRetransmitBuffersHeld = 0;
 };
 
 } // namespace Transport
@@ -337,6 +337,88 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
     });
 }
 
+void SecureSessionTable::ReleaseSession(SecureSession * session)
+{
+    if (!session->GetResourceStats().IsEmpty() && !session->IsResourceStatsDetached())
+    {
+        RetainResourceStats(*session);
+    }
+    mEntries.ReleaseObject(session);
+}
+
+void SecureSessionTable::RetainResourceStats(const SecureSession & session)
+{
+    const ScopedNodeId peer          = session.GetPeer();
+    RetainedResourceStats * retained = nullptr;
+    for (auto & entry : mRetainedStats)
+    {
+        if (entry.generation != 0 && entry.peer == peer)
+        {
+            retained = &entry;
+            break;
+        }
+        // Otherwise forget the peer whose counters were updated the least recently.
+        if (retained == nullptr || (retained->generation != 0 && entry.generation < retained->generation))
+        {
+            retained = &entry;
+        }
+    }
+
+    if (retained->generation == 0 || retained->peer != peer)
+    {
+        retained->peer  = peer;
+        retained->stats = PeerResourceStats();
+    }
+    retained->stats.Accumulate(session.GetResourceStats());
+    retained->generation = ++mRetainedStatsGeneration;
+}
+
+bool SecureSessionTable::HasSessionWithPeer(const ScopedNodeId & peer)
+{
+    return mEntries.ForEachActiveObject([&](SecureSession * session) {
+        return session->GetPeer() == peer ? Loop::Break : Loop::Continue;
+    }) == Loop::Break;
+}
+
+PeerResourceStats SecureSessionTable::GetPeerResourceStats(const ScopedNodeId & peer)
+{
+    PeerResourceStats stats;
+    mEntries.ForEachActiveObject([&](SecureSession * session) {
+        if (session->GetPeer() == peer && !session->IsResourceStatsDetached())
+        {
+            stats.Accumulate(session->GetResourceStats());
+        }
+        return Loop::Continue;
+    });
+    for (auto & retained : mRetainedStats)
+    {
+        if (retained.generation != 0 && retained.peer == peer)
+        {
+            stats.Accumulate(retained.stats);
+            break;
+        }
+    }
+    return stats;
+}
+
+void SecureSessionTable::ClearFabricResourceStats(FabricIndex fabricIndex)
+{
+    mEntries.ForEachActiveObject([&](SecureSession * session) {
+        if (session->GetFabricIndex() == fabricIndex)
+        {
+            session->DetachResourceStats();
+        }
+        return Loop::Continue;
+    });
+    for (auto & retained : mRetainedStats)
+    {
+        if (retained.peer.GetFabricIndex() == fabricIndex)
+        {
+            retained.generation = 0;
+        }
+    }
+}
+
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
     SecureSession * result = nullptr;
@@ -76,7 +76,10 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    /**
+     * Release a session, retaining its resource usage counters under its peer.
+     */
+    void ReleaseSession(SecureSession * session);
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -84,6 +87,51 @@ public:
         return mEntries.ForEachActiveObject(std::forward<Function>(function));
     }
 
+    /**
+     * Get the resource usage of a peer: the sum of the counters of its sessions, and of its
+     * released sessions if its counters are still retained.
+     */
+    PeerResourceStats GetPeerResourceStats(const ScopedNodeId & peer);
+
+    /**
+     * Call function(const ScopedNodeId & peer, const PeerResourceStats & stats) once for every
+     * peer with a non empty resource usage, until it returns Loop::Break.
+     */
+    template <typename Function>
+    Loop ForEachPeerResourceStats(Function && function)
+    {
+        Loop result = mEntries.ForEachActiveObject([&](SecureSession * session) {
+            // Peers are visited at their first session in pool order.
+            const ScopedNodeId peer = session->GetPeer();
+            bool visited            = false;
+            mEntries.ForEachActiveObject([&](SecureSession * other) {
+                visited = other != session && other->GetPeer() == peer;
+                return (visited || other == session) ? Loop::Break : Loop::Continue;
+            });
+            VerifyOrReturnValue(!visited, Loop::Continue);
+
+            PeerResourceStats stats = GetPeerResourceStats(peer);
+            return stats.IsEmpty() ? Loop::Continue : function(peer, stats);
+        });
+        VerifyOrReturnValue(result != Loop::Break, result);
+
+        for (auto & retained : mRetainedStats)
+        {
+            if (retained.generation == 0 || HasSessionWithPeer(retained.peer))
+            {
+                continue;
+            }
+            VerifyOrReturnValue(function(retained.peer, retained.stats) != Loop::Break, Loop::Break);
+        }
+        return Loop::Finish;
+    }
+
+    /**
+     * Forget the resource usage counters of the peers of a removed fabric, retained ones as well
+     * as those of its sessions still open, so they are not reported for a fabric reusing the index.
+     */
+    void ClearFabricResourceStats(FabricIndex fabricIndex);
+
     /**
      * Get a secure session given its session ID.
      *
@@ -256,9 +304,23 @@ private:
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+    // Resource usage counters of a peer, folded in from its released sessions.
+    struct RetainedResourceStats
+    {
+        ScopedNodeId peer;
+        PeerResourceStats stats;
+        uint32_t generation = 0; // when the entry was last updated, 0 if unused
+    };
+
+    void RetainResourceStats(const SecureSession & session);
+    bool HasSessionWithPeer(const ScopedNodeId & peer);
+
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
 
+    RetainedResourceStats mRetainedStats[CHIP_CONFIG_PEER_RESOURCE_STATS_RETAINED_PEERS];
+    uint32_t mRetainedStatsGeneration = 0;
+
     size_t GetMaxSessionTableSize() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
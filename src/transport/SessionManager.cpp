@@ -192,6 +192,20 @@ void SessionManager::Shutdown()
 void SessionManager::FabricRemoved(FabricIndex fabricIndex)
 {
     gGroupPeerTable->FabricRemoved(fabricIndex);
+    mSecureSessions.ClearFabricResourceStats(fabricIndex);
+}
+
+Transport::PeerResourceStats SessionManager::GetFabricResourceStats(FabricIndex fabricIndex)
+{
+    Transport::PeerResourceStats stats;
+    mSecureSessions.ForEachPeerResourceStats([&](const ScopedNodeId & peer, const Transport::PeerResourceStats & peerStats) {
+        if (peer.GetFabricIndex() == fabricIndex)
+        {
+            stats.Accumulate(peerStats);
+        }
+        return Loop::Continue;
+    });
+    return stats;
 }
 
 CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, PayloadHeader & payloadHeader,
@@ -422,6 +436,7 @@ CHIP_ERROR SessionManager::SendPreparedMessage(const SessionHandle & sessionHand
 
     Transport::PeerAddress multicastAddress; // Only used for the group case
     const Transport::PeerAddress * destination;
+    SecureSession * secureSession = nullptr; // Only used for the unicast secure case
 
     switch (sessionHandle->GetSessionType())
     {
@@ -442,7 +457,8 @@ CHIP_ERROR SessionManager::SendPreparedMessage(const SessionHandle & sessionHand
         // This marks any connection where we send data to as 'active'
         secure->MarkActive();
 
-        destination = &secure->GetPeerAddress();
+        destination   = &secure->GetPeerAddress();
+        secureSession = secure;
     }
     break;
     case Transport::Session::SessionType::kUnauthenticated: {
@@ -512,6 +528,11 @@ CHIP_ERROR SessionManager::SendPreparedMessage(const SessionHandle & sessionHand
 
 #endif // CHIP_SYSTEM_CONFIG_MULTICAST_HOMING
 
+    if (secureSession != nullptr)
+    {
+        secureSession->GetResourceStats().OnMessageSent(msgBuf->DataLength());
+    }
+
     if (mTransportMgr != nullptr)
     {
         CHIP_ERROR err = mTransportMgr->SendMessage(*destination, std::move(msgBuf));
@@ -997,11 +1018,14 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), packetHeader.GetMessageCounter(),
                               secureSession->GetSecureSessionType() == SecureSession::Type::kCASE ? secureSession->GetPeerNodeId()
                                                                                                   : kUndefinedNodeId);
+    const size_t encryptedLength = packetHeader.EncodeSizeBytes() + msg->TotalLength();
     if (SecureMessageCodec::Decrypt(secureSession->GetCryptoContext(), nonce, payloadHeader, packetHeader, msg) != CHIP_NO_ERROR)
     {
         ChipLogError(Inet, "Secure transport received message, but failed to decode/authenticate it, discarding");
+        secureSession->GetResourceStats().decryptFailures++;
         return;
     }
+    secureSession->GetResourceStats().OnMessageReceived(encryptedLength);
 
     err =
         secureSession->GetSessionMessageCounter().GetPeerMessageCounter().VerifyEncryptedUnicast(packetHeader.GetMessageCounter());
@@ -415,6 +415,36 @@ public:
      */
     void UpdateAllSessionsPeerAddress(const ScopedNodeId & node, const Transport::PeerAddress & addr);
 
+    /**
+     * @brief
+     *   Return the resources used by the secure sessions with a peer: messages and bytes exchanged,
+     *   MRP retransmissions, decryption failures and the retransmission buffers held at once.
+     *
+     *   Counters of released sessions are kept for up to CHIP_CONFIG_PEER_RESOURCE_STATS_RETAINED_PEERS
+     *   peers, and forgotten when their fabric is removed.
+     */
+    Transport::PeerResourceStats GetPeerResourceStats(const ScopedNodeId & peer)
+    {
+        return mSecureSessions.GetPeerResourceStats(peer);
+    }
+
+    /**
+     * @brief
+     *   Return the sum of the resources used by the peers on a fabric.
+     */
+    Transport::PeerResourceStats GetFabricResourceStats(FabricIndex fabricIndex);
+
+    /**
+     * @brief
+     *   Call function(const ScopedNodeId & peer, const Transport::PeerResourceStats & stats) for every
+     *   peer with a known resource usage, until it returns Loop::Break.
+     */
+    template <typename Function>
+    Loop ForEachPeerResourceStats(Function && function)
+    {
+        return mSecureSessions.ForEachPeerResourceStats(std::forward<Function>(function));
+    }
+
     /**
      * @brief
      *   Return the System Layer pointer used by current SessionManager.
@@ -51,8 +51,117 @@ constexpr uint32_t kMaxTCPMessageSize =
 
 constexpr int kListenBacklogSize = 2;
 
+// Fibonacci hashing multiplier, spreads the bits of keys over the whole word.
+constexpr size_t kHashMultiplier = static_cast<size_t>(0x9E3779B97F4A7C15ull);
+
 } // namespace
 
+ActiveTCPConnectionIndex::ActiveTCPConnectionIndex(ActiveTCPConnectionState ** endPointBuckets,
+                                                   ActiveTCPConnectionState ** peerBuckets, size_t bucketCount) :
+    mEndPointBuckets(endPointBuckets),
+    mPeerBuckets(peerBuckets), mMask(bucketCount - 1)
+{
+    VerifyOrDie(bucketCount > 0 && (bucketCount & mMask) == 0);
+}
+
+size_t ActiveTCPConnectionIndex::HashEndPoint(const Inet::TCPEndPoint * endPoint)
+{
+    return (reinterpret_cast<uintptr_t>(endPoint) * kHashMultiplier) >> (std::numeric_limits<size_t>::digits / 2);
+}
+
+size_t ActiveTCPConnectionIndex::HashPeer(const Inet::IPAddress & address, uint16_t port)
+{
+    size_t hash = port;
+    for (uint32_t word : address.Addr)
+    {
+        hash = (hash ^ word) * kHashMultiplier;
+    }
+    return hash >> (std::numeric_limits<size_t>::digits / 2);
+}
+
+size_t ActiveTCPConnectionIndex::HashConnectionEndPoint(const ActiveTCPConnectionState * connection)
+{
+    return HashEndPoint(connection->mEndPoint);
+}
+
+size_t ActiveTCPConnectionIndex::HashConnectionPeer(const ActiveTCPConnectionState * connection)
+{
+    return HashPeer(connection->mPeerAddr.GetIPAddress(), connection->mPeerAddr.GetPort());
+}
+
+void ActiveTCPConnectionIndex::Add(ActiveTCPConnectionState * connection)
+{
+    Insert(mEndPointBuckets, HashConnectionEndPoint, connection);
+    Insert(mPeerBuckets, HashConnectionPeer, connection);
+}
+
+void ActiveTCPConnectionIndex::Remove(ActiveTCPConnectionState * connection)
+{
+    Erase(mEndPointBuckets, HashConnectionEndPoint, connection);
+    Erase(mPeerBuckets, HashConnectionPeer, connection);
+}
+
+void ActiveTCPConnectionIndex::Insert(ActiveTCPConnectionState ** buckets, Hash hash, ActiveTCPConnectionState * connection)
+{
+    // There are more buckets than connections, a free one is always found.
+    size_t i = hash(connection) & mMask;
+    while (buckets[i] != nullptr)
+    {
+        VerifyOrDie(buckets[i] != connection);
+        i = (i + 1) & mMask;
+    }
+    buckets[i] = connection;
+}
+
+void ActiveTCPConnectionIndex::Erase(ActiveTCPConnectionState ** buckets, Hash hash, const ActiveTCPConnectionState * connection)
+{
+    size_t i = hash(connection) & mMask;
+    while (buckets[i] != connection)
+    {
+        VerifyOrReturn(buckets[i] != nullptr);
+        i = (i + 1) & mMask;
+    }
+    buckets[i] = nullptr;
+
+    // Shift back the following connections that cannot be found anymore across the emptied bucket.
+    for (size_t j = (i + 1) & mMask; buckets[j] != nullptr; j = (j + 1) & mMask)
+    {
+        const size_t home = hash(buckets[j]) & mMask;
+        // Distances from the home bucket of the connection, modulo the bucket count.
+        if (((j - home) & mMask) >= ((j - i) & mMask))
+        {
+            buckets[i] = buckets[j];
+            buckets[j] = nullptr;
+            i          = j;
+        }
+    }
+}
+
+ActiveTCPConnectionState * ActiveTCPConnectionIndex::Find(const Inet::TCPEndPoint * endPoint) const
+{
+    for (size_t i = HashEndPoint(endPoint) & mMask; mEndPointBuckets[i] != nullptr; i = (i + 1) & mMask)
+    {
+        if (mEndPointBuckets[i]->mEndPoint == endPoint)
+        {
+            return mEndPointBuckets[i];
+        }
+    }
+    return nullptr;
+}
+
+ActiveTCPConnectionState * ActiveTCPConnectionIndex::FindConnected(const Inet::IPAddress & address, uint16_t port) const
+{
+    for (size_t i = HashPeer(address, port) & mMask; mPeerBuckets[i] != nullptr; i = (i + 1) & mMask)
+    {
+        ActiveTCPConnectionState * connection = mPeerBuckets[i];
+        if (connection->IsConnected() && connection->mPeerAddr.GetIPAddress() == address && connection->mPeerAddr.GetPort() == port)
+        {
+            return connection;
+        }
+    }
+    return nullptr;
+}
+
 TCPBase::~TCPBase()
 {
     // Call Close to free the listening socket and close all active connections.
@@ -146,36 +255,14 @@ ActiveTCPConnectionState * TCPBase::FindActiveConnection(const PeerAddress & add
         return nullptr;
     }
 
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
-    {
-        if (!mActiveConnections[i].IsConnected())
-        {
-            continue;
-        }
-        Inet::IPAddress addr;
-        uint16_t port;
-        mActiveConnections[i].mEndPoint->GetPeerInfo(&addr, &port);
-
-        if ((addr == address.GetIPAddress()) && (port == address.GetPort()))
-        {
-            return &mActiveConnections[i];
-        }
-    }
-
-    return nullptr;
+    return mConnectionIndex.FindConnected(address.GetIPAddress(), address.GetPort());
 }
 
 // Find the ActiveTCPConnectionState for a given TCPEndPoint
 ActiveTCPConnectionState * TCPBase::FindActiveConnection(const Inet::TCPEndPoint * endPoint)
 {
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
-    {
-        if (mActiveConnections[i].mEndPoint == endPoint && mActiveConnections[i].IsConnected())
-        {
-            return &mActiveConnections[i];
-        }
-    }
-    return nullptr;
+    ActiveTCPConnectionState * connection = FindInUseConnection(endPoint);
+    return (connection != nullptr && connection->IsConnected()) ? connection : nullptr;
 }
 
 ActiveTCPConnectionState * TCPBase::FindInUseConnection(const Inet::TCPEndPoint * endPoint)
@@ -185,14 +272,7 @@ ActiveTCPConnectionState * TCPBase::FindInUseConnection(const Inet::TCPEndPoint
         return nullptr;
     }
 
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
-    {
-        if (mActiveConnections[i].mEndPoint == endPoint)
-        {
-            return &mActiveConnections[i];
-        }
-    }
-    return nullptr;
+    return mConnectionIndex.Find(endPoint);
 }
 
 CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf)
@@ -247,11 +327,20 @@ CHIP_ERROR TCPBase::StartConnect(const PeerAddress & addr, Transport::AppTCPConn
     activeConnection->Init(endPoint, addr);
     activeConnection->mAppState        = appState;
     activeConnection->mConnectionState = TCPState::kConnecting;
+    mConnectionIndex.Add(activeConnection);
     // Set the return value of the peer connection state to the allocated
     // connection.
     *outPeerConnState = activeConnection;
 
-    ReturnErrorOnFailure(endPoint->Connect(addr.GetIPAddress(), addr.GetPort(), addr.GetInterface()));
+    CHIP_ERROR err = endPoint->Connect(addr.GetIPAddress(), addr.GetPort(), addr.GetInterface());
+    if (err != CHIP_NO_ERROR)
+    {
+        // The endpoint is freed by its holder, leave the connection unused.
+        mConnectionIndex.Remove(activeConnection);
+        activeConnection->Init(nullptr, PeerAddress::Uninitialized());
+        *outPeerConnState = nullptr;
+        return err;
+    }
 
     mUsedEndPointCount++;
 
@@ -360,36 +449,78 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
     // We enter with `state->mReceived` containing at least one full message, perhaps in a chain.
     // `state->mReceived->Start()` currently points to the message data.
     // On exit, `state->mReceived` will have had `messageSize` bytes consumed, no matter what.
-    System::PacketBufferHandle message;
     MessageTransportContext msgContext;
     msgContext.conn = state;
 
-    if (state->mReceived->DataLength() == messageSize)
+    System::PacketBufferHandle message = TakeMessage(state, messageSize);
+    if (message.IsNull())
+    {
+        state->mReceived.Consume(messageSize);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    HandleMessageReceived(peerAddress, std::move(message), &msgContext);
+    return CHIP_NO_ERROR;
+}
+
+System::PacketBufferHandle TCPBase::TakeMessage(ActiveTCPConnectionState * state, size_t messageSize)
+{
+    // We never hand upstream a buffer that is also referenced elsewhere, or that holds data beyond the message: upper layers
+    // may manipulate the buffer in ways that would affect that data, e.g. chaining it elsewhere or reusing space beyond the
+    // current message.
+    const size_t headLength = state->mReceived->DataLength();
+
+    if (headLength == messageSize)
     {
         // In this case, the head packet buffer contains exactly the message.
         // This is common because typical messages fit in a network packet, and are delivered as such.
         // Peel off the head to pass upstream, which effectively consumes it from `state->mReceived`.
-        message = state->mReceived.PopHead();
+        return state->mReceived.PopHead();
     }
-    else
+
+    if (state->mReceived.HasSoleOwnership())
     {
-        // The message is either longer or shorter than the head buffer.
-        // In either case, copy the message to a fresh linear buffer to pass upstream. We always copy, rather than provide
-        // a shared reference to the current buffer, in case upper layers manipulate the buffer in ways that would affect
-        // our use, e.g. chaining it elsewhere or reusing space beyond the current message.
-        message = System::PacketBufferHandle::New(messageSize, 0);
-        if (message.IsNull())
+        if (headLength > messageSize && headLength - messageSize < messageSize)
         {
-            return CHIP_ERROR_NO_MEMORY;
+            // The head buffer also holds the start of the next messages, which is shorter than this message: move that data
+            // to a buffer of its own rather than copying the message.
+            System::PacketBufferHandle rest =
+                System::PacketBufferHandle::NewWithData(state->mReceived->Start() + messageSize, headLength - messageSize);
+            if (!rest.IsNull())
+            {
+                System::PacketBufferHandle message = state->mReceived.PopHead();
+                message->SetDataLength(messageSize);
+                if (!state->mReceived.IsNull())
+                {
+                    rest->AddToEnd(std::move(state->mReceived));
+                }
+                state->mReceived = std::move(rest);
+                return message;
+            }
+        }
+        else if (headLength < messageSize && messageSize - headLength <= state->mReceived->AvailableDataLength())
+        {
+            // The message continues in the next buffers and fits in the head buffer: append the rest of the message to it.
+            System::PacketBufferHandle message = state->mReceived.PopHead();
+            CHIP_ERROR err                     = state->mReceived->Read(message->Start() + headLength, messageSize - headLength);
+            VerifyOrDie(err == CHIP_NO_ERROR);
+            state->mReceived.Consume(messageSize - headLength);
+            message->SetDataLength(messageSize);
+            return message;
         }
-        CHIP_ERROR err = state->mReceived->Read(message->Start(), messageSize);
-        state->mReceived.Consume(messageSize);
-        ReturnErrorOnFailure(err);
-        message->SetDataLength(messageSize);
     }
 
-    HandleMessageReceived(peerAddress, std::move(message), &msgContext);
-    return CHIP_NO_ERROR;
+    // Otherwise copy the message to a fresh linear buffer to pass upstream.
+    System::PacketBufferHandle message = System::PacketBufferHandle::New(messageSize, 0);
+    if (message.IsNull())
+    {
+        return message;
+    }
+    CHIP_ERROR err = state->mReceived->Read(message->Start(), messageSize);
+    VerifyOrDie(err == CHIP_NO_ERROR);
+    state->mReceived.Consume(messageSize);
+    message->SetDataLength(messageSize);
+    return message;
 }
 
 void TCPBase::CloseConnectionInternal(ActiveTCPConnectionState * connection, CHIP_ERROR err, SuppressCallback suppressCallback)
@@ -433,6 +564,7 @@ void TCPBase::CloseConnectionInternal(ActiveTCPConnectionState * connection, CHI
             }
         }
 
+        mConnectionIndex.Remove(connection);
         connection->Free();
         mUsedEndPointCount--;
     }
@@ -528,7 +660,17 @@ void TCPBase::HandleTCPEndPointConnectComplete(Inet::TCPEndPoint * endPoint, CHI
     else
     {
         ChipLogError(Inet, "Connection establishment with %s encountered an error: %" CHIP_ERROR_FORMAT, addrStr, err.Format());
-        endPoint->Free();
+        activeConnection = tcp->FindInUseConnection(endPoint);
+        if (activeConnection != nullptr)
+        {
+            // Freeing the connection frees its endpoint.
+            tcp->mConnectionIndex.Remove(activeConnection);
+            activeConnection->Free();
+        }
+        else
+        {
+            endPoint->Free();
+        }
         tcp->mUsedEndPointCount--;
     }
 }
@@ -580,6 +722,7 @@ void TCPBase::HandleIncomingConnection(Inet::TCPEndPoint * listenEndPoint, Inet:
 
         // Update state for the active connection
         activeConnection->Init(endPoint, addr);
+        tcp->mConnectionIndex.Add(activeConnection);
         tcp->mUsedEndPointCount++;
         activeConnection->mConnectionState = TCPState::kConnected;
 
@@ -628,26 +771,18 @@ CHIP_ERROR TCPBase::TCPConnect(const PeerAddress & address, Transport::AppTCPCon
 
 void TCPBase::TCPDisconnect(const PeerAddress & address)
 {
-    // Closes an existing connection
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    // Closes existing connections.
+    // Ignoring the InterfaceID in the check as it may not have been provided in
+    // the PeerAddress during connection establishment. The IPAddress and Port
+    // are the necessary and sufficient set of parameters for searching
+    // through the connections.
+    ActiveTCPConnectionState * connection;
+    while ((connection = FindActiveConnection(address)) != nullptr)
     {
-        if (mActiveConnections[i].IsConnected())
-        {
-            const Inet::IPAddress & ipAddress = mActiveConnections[i].mPeerAddr.GetIPAddress();
-            uint16_t port                     = mActiveConnections[i].mPeerAddr.GetPort();
-
-            // Ignoring the InterfaceID in the check as it may not have been provided in
-            // the PeerAddress during connection establishment. The IPAddress and Port
-            // are the necessary and sufficient set of parameters for searching
-            // through the connections.
-            if (ipAddress == address.GetIPAddress() && port == address.GetPort() && address.GetTransportType() == Type::kTcp)
-            {
-                // NOTE: this leaves the socket in TIME_WAIT.
-                // Calling Abort() would clean it since SO_LINGER would be set to 0,
-                // however this seems not to be useful.
-                CloseConnectionInternal(&mActiveConnections[i], CHIP_NO_ERROR, SuppressCallback::Yes);
-            }
-        }
+        // NOTE: this leaves the socket in TIME_WAIT.
+        // Calling Abort() would clean it since SO_LINGER would be set to 0,
+        // however this seems not to be useful.
+        CloseConnectionInternal(connection, CHIP_NO_ERROR, SuppressCallback::Yes);
     }
 }
 
@@ -99,6 +99,56 @@ struct PendingPacket
     System::PacketBufferHandle mPacketBuffer; // what data needs to be sent
 };
 
+/**
+ * Hash index of the in-use connections of a TCP transport, by endpoint and by peer address, so that received data and sent
+ * messages find their connection without going through all connections.
+ *
+ * Uses open addressing with linear probing over caller-provided buckets, which must be a power of two at least twice as many
+ * as the connections.
+ */
+class ActiveTCPConnectionIndex
+{
+public:
+    /// Number of buckets to index the given number of connections.
+    static constexpr size_t BucketCount(size_t connectionCount)
+    {
+        size_t count = 2;
+        while (count < 2 * connectionCount)
+        {
+            count *= 2;
+        }
+        return count;
+    }
+
+    ActiveTCPConnectionIndex(ActiveTCPConnectionState ** endPointBuckets, ActiveTCPConnectionState ** peerBuckets,
+                             size_t bucketCount);
+
+    /// Index a connection by its current endpoint and peer address.
+    void Add(ActiveTCPConnectionState * connection);
+    /// Remove a connection, before its endpoint or peer address change.
+    void Remove(ActiveTCPConnectionState * connection);
+
+    /// Find the connection using the given endpoint, or nullptr.
+    ActiveTCPConnectionState * Find(const Inet::TCPEndPoint * endPoint) const;
+    /// Find a connected connection to the given IP address and port, or nullptr.
+    ActiveTCPConnectionState * FindConnected(const Inet::IPAddress & address, uint16_t port) const;
+
+private:
+    using Hash = size_t (*)(const ActiveTCPConnectionState * connection);
+
+    static size_t HashEndPoint(const Inet::TCPEndPoint * endPoint);
+    static size_t HashPeer(const Inet::IPAddress & address, uint16_t port);
+    static size_t HashConnectionEndPoint(const ActiveTCPConnectionState * connection);
+    static size_t HashConnectionPeer(const ActiveTCPConnectionState * connection);
+
+    void Insert(ActiveTCPConnectionState ** buckets, Hash hash, ActiveTCPConnectionState * connection);
+    void Erase(ActiveTCPConnectionState ** buckets, Hash hash, const ActiveTCPConnectionState * connection);
+
+    ActiveTCPConnectionState ** mEndPointBuckets;
+    ActiveTCPConnectionState ** mPeerBuckets;
+    const size_t mMask;
+};
+
 /** Implements a transport using TCP. */
 class DLL_EXPORT TCPBase : public Base
 {
@@ -118,10 +168,13 @@ protected:
 
 public:
     using PendingPacketPoolType = PoolInterface<PendingPacket, const PeerAddress &, System::PacketBufferHandle &&>;
-    TCPBase(ActiveTCPConnectionState * activeConnectionsBuffer, size_t bufferSize, PendingPacketPoolType & packetBuffers) :
-        mActiveConnections(activeConnectionsBuffer), mActiveConnectionsSize(bufferSize), mPendingPackets(packetBuffers)
+    TCPBase(ActiveTCPConnectionState * activeConnectionsBuffer, size_t bufferSize, ActiveTCPConnectionState ** indexBuckets,
+            size_t indexBucketCount, PendingPacketPoolType & packetBuffers) :
+        mActiveConnections(activeConnectionsBuffer),
+        mActiveConnectionsSize(bufferSize), mConnectionIndex(indexBuckets, indexBuckets + indexBucketCount, indexBucketCount),
+        mPendingPackets(packetBuffers)
     {
-        // activeConnectionsBuffer must be initialized by the caller.
+        // activeConnectionsBuffer must be initialized by the caller, indexBuckets must hold 2 * indexBucketCount null pointers.
     }
     ~TCPBase() override;
 
@@ -260,6 +313,16 @@ private:
      */
     CHIP_ERROR ProcessSingleMessage(const PeerAddress & peerAddress, ActiveTCPConnectionState * state, size_t messageSize);
 
+    /**
+     * Take a message of the specified size from the head of the received buffers of a connection, reusing the head buffer
+     * rather than copying the message when possible.
+     *
+     * @return the message in a single buffer, or a null handle if no memory is available. In that case, the received
+     *         buffers are left unchanged and the caller is responsible for consuming the message: ProcessSingleMessage
+     *         drops it.
+     */
+    static System::PacketBufferHandle TakeMessage(ActiveTCPConnectionState * state, size_t messageSize);
+
     /**
      * Initiate a connection to the given peer. On connection completion,
      * HandleTCPConnectComplete callback would be called.
@@ -312,6 +375,7 @@ private:
     // Currently active connections
     ActiveTCPConnectionState * mActiveConnections;
     const size_t mActiveConnectionsSize;
+    ActiveTCPConnectionIndex mConnectionIndex;
 
     // Data to be sent when connections succeed
     PendingPacketPoolType & mPendingPackets;
@@ -321,7 +385,7 @@ template <size_t kActiveConnectionsSize, size_t kPendingPacketSize>
 class TCP : public TCPBase
 {
 public:
-    TCP() : TCPBase(mConnectionsBuffer, kActiveConnectionsSize, mPendingPackets)
+    TCP() : TCPBase(mConnectionsBuffer, kActiveConnectionsSize, mIndexBuckets, kIndexBucketCount, mPendingPackets)
     {
         for (size_t i = 0; i < kActiveConnectionsSize; ++i)
         {
@@ -332,7 +396,10 @@ public:
     ~TCP() override { mPendingPackets.ReleaseAll(); }
 
 private:
+    static constexpr size_t kIndexBucketCount = ActiveTCPConnectionIndex::BucketCount(kActiveConnectionsSize);
+
     ActiveTCPConnectionState mConnectionsBuffer[kActiveConnectionsSize];
+    ActiveTCPConnectionState * mIndexBuckets[2 * kIndexBucketCount] = {};
     PoolImpl<PendingPacket, kPendingPacketSize, ObjectPoolMem::kInline, PendingPacketPoolType::Interface> mPendingPackets;
 };
 
@@ -202,6 +202,29 @@ public:
         SetCallback(nullptr);
     }
 
+    void MultipleMessagesTest(TCPImpl & tcp, const IPAddress & addr, int count)
+    {
+        PacketHeader header;
+        header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter);
+
+        SetCallback([](const uint8_t * message, size_t length, int, void * data) { return memcmp(message, data, length); },
+                    const_cast<void *>(static_cast<const void *>(PAYLOAD)));
+
+        // Messages sent back to back are received coalesced in the TCP stream.
+        for (int i = 0; i < count; i++)
+        {
+            chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+            ASSERT_FALSE(buffer.IsNull());
+            EXPECT_EQ(header.EncodeBeforeData(buffer), CHIP_NO_ERROR);
+            EXPECT_EQ(tcp.SendMessage(Transport::PeerAddress::TCP(addr, gChipTCPPort), std::move(buffer)), CHIP_NO_ERROR);
+        }
+
+        mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(5), [this, count]() { return mReceiveHandlerCallCount >= count; });
+        EXPECT_EQ(mReceiveHandlerCallCount, count);
+
+        SetCallback(nullptr);
+    }
+
     void ConnectTest(TCPImpl & tcp, const IPAddress & addr)
     {
         // Connect and wait for seeing active connection
@@ -487,6 +510,17 @@ protected:
         gMockTransportMgrDelegate.DisconnectTest(tcp, addr);
     }
 
+    void MultipleMessagesTest(const IPAddress & addr)
+    {
+        TCPImpl tcp;
+
+        MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+        gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr);
+        gMockTransportMgrDelegate.ConnectTest(tcp, addr);
+        gMockTransportMgrDelegate.MultipleMessagesTest(tcp, addr, 200);
+        gMockTransportMgrDelegate.DisconnectTest(tcp, addr);
+    }
+
     void HandleConnCompleteTest(const IPAddress & addr)
     {
         TCPImpl tcp;
@@ -596,6 +630,13 @@ TEST_F(TestTCP, ConnectSendMessageThenCloseTest6)
     ConnectSendMessageThenCloseTest(addr);
 }
 
+TEST_F(TestTCP, MultipleMessagesTest6)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    MultipleMessagesTest(addr);
+}
+
 TEST_F(TestTCP, HandleConnCompleteCalledTest6)
 {
     IPAddress addr;
@@ -695,6 +736,40 @@ TEST_F(TestTCP, CheckProcessReceivedBuffer)
     EXPECT_EQ(err, CHIP_NO_ERROR);
     EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 2);
 
+    // Test two messages in a single packet buffer, the second one shorter or longer than the first one.
+    for (const uint32_t secondSize : { 132u, 1032u })
+    {
+        gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+        EXPECT_TRUE(testData[0].Init((const uint32_t[]){ 531, 0 }));
+        const uint32_t secondSizes[] = { secondSize, 0 };
+        EXPECT_TRUE(testData[1].Init(secondSizes));
+        System::PacketBufferHandle buffer =
+            System::PacketBufferHandle::New(testData[0].mTotalLength + testData[1].mTotalLength, 0 /* reserve */);
+        ASSERT_FALSE(buffer.IsNull());
+        memcpy(buffer->Start(), testData[0].mPayload, testData[0].mTotalLength);
+        memcpy(buffer->Start() + testData[0].mTotalLength, testData[1].mPayload, testData[1].mTotalLength);
+        buffer->SetDataLength(testData[0].mTotalLength + testData[1].mTotalLength);
+        err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, std::move(buffer));
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 2);
+    }
+
+    // Test a message continuing in a second buffer, with room for the rest of the message in the first one.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    EXPECT_TRUE(testData[0].Init((const uint32_t[]){ 151, 0 }));
+    {
+        constexpr size_t kFirstLength     = 100;
+        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(testData[0].mTotalLength, 0 /* reserve */);
+        ASSERT_FALSE(buffer.IsNull());
+        memcpy(buffer->Start(), testData[0].mPayload, kFirstLength);
+        buffer->SetDataLength(kFirstLength);
+        buffer->AddToEnd(System::PacketBufferHandle::NewWithData(testData[0].mPayload + kFirstLength,
+                                                                 testData[0].mTotalLength - kFirstLength));
+        err = TestAccess::ProcessReceivedBuffer(tcp, lEndPoint, lPeerAddress, std::move(buffer));
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+        EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 1);
+    }
+
     // Test a single packet buffer that is larger than
     // kMaxSizeWithoutReserve but less than CHIP_CONFIG_MAX_LARGE_PAYLOAD_SIZE_BYTES.
     gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
@@ -43,6 +43,9 @@ public:
     static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
 
     void ValidateSessionSorting();
+    void ValidateResourceStats();
+    void ValidateResourceStatsRetention();
+    void ValidateResourceStatsAfterFabricRemoval();
 
 private:
     struct SessionParameters
@@ -452,6 +455,136 @@ void TestSecureSessionTable::ValidateSessionSorting()
     }
 }
 
+void TestSecureSessionTable::ValidateResourceStats()
+{
+    const ScopedNodeId peer1(2, kFabric1);
+    const ScopedNodeId peer2(3, kFabric1);
+    const ScopedNodeId peer3(2, kFabric2);
+
+    std::vector<SessionParameters> sessionParamList = {
+        { peer1, System::Clock::Timestamp(1), SecureSession::State::kActive },
+        { peer1, System::Clock::Timestamp(2), SecureSession::State::kActive },
+        { peer2, System::Clock::Timestamp(3), SecureSession::State::kActive },
+        { peer3, System::Clock::Timestamp(4), SecureSession::State::kActive },
+    };
+    CreateSessionTable(sessionParamList);
+
+    auto stats = [&](size_t index) -> PeerResourceStats & {
+        return mSessionList[index]->mSessionHolder->AsSecureSession()->GetResourceStats();
+    };
+    stats(0).OnMessageSent(100);
+    stats(0).OnRetransmitBuffersHeld(2);
+    stats(0).retransmissions++;
+    stats(1).OnMessageReceived(40);
+    stats(1).OnRetransmitBuffersHeld(1);
+    stats(2).decryptFailures++;
+
+    // Sessions with the same peer are summed.
+    PeerResourceStats peer1Stats = mSessionTable->GetPeerResourceStats(peer1);
+    EXPECT_EQ(peer1Stats.messagesSent, 1u);
+    EXPECT_EQ(peer1Stats.bytesSent, 100u);
+    EXPECT_EQ(peer1Stats.messagesReceived, 1u);
+    EXPECT_EQ(peer1Stats.bytesReceived, 40u);
+    EXPECT_EQ(peer1Stats.retransmissions, 1u);
+    EXPECT_EQ(peer1Stats.retransmitBuffersHighWater, 2u);
+    EXPECT_EQ(mSessionTable->GetPeerResourceStats(peer2).decryptFailures, 1u);
+    EXPECT_TRUE(mSessionTable->GetPeerResourceStats(peer3).IsEmpty());
+
+    // Released sessions are still accounted for.
+    mSessionList[0]->mSessionHolder->AsSecureSession()->MarkForEviction();
+    EXPECT_TRUE(mSessionList[0]->mSessionReleased);
+    peer1Stats = mSessionTable->GetPeerResourceStats(peer1);
+    EXPECT_EQ(peer1Stats.messagesSent, 1u);
+    EXPECT_EQ(peer1Stats.messagesReceived, 1u);
+
+    mSessionList[1]->mSessionHolder->AsSecureSession()->MarkForEviction();
+    EXPECT_EQ(mSessionTable->GetPeerResourceStats(peer1).bytesSent, 100u);
+
+    // Every peer with a resource usage is visited once.
+    size_t visited = 0;
+    mSessionTable->ForEachPeerResourceStats([&](const ScopedNodeId & peer, const PeerResourceStats & peerStats) {
+        visited++;
+        EXPECT_TRUE(peer == peer1 || peer == peer2);
+        EXPECT_FALSE(peerStats.IsEmpty());
+        return Loop::Continue;
+    });
+    EXPECT_EQ(visited, 2u);
+
+    // Removing a fabric forgets the usage of its peers, including those with sessions still open.
+    stats(3).decryptFailures++;
+    mSessionTable->ClearFabricResourceStats(kFabric1);
+    EXPECT_TRUE(mSessionTable->GetPeerResourceStats(peer1).IsEmpty());
+    EXPECT_TRUE(mSessionTable->GetPeerResourceStats(peer2).IsEmpty());
+    EXPECT_EQ(mSessionTable->GetPeerResourceStats(peer3).decryptFailures, 1u);
+}
+
+void TestSecureSessionTable::ValidateResourceStatsAfterFabricRemoval()
+{
+    const ScopedNodeId peer(2, kFabric1);
+
+    std::vector<SessionParameters> sessionParamList = {
+        { peer, System::Clock::Timestamp(1), SecureSession::State::kActive },
+    };
+    CreateSessionTable(sessionParamList);
+    SecureSession * oldSession = mSessionList[0]->mSessionHolder->AsSecureSession();
+    oldSession->GetResourceStats().OnMessageSent(100);
+
+    // The fabric is removed while its session stays open to send the RemoveFabric response.
+    mSessionTable->ClearFabricResourceStats(kFabric1);
+    oldSession->GetResourceStats().OnMessageSent(20);
+    EXPECT_TRUE(mSessionTable->GetPeerResourceStats(peer).IsEmpty());
+
+    oldSession->MarkForEviction();
+    EXPECT_TRUE(mSessionList[0]->mSessionReleased);
+    EXPECT_TRUE(mSessionTable->GetPeerResourceStats(peer).IsEmpty());
+
+    // A new fabric gets the same index: only the usage of its own sessions is reported.
+    auto session = mSessionTable->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    ASSERT_TRUE(session.HasValue());
+    SecureSession * newSession = session.Value()->AsSecureSession();
+    newSession->Activate(ScopedNodeId(1, kFabric1), peer, CATValues(), 1,
+                         ReliableMessageProtocolConfig(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                                       System::Clock::Milliseconds16(0)));
+    EXPECT_TRUE(mSessionTable->GetPeerResourceStats(peer).IsEmpty());
+
+    size_t visited = 0;
+    mSessionTable->ForEachPeerResourceStats([&](const ScopedNodeId &, const PeerResourceStats &) {
+        visited++;
+        return Loop::Continue;
+    });
+    EXPECT_EQ(visited, 0u);
+
+    newSession->GetResourceStats().OnMessageSent(10);
+    EXPECT_EQ(mSessionTable->GetPeerResourceStats(peer).messagesSent, 1u);
+    EXPECT_EQ(mSessionTable->GetPeerResourceStats(peer).bytesSent, 10u);
+}
+
+void TestSecureSessionTable::ValidateResourceStatsRetention()
+{
+    std::vector<SessionParameters> sessionParamList;
+    for (NodeId node = 1; node <= CHIP_CONFIG_PEER_RESOURCE_STATS_RETAINED_PEERS + 1; node++)
+    {
+        sessionParamList.push_back({ { node, kFabric1 }, System::Clock::Timestamp(node), SecureSession::State::kActive });
+    }
+    CreateSessionTable(sessionParamList);
+
+    for (auto & listener : mSessionList)
+    {
+        listener->mSessionHolder->AsSecureSession()->GetResourceStats().OnMessageSent(10);
+    }
+    for (auto & listener : mSessionList)
+    {
+        listener->mSessionHolder->AsSecureSession()->MarkForEviction();
+    }
+
+    // The peer released first is forgotten to make room for the last one.
+    EXPECT_TRUE(mSessionTable->GetPeerResourceStats(ScopedNodeId(1, kFabric1)).IsEmpty());
+    for (NodeId node = 2; node <= CHIP_CONFIG_PEER_RESOURCE_STATS_RETAINED_PEERS + 1; node++)
+    {
+        EXPECT_EQ(mSessionTable->GetPeerResourceStats(ScopedNodeId(node, kFabric1)).messagesSent, 1u);
+    }
+}
+
 TEST_F(TestSecureSessionTable, ValidateSessionSorting)
 {
     // This calls TestSecureSessionTable::ValidateSessionSorting instead of just doing the
@@ -461,5 +594,20 @@ TEST_F(TestSecureSessionTable, ValidateSessionSorting)
     ValidateSessionSorting();
 }
 
+TEST_F(TestSecureSessionTable, ValidateResourceStats)
+{
+    ValidateResourceStats();
+}
+
+TEST_F(TestSecureSessionTable, ValidateResourceStatsRetention)
+{
+    ValidateResourceStatsRetention();
+}
+
+TEST_F(TestSecureSessionTable, ValidateResourceStatsAfterFabricRemoval)
+{
+    ValidateResourceStatsAfterFabricRemoval();
+}
+
 } // namespace Transport
 } // namespace chip
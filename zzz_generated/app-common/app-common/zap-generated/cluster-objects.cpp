@@ -18,65 +18,15 @@
 // THIS FILE IS GENERATED BY ZAP
 
 #include <app-common/zap-generated/cluster-objects.h>
+#include <app/data-model/StructDecoder.h>
 #include <app/data-model/WrappedStructEncoder.h>
 
-#include <variant>
-
 namespace chip {
 namespace app {
 namespace Clusters {
 
 namespace detail {
 
-class StructDecodeIterator
-{
-public:
-    // may return a context tag, a CHIP_ERROR (end iteration)
-    using EntryElement = std::variant<uint8_t, CHIP_ERROR>;
-
-    StructDecodeIterator(TLV::TLVReader & reader) : mReader(reader) {}
-
-    // Iterate through structure elements. Returns one of:
-    //   - uint8_t CONTEXT TAG (keep iterating)
-    //   - CHIP_ERROR (including CHIP_NO_ERROR) which should be a final
-    //     return value (stop iterating)
-    EntryElement Next()
-    {
-        if (!mEntered)
-        {
-            VerifyOrReturnError(TLV::kTLVType_Structure == mReader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
-            ReturnErrorOnFailure(mReader.EnterContainer(mOuter));
-            mEntered = true;
-        }
-
-        while (true)
-        {
-            CHIP_ERROR err = mReader.Next();
-            if (err != CHIP_NO_ERROR)
-            {
-                VerifyOrReturnError(err == CHIP_ERROR_END_OF_TLV, err);
-                break;
-            }
-
-            const TLV::Tag tag = mReader.GetTag();
-            if (!TLV::IsContextTag(tag))
-            {
-                continue;
-            }
-
-            // we know context tags are 8-bit
-            return static_cast<uint8_t>(TLV::TagNumFromTag(tag));
-        }
-
-        return mReader.ExitContainer(mOuter);
-    }
-
-private:
-    bool mEntered = false;
-    TLV::TLVType mOuter;
-    TLV::TLVReader & mReader;
-};
-
 // Structs shared across multiple clusters.
 namespace Structs {
 
@@ -91,32 +41,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMfgCode))
-        {
-            err = DataModel::Decode(reader, mfgCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMfgCode, Fields::kValue>(reader, mfgCode, value);
 }
 
 } // namespace ModeTagStruct
@@ -133,36 +58,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else if (__context_tag == to_underlying(Fields::kMode))
-        {
-            err = DataModel::Decode(reader, mode);
-        }
-        else if (__context_tag == to_underlying(Fields::kModeTags))
-        {
-            err = DataModel::Decode(reader, modeTags);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLabel, Fields::kMode, Fields::kModeTags>(reader, label, mode, modeTags);
 }
 
 } // namespace ModeOptionStruct
@@ -184,56 +80,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kRangeMin))
-        {
-            err = DataModel::Decode(reader, rangeMin);
-        }
-        else if (__context_tag == to_underlying(Fields::kRangeMax))
-        {
-            err = DataModel::Decode(reader, rangeMax);
-        }
-        else if (__context_tag == to_underlying(Fields::kPercentMax))
-        {
-            err = DataModel::Decode(reader, percentMax);
-        }
-        else if (__context_tag == to_underlying(Fields::kPercentMin))
-        {
-            err = DataModel::Decode(reader, percentMin);
-        }
-        else if (__context_tag == to_underlying(Fields::kPercentTypical))
-        {
-            err = DataModel::Decode(reader, percentTypical);
-        }
-        else if (__context_tag == to_underlying(Fields::kFixedMax))
-        {
-            err = DataModel::Decode(reader, fixedMax);
-        }
-        else if (__context_tag == to_underlying(Fields::kFixedMin))
-        {
-            err = DataModel::Decode(reader, fixedMin);
-        }
-        else if (__context_tag == to_underlying(Fields::kFixedTypical))
-        {
-            err = DataModel::Decode(reader, fixedTypical);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kRangeMin, Fields::kRangeMax, Fields::kPercentMax, Fields::kPercentMin,
+                                   Fields::kPercentTypical, Fields::kFixedMax, Fields::kFixedMin, Fields::kFixedTypical>(
+        reader, rangeMin, rangeMax, percentMax, percentMin, percentTypical, fixedMax, fixedMin, fixedTypical);
 }
 
 } // namespace MeasurementAccuracyRangeStruct
@@ -252,44 +101,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMeasurementType))
-        {
-            err = DataModel::Decode(reader, measurementType);
-        }
-        else if (__context_tag == to_underlying(Fields::kMeasured))
-        {
-            err = DataModel::Decode(reader, measured);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinMeasuredValue))
-        {
-            err = DataModel::Decode(reader, minMeasuredValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxMeasuredValue))
-        {
-            err = DataModel::Decode(reader, maxMeasuredValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kAccuracyRanges))
-        {
-            err = DataModel::Decode(reader, accuracyRanges);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMeasurementType, Fields::kMeasured, Fields::kMinMeasuredValue,
+                                   Fields::kMaxMeasuredValue, Fields::kAccuracyRanges>(
+        reader, measurementType, measured, minMeasuredValue, maxMeasuredValue, accuracyRanges);
 }
 
 } // namespace MeasurementAccuracyStruct
@@ -305,32 +119,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDeviceType))
-        {
-            err = DataModel::Decode(reader, deviceType);
-        }
-        else if (__context_tag == to_underlying(Fields::kRevision))
-        {
-            err = DataModel::Decode(reader, revision);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDeviceType, Fields::kRevision>(reader, deviceType, revision);
 }
 
 } // namespace DeviceTypeStruct
@@ -346,32 +135,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCatalogVendorID))
-        {
-            err = DataModel::Decode(reader, catalogVendorID);
-        }
-        else if (__context_tag == to_underlying(Fields::kApplicationID))
-        {
-            err = DataModel::Decode(reader, applicationID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCatalogVendorID, Fields::kApplicationID>(reader, catalogVendorID, applicationID);
 }
 
 } // namespace ApplicationStruct
@@ -388,36 +152,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kErrorStateID))
-        {
-            err = DataModel::Decode(reader, errorStateID);
-        }
-        else if (__context_tag == to_underlying(Fields::kErrorStateLabel))
-        {
-            err = DataModel::Decode(reader, errorStateLabel);
-        }
-        else if (__context_tag == to_underlying(Fields::kErrorStateDetails))
-        {
-            err = DataModel::Decode(reader, errorStateDetails);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kErrorStateID, Fields::kErrorStateLabel, Fields::kErrorStateDetails>(
+        reader, errorStateID, errorStateLabel, errorStateDetails);
 }
 
 } // namespace ErrorStateStruct
@@ -435,40 +171,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kUrls))
-        {
-            err = DataModel::Decode(reader, urls);
-        }
-        else if (__context_tag == to_underlying(Fields::kUsername))
-        {
-            err = DataModel::Decode(reader, username);
-        }
-        else if (__context_tag == to_underlying(Fields::kCredential))
-        {
-            err = DataModel::Decode(reader, credential);
-        }
-        else if (__context_tag == to_underlying(Fields::kCaid))
-        {
-            err = DataModel::Decode(reader, caid);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kUrls, Fields::kUsername, Fields::kCredential, Fields::kCaid>(reader, urls, username,
+                                                                                                         credential, caid);
 }
 
 } // namespace ICEServerStruct
@@ -484,32 +188,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLabel, Fields::kValue>(reader, label, value);
 }
 
 } // namespace LabelStruct
@@ -525,32 +204,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOperationalStateID))
-        {
-            err = DataModel::Decode(reader, operationalStateID);
-        }
-        else if (__context_tag == to_underlying(Fields::kOperationalStateLabel))
-        {
-            err = DataModel::Decode(reader, operationalStateLabel);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOperationalStateID, Fields::kOperationalStateLabel>(reader, operationalStateID,
+                                                                                                operationalStateLabel);
 }
 
 } // namespace OperationalStateStruct
@@ -568,40 +223,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kX1))
-        {
-            err = DataModel::Decode(reader, x1);
-        }
-        else if (__context_tag == to_underlying(Fields::kY1))
-        {
-            err = DataModel::Decode(reader, y1);
-        }
-        else if (__context_tag == to_underlying(Fields::kX2))
-        {
-            err = DataModel::Decode(reader, x2);
-        }
-        else if (__context_tag == to_underlying(Fields::kY2))
-        {
-            err = DataModel::Decode(reader, y2);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kX1, Fields::kY1, Fields::kX2, Fields::kY2>(reader, x1, y1, x2, y2);
 }
 
 } // namespace ViewportStruct
@@ -622,52 +244,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kId))
-        {
-            err = DataModel::Decode(reader, id);
-        }
-        else if (__context_tag == to_underlying(Fields::kPeerNodeID))
-        {
-            err = DataModel::Decode(reader, peerNodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kPeerFabricIndex))
-        {
-            err = DataModel::Decode(reader, peerFabricIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kStreamType))
-        {
-            err = DataModel::Decode(reader, streamType);
-        }
-        else if (__context_tag == to_underlying(Fields::kVideoStreamID))
-        {
-            err = DataModel::Decode(reader, videoStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioStreamID))
-        {
-            err = DataModel::Decode(reader, audioStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kMetadataOptions))
-        {
-            err = DataModel::Decode(reader, metadataOptions);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kId, Fields::kPeerNodeID, Fields::kPeerFabricIndex, Fields::kStreamType,
+                                   Fields::kVideoStreamID, Fields::kAudioStreamID, Fields::kMetadataOptions>(
+        reader, id, peerNodeID, peerFabricIndex, streamType, videoStreamID, audioStreamID, metadataOptions);
 }
 
 } // namespace WebRTCSessionStruct
@@ -690,36 +269,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kMyBitmap))
-        {
-            err = DataModel::Decode(reader, myBitmap);
-        }
-        else if (__context_tag == to_underlying(Fields::kMyEnum))
-        {
-            err = DataModel::Decode(reader, myEnum);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kName, Fields::kMyBitmap, Fields::kMyEnum>(reader, name, myBitmap, myEnum);
 }
 
 } // namespace TestGlobalStruct
@@ -736,36 +286,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLocationName))
-        {
-            err = DataModel::Decode(reader, locationName);
-        }
-        else if (__context_tag == to_underlying(Fields::kFloorNumber))
-        {
-            err = DataModel::Decode(reader, floorNumber);
-        }
-        else if (__context_tag == to_underlying(Fields::kAreaType))
-        {
-            err = DataModel::Decode(reader, areaType);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLocationName, Fields::kFloorNumber, Fields::kAreaType>(reader, locationName,
+                                                                                                   floorNumber, areaType);
 }
 
 } // namespace LocationDescriptorStruct
@@ -781,32 +303,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAttributeID))
-        {
-            err = DataModel::Decode(reader, attributeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusCode))
-        {
-            err = DataModel::Decode(reader, statusCode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAttributeID, Fields::kStatusCode>(reader, attributeID, statusCode);
 }
 
 } // namespace AtomicAttributeStatusStruct
@@ -827,28 +324,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kIdentifyTime))
-        {
-            err = DataModel::Decode(reader, identifyTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kIdentifyTime>(reader, identifyTime);
 }
 } // namespace Identify.
 namespace TriggerEffect {
@@ -862,32 +338,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEffectIdentifier))
-        {
-            err = DataModel::Decode(reader, effectIdentifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kEffectVariant))
-        {
-            err = DataModel::Decode(reader, effectVariant);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEffectIdentifier, Fields::kEffectVariant>(reader, effectIdentifier, effectVariant);
 }
 } // namespace TriggerEffect.
 } // namespace Commands
@@ -934,32 +385,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupName))
-        {
-            err = DataModel::Decode(reader, groupName);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupID, Fields::kGroupName>(reader, groupID, groupName);
 }
 } // namespace AddGroup.
 namespace AddGroupResponse {
@@ -973,32 +399,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kGroupID>(reader, status, groupID);
 }
 } // namespace AddGroupResponse.
 namespace ViewGroup {
@@ -1011,28 +412,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupID>(reader, groupID);
 }
 } // namespace ViewGroup.
 namespace ViewGroupResponse {
@@ -1047,36 +427,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupName))
-        {
-            err = DataModel::Decode(reader, groupName);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kGroupID, Fields::kGroupName>(reader, status, groupID, groupName);
 }
 } // namespace ViewGroupResponse.
 namespace GetGroupMembership {
@@ -1089,28 +440,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupList))
-        {
-            err = DataModel::Decode(reader, groupList);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupList>(reader, groupList);
 }
 } // namespace GetGroupMembership.
 namespace GetGroupMembershipResponse {
@@ -1124,32 +454,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCapacity))
-        {
-            err = DataModel::Decode(reader, capacity);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupList))
-        {
-            err = DataModel::Decode(reader, groupList);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCapacity, Fields::kGroupList>(reader, capacity, groupList);
 }
 } // namespace GetGroupMembershipResponse.
 namespace RemoveGroup {
@@ -1162,28 +467,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupID>(reader, groupID);
 }
 } // namespace RemoveGroup.
 namespace RemoveGroupResponse {
@@ -1197,32 +481,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kGroupID>(reader, status, groupID);
 }
 } // namespace RemoveGroupResponse.
 namespace RemoveAllGroups {
@@ -1234,15 +493,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace RemoveAllGroups.
 namespace AddGroupIfIdentifying {
@@ -1256,32 +507,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupName))
-        {
-            err = DataModel::Decode(reader, groupName);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupID, Fields::kGroupName>(reader, groupID, groupName);
 }
 } // namespace AddGroupIfIdentifying.
 } // namespace Commands
@@ -1324,15 +550,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Off.
 namespace On {
@@ -1344,15 +562,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace On.
 namespace Toggle {
@@ -1364,15 +574,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Toggle.
 namespace OffWithEffect {
@@ -1386,32 +588,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEffectIdentifier))
-        {
-            err = DataModel::Decode(reader, effectIdentifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kEffectVariant))
-        {
-            err = DataModel::Decode(reader, effectVariant);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEffectIdentifier, Fields::kEffectVariant>(reader, effectIdentifier, effectVariant);
 }
 } // namespace OffWithEffect.
 namespace OnWithRecallGlobalScene {
@@ -1423,15 +600,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace OnWithRecallGlobalScene.
 namespace OnWithTimedOff {
@@ -1446,36 +615,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOnOffControl))
-        {
-            err = DataModel::Decode(reader, onOffControl);
-        }
-        else if (__context_tag == to_underlying(Fields::kOnTime))
-        {
-            err = DataModel::Decode(reader, onTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOffWaitTime))
-        {
-            err = DataModel::Decode(reader, offWaitTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOnOffControl, Fields::kOnTime, Fields::kOffWaitTime>(reader, onOffControl, onTime,
+                                                                                                 offWaitTime);
 }
 } // namespace OnWithTimedOff.
 } // namespace Commands
@@ -1530,40 +671,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLevel))
-        {
-            err = DataModel::Decode(reader, level);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLevel, Fields::kTransitionTime, Fields::kOptionsMask, Fields::kOptionsOverride>(
+        reader, level, transitionTime, optionsMask, optionsOverride);
 }
 } // namespace MoveToLevel.
 namespace Move {
@@ -1579,40 +688,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMoveMode))
-        {
-            err = DataModel::Decode(reader, moveMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kRate))
-        {
-            err = DataModel::Decode(reader, rate);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMoveMode, Fields::kRate, Fields::kOptionsMask, Fields::kOptionsOverride>(
+        reader, moveMode, rate, optionsMask, optionsOverride);
 }
 } // namespace Move.
 namespace Step {
@@ -1629,44 +706,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStepMode))
-        {
-            err = DataModel::Decode(reader, stepMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kStepSize))
-        {
-            err = DataModel::Decode(reader, stepSize);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStepMode, Fields::kStepSize, Fields::kTransitionTime, Fields::kOptionsMask,
+                                   Fields::kOptionsOverride>(reader, stepMode, stepSize, transitionTime, optionsMask,
+                                                             optionsOverride);
 }
 } // namespace Step.
 namespace Stop {
@@ -1680,32 +722,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOptionsMask, Fields::kOptionsOverride>(reader, optionsMask, optionsOverride);
 }
 } // namespace Stop.
 namespace MoveToLevelWithOnOff {
@@ -1721,40 +738,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLevel))
-        {
-            err = DataModel::Decode(reader, level);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLevel, Fields::kTransitionTime, Fields::kOptionsMask, Fields::kOptionsOverride>(
+        reader, level, transitionTime, optionsMask, optionsOverride);
 }
 } // namespace MoveToLevelWithOnOff.
 namespace MoveWithOnOff {
@@ -1770,40 +755,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMoveMode))
-        {
-            err = DataModel::Decode(reader, moveMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kRate))
-        {
-            err = DataModel::Decode(reader, rate);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMoveMode, Fields::kRate, Fields::kOptionsMask, Fields::kOptionsOverride>(
+        reader, moveMode, rate, optionsMask, optionsOverride);
 }
 } // namespace MoveWithOnOff.
 namespace StepWithOnOff {
@@ -1820,44 +773,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStepMode))
-        {
-            err = DataModel::Decode(reader, stepMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kStepSize))
-        {
-            err = DataModel::Decode(reader, stepSize);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStepMode, Fields::kStepSize, Fields::kTransitionTime, Fields::kOptionsMask,
+                                   Fields::kOptionsOverride>(reader, stepMode, stepSize, transitionTime, optionsMask,
+                                                             optionsOverride);
 }
 } // namespace StepWithOnOff.
 namespace StopWithOnOff {
@@ -1871,32 +789,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOptionsMask, Fields::kOptionsOverride>(reader, optionsMask, optionsOverride);
 }
 } // namespace StopWithOnOff.
 namespace MoveToClosestFrequency {
@@ -1909,28 +802,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kFrequency))
-        {
-            err = DataModel::Decode(reader, frequency);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kFrequency>(reader, frequency);
 }
 } // namespace MoveToClosestFrequency.
 } // namespace Commands
@@ -2031,40 +903,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMfgCode))
-        {
-            err = DataModel::Decode(reader, mfgCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kNamespaceID))
-        {
-            err = DataModel::Decode(reader, namespaceID);
-        }
-        else if (__context_tag == to_underlying(Fields::kTag))
-        {
-            err = DataModel::Decode(reader, tag);
-        }
-        else if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMfgCode, Fields::kNamespaceID, Fields::kTag, Fields::kLabel>(reader, mfgCode,
+                                                                                                         namespaceID, tag, label);
 }
 
 } // namespace SemanticTagStruct
@@ -2139,44 +979,8 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNode))
-        {
-            err = DataModel::Decode(reader, node);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroup))
-        {
-            err = DataModel::Decode(reader, group);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpoint))
-        {
-            err = DataModel::Decode(reader, endpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kCluster))
-        {
-            err = DataModel::Decode(reader, cluster);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNode, Fields::kGroup, Fields::kEndpoint, Fields::kCluster, Fields::kFabricIndex>(
+        reader, node, group, endpoint, cluster, fabricIndex);
 }
 
 } // namespace TargetStruct
@@ -2224,32 +1028,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kType))
-        {
-            err = DataModel::Decode(reader, type);
-        }
-        else if (__context_tag == to_underlying(Fields::kId))
-        {
-            err = DataModel::Decode(reader, id);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kType, Fields::kId>(reader, type, id);
 }
 
 } // namespace AccessRestrictionStruct
@@ -2266,36 +1045,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEndpoint))
-        {
-            err = DataModel::Decode(reader, endpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kCluster))
-        {
-            err = DataModel::Decode(reader, cluster);
-        }
-        else if (__context_tag == to_underlying(Fields::kRestrictions))
-        {
-            err = DataModel::Decode(reader, restrictions);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEndpoint, Fields::kCluster, Fields::kRestrictions>(reader, endpoint, cluster,
+                                                                                               restrictions);
 }
 
 } // namespace CommissioningAccessRestrictionEntryStruct
@@ -2339,40 +1090,8 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEndpoint))
-        {
-            err = DataModel::Decode(reader, endpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kCluster))
-        {
-            err = DataModel::Decode(reader, cluster);
-        }
-        else if (__context_tag == to_underlying(Fields::kRestrictions))
-        {
-            err = DataModel::Decode(reader, restrictions);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEndpoint, Fields::kCluster, Fields::kRestrictions, Fields::kFabricIndex>(
+        reader, endpoint, cluster, restrictions, fabricIndex);
 }
 
 } // namespace AccessRestrictionEntryStruct
@@ -2389,36 +1108,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCluster))
-        {
-            err = DataModel::Decode(reader, cluster);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpoint))
-        {
-            err = DataModel::Decode(reader, endpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kDeviceType))
-        {
-            err = DataModel::Decode(reader, deviceType);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCluster, Fields::kEndpoint, Fields::kDeviceType>(reader, cluster, endpoint, deviceType);
 }
 
 } // namespace AccessControlTargetStruct
@@ -2466,44 +1156,8 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPrivilege))
-        {
-            err = DataModel::Decode(reader, privilege);
-        }
-        else if (__context_tag == to_underlying(Fields::kAuthMode))
-        {
-            err = DataModel::Decode(reader, authMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kSubjects))
-        {
-            err = DataModel::Decode(reader, subjects);
-        }
-        else if (__context_tag == to_underlying(Fields::kTargets))
-        {
-            err = DataModel::Decode(reader, targets);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPrivilege, Fields::kAuthMode, Fields::kSubjects, Fields::kTargets,
+                                   Fields::kFabricIndex>(reader, privilege, authMode, subjects, targets, fabricIndex);
 }
 
 } // namespace AccessControlEntryStruct
@@ -2539,32 +1193,7 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kData, Fields::kFabricIndex>(reader, data, fabricIndex);
 }
 
 } // namespace AccessControlExtensionStruct
@@ -2581,28 +1210,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArl))
-        {
-            err = DataModel::Decode(reader, arl);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArl>(reader, arl);
 }
 } // namespace ReviewFabricRestrictions.
 namespace ReviewFabricRestrictionsResponse {
@@ -2615,28 +1223,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kToken))
-        {
-            err = DataModel::Decode(reader, token);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kToken>(reader, token);
 }
 } // namespace ReviewFabricRestrictionsResponse.
 } // namespace Commands
@@ -2692,44 +1279,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAdminNodeID))
-        {
-            err = DataModel::Decode(reader, adminNodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAdminPasscodeID))
-        {
-            err = DataModel::Decode(reader, adminPasscodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kChangeType))
-        {
-            err = DataModel::Decode(reader, changeType);
-        }
-        else if (__context_tag == to_underlying(Fields::kLatestValue))
-        {
-            err = DataModel::Decode(reader, latestValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAdminNodeID, Fields::kAdminPasscodeID, Fields::kChangeType, Fields::kLatestValue,
+                                   Fields::kFabricIndex>(reader, adminNodeID, adminPasscodeID, changeType, latestValue,
+                                                         fabricIndex);
 }
 } // namespace AccessControlEntryChanged.
 namespace AccessControlExtensionChanged {
@@ -2747,94 +1299,27 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAdminNodeID))
-        {
-            err = DataModel::Decode(reader, adminNodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAdminPasscodeID))
-        {
-            err = DataModel::Decode(reader, adminPasscodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kChangeType))
-        {
-            err = DataModel::Decode(reader, changeType);
-        }
-        else if (__context_tag == to_underlying(Fields::kLatestValue))
-        {
-            err = DataModel::Decode(reader, latestValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
-}
-} // namespace AccessControlExtensionChanged.
-namespace FabricRestrictionReviewUpdate {
-CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
-{
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(aWriter.StartContainer(aTag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(aWriter, TLV::ContextTag(Fields::kToken), token));
-    ReturnErrorOnFailure(DataModel::Encode(aWriter, TLV::ContextTag(Fields::kInstruction), instruction));
-    ReturnErrorOnFailure(DataModel::Encode(aWriter, TLV::ContextTag(Fields::kARLRequestFlowUrl), ARLRequestFlowUrl));
-    ReturnErrorOnFailure(DataModel::Encode(aWriter, TLV::ContextTag(Fields::kFabricIndex), fabricIndex));
-    return aWriter.EndContainer(outer);
-}
+    return DataModel::DecodeStruct<Fields::kAdminNodeID, Fields::kAdminPasscodeID, Fields::kChangeType, Fields::kLatestValue,
+                                   Fields::kFabricIndex>(reader, adminNodeID, adminPasscodeID, changeType, latestValue,
+                                                         fabricIndex);
+}
+} // namespace AccessControlExtensionChanged.
+namespace FabricRestrictionReviewUpdate {
+CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
+{
+    TLV::TLVType outer;
+    ReturnErrorOnFailure(aWriter.StartContainer(aTag, TLV::kTLVType_Structure, outer));
+    ReturnErrorOnFailure(DataModel::Encode(aWriter, TLV::ContextTag(Fields::kToken), token));
+    ReturnErrorOnFailure(DataModel::Encode(aWriter, TLV::ContextTag(Fields::kInstruction), instruction));
+    ReturnErrorOnFailure(DataModel::Encode(aWriter, TLV::ContextTag(Fields::kARLRequestFlowUrl), ARLRequestFlowUrl));
+    ReturnErrorOnFailure(DataModel::Encode(aWriter, TLV::ContextTag(Fields::kFabricIndex), fabricIndex));
+    return aWriter.EndContainer(outer);
+}
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kToken))
-        {
-            err = DataModel::Decode(reader, token);
-        }
-        else if (__context_tag == to_underlying(Fields::kInstruction))
-        {
-            err = DataModel::Decode(reader, instruction);
-        }
-        else if (__context_tag == to_underlying(Fields::kARLRequestFlowUrl))
-        {
-            err = DataModel::Decode(reader, ARLRequestFlowUrl);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kToken, Fields::kInstruction, Fields::kARLRequestFlowUrl, Fields::kFabricIndex>(
+        reader, token, instruction, ARLRequestFlowUrl, fabricIndex);
 }
 } // namespace FabricRestrictionReviewUpdate.
 } // namespace Events
@@ -2858,48 +1343,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kType))
-        {
-            err = DataModel::Decode(reader, type);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpointListID))
-        {
-            err = DataModel::Decode(reader, endpointListID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSupportedCommands))
-        {
-            err = DataModel::Decode(reader, supportedCommands);
-        }
-        else if (__context_tag == to_underlying(Fields::kState))
-        {
-            err = DataModel::Decode(reader, state);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActionID, Fields::kName, Fields::kType, Fields::kEndpointListID,
+                                   Fields::kSupportedCommands, Fields::kState>(reader, actionID, name, type, endpointListID,
+                                                                               supportedCommands, state);
 }
 
 } // namespace ActionStruct
@@ -2917,40 +1363,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEndpointListID))
-        {
-            err = DataModel::Decode(reader, endpointListID);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kType))
-        {
-            err = DataModel::Decode(reader, type);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpoints))
-        {
-            err = DataModel::Decode(reader, endpoints);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEndpointListID, Fields::kName, Fields::kType, Fields::kEndpoints>(
+        reader, endpointListID, name, type, endpoints);
 }
 
 } // namespace EndpointListStruct
@@ -2968,32 +1382,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActionID, Fields::kInvokeID>(reader, actionID, invokeID);
 }
 } // namespace InstantAction.
 namespace InstantActionWithTransition {
@@ -3008,36 +1397,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActionID, Fields::kInvokeID, Fields::kTransitionTime>(reader, actionID, invokeID,
+                                                                                                  transitionTime);
 }
 } // namespace InstantActionWithTransition.
 namespace StartAction {
@@ -3051,32 +1412,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActionID, Fields::kInvokeID>(reader, actionID, invokeID);
 }
 } // namespace StartAction.
 namespace StartActionWithDuration {
@@ -3091,36 +1427,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActionID, Fields::kInvokeID, Fields::kDuration>(reader, actionID, invokeID, duration);
 }
 } // namespace StartActionWithDuration.
 namespace StopAction {
@@ -3134,32 +1441,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActionID, Fields::kInvokeID>(reader, actionID, invokeID);
 }
 } // namespace StopAction.
 namespace PauseAction {
@@ -3173,32 +1455,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActionID, Fields::kInvokeID>(reader, actionID, invokeID);
 }
 } // namespace PauseAction.
 namespace PauseActionWithDuration {
@@ -3213,36 +1470,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActionID, Fields::kInvokeID, Fields::kDuration>(reader, actionID, invokeID, duration);
 }
 } // namespace PauseActionWithDuration.
 namespace ResumeAction {
@@ -3256,32 +1484,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActionID, Fields::kInvokeID>(reader, actionID, invokeID);
 }
 } // namespace ResumeAction.
 namespace EnableAction {
@@ -3295,32 +1498,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActionID, Fields::kInvokeID>(reader, actionID, invokeID);
 }
 } // namespace EnableAction.
 namespace EnableActionWithDuration {
@@ -3335,36 +1513,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActionID, Fields::kInvokeID, Fields::kDuration>(reader, actionID, invokeID, duration);
 }
 } // namespace EnableActionWithDuration.
 namespace DisableAction {
@@ -3378,32 +1527,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActionID, Fields::kInvokeID>(reader, actionID, invokeID);
 }
 } // namespace DisableAction.
 namespace DisableActionWithDuration {
@@ -3418,36 +1542,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActionID, Fields::kInvokeID, Fields::kDuration>(reader, actionID, invokeID, duration);
 }
 } // namespace DisableActionWithDuration.
 } // namespace Commands
@@ -3493,36 +1588,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kNewState))
-        {
-            err = DataModel::Decode(reader, newState);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActionID, Fields::kInvokeID, Fields::kNewState>(reader, actionID, invokeID, newState);
 }
 } // namespace StateChanged.
 namespace ActionFailed {
@@ -3539,40 +1605,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActionID))
-        {
-            err = DataModel::Decode(reader, actionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kInvokeID))
-        {
-            err = DataModel::Decode(reader, invokeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kNewState))
-        {
-            err = DataModel::Decode(reader, newState);
-        }
-        else if (__context_tag == to_underlying(Fields::kError))
-        {
-            err = DataModel::Decode(reader, error);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActionID, Fields::kInvokeID, Fields::kNewState, Fields::kError>(
+        reader, actionID, invokeID, newState, error);
 }
 } // namespace ActionFailed.
 } // namespace Events
@@ -3592,32 +1626,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCaseSessionsPerFabric))
-        {
-            err = DataModel::Decode(reader, caseSessionsPerFabric);
-        }
-        else if (__context_tag == to_underlying(Fields::kSubscriptionsPerFabric))
-        {
-            err = DataModel::Decode(reader, subscriptionsPerFabric);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCaseSessionsPerFabric, Fields::kSubscriptionsPerFabric>(reader, caseSessionsPerFabric,
+                                                                                                    subscriptionsPerFabric);
 }
 
 } // namespace CapabilityMinimaStruct
@@ -3633,32 +1643,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kFinish))
-        {
-            err = DataModel::Decode(reader, finish);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrimaryColor))
-        {
-            err = DataModel::Decode(reader, primaryColor);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kFinish, Fields::kPrimaryColor>(reader, finish, primaryColor);
 }
 
 } // namespace ProductAppearanceStruct
@@ -3674,15 +1659,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace MfgSpecificPing.
 } // namespace Commands
@@ -3766,28 +1743,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSoftwareVersion))
-        {
-            err = DataModel::Decode(reader, softwareVersion);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSoftwareVersion>(reader, softwareVersion);
 }
 } // namespace StartUp.
 namespace ShutDown {
@@ -3800,15 +1756,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ShutDown.
 namespace Leave {
@@ -3822,28 +1770,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kFabricIndex>(reader, fabricIndex);
 }
 } // namespace Leave.
 namespace ReachableChanged {
@@ -3857,28 +1784,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kReachableNewValue))
-        {
-            err = DataModel::Decode(reader, reachableNewValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kReachableNewValue>(reader, reachableNewValue);
 }
 } // namespace ReachableChanged.
 } // namespace Events
@@ -3904,56 +1810,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kVendorID))
-        {
-            err = DataModel::Decode(reader, vendorID);
-        }
-        else if (__context_tag == to_underlying(Fields::kProductID))
-        {
-            err = DataModel::Decode(reader, productID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSoftwareVersion))
-        {
-            err = DataModel::Decode(reader, softwareVersion);
-        }
-        else if (__context_tag == to_underlying(Fields::kProtocolsSupported))
-        {
-            err = DataModel::Decode(reader, protocolsSupported);
-        }
-        else if (__context_tag == to_underlying(Fields::kHardwareVersion))
-        {
-            err = DataModel::Decode(reader, hardwareVersion);
-        }
-        else if (__context_tag == to_underlying(Fields::kLocation))
-        {
-            err = DataModel::Decode(reader, location);
-        }
-        else if (__context_tag == to_underlying(Fields::kRequestorCanConsent))
-        {
-            err = DataModel::Decode(reader, requestorCanConsent);
-        }
-        else if (__context_tag == to_underlying(Fields::kMetadataForProvider))
-        {
-            err = DataModel::Decode(reader, metadataForProvider);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kVendorID, Fields::kProductID, Fields::kSoftwareVersion, Fields::kProtocolsSupported,
+                                   Fields::kHardwareVersion, Fields::kLocation, Fields::kRequestorCanConsent,
+                                   Fields::kMetadataForProvider>(reader, vendorID, productID, softwareVersion, protocolsSupported,
+                                                                 hardwareVersion, location, requestorCanConsent,
+                                                                 metadataForProvider);
 }
 } // namespace QueryImage.
 namespace QueryImageResponse {
@@ -3973,56 +1834,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kDelayedActionTime))
-        {
-            err = DataModel::Decode(reader, delayedActionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kImageURI))
-        {
-            err = DataModel::Decode(reader, imageURI);
-        }
-        else if (__context_tag == to_underlying(Fields::kSoftwareVersion))
-        {
-            err = DataModel::Decode(reader, softwareVersion);
-        }
-        else if (__context_tag == to_underlying(Fields::kSoftwareVersionString))
-        {
-            err = DataModel::Decode(reader, softwareVersionString);
-        }
-        else if (__context_tag == to_underlying(Fields::kUpdateToken))
-        {
-            err = DataModel::Decode(reader, updateToken);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserConsentNeeded))
-        {
-            err = DataModel::Decode(reader, userConsentNeeded);
-        }
-        else if (__context_tag == to_underlying(Fields::kMetadataForRequestor))
-        {
-            err = DataModel::Decode(reader, metadataForRequestor);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kDelayedActionTime, Fields::kImageURI, Fields::kSoftwareVersion,
+                                   Fields::kSoftwareVersionString, Fields::kUpdateToken, Fields::kUserConsentNeeded,
+                                   Fields::kMetadataForRequestor>(reader, status, delayedActionTime, imageURI, softwareVersion,
+                                                                  softwareVersionString, updateToken, userConsentNeeded,
+                                                                  metadataForRequestor);
 }
 } // namespace QueryImageResponse.
 namespace ApplyUpdateRequest {
@@ -4036,32 +1852,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kUpdateToken))
-        {
-            err = DataModel::Decode(reader, updateToken);
-        }
-        else if (__context_tag == to_underlying(Fields::kNewVersion))
-        {
-            err = DataModel::Decode(reader, newVersion);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kUpdateToken, Fields::kNewVersion>(reader, updateToken, newVersion);
 }
 } // namespace ApplyUpdateRequest.
 namespace ApplyUpdateResponse {
@@ -4075,32 +1866,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAction))
-        {
-            err = DataModel::Decode(reader, action);
-        }
-        else if (__context_tag == to_underlying(Fields::kDelayedActionTime))
-        {
-            err = DataModel::Decode(reader, delayedActionTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAction, Fields::kDelayedActionTime>(reader, action, delayedActionTime);
 }
 } // namespace ApplyUpdateResponse.
 namespace NotifyUpdateApplied {
@@ -4114,32 +1880,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kUpdateToken))
-        {
-            err = DataModel::Decode(reader, updateToken);
-        }
-        else if (__context_tag == to_underlying(Fields::kSoftwareVersion))
-        {
-            err = DataModel::Decode(reader, softwareVersion);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kUpdateToken, Fields::kSoftwareVersion>(reader, updateToken, softwareVersion);
 }
 } // namespace NotifyUpdateApplied.
 } // namespace Commands
@@ -4199,36 +1940,8 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kProviderNodeID))
-        {
-            err = DataModel::Decode(reader, providerNodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpoint))
-        {
-            err = DataModel::Decode(reader, endpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kProviderNodeID, Fields::kEndpoint, Fields::kFabricIndex>(reader, providerNodeID,
+                                                                                                     endpoint, fabricIndex);
 }
 
 } // namespace ProviderLocation
@@ -4249,44 +1962,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kProviderNodeID))
-        {
-            err = DataModel::Decode(reader, providerNodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kVendorID))
-        {
-            err = DataModel::Decode(reader, vendorID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAnnouncementReason))
-        {
-            err = DataModel::Decode(reader, announcementReason);
-        }
-        else if (__context_tag == to_underlying(Fields::kMetadataForNode))
-        {
-            err = DataModel::Decode(reader, metadataForNode);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpoint))
-        {
-            err = DataModel::Decode(reader, endpoint);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kProviderNodeID, Fields::kVendorID, Fields::kAnnouncementReason,
+                                   Fields::kMetadataForNode, Fields::kEndpoint>(reader, providerNodeID, vendorID,
+                                                                                announcementReason, metadataForNode, endpoint);
 }
 } // namespace AnnounceOTAProvider.
 } // namespace Commands
@@ -4335,40 +2013,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPreviousState))
-        {
-            err = DataModel::Decode(reader, previousState);
-        }
-        else if (__context_tag == to_underlying(Fields::kNewState))
-        {
-            err = DataModel::Decode(reader, newState);
-        }
-        else if (__context_tag == to_underlying(Fields::kReason))
-        {
-            err = DataModel::Decode(reader, reason);
-        }
-        else if (__context_tag == to_underlying(Fields::kTargetSoftwareVersion))
-        {
-            err = DataModel::Decode(reader, targetSoftwareVersion);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPreviousState, Fields::kNewState, Fields::kReason,
+                                   Fields::kTargetSoftwareVersion>(reader, previousState, newState, reason, targetSoftwareVersion);
 }
 } // namespace StateTransition.
 namespace VersionApplied {
@@ -4383,32 +2029,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSoftwareVersion))
-        {
-            err = DataModel::Decode(reader, softwareVersion);
-        }
-        else if (__context_tag == to_underlying(Fields::kProductID))
-        {
-            err = DataModel::Decode(reader, productID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSoftwareVersion, Fields::kProductID>(reader, softwareVersion, productID);
 }
 } // namespace VersionApplied.
 namespace DownloadError {
@@ -4425,46 +2046,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
+    return DataModel::DecodeStruct<Fields::kSoftwareVersion, Fields::kBytesDownloaded, Fields::kProgressPercent,
+                                   Fields::kPlatformCode>(reader, softwareVersion, bytesDownloaded, progressPercent, platformCode);
+}
+} // namespace DownloadError.
+} // namespace Events
 
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSoftwareVersion))
-        {
-            err = DataModel::Decode(reader, softwareVersion);
-        }
-        else if (__context_tag == to_underlying(Fields::kBytesDownloaded))
-        {
-            err = DataModel::Decode(reader, bytesDownloaded);
-        }
-        else if (__context_tag == to_underlying(Fields::kProgressPercent))
-        {
-            err = DataModel::Decode(reader, progressPercent);
-        }
-        else if (__context_tag == to_underlying(Fields::kPlatformCode))
-        {
-            err = DataModel::Decode(reader, platformCode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
-}
-} // namespace DownloadError.
-} // namespace Events
-
-} // namespace OtaSoftwareUpdateRequestor
-namespace LocalizationConfiguration {
+} // namespace OtaSoftwareUpdateRequestor
+namespace LocalizationConfiguration {
 
 namespace Commands {} // namespace Commands
 
@@ -4604,32 +2193,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCurrent))
-        {
-            err = DataModel::Decode(reader, current);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrevious))
-        {
-            err = DataModel::Decode(reader, previous);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCurrent, Fields::kPrevious>(reader, current, previous);
 }
 
 } // namespace BatChargeFaultChangeType
@@ -4645,32 +2209,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCurrent))
-        {
-            err = DataModel::Decode(reader, current);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrevious))
-        {
-            err = DataModel::Decode(reader, previous);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCurrent, Fields::kPrevious>(reader, current, previous);
 }
 
 } // namespace BatFaultChangeType
@@ -4686,32 +2225,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCurrent))
-        {
-            err = DataModel::Decode(reader, current);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrevious))
-        {
-            err = DataModel::Decode(reader, previous);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCurrent, Fields::kPrevious>(reader, current, previous);
 }
 
 } // namespace WiredFaultChangeType
@@ -4817,32 +2331,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCurrent))
-        {
-            err = DataModel::Decode(reader, current);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrevious))
-        {
-            err = DataModel::Decode(reader, previous);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCurrent, Fields::kPrevious>(reader, current, previous);
 }
 } // namespace WiredFaultChange.
 namespace BatFaultChange {
@@ -4857,32 +2346,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCurrent))
-        {
-            err = DataModel::Decode(reader, current);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrevious))
-        {
-            err = DataModel::Decode(reader, previous);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCurrent, Fields::kPrevious>(reader, current, previous);
 }
 } // namespace BatFaultChange.
 namespace BatChargeFaultChange {
@@ -4897,32 +2361,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCurrent))
-        {
-            err = DataModel::Decode(reader, current);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrevious))
-        {
-            err = DataModel::Decode(reader, previous);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCurrent, Fields::kPrevious>(reader, current, previous);
 }
 } // namespace BatChargeFaultChange.
 } // namespace Events
@@ -4942,32 +2381,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kFailSafeExpiryLengthSeconds))
-        {
-            err = DataModel::Decode(reader, failSafeExpiryLengthSeconds);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxCumulativeFailsafeSeconds))
-        {
-            err = DataModel::Decode(reader, maxCumulativeFailsafeSeconds);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kFailSafeExpiryLengthSeconds, Fields::kMaxCumulativeFailsafeSeconds>(
+        reader, failSafeExpiryLengthSeconds, maxCumulativeFailsafeSeconds);
 }
 
 } // namespace BasicCommissioningInfo
@@ -4985,32 +2400,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kExpiryLengthSeconds))
-        {
-            err = DataModel::Decode(reader, expiryLengthSeconds);
-        }
-        else if (__context_tag == to_underlying(Fields::kBreadcrumb))
-        {
-            err = DataModel::Decode(reader, breadcrumb);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kExpiryLengthSeconds, Fields::kBreadcrumb>(reader, expiryLengthSeconds, breadcrumb);
 }
 } // namespace ArmFailSafe.
 namespace ArmFailSafeResponse {
@@ -5024,32 +2414,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kErrorCode))
-        {
-            err = DataModel::Decode(reader, errorCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kDebugText))
-        {
-            err = DataModel::Decode(reader, debugText);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kErrorCode, Fields::kDebugText>(reader, errorCode, debugText);
 }
 } // namespace ArmFailSafeResponse.
 namespace SetRegulatoryConfig {
@@ -5064,36 +2429,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewRegulatoryConfig))
-        {
-            err = DataModel::Decode(reader, newRegulatoryConfig);
-        }
-        else if (__context_tag == to_underlying(Fields::kCountryCode))
-        {
-            err = DataModel::Decode(reader, countryCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kBreadcrumb))
-        {
-            err = DataModel::Decode(reader, breadcrumb);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewRegulatoryConfig, Fields::kCountryCode, Fields::kBreadcrumb>(
+        reader, newRegulatoryConfig, countryCode, breadcrumb);
 }
 } // namespace SetRegulatoryConfig.
 namespace SetRegulatoryConfigResponse {
@@ -5107,32 +2444,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kErrorCode))
-        {
-            err = DataModel::Decode(reader, errorCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kDebugText))
-        {
-            err = DataModel::Decode(reader, debugText);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kErrorCode, Fields::kDebugText>(reader, errorCode, debugText);
 }
 } // namespace SetRegulatoryConfigResponse.
 namespace CommissioningComplete {
@@ -5144,15 +2456,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace CommissioningComplete.
 namespace CommissioningCompleteResponse {
@@ -5166,32 +2470,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kErrorCode))
-        {
-            err = DataModel::Decode(reader, errorCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kDebugText))
-        {
-            err = DataModel::Decode(reader, debugText);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kErrorCode, Fields::kDebugText>(reader, errorCode, debugText);
 }
 } // namespace CommissioningCompleteResponse.
 namespace SetTCAcknowledgements {
@@ -5205,32 +2484,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTCVersion))
-        {
-            err = DataModel::Decode(reader, TCVersion);
-        }
-        else if (__context_tag == to_underlying(Fields::kTCUserResponse))
-        {
-            err = DataModel::Decode(reader, TCUserResponse);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTCVersion, Fields::kTCUserResponse>(reader, TCVersion, TCUserResponse);
 }
 } // namespace SetTCAcknowledgements.
 namespace SetTCAcknowledgementsResponse {
@@ -5243,28 +2497,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kErrorCode))
-        {
-            err = DataModel::Decode(reader, errorCode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kErrorCode>(reader, errorCode);
 }
 } // namespace SetTCAcknowledgementsResponse.
 } // namespace Commands
@@ -5329,40 +2562,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNetworkID))
-        {
-            err = DataModel::Decode(reader, networkID);
-        }
-        else if (__context_tag == to_underlying(Fields::kConnected))
-        {
-            err = DataModel::Decode(reader, connected);
-        }
-        else if (__context_tag == to_underlying(Fields::kNetworkIdentifier))
-        {
-            err = DataModel::Decode(reader, networkIdentifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kClientIdentifier))
-        {
-            err = DataModel::Decode(reader, clientIdentifier);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNetworkID, Fields::kConnected, Fields::kNetworkIdentifier,
+                                   Fields::kClientIdentifier>(reader, networkID, connected, networkIdentifier, clientIdentifier);
 }
 
 } // namespace NetworkInfoStruct
@@ -5384,56 +2585,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPanId))
-        {
-            err = DataModel::Decode(reader, panId);
-        }
-        else if (__context_tag == to_underlying(Fields::kExtendedPanId))
-        {
-            err = DataModel::Decode(reader, extendedPanId);
-        }
-        else if (__context_tag == to_underlying(Fields::kNetworkName))
-        {
-            err = DataModel::Decode(reader, networkName);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannel))
-        {
-            err = DataModel::Decode(reader, channel);
-        }
-        else if (__context_tag == to_underlying(Fields::kVersion))
-        {
-            err = DataModel::Decode(reader, version);
-        }
-        else if (__context_tag == to_underlying(Fields::kExtendedAddress))
-        {
-            err = DataModel::Decode(reader, extendedAddress);
-        }
-        else if (__context_tag == to_underlying(Fields::kRssi))
-        {
-            err = DataModel::Decode(reader, rssi);
-        }
-        else if (__context_tag == to_underlying(Fields::kLqi))
-        {
-            err = DataModel::Decode(reader, lqi);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPanId, Fields::kExtendedPanId, Fields::kNetworkName, Fields::kChannel, Fields::kVersion,
+                                   Fields::kExtendedAddress, Fields::kRssi, Fields::kLqi>(
+        reader, panId, extendedPanId, networkName, channel, version, extendedAddress, rssi, lqi);
 }
 
 } // namespace ThreadInterfaceScanResultStruct
@@ -5453,52 +2607,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
+    return DataModel::DecodeStruct<Fields::kSecurity, Fields::kSsid, Fields::kBssid, Fields::kChannel, Fields::kWiFiBand,
+                                   Fields::kRssi>(reader, security, ssid, bssid, channel, wiFiBand, rssi);
+}
 
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSecurity))
-        {
-            err = DataModel::Decode(reader, security);
-        }
-        else if (__context_tag == to_underlying(Fields::kSsid))
-        {
-            err = DataModel::Decode(reader, ssid);
-        }
-        else if (__context_tag == to_underlying(Fields::kBssid))
-        {
-            err = DataModel::Decode(reader, bssid);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannel))
-        {
-            err = DataModel::Decode(reader, channel);
-        }
-        else if (__context_tag == to_underlying(Fields::kWiFiBand))
-        {
-            err = DataModel::Decode(reader, wiFiBand);
-        }
-        else if (__context_tag == to_underlying(Fields::kRssi))
-        {
-            err = DataModel::Decode(reader, rssi);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
-}
-
-} // namespace WiFiInterfaceScanResultStruct
-} // namespace Structs
+} // namespace WiFiInterfaceScanResultStruct
+} // namespace Structs
 
 namespace Commands {
 namespace ScanNetworks {
@@ -5512,32 +2626,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSsid))
-        {
-            err = DataModel::Decode(reader, ssid);
-        }
-        else if (__context_tag == to_underlying(Fields::kBreadcrumb))
-        {
-            err = DataModel::Decode(reader, breadcrumb);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSsid, Fields::kBreadcrumb>(reader, ssid, breadcrumb);
 }
 } // namespace ScanNetworks.
 namespace ScanNetworksResponse {
@@ -5553,40 +2642,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNetworkingStatus))
-        {
-            err = DataModel::Decode(reader, networkingStatus);
-        }
-        else if (__context_tag == to_underlying(Fields::kDebugText))
-        {
-            err = DataModel::Decode(reader, debugText);
-        }
-        else if (__context_tag == to_underlying(Fields::kWiFiScanResults))
-        {
-            err = DataModel::Decode(reader, wiFiScanResults);
-        }
-        else if (__context_tag == to_underlying(Fields::kThreadScanResults))
-        {
-            err = DataModel::Decode(reader, threadScanResults);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNetworkingStatus, Fields::kDebugText, Fields::kWiFiScanResults,
+                                   Fields::kThreadScanResults>(reader, networkingStatus, debugText, wiFiScanResults,
+                                                               threadScanResults);
 }
 } // namespace ScanNetworksResponse.
 namespace AddOrUpdateWiFiNetwork {
@@ -5604,48 +2662,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSsid))
-        {
-            err = DataModel::Decode(reader, ssid);
-        }
-        else if (__context_tag == to_underlying(Fields::kCredentials))
-        {
-            err = DataModel::Decode(reader, credentials);
-        }
-        else if (__context_tag == to_underlying(Fields::kBreadcrumb))
-        {
-            err = DataModel::Decode(reader, breadcrumb);
-        }
-        else if (__context_tag == to_underlying(Fields::kNetworkIdentity))
-        {
-            err = DataModel::Decode(reader, networkIdentity);
-        }
-        else if (__context_tag == to_underlying(Fields::kClientIdentifier))
-        {
-            err = DataModel::Decode(reader, clientIdentifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kPossessionNonce))
-        {
-            err = DataModel::Decode(reader, possessionNonce);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSsid, Fields::kCredentials, Fields::kBreadcrumb, Fields::kNetworkIdentity,
+                                   Fields::kClientIdentifier, Fields::kPossessionNonce>(
+        reader, ssid, credentials, breadcrumb, networkIdentity, clientIdentifier, possessionNonce);
 }
 } // namespace AddOrUpdateWiFiNetwork.
 namespace AddOrUpdateThreadNetwork {
@@ -5659,32 +2678,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOperationalDataset))
-        {
-            err = DataModel::Decode(reader, operationalDataset);
-        }
-        else if (__context_tag == to_underlying(Fields::kBreadcrumb))
-        {
-            err = DataModel::Decode(reader, breadcrumb);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOperationalDataset, Fields::kBreadcrumb>(reader, operationalDataset, breadcrumb);
 }
 } // namespace AddOrUpdateThreadNetwork.
 namespace RemoveNetwork {
@@ -5698,32 +2692,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNetworkID))
-        {
-            err = DataModel::Decode(reader, networkID);
-        }
-        else if (__context_tag == to_underlying(Fields::kBreadcrumb))
-        {
-            err = DataModel::Decode(reader, breadcrumb);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNetworkID, Fields::kBreadcrumb>(reader, networkID, breadcrumb);
 }
 } // namespace RemoveNetwork.
 namespace NetworkConfigResponse {
@@ -5740,44 +2709,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNetworkingStatus))
-        {
-            err = DataModel::Decode(reader, networkingStatus);
-        }
-        else if (__context_tag == to_underlying(Fields::kDebugText))
-        {
-            err = DataModel::Decode(reader, debugText);
-        }
-        else if (__context_tag == to_underlying(Fields::kNetworkIndex))
-        {
-            err = DataModel::Decode(reader, networkIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kClientIdentity))
-        {
-            err = DataModel::Decode(reader, clientIdentity);
-        }
-        else if (__context_tag == to_underlying(Fields::kPossessionSignature))
-        {
-            err = DataModel::Decode(reader, possessionSignature);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNetworkingStatus, Fields::kDebugText, Fields::kNetworkIndex, Fields::kClientIdentity,
+                                   Fields::kPossessionSignature>(reader, networkingStatus, debugText, networkIndex, clientIdentity,
+                                                                 possessionSignature);
 }
 } // namespace NetworkConfigResponse.
 namespace ConnectNetwork {
@@ -5791,32 +2725,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNetworkID))
-        {
-            err = DataModel::Decode(reader, networkID);
-        }
-        else if (__context_tag == to_underlying(Fields::kBreadcrumb))
-        {
-            err = DataModel::Decode(reader, breadcrumb);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNetworkID, Fields::kBreadcrumb>(reader, networkID, breadcrumb);
 }
 } // namespace ConnectNetwork.
 namespace ConnectNetworkResponse {
@@ -5831,36 +2740,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNetworkingStatus))
-        {
-            err = DataModel::Decode(reader, networkingStatus);
-        }
-        else if (__context_tag == to_underlying(Fields::kDebugText))
-        {
-            err = DataModel::Decode(reader, debugText);
-        }
-        else if (__context_tag == to_underlying(Fields::kErrorValue))
-        {
-            err = DataModel::Decode(reader, errorValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNetworkingStatus, Fields::kDebugText, Fields::kErrorValue>(reader, networkingStatus,
+                                                                                                       debugText, errorValue);
 }
 } // namespace ConnectNetworkResponse.
 namespace ReorderNetwork {
@@ -5875,36 +2756,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNetworkID))
-        {
-            err = DataModel::Decode(reader, networkID);
-        }
-        else if (__context_tag == to_underlying(Fields::kNetworkIndex))
-        {
-            err = DataModel::Decode(reader, networkIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kBreadcrumb))
-        {
-            err = DataModel::Decode(reader, breadcrumb);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNetworkID, Fields::kNetworkIndex, Fields::kBreadcrumb>(reader, networkID, networkIndex,
+                                                                                                   breadcrumb);
 }
 } // namespace ReorderNetwork.
 namespace QueryIdentity {
@@ -5918,32 +2771,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kKeyIdentifier))
-        {
-            err = DataModel::Decode(reader, keyIdentifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kPossessionNonce))
-        {
-            err = DataModel::Decode(reader, possessionNonce);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kKeyIdentifier, Fields::kPossessionNonce>(reader, keyIdentifier, possessionNonce);
 }
 } // namespace QueryIdentity.
 namespace QueryIdentityResponse {
@@ -5957,32 +2785,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kIdentity))
-        {
-            err = DataModel::Decode(reader, identity);
-        }
-        else if (__context_tag == to_underlying(Fields::kPossessionSignature))
-        {
-            err = DataModel::Decode(reader, possessionSignature);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kIdentity, Fields::kPossessionSignature>(reader, identity, possessionSignature);
 }
 } // namespace QueryIdentityResponse.
 } // namespace Commands
@@ -6048,36 +2851,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kIntent))
-        {
-            err = DataModel::Decode(reader, intent);
-        }
-        else if (__context_tag == to_underlying(Fields::kRequestedProtocol))
-        {
-            err = DataModel::Decode(reader, requestedProtocol);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransferFileDesignator))
-        {
-            err = DataModel::Decode(reader, transferFileDesignator);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kIntent, Fields::kRequestedProtocol, Fields::kTransferFileDesignator>(
+        reader, intent, requestedProtocol, transferFileDesignator);
 }
 } // namespace RetrieveLogsRequest.
 namespace RetrieveLogsResponse {
@@ -6093,40 +2868,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kLogContent))
-        {
-            err = DataModel::Decode(reader, logContent);
-        }
-        else if (__context_tag == to_underlying(Fields::kUTCTimeStamp))
-        {
-            err = DataModel::Decode(reader, UTCTimeStamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kTimeSinceBoot))
-        {
-            err = DataModel::Decode(reader, timeSinceBoot);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kLogContent, Fields::kUTCTimeStamp, Fields::kTimeSinceBoot>(
+        reader, status, logContent, UTCTimeStamp, timeSinceBoot);
 }
 } // namespace RetrieveLogsResponse.
 } // namespace Commands
@@ -6175,56 +2918,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kIsOperational))
-        {
-            err = DataModel::Decode(reader, isOperational);
-        }
-        else if (__context_tag == to_underlying(Fields::kOffPremiseServicesReachableIPv4))
-        {
-            err = DataModel::Decode(reader, offPremiseServicesReachableIPv4);
-        }
-        else if (__context_tag == to_underlying(Fields::kOffPremiseServicesReachableIPv6))
-        {
-            err = DataModel::Decode(reader, offPremiseServicesReachableIPv6);
-        }
-        else if (__context_tag == to_underlying(Fields::kHardwareAddress))
-        {
-            err = DataModel::Decode(reader, hardwareAddress);
-        }
-        else if (__context_tag == to_underlying(Fields::kIPv4Addresses))
-        {
-            err = DataModel::Decode(reader, IPv4Addresses);
-        }
-        else if (__context_tag == to_underlying(Fields::kIPv6Addresses))
-        {
-            err = DataModel::Decode(reader, IPv6Addresses);
-        }
-        else if (__context_tag == to_underlying(Fields::kType))
-        {
-            err = DataModel::Decode(reader, type);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kName, Fields::kIsOperational, Fields::kOffPremiseServicesReachableIPv4,
+                                   Fields::kOffPremiseServicesReachableIPv6, Fields::kHardwareAddress, Fields::kIPv4Addresses,
+                                   Fields::kIPv6Addresses, Fields::kType>(
+        reader, name, isOperational, offPremiseServicesReachableIPv4, offPremiseServicesReachableIPv6, hardwareAddress,
+        IPv4Addresses, IPv6Addresses, type);
 }
 
 } // namespace NetworkInterface
@@ -6242,32 +2940,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEnableKey))
-        {
-            err = DataModel::Decode(reader, enableKey);
-        }
-        else if (__context_tag == to_underlying(Fields::kEventTrigger))
-        {
-            err = DataModel::Decode(reader, eventTrigger);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEnableKey, Fields::kEventTrigger>(reader, enableKey, eventTrigger);
 }
 } // namespace TestEventTrigger.
 namespace TimeSnapshot {
@@ -6279,15 +2952,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace TimeSnapshot.
 namespace TimeSnapshotResponse {
@@ -6301,32 +2966,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSystemTimeMs))
-        {
-            err = DataModel::Decode(reader, systemTimeMs);
-        }
-        else if (__context_tag == to_underlying(Fields::kPosixTimeMs))
-        {
-            err = DataModel::Decode(reader, posixTimeMs);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSystemTimeMs, Fields::kPosixTimeMs>(reader, systemTimeMs, posixTimeMs);
 }
 } // namespace TimeSnapshotResponse.
 namespace PayloadTestRequest {
@@ -6341,36 +2981,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEnableKey))
-        {
-            err = DataModel::Decode(reader, enableKey);
-        }
-        else if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-        else if (__context_tag == to_underlying(Fields::kCount))
-        {
-            err = DataModel::Decode(reader, count);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEnableKey, Fields::kValue, Fields::kCount>(reader, enableKey, value, count);
 }
 } // namespace PayloadTestRequest.
 namespace PayloadTestResponse {
@@ -6383,28 +2994,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPayload))
-        {
-            err = DataModel::Decode(reader, payload);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPayload>(reader, payload);
 }
 } // namespace PayloadTestResponse.
 } // namespace Commands
@@ -6461,32 +3051,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCurrent))
-        {
-            err = DataModel::Decode(reader, current);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrevious))
-        {
-            err = DataModel::Decode(reader, previous);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCurrent, Fields::kPrevious>(reader, current, previous);
 }
 } // namespace HardwareFaultChange.
 namespace RadioFaultChange {
@@ -6501,32 +3066,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCurrent))
-        {
-            err = DataModel::Decode(reader, current);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrevious))
-        {
-            err = DataModel::Decode(reader, previous);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCurrent, Fields::kPrevious>(reader, current, previous);
 }
 } // namespace RadioFaultChange.
 namespace NetworkFaultChange {
@@ -6541,32 +3081,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCurrent))
-        {
-            err = DataModel::Decode(reader, current);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrevious))
-        {
-            err = DataModel::Decode(reader, previous);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCurrent, Fields::kPrevious>(reader, current, previous);
 }
 } // namespace NetworkFaultChange.
 namespace BootReason {
@@ -6580,28 +3095,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kBootReason))
-        {
-            err = DataModel::Decode(reader, bootReason);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kBootReason>(reader, bootReason);
 }
 } // namespace BootReason.
 } // namespace Events
@@ -6624,44 +3118,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kId))
-        {
-            err = DataModel::Decode(reader, id);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kStackFreeCurrent))
-        {
-            err = DataModel::Decode(reader, stackFreeCurrent);
-        }
-        else if (__context_tag == to_underlying(Fields::kStackFreeMinimum))
-        {
-            err = DataModel::Decode(reader, stackFreeMinimum);
-        }
-        else if (__context_tag == to_underlying(Fields::kStackSize))
-        {
-            err = DataModel::Decode(reader, stackSize);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kId, Fields::kName, Fields::kStackFreeCurrent, Fields::kStackFreeMinimum,
+                                   Fields::kStackSize>(reader, id, name, stackFreeCurrent, stackFreeMinimum, stackSize);
 }
 
 } // namespace ThreadMetricsStruct
@@ -6677,15 +3135,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ResetWatermarks.
 } // namespace Commands
@@ -6733,36 +3183,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kId))
-        {
-            err = DataModel::Decode(reader, id);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kFaultRecording))
-        {
-            err = DataModel::Decode(reader, faultRecording);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kId, Fields::kName, Fields::kFaultRecording>(reader, id, name, faultRecording);
 }
 } // namespace SoftwareFault.
 } // namespace Events
@@ -6794,80 +3215,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kExtAddress))
-        {
-            err = DataModel::Decode(reader, extAddress);
-        }
-        else if (__context_tag == to_underlying(Fields::kAge))
-        {
-            err = DataModel::Decode(reader, age);
-        }
-        else if (__context_tag == to_underlying(Fields::kRloc16))
-        {
-            err = DataModel::Decode(reader, rloc16);
-        }
-        else if (__context_tag == to_underlying(Fields::kLinkFrameCounter))
-        {
-            err = DataModel::Decode(reader, linkFrameCounter);
-        }
-        else if (__context_tag == to_underlying(Fields::kMleFrameCounter))
-        {
-            err = DataModel::Decode(reader, mleFrameCounter);
-        }
-        else if (__context_tag == to_underlying(Fields::kLqi))
-        {
-            err = DataModel::Decode(reader, lqi);
-        }
-        else if (__context_tag == to_underlying(Fields::kAverageRssi))
-        {
-            err = DataModel::Decode(reader, averageRssi);
-        }
-        else if (__context_tag == to_underlying(Fields::kLastRssi))
-        {
-            err = DataModel::Decode(reader, lastRssi);
-        }
-        else if (__context_tag == to_underlying(Fields::kFrameErrorRate))
-        {
-            err = DataModel::Decode(reader, frameErrorRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMessageErrorRate))
-        {
-            err = DataModel::Decode(reader, messageErrorRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kRxOnWhenIdle))
-        {
-            err = DataModel::Decode(reader, rxOnWhenIdle);
-        }
-        else if (__context_tag == to_underlying(Fields::kFullThreadDevice))
-        {
-            err = DataModel::Decode(reader, fullThreadDevice);
-        }
-        else if (__context_tag == to_underlying(Fields::kFullNetworkData))
-        {
-            err = DataModel::Decode(reader, fullNetworkData);
-        }
-        else if (__context_tag == to_underlying(Fields::kIsChild))
-        {
-            err = DataModel::Decode(reader, isChild);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kExtAddress, Fields::kAge, Fields::kRloc16, Fields::kLinkFrameCounter,
+                                   Fields::kMleFrameCounter, Fields::kLqi, Fields::kAverageRssi, Fields::kLastRssi,
+                                   Fields::kFrameErrorRate, Fields::kMessageErrorRate, Fields::kRxOnWhenIdle,
+                                   Fields::kFullThreadDevice, Fields::kFullNetworkData, Fields::kIsChild>(
+        reader, extAddress, age, rloc16, linkFrameCounter, mleFrameCounter, lqi, averageRssi, lastRssi, frameErrorRate,
+        messageErrorRate, rxOnWhenIdle, fullThreadDevice, fullNetworkData, isChild);
 }
 
 } // namespace NeighborTableStruct
@@ -6893,72 +3246,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActiveTimestampPresent))
-        {
-            err = DataModel::Decode(reader, activeTimestampPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kPendingTimestampPresent))
-        {
-            err = DataModel::Decode(reader, pendingTimestampPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kMasterKeyPresent))
-        {
-            err = DataModel::Decode(reader, masterKeyPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kNetworkNamePresent))
-        {
-            err = DataModel::Decode(reader, networkNamePresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kExtendedPanIdPresent))
-        {
-            err = DataModel::Decode(reader, extendedPanIdPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kMeshLocalPrefixPresent))
-        {
-            err = DataModel::Decode(reader, meshLocalPrefixPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kDelayPresent))
-        {
-            err = DataModel::Decode(reader, delayPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kPanIdPresent))
-        {
-            err = DataModel::Decode(reader, panIdPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannelPresent))
-        {
-            err = DataModel::Decode(reader, channelPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kPskcPresent))
-        {
-            err = DataModel::Decode(reader, pskcPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kSecurityPolicyPresent))
-        {
-            err = DataModel::Decode(reader, securityPolicyPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannelMaskPresent))
-        {
-            err = DataModel::Decode(reader, channelMaskPresent);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActiveTimestampPresent, Fields::kPendingTimestampPresent, Fields::kMasterKeyPresent,
+                                   Fields::kNetworkNamePresent, Fields::kExtendedPanIdPresent, Fields::kMeshLocalPrefixPresent,
+                                   Fields::kDelayPresent, Fields::kPanIdPresent, Fields::kChannelPresent, Fields::kPskcPresent,
+                                   Fields::kSecurityPolicyPresent, Fields::kChannelMaskPresent>(
+        reader, activeTimestampPresent, pendingTimestampPresent, masterKeyPresent, networkNamePresent, extendedPanIdPresent,
+        meshLocalPrefixPresent, delayPresent, panIdPresent, channelPresent, pskcPresent, securityPolicyPresent, channelMaskPresent);
 }
 
 } // namespace OperationalDatasetComponents
@@ -6982,64 +3275,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kExtAddress))
-        {
-            err = DataModel::Decode(reader, extAddress);
-        }
-        else if (__context_tag == to_underlying(Fields::kRloc16))
-        {
-            err = DataModel::Decode(reader, rloc16);
-        }
-        else if (__context_tag == to_underlying(Fields::kRouterId))
-        {
-            err = DataModel::Decode(reader, routerId);
-        }
-        else if (__context_tag == to_underlying(Fields::kNextHop))
-        {
-            err = DataModel::Decode(reader, nextHop);
-        }
-        else if (__context_tag == to_underlying(Fields::kPathCost))
-        {
-            err = DataModel::Decode(reader, pathCost);
-        }
-        else if (__context_tag == to_underlying(Fields::kLQIIn))
-        {
-            err = DataModel::Decode(reader, LQIIn);
-        }
-        else if (__context_tag == to_underlying(Fields::kLQIOut))
-        {
-            err = DataModel::Decode(reader, LQIOut);
-        }
-        else if (__context_tag == to_underlying(Fields::kAge))
-        {
-            err = DataModel::Decode(reader, age);
-        }
-        else if (__context_tag == to_underlying(Fields::kAllocated))
-        {
-            err = DataModel::Decode(reader, allocated);
-        }
-        else if (__context_tag == to_underlying(Fields::kLinkEstablished))
-        {
-            err = DataModel::Decode(reader, linkEstablished);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kExtAddress, Fields::kRloc16, Fields::kRouterId, Fields::kNextHop, Fields::kPathCost,
+                                   Fields::kLQIIn, Fields::kLQIOut, Fields::kAge, Fields::kAllocated, Fields::kLinkEstablished>(
+        reader, extAddress, rloc16, routerId, nextHop, pathCost, LQIIn, LQIOut, age, allocated, linkEstablished);
 }
 
 } // namespace RouteTableStruct
@@ -7055,32 +3293,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kRotationTime))
-        {
-            err = DataModel::Decode(reader, rotationTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kFlags))
-        {
-            err = DataModel::Decode(reader, flags);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kRotationTime, Fields::kFlags>(reader, rotationTime, flags);
 }
 
 } // namespace SecurityPolicy
@@ -7096,15 +3309,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ResetCounts.
 } // namespace Commands
@@ -7268,28 +3473,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kConnectionStatus))
-        {
-            err = DataModel::Decode(reader, connectionStatus);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kConnectionStatus>(reader, connectionStatus);
 }
 } // namespace ConnectionStatus.
 namespace NetworkFaultChange {
@@ -7304,32 +3488,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCurrent))
-        {
-            err = DataModel::Decode(reader, current);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrevious))
-        {
-            err = DataModel::Decode(reader, previous);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCurrent, Fields::kPrevious>(reader, current, previous);
 }
 } // namespace NetworkFaultChange.
 } // namespace Events
@@ -7347,15 +3506,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ResetCounts.
 } // namespace Commands
@@ -7419,28 +3570,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kReasonCode))
-        {
-            err = DataModel::Decode(reader, reasonCode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kReasonCode>(reader, reasonCode);
 }
 } // namespace Disconnection.
 namespace AssociationFailure {
@@ -7455,32 +3585,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAssociationFailureCause))
-        {
-            err = DataModel::Decode(reader, associationFailureCause);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAssociationFailureCause, Fields::kStatus>(reader, associationFailureCause, status);
 }
 } // namespace AssociationFailure.
 namespace ConnectionStatus {
@@ -7494,28 +3599,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kConnectionStatus))
-        {
-            err = DataModel::Decode(reader, connectionStatus);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kConnectionStatus>(reader, connectionStatus);
 }
 } // namespace ConnectionStatus.
 } // namespace Events
@@ -7533,15 +3617,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ResetCounts.
 } // namespace Commands
@@ -7603,36 +3679,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOffset))
-        {
-            err = DataModel::Decode(reader, offset);
-        }
-        else if (__context_tag == to_underlying(Fields::kValidStarting))
-        {
-            err = DataModel::Decode(reader, validStarting);
-        }
-        else if (__context_tag == to_underlying(Fields::kValidUntil))
-        {
-            err = DataModel::Decode(reader, validUntil);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOffset, Fields::kValidStarting, Fields::kValidUntil>(reader, offset, validStarting,
+                                                                                                 validUntil);
 }
 
 } // namespace DSTOffsetStruct
@@ -7648,32 +3696,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNodeID))
-        {
-            err = DataModel::Decode(reader, nodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpoint))
-        {
-            err = DataModel::Decode(reader, endpoint);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNodeID, Fields::kEndpoint>(reader, nodeID, endpoint);
 }
 
 } // namespace FabricScopedTrustedTimeSourceStruct
@@ -7690,36 +3713,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOffset))
-        {
-            err = DataModel::Decode(reader, offset);
-        }
-        else if (__context_tag == to_underlying(Fields::kValidAt))
-        {
-            err = DataModel::Decode(reader, validAt);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOffset, Fields::kValidAt, Fields::kName>(reader, offset, validAt, name);
 }
 
 } // namespace TimeZoneStruct
@@ -7736,36 +3730,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kNodeID))
-        {
-            err = DataModel::Decode(reader, nodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpoint))
-        {
-            err = DataModel::Decode(reader, endpoint);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kFabricIndex, Fields::kNodeID, Fields::kEndpoint>(reader, fabricIndex, nodeID, endpoint);
 }
 
 } // namespace TrustedTimeSourceStruct
@@ -7784,36 +3749,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kUTCTime))
-        {
-            err = DataModel::Decode(reader, UTCTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kGranularity))
-        {
-            err = DataModel::Decode(reader, granularity);
-        }
-        else if (__context_tag == to_underlying(Fields::kTimeSource))
-        {
-            err = DataModel::Decode(reader, timeSource);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kUTCTime, Fields::kGranularity, Fields::kTimeSource>(reader, UTCTime, granularity,
+                                                                                                timeSource);
 }
 } // namespace SetUTCTime.
 namespace SetTrustedTimeSource {
@@ -7826,28 +3763,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTrustedTimeSource))
-        {
-            err = DataModel::Decode(reader, trustedTimeSource);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTrustedTimeSource>(reader, trustedTimeSource);
 }
 } // namespace SetTrustedTimeSource.
 namespace SetTimeZone {
@@ -7860,28 +3776,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTimeZone))
-        {
-            err = DataModel::Decode(reader, timeZone);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTimeZone>(reader, timeZone);
 }
 } // namespace SetTimeZone.
 namespace SetTimeZoneResponse {
@@ -7894,28 +3789,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDSTOffsetRequired))
-        {
-            err = DataModel::Decode(reader, DSTOffsetRequired);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDSTOffsetRequired>(reader, DSTOffsetRequired);
 }
 } // namespace SetTimeZoneResponse.
 namespace SetDSTOffset {
@@ -7928,28 +3802,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDSTOffset))
-        {
-            err = DataModel::Decode(reader, DSTOffset);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDSTOffset>(reader, DSTOffset);
 }
 } // namespace SetDSTOffset.
 namespace SetDefaultNTP {
@@ -7962,28 +3815,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDefaultNTP))
-        {
-            err = DataModel::Decode(reader, defaultNTP);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDefaultNTP>(reader, defaultNTP);
 }
 } // namespace SetDefaultNTP.
 } // namespace Commands
@@ -8046,15 +3878,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace DSTTableEmpty.
 namespace DSTStatus {
@@ -8068,28 +3892,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDSTOffsetActive))
-        {
-            err = DataModel::Decode(reader, DSTOffsetActive);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDSTOffsetActive>(reader, DSTOffsetActive);
 }
 } // namespace DSTStatus.
 namespace TimeZoneStatus {
@@ -8104,32 +3907,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOffset))
-        {
-            err = DataModel::Decode(reader, offset);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOffset, Fields::kName>(reader, offset, name);
 }
 } // namespace TimeZoneStatus.
 namespace TimeFailure {
@@ -8142,15 +3920,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace TimeFailure.
 namespace MissingTrustedTimeSource {
@@ -8163,15 +3933,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace MissingTrustedTimeSource.
 } // namespace Events
@@ -8191,32 +3953,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kFinish))
-        {
-            err = DataModel::Decode(reader, finish);
-        }
-        else if (__context_tag == to_underlying(Fields::kPrimaryColor))
-        {
-            err = DataModel::Decode(reader, primaryColor);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kFinish, Fields::kPrimaryColor>(reader, finish, primaryColor);
 }
 
 } // namespace ProductAppearanceStruct
@@ -8234,32 +3971,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStayActiveDuration))
-        {
-            err = DataModel::Decode(reader, stayActiveDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kTimeoutMs))
-        {
-            err = DataModel::Decode(reader, timeoutMs);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStayActiveDuration, Fields::kTimeoutMs>(reader, stayActiveDuration, timeoutMs);
 }
 } // namespace KeepActive.
 } // namespace Commands
@@ -8331,28 +4043,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSoftwareVersion))
-        {
-            err = DataModel::Decode(reader, softwareVersion);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSoftwareVersion>(reader, softwareVersion);
 }
 } // namespace StartUp.
 namespace ShutDown {
@@ -8365,15 +4056,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ShutDown.
 namespace Leave {
@@ -8386,15 +4069,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Leave.
 namespace ReachableChanged {
@@ -8408,28 +4083,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kReachableNewValue))
-        {
-            err = DataModel::Decode(reader, reachableNewValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kReachableNewValue>(reader, reachableNewValue);
 }
 } // namespace ReachableChanged.
 namespace ActiveChanged {
@@ -8443,28 +4097,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPromisedActiveDuration))
-        {
-            err = DataModel::Decode(reader, promisedActiveDuration);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPromisedActiveDuration>(reader, promisedActiveDuration);
 }
 } // namespace ActiveChanged.
 } // namespace Events
@@ -8513,28 +4146,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewPosition))
-        {
-            err = DataModel::Decode(reader, newPosition);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewPosition>(reader, newPosition);
 }
 } // namespace SwitchLatched.
 namespace InitialPress {
@@ -8548,28 +4160,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewPosition))
-        {
-            err = DataModel::Decode(reader, newPosition);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewPosition>(reader, newPosition);
 }
 } // namespace InitialPress.
 namespace LongPress {
@@ -8583,28 +4174,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewPosition))
-        {
-            err = DataModel::Decode(reader, newPosition);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewPosition>(reader, newPosition);
 }
 } // namespace LongPress.
 namespace ShortRelease {
@@ -8618,28 +4188,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPreviousPosition))
-        {
-            err = DataModel::Decode(reader, previousPosition);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPreviousPosition>(reader, previousPosition);
 }
 } // namespace ShortRelease.
 namespace LongRelease {
@@ -8653,28 +4202,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPreviousPosition))
-        {
-            err = DataModel::Decode(reader, previousPosition);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPreviousPosition>(reader, previousPosition);
 }
 } // namespace LongRelease.
 namespace MultiPressOngoing {
@@ -8690,32 +4218,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewPosition))
-        {
-            err = DataModel::Decode(reader, newPosition);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrentNumberOfPressesCounted))
-        {
-            err = DataModel::Decode(reader, currentNumberOfPressesCounted);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewPosition, Fields::kCurrentNumberOfPressesCounted>(reader, newPosition,
+                                                                                                 currentNumberOfPressesCounted);
 }
 } // namespace MultiPressOngoing.
 namespace MultiPressComplete {
@@ -8731,32 +4235,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPreviousPosition))
-        {
-            err = DataModel::Decode(reader, previousPosition);
-        }
-        else if (__context_tag == to_underlying(Fields::kTotalNumberOfPressesCounted))
-        {
-            err = DataModel::Decode(reader, totalNumberOfPressesCounted);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPreviousPosition, Fields::kTotalNumberOfPressesCounted>(reader, previousPosition,
+                                                                                                    totalNumberOfPressesCounted);
 }
 } // namespace MultiPressComplete.
 } // namespace Events
@@ -8779,44 +4259,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCommissioningTimeout))
-        {
-            err = DataModel::Decode(reader, commissioningTimeout);
-        }
-        else if (__context_tag == to_underlying(Fields::kPAKEPasscodeVerifier))
-        {
-            err = DataModel::Decode(reader, PAKEPasscodeVerifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kDiscriminator))
-        {
-            err = DataModel::Decode(reader, discriminator);
-        }
-        else if (__context_tag == to_underlying(Fields::kIterations))
-        {
-            err = DataModel::Decode(reader, iterations);
-        }
-        else if (__context_tag == to_underlying(Fields::kSalt))
-        {
-            err = DataModel::Decode(reader, salt);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCommissioningTimeout, Fields::kPAKEPasscodeVerifier, Fields::kDiscriminator,
+                                   Fields::kIterations, Fields::kSalt>(reader, commissioningTimeout, PAKEPasscodeVerifier,
+                                                                       discriminator, iterations, salt);
 }
 } // namespace OpenCommissioningWindow.
 namespace OpenBasicCommissioningWindow {
@@ -8829,28 +4274,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCommissioningTimeout))
-        {
-            err = DataModel::Decode(reader, commissioningTimeout);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCommissioningTimeout>(reader, commissioningTimeout);
 }
 } // namespace OpenBasicCommissioningWindow.
 namespace RevokeCommissioning {
@@ -8862,15 +4286,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace RevokeCommissioning.
 } // namespace Commands
@@ -8939,48 +4355,8 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kRootPublicKey))
-        {
-            err = DataModel::Decode(reader, rootPublicKey);
-        }
-        else if (__context_tag == to_underlying(Fields::kVendorID))
-        {
-            err = DataModel::Decode(reader, vendorID);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricID))
-        {
-            err = DataModel::Decode(reader, fabricID);
-        }
-        else if (__context_tag == to_underlying(Fields::kNodeID))
-        {
-            err = DataModel::Decode(reader, nodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kRootPublicKey, Fields::kVendorID, Fields::kFabricID, Fields::kNodeID, Fields::kLabel,
+                                   Fields::kFabricIndex>(reader, rootPublicKey, vendorID, fabricID, nodeID, label, fabricIndex);
 }
 
 } // namespace FabricDescriptorStruct
@@ -9020,36 +4396,7 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNoc))
-        {
-            err = DataModel::Decode(reader, noc);
-        }
-        else if (__context_tag == to_underlying(Fields::kIcac))
-        {
-            err = DataModel::Decode(reader, icac);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNoc, Fields::kIcac, Fields::kFabricIndex>(reader, noc, icac, fabricIndex);
 }
 
 } // namespace NOCStruct
@@ -9066,28 +4413,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAttestationNonce))
-        {
-            err = DataModel::Decode(reader, attestationNonce);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAttestationNonce>(reader, attestationNonce);
 }
 } // namespace AttestationRequest.
 namespace AttestationResponse {
@@ -9101,32 +4427,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAttestationElements))
-        {
-            err = DataModel::Decode(reader, attestationElements);
-        }
-        else if (__context_tag == to_underlying(Fields::kAttestationSignature))
-        {
-            err = DataModel::Decode(reader, attestationSignature);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAttestationElements, Fields::kAttestationSignature>(reader, attestationElements,
+                                                                                                attestationSignature);
 }
 } // namespace AttestationResponse.
 namespace CertificateChainRequest {
@@ -9139,28 +4441,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCertificateType))
-        {
-            err = DataModel::Decode(reader, certificateType);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCertificateType>(reader, certificateType);
 }
 } // namespace CertificateChainRequest.
 namespace CertificateChainResponse {
@@ -9173,28 +4454,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCertificate))
-        {
-            err = DataModel::Decode(reader, certificate);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCertificate>(reader, certificate);
 }
 } // namespace CertificateChainResponse.
 namespace CSRRequest {
@@ -9208,32 +4468,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCSRNonce))
-        {
-            err = DataModel::Decode(reader, CSRNonce);
-        }
-        else if (__context_tag == to_underlying(Fields::kIsForUpdateNOC))
-        {
-            err = DataModel::Decode(reader, isForUpdateNOC);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCSRNonce, Fields::kIsForUpdateNOC>(reader, CSRNonce, isForUpdateNOC);
 }
 } // namespace CSRRequest.
 namespace CSRResponse {
@@ -9247,32 +4482,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNOCSRElements))
-        {
-            err = DataModel::Decode(reader, NOCSRElements);
-        }
-        else if (__context_tag == to_underlying(Fields::kAttestationSignature))
-        {
-            err = DataModel::Decode(reader, attestationSignature);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNOCSRElements, Fields::kAttestationSignature>(reader, NOCSRElements,
+                                                                                          attestationSignature);
 }
 } // namespace CSRResponse.
 namespace AddNOC {
@@ -9289,44 +4500,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNOCValue))
-        {
-            err = DataModel::Decode(reader, NOCValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kICACValue))
-        {
-            err = DataModel::Decode(reader, ICACValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kIPKValue))
-        {
-            err = DataModel::Decode(reader, IPKValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kCaseAdminSubject))
-        {
-            err = DataModel::Decode(reader, caseAdminSubject);
-        }
-        else if (__context_tag == to_underlying(Fields::kAdminVendorId))
-        {
-            err = DataModel::Decode(reader, adminVendorId);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNOCValue, Fields::kICACValue, Fields::kIPKValue, Fields::kCaseAdminSubject,
+                                   Fields::kAdminVendorId>(reader, NOCValue, ICACValue, IPKValue, caseAdminSubject, adminVendorId);
 }
 } // namespace AddNOC.
 namespace UpdateNOC {
@@ -9340,32 +4515,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNOCValue))
-        {
-            err = DataModel::Decode(reader, NOCValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kICACValue))
-        {
-            err = DataModel::Decode(reader, ICACValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNOCValue, Fields::kICACValue>(reader, NOCValue, ICACValue);
 }
 } // namespace UpdateNOC.
 namespace NOCResponse {
@@ -9380,36 +4530,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatusCode))
-        {
-            err = DataModel::Decode(reader, statusCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kDebugText))
-        {
-            err = DataModel::Decode(reader, debugText);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatusCode, Fields::kFabricIndex, Fields::kDebugText>(reader, statusCode, fabricIndex,
+                                                                                                  debugText);
 }
 } // namespace NOCResponse.
 namespace UpdateFabricLabel {
@@ -9422,28 +4544,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLabel>(reader, label);
 }
 } // namespace UpdateFabricLabel.
 namespace RemoveFabric {
@@ -9456,28 +4557,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kFabricIndex>(reader, fabricIndex);
 }
 } // namespace RemoveFabric.
 namespace AddTrustedRootCertificate {
@@ -9490,28 +4570,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kRootCACertificate))
-        {
-            err = DataModel::Decode(reader, rootCACertificate);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kRootCACertificate>(reader, rootCACertificate);
 }
 } // namespace AddTrustedRootCertificate.
 } // namespace Commands
@@ -9584,40 +4643,8 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupId))
-        {
-            err = DataModel::Decode(reader, groupId);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpoints))
-        {
-            err = DataModel::Decode(reader, endpoints);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupName))
-        {
-            err = DataModel::Decode(reader, groupName);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupId, Fields::kEndpoints, Fields::kGroupName, Fields::kFabricIndex>(
+        reader, groupId, endpoints, groupName, fabricIndex);
 }
 
 } // namespace GroupInfoMapStruct
@@ -9650,36 +4677,8 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupId))
-        {
-            err = DataModel::Decode(reader, groupId);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupKeySetID))
-        {
-            err = DataModel::Decode(reader, groupKeySetID);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupId, Fields::kGroupKeySetID, Fields::kFabricIndex>(reader, groupId, groupKeySetID,
+                                                                                                   fabricIndex);
 }
 
 } // namespace GroupKeyMapStruct
@@ -9701,56 +4700,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupKeySetID))
-        {
-            err = DataModel::Decode(reader, groupKeySetID);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupKeySecurityPolicy))
-        {
-            err = DataModel::Decode(reader, groupKeySecurityPolicy);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochKey0))
-        {
-            err = DataModel::Decode(reader, epochKey0);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochStartTime0))
-        {
-            err = DataModel::Decode(reader, epochStartTime0);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochKey1))
-        {
-            err = DataModel::Decode(reader, epochKey1);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochStartTime1))
-        {
-            err = DataModel::Decode(reader, epochStartTime1);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochKey2))
-        {
-            err = DataModel::Decode(reader, epochKey2);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpochStartTime2))
-        {
-            err = DataModel::Decode(reader, epochStartTime2);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupKeySetID, Fields::kGroupKeySecurityPolicy, Fields::kEpochKey0,
+                                   Fields::kEpochStartTime0, Fields::kEpochKey1, Fields::kEpochStartTime1, Fields::kEpochKey2,
+                                   Fields::kEpochStartTime2>(reader, groupKeySetID, groupKeySecurityPolicy, epochKey0,
+                                                             epochStartTime0, epochKey1, epochStartTime1, epochKey2,
+                                                             epochStartTime2);
 }
 
 } // namespace GroupKeySetStruct
@@ -9767,28 +4721,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupKeySet))
-        {
-            err = DataModel::Decode(reader, groupKeySet);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupKeySet>(reader, groupKeySet);
 }
 } // namespace KeySetWrite.
 namespace KeySetRead {
@@ -9801,28 +4734,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupKeySetID))
-        {
-            err = DataModel::Decode(reader, groupKeySetID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupKeySetID>(reader, groupKeySetID);
 }
 } // namespace KeySetRead.
 namespace KeySetReadResponse {
@@ -9835,28 +4747,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupKeySet))
-        {
-            err = DataModel::Decode(reader, groupKeySet);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupKeySet>(reader, groupKeySet);
 }
 } // namespace KeySetReadResponse.
 namespace KeySetRemove {
@@ -9869,28 +4760,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupKeySetID))
-        {
-            err = DataModel::Decode(reader, groupKeySetID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupKeySetID>(reader, groupKeySetID);
 }
 } // namespace KeySetRemove.
 namespace KeySetReadAllIndices {
@@ -9902,15 +4772,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace KeySetReadAllIndices.
 namespace KeySetReadAllIndicesResponse {
@@ -9923,28 +4785,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupKeySetIDs))
-        {
-            err = DataModel::Decode(reader, groupKeySetIDs);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupKeySetIDs>(reader, groupKeySetIDs);
 }
 } // namespace KeySetReadAllIndicesResponse.
 } // namespace Commands
@@ -10166,28 +5007,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStateValue))
-        {
-            err = DataModel::Decode(reader, stateValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStateValue>(reader, stateValue);
 }
 } // namespace StateChange.
 } // namespace Events
@@ -10235,40 +5055,8 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCheckInNodeID))
-        {
-            err = DataModel::Decode(reader, checkInNodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kMonitoredSubject))
-        {
-            err = DataModel::Decode(reader, monitoredSubject);
-        }
-        else if (__context_tag == to_underlying(Fields::kClientType))
-        {
-            err = DataModel::Decode(reader, clientType);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCheckInNodeID, Fields::kMonitoredSubject, Fields::kClientType,
+                                   Fields::kFabricIndex>(reader, checkInNodeID, monitoredSubject, clientType, fabricIndex);
 }
 
 } // namespace MonitoringRegistrationStruct
@@ -10289,44 +5077,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCheckInNodeID))
-        {
-            err = DataModel::Decode(reader, checkInNodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kMonitoredSubject))
-        {
-            err = DataModel::Decode(reader, monitoredSubject);
-        }
-        else if (__context_tag == to_underlying(Fields::kKey))
-        {
-            err = DataModel::Decode(reader, key);
-        }
-        else if (__context_tag == to_underlying(Fields::kVerificationKey))
-        {
-            err = DataModel::Decode(reader, verificationKey);
-        }
-        else if (__context_tag == to_underlying(Fields::kClientType))
-        {
-            err = DataModel::Decode(reader, clientType);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCheckInNodeID, Fields::kMonitoredSubject, Fields::kKey, Fields::kVerificationKey,
+                                   Fields::kClientType>(reader, checkInNodeID, monitoredSubject, key, verificationKey, clientType);
 }
 } // namespace RegisterClient.
 namespace RegisterClientResponse {
@@ -10339,28 +5091,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kICDCounter))
-        {
-            err = DataModel::Decode(reader, ICDCounter);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kICDCounter>(reader, ICDCounter);
 }
 } // namespace RegisterClientResponse.
 namespace UnregisterClient {
@@ -10374,32 +5105,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCheckInNodeID))
-        {
-            err = DataModel::Decode(reader, checkInNodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kVerificationKey))
-        {
-            err = DataModel::Decode(reader, verificationKey);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCheckInNodeID, Fields::kVerificationKey>(reader, checkInNodeID, verificationKey);
 }
 } // namespace UnregisterClient.
 namespace StayActiveRequest {
@@ -10412,28 +5118,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStayActiveDuration))
-        {
-            err = DataModel::Decode(reader, stayActiveDuration);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStayActiveDuration>(reader, stayActiveDuration);
 }
 } // namespace StayActiveRequest.
 namespace StayActiveResponse {
@@ -10446,28 +5131,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPromisedActiveDuration))
-        {
-            err = DataModel::Decode(reader, promisedActiveDuration);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPromisedActiveDuration>(reader, promisedActiveDuration);
 }
 } // namespace StayActiveResponse.
 } // namespace Commands
@@ -10529,28 +5193,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewTime))
-        {
-            err = DataModel::Decode(reader, newTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewTime>(reader, newTime);
 }
 } // namespace SetTimer.
 namespace ResetTimer {
@@ -10562,15 +5205,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ResetTimer.
 namespace AddTime {
@@ -10583,28 +5218,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAdditionalTime))
-        {
-            err = DataModel::Decode(reader, additionalTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAdditionalTime>(reader, additionalTime);
 }
 } // namespace AddTime.
 namespace ReduceTime {
@@ -10617,28 +5231,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTimeReduction))
-        {
-            err = DataModel::Decode(reader, timeReduction);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTimeReduction>(reader, timeReduction);
 }
 } // namespace ReduceTime.
 } // namespace Commands
@@ -10686,15 +5279,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Pause.
 namespace Stop {
@@ -10706,15 +5291,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Stop.
 namespace Start {
@@ -10726,15 +5303,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Start.
 namespace Resume {
@@ -10746,15 +5315,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Resume.
 namespace OperationalCommandResponse {
@@ -10767,28 +5328,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCommandResponseState))
-        {
-            err = DataModel::Decode(reader, commandResponseState);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCommandResponseState>(reader, commandResponseState);
 }
 } // namespace OperationalCommandResponse.
 } // namespace Commands
@@ -10838,28 +5378,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kErrorState))
-        {
-            err = DataModel::Decode(reader, errorState);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kErrorState>(reader, errorState);
 }
 } // namespace OperationalError.
 namespace OperationCompletion {
@@ -10875,36 +5394,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCompletionErrorCode))
-        {
-            err = DataModel::Decode(reader, completionErrorCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kTotalOperationalTime))
-        {
-            err = DataModel::Decode(reader, totalOperationalTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kPausedTime))
-        {
-            err = DataModel::Decode(reader, pausedTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCompletionErrorCode, Fields::kTotalOperationalTime, Fields::kPausedTime>(
+        reader, completionErrorCode, totalOperationalTime, pausedTime);
 }
 } // namespace OperationCompletion.
 } // namespace Events
@@ -10924,28 +5415,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewMode))
-        {
-            err = DataModel::Decode(reader, newMode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewMode>(reader, newMode);
 }
 } // namespace ChangeToMode.
 namespace ChangeToModeResponse {
@@ -10959,32 +5429,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusText))
-        {
-            err = DataModel::Decode(reader, statusText);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kStatusText>(reader, status, statusText);
 }
 } // namespace ChangeToModeResponse.
 } // namespace Commands
@@ -11067,32 +5512,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMfgCode))
-        {
-            err = DataModel::Decode(reader, mfgCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMfgCode, Fields::kValue>(reader, mfgCode, value);
 }
 
 } // namespace SemanticTagStruct
@@ -11109,36 +5529,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else if (__context_tag == to_underlying(Fields::kMode))
-        {
-            err = DataModel::Decode(reader, mode);
-        }
-        else if (__context_tag == to_underlying(Fields::kSemanticTags))
-        {
-            err = DataModel::Decode(reader, semanticTags);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLabel, Fields::kMode, Fields::kSemanticTags>(reader, label, mode, semanticTags);
 }
 
 } // namespace ModeOptionStruct
@@ -11155,28 +5546,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewMode))
-        {
-            err = DataModel::Decode(reader, newMode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewMode>(reader, newMode);
 }
 } // namespace ChangeToMode.
 } // namespace Commands
@@ -11231,28 +5601,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewMode))
-        {
-            err = DataModel::Decode(reader, newMode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewMode>(reader, newMode);
 }
 } // namespace ChangeToMode.
 namespace ChangeToModeResponse {
@@ -11266,32 +5615,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusText))
-        {
-            err = DataModel::Decode(reader, statusText);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kStatusText>(reader, status, statusText);
 }
 } // namespace ChangeToModeResponse.
 } // namespace Commands
@@ -11342,28 +5666,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewMode))
-        {
-            err = DataModel::Decode(reader, newMode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewMode>(reader, newMode);
 }
 } // namespace ChangeToMode.
 namespace ChangeToModeResponse {
@@ -11377,32 +5680,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusText))
-        {
-            err = DataModel::Decode(reader, statusText);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kStatusText>(reader, status, statusText);
 }
 } // namespace ChangeToModeResponse.
 } // namespace Commands
@@ -11489,28 +5767,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewMode))
-        {
-            err = DataModel::Decode(reader, newMode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewMode>(reader, newMode);
 }
 } // namespace ChangeToMode.
 namespace ChangeToModeResponse {
@@ -11524,32 +5781,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusText))
-        {
-            err = DataModel::Decode(reader, statusText);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kStatusText>(reader, status, statusText);
 }
 } // namespace ChangeToModeResponse.
 } // namespace Commands
@@ -11596,28 +5828,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewMode))
-        {
-            err = DataModel::Decode(reader, newMode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewMode>(reader, newMode);
 }
 } // namespace ChangeToMode.
 namespace ChangeToModeResponse {
@@ -11631,32 +5842,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusText))
-        {
-            err = DataModel::Decode(reader, statusText);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kStatusText>(reader, status, statusText);
 }
 } // namespace ChangeToModeResponse.
 } // namespace Commands
@@ -11703,32 +5889,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTargetTemperature))
-        {
-            err = DataModel::Decode(reader, targetTemperature);
-        }
-        else if (__context_tag == to_underlying(Fields::kTargetTemperatureLevel))
-        {
-            err = DataModel::Decode(reader, targetTemperatureLevel);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTargetTemperature, Fields::kTargetTemperatureLevel>(reader, targetTemperature,
+                                                                                                targetTemperatureLevel);
 }
 } // namespace SetTemperature.
 } // namespace Commands
@@ -11815,40 +5977,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActive))
-        {
-            err = DataModel::Decode(reader, active);
-        }
-        else if (__context_tag == to_underlying(Fields::kInactive))
-        {
-            err = DataModel::Decode(reader, inactive);
-        }
-        else if (__context_tag == to_underlying(Fields::kState))
-        {
-            err = DataModel::Decode(reader, state);
-        }
-        else if (__context_tag == to_underlying(Fields::kMask))
-        {
-            err = DataModel::Decode(reader, mask);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActive, Fields::kInactive, Fields::kState, Fields::kMask>(reader, active, inactive,
+                                                                                                      state, mask);
 }
 } // namespace Notify.
 } // namespace Events
@@ -11868,28 +5998,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewMode))
-        {
-            err = DataModel::Decode(reader, newMode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewMode>(reader, newMode);
 }
 } // namespace ChangeToMode.
 namespace ChangeToModeResponse {
@@ -11903,32 +6012,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusText))
-        {
-            err = DataModel::Decode(reader, statusText);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kStatusText>(reader, status, statusText);
 }
 } // namespace ChangeToModeResponse.
 } // namespace Commands
@@ -12007,15 +6091,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace SelfTestRequest.
 } // namespace Commands
@@ -12079,28 +6155,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAlarmSeverityLevel))
-        {
-            err = DataModel::Decode(reader, alarmSeverityLevel);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAlarmSeverityLevel>(reader, alarmSeverityLevel);
 }
 } // namespace SmokeAlarm.
 namespace COAlarm {
@@ -12114,28 +6169,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAlarmSeverityLevel))
-        {
-            err = DataModel::Decode(reader, alarmSeverityLevel);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAlarmSeverityLevel>(reader, alarmSeverityLevel);
 }
 } // namespace COAlarm.
 namespace LowBattery {
@@ -12149,28 +6183,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAlarmSeverityLevel))
-        {
-            err = DataModel::Decode(reader, alarmSeverityLevel);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAlarmSeverityLevel>(reader, alarmSeverityLevel);
 }
 } // namespace LowBattery.
 namespace HardwareFault {
@@ -12183,15 +6196,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace HardwareFault.
 namespace EndOfService {
@@ -12204,15 +6209,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace EndOfService.
 namespace SelfTestComplete {
@@ -12225,15 +6222,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace SelfTestComplete.
 namespace AlarmMuted {
@@ -12246,15 +6235,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace AlarmMuted.
 namespace MuteEnded {
@@ -12267,15 +6248,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace MuteEnded.
 namespace InterconnectSmokeAlarm {
@@ -12289,28 +6262,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAlarmSeverityLevel))
-        {
-            err = DataModel::Decode(reader, alarmSeverityLevel);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAlarmSeverityLevel>(reader, alarmSeverityLevel);
 }
 } // namespace InterconnectSmokeAlarm.
 namespace InterconnectCOAlarm {
@@ -12324,28 +6276,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAlarmSeverityLevel))
-        {
-            err = DataModel::Decode(reader, alarmSeverityLevel);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAlarmSeverityLevel>(reader, alarmSeverityLevel);
 }
 } // namespace InterconnectCOAlarm.
 namespace AllClear {
@@ -12358,15 +6289,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace AllClear.
 } // namespace Events
@@ -12385,28 +6308,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAlarms))
-        {
-            err = DataModel::Decode(reader, alarms);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAlarms>(reader, alarms);
 }
 } // namespace Reset.
 namespace ModifyEnabledAlarms {
@@ -12419,28 +6321,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMask))
-        {
-            err = DataModel::Decode(reader, mask);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMask>(reader, mask);
 }
 } // namespace ModifyEnabledAlarms.
 } // namespace Commands
@@ -12489,40 +6370,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActive))
-        {
-            err = DataModel::Decode(reader, active);
-        }
-        else if (__context_tag == to_underlying(Fields::kInactive))
-        {
-            err = DataModel::Decode(reader, inactive);
-        }
-        else if (__context_tag == to_underlying(Fields::kState))
-        {
-            err = DataModel::Decode(reader, state);
-        }
-        else if (__context_tag == to_underlying(Fields::kMask))
-        {
-            err = DataModel::Decode(reader, mask);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActive, Fields::kInactive, Fields::kState, Fields::kMask>(reader, active, inactive,
+                                                                                                      state, mask);
 }
 } // namespace Notify.
 } // namespace Events
@@ -12578,44 +6427,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCookMode))
-        {
-            err = DataModel::Decode(reader, cookMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kCookTime))
-        {
-            err = DataModel::Decode(reader, cookTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kPowerSetting))
-        {
-            err = DataModel::Decode(reader, powerSetting);
-        }
-        else if (__context_tag == to_underlying(Fields::kWattSettingIndex))
-        {
-            err = DataModel::Decode(reader, wattSettingIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartAfterSetting))
-        {
-            err = DataModel::Decode(reader, startAfterSetting);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCookMode, Fields::kCookTime, Fields::kPowerSetting, Fields::kWattSettingIndex,
+                                   Fields::kStartAfterSetting>(reader, cookMode, cookTime, powerSetting, wattSettingIndex,
+                                                               startAfterSetting);
 }
 } // namespace SetCookingParameters.
 namespace AddMoreTime {
@@ -12628,28 +6442,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTimeToAdd))
-        {
-            err = DataModel::Decode(reader, timeToAdd);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTimeToAdd>(reader, timeToAdd);
 }
 } // namespace AddMoreTime.
 } // namespace Commands
@@ -12709,15 +6502,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Pause.
 namespace Stop {
@@ -12729,15 +6514,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Stop.
 namespace Start {
@@ -12749,15 +6526,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Start.
 namespace Resume {
@@ -12769,15 +6538,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Resume.
 namespace OperationalCommandResponse {
@@ -12790,28 +6551,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCommandResponseState))
-        {
-            err = DataModel::Decode(reader, commandResponseState);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCommandResponseState>(reader, commandResponseState);
 }
 } // namespace OperationalCommandResponse.
 } // namespace Commands
@@ -12861,28 +6601,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kErrorState))
-        {
-            err = DataModel::Decode(reader, errorState);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kErrorState>(reader, errorState);
 }
 } // namespace OperationalError.
 namespace OperationCompletion {
@@ -12898,36 +6617,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCompletionErrorCode))
-        {
-            err = DataModel::Decode(reader, completionErrorCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kTotalOperationalTime))
-        {
-            err = DataModel::Decode(reader, totalOperationalTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kPausedTime))
-        {
-            err = DataModel::Decode(reader, pausedTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCompletionErrorCode, Fields::kTotalOperationalTime, Fields::kPausedTime>(
+        reader, completionErrorCode, totalOperationalTime, pausedTime);
 }
 } // namespace OperationCompletion.
 } // namespace Events
@@ -12946,15 +6637,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Pause.
 namespace Resume {
@@ -12966,15 +6649,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Resume.
 namespace OperationalCommandResponse {
@@ -12987,28 +6662,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCommandResponseState))
-        {
-            err = DataModel::Decode(reader, commandResponseState);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCommandResponseState>(reader, commandResponseState);
 }
 } // namespace OperationalCommandResponse.
 namespace GoHome {
@@ -13020,15 +6674,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace GoHome.
 } // namespace Commands
@@ -13078,28 +6724,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kErrorState))
-        {
-            err = DataModel::Decode(reader, errorState);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kErrorState>(reader, errorState);
 }
 } // namespace OperationalError.
 namespace OperationCompletion {
@@ -13115,36 +6740,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCompletionErrorCode))
-        {
-            err = DataModel::Decode(reader, completionErrorCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kTotalOperationalTime))
-        {
-            err = DataModel::Decode(reader, totalOperationalTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kPausedTime))
-        {
-            err = DataModel::Decode(reader, pausedTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCompletionErrorCode, Fields::kTotalOperationalTime, Fields::kPausedTime>(
+        reader, completionErrorCode, totalOperationalTime, pausedTime);
 }
 } // namespace OperationCompletion.
 } // namespace Events
@@ -13171,60 +6768,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAttributeID))
-        {
-            err = DataModel::Decode(reader, attributeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueUnsigned8))
-        {
-            err = DataModel::Decode(reader, valueUnsigned8);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueSigned8))
-        {
-            err = DataModel::Decode(reader, valueSigned8);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueUnsigned16))
-        {
-            err = DataModel::Decode(reader, valueUnsigned16);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueSigned16))
-        {
-            err = DataModel::Decode(reader, valueSigned16);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueUnsigned32))
-        {
-            err = DataModel::Decode(reader, valueUnsigned32);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueSigned32))
-        {
-            err = DataModel::Decode(reader, valueSigned32);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueUnsigned64))
-        {
-            err = DataModel::Decode(reader, valueUnsigned64);
-        }
-        else if (__context_tag == to_underlying(Fields::kValueSigned64))
-        {
-            err = DataModel::Decode(reader, valueSigned64);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAttributeID, Fields::kValueUnsigned8, Fields::kValueSigned8, Fields::kValueUnsigned16,
+                                   Fields::kValueSigned16, Fields::kValueUnsigned32, Fields::kValueSigned32,
+                                   Fields::kValueUnsigned64, Fields::kValueSigned64>(
+        reader, attributeID, valueUnsigned8, valueSigned8, valueUnsigned16, valueSigned16, valueUnsigned32, valueSigned32,
+        valueUnsigned64, valueSigned64);
 }
 
 } // namespace AttributeValuePairStruct
@@ -13240,32 +6788,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kClusterID))
-        {
-            err = DataModel::Decode(reader, clusterID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAttributeValueList))
-        {
-            err = DataModel::Decode(reader, attributeValueList);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kClusterID, Fields::kAttributeValueList>(reader, clusterID, attributeValueList);
 }
 
 } // namespace ExtensionFieldSet
@@ -13311,48 +6834,9 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSceneCount))
-        {
-            err = DataModel::Decode(reader, sceneCount);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrentScene))
-        {
-            err = DataModel::Decode(reader, currentScene);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrentGroup))
-        {
-            err = DataModel::Decode(reader, currentGroup);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneValid))
-        {
-            err = DataModel::Decode(reader, sceneValid);
-        }
-        else if (__context_tag == to_underlying(Fields::kRemainingCapacity))
-        {
-            err = DataModel::Decode(reader, remainingCapacity);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSceneCount, Fields::kCurrentScene, Fields::kCurrentGroup, Fields::kSceneValid,
+                                   Fields::kRemainingCapacity, Fields::kFabricIndex>(reader, sceneCount, currentScene, currentGroup,
+                                                                                     sceneValid, remainingCapacity, fabricIndex);
 }
 
 } // namespace SceneInfoStruct
@@ -13373,44 +6857,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneID))
-        {
-            err = DataModel::Decode(reader, sceneID);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneName))
-        {
-            err = DataModel::Decode(reader, sceneName);
-        }
-        else if (__context_tag == to_underlying(Fields::kExtensionFieldSets))
-        {
-            err = DataModel::Decode(reader, extensionFieldSets);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupID, Fields::kSceneID, Fields::kTransitionTime, Fields::kSceneName,
+                                   Fields::kExtensionFieldSets>(reader, groupID, sceneID, transitionTime, sceneName,
+                                                                extensionFieldSets);
 }
 } // namespace AddScene.
 namespace AddSceneResponse {
@@ -13425,36 +6874,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneID))
-        {
-            err = DataModel::Decode(reader, sceneID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kGroupID, Fields::kSceneID>(reader, status, groupID, sceneID);
 }
 } // namespace AddSceneResponse.
 namespace ViewScene {
@@ -13468,32 +6888,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneID))
-        {
-            err = DataModel::Decode(reader, sceneID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupID, Fields::kSceneID>(reader, groupID, sceneID);
 }
 } // namespace ViewScene.
 namespace ViewSceneResponse {
@@ -13511,48 +6906,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneID))
-        {
-            err = DataModel::Decode(reader, sceneID);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneName))
-        {
-            err = DataModel::Decode(reader, sceneName);
-        }
-        else if (__context_tag == to_underlying(Fields::kExtensionFieldSets))
-        {
-            err = DataModel::Decode(reader, extensionFieldSets);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kGroupID, Fields::kSceneID, Fields::kTransitionTime, Fields::kSceneName,
+                                   Fields::kExtensionFieldSets>(reader, status, groupID, sceneID, transitionTime, sceneName,
+                                                                extensionFieldSets);
 }
 } // namespace ViewSceneResponse.
 namespace RemoveScene {
@@ -13566,32 +6922,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneID))
-        {
-            err = DataModel::Decode(reader, sceneID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupID, Fields::kSceneID>(reader, groupID, sceneID);
 }
 } // namespace RemoveScene.
 namespace RemoveSceneResponse {
@@ -13606,36 +6937,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneID))
-        {
-            err = DataModel::Decode(reader, sceneID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kGroupID, Fields::kSceneID>(reader, status, groupID, sceneID);
 }
 } // namespace RemoveSceneResponse.
 namespace RemoveAllScenes {
@@ -13648,28 +6950,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupID>(reader, groupID);
 }
 } // namespace RemoveAllScenes.
 namespace RemoveAllScenesResponse {
@@ -13683,32 +6964,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kGroupID>(reader, status, groupID);
 }
 } // namespace RemoveAllScenesResponse.
 namespace StoreScene {
@@ -13722,32 +6978,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneID))
-        {
-            err = DataModel::Decode(reader, sceneID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupID, Fields::kSceneID>(reader, groupID, sceneID);
 }
 } // namespace StoreScene.
 namespace StoreSceneResponse {
@@ -13762,36 +6993,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneID))
-        {
-            err = DataModel::Decode(reader, sceneID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kGroupID, Fields::kSceneID>(reader, status, groupID, sceneID);
 }
 } // namespace StoreSceneResponse.
 namespace RecallScene {
@@ -13806,36 +7008,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneID))
-        {
-            err = DataModel::Decode(reader, sceneID);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupID, Fields::kSceneID, Fields::kTransitionTime>(reader, groupID, sceneID,
+                                                                                                transitionTime);
 }
 } // namespace RecallScene.
 namespace GetSceneMembership {
@@ -13848,28 +7022,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kGroupID>(reader, groupID);
 }
 } // namespace GetSceneMembership.
 namespace GetSceneMembershipResponse {
@@ -13885,40 +7038,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kCapacity))
-        {
-            err = DataModel::Decode(reader, capacity);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupID))
-        {
-            err = DataModel::Decode(reader, groupID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneList))
-        {
-            err = DataModel::Decode(reader, sceneList);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kCapacity, Fields::kGroupID, Fields::kSceneList>(
+        reader, status, capacity, groupID, sceneList);
 }
 } // namespace GetSceneMembershipResponse.
 namespace CopyScene {
@@ -13935,44 +7056,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMode))
-        {
-            err = DataModel::Decode(reader, mode);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupIdentifierFrom))
-        {
-            err = DataModel::Decode(reader, groupIdentifierFrom);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneIdentifierFrom))
-        {
-            err = DataModel::Decode(reader, sceneIdentifierFrom);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupIdentifierTo))
-        {
-            err = DataModel::Decode(reader, groupIdentifierTo);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneIdentifierTo))
-        {
-            err = DataModel::Decode(reader, sceneIdentifierTo);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMode, Fields::kGroupIdentifierFrom, Fields::kSceneIdentifierFrom,
+                                   Fields::kGroupIdentifierTo, Fields::kSceneIdentifierTo>(
+        reader, mode, groupIdentifierFrom, sceneIdentifierFrom, groupIdentifierTo, sceneIdentifierTo);
 }
 } // namespace CopyScene.
 namespace CopySceneResponse {
@@ -13987,36 +7073,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupIdentifierFrom))
-        {
-            err = DataModel::Decode(reader, groupIdentifierFrom);
-        }
-        else if (__context_tag == to_underlying(Fields::kSceneIdentifierFrom))
-        {
-            err = DataModel::Decode(reader, sceneIdentifierFrom);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kGroupIdentifierFrom, Fields::kSceneIdentifierFrom>(
+        reader, status, groupIdentifierFrom, sceneIdentifierFrom);
 }
 } // namespace CopySceneResponse.
 } // namespace Commands
@@ -14065,32 +7123,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kProductIdentifierType))
-        {
-            err = DataModel::Decode(reader, productIdentifierType);
-        }
-        else if (__context_tag == to_underlying(Fields::kProductIdentifierValue))
-        {
-            err = DataModel::Decode(reader, productIdentifierValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kProductIdentifierType, Fields::kProductIdentifierValue>(reader, productIdentifierType,
+                                                                                                    productIdentifierValue);
 }
 
 } // namespace ReplacementProductStruct
@@ -14106,15 +7140,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ResetCondition.
 } // namespace Commands
@@ -14169,32 +7195,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kProductIdentifierType))
-        {
-            err = DataModel::Decode(reader, productIdentifierType);
-        }
-        else if (__context_tag == to_underlying(Fields::kProductIdentifierValue))
-        {
-            err = DataModel::Decode(reader, productIdentifierValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kProductIdentifierType, Fields::kProductIdentifierValue>(reader, productIdentifierType,
+                                                                                                    productIdentifierValue);
 }
 
 } // namespace ReplacementProductStruct
@@ -14210,15 +7212,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ResetCondition.
 } // namespace Commands
@@ -14272,28 +7266,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAlarmsToSuppress))
-        {
-            err = DataModel::Decode(reader, alarmsToSuppress);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAlarmsToSuppress>(reader, alarmsToSuppress);
 }
 } // namespace SuppressAlarm.
 namespace EnableDisableAlarm {
@@ -14306,28 +7279,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAlarmsToEnableDisable))
-        {
-            err = DataModel::Decode(reader, alarmsToEnableDisable);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAlarmsToEnableDisable>(reader, alarmsToEnableDisable);
 }
 } // namespace EnableDisableAlarm.
 } // namespace Commands
@@ -14382,32 +7334,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAlarmsActive))
-        {
-            err = DataModel::Decode(reader, alarmsActive);
-        }
-        else if (__context_tag == to_underlying(Fields::kAlarmsSuppressed))
-        {
-            err = DataModel::Decode(reader, alarmsSuppressed);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAlarmsActive, Fields::kAlarmsSuppressed>(reader, alarmsActive, alarmsSuppressed);
 }
 } // namespace AlarmsStateChanged.
 namespace SensorFault {
@@ -14421,28 +7348,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSensorFault))
-        {
-            err = DataModel::Decode(reader, sensorFault);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSensorFault>(reader, sensorFault);
 }
 } // namespace SensorFault.
 } // namespace Events
@@ -14462,32 +7368,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOpenDuration))
-        {
-            err = DataModel::Decode(reader, openDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kTargetLevel))
-        {
-            err = DataModel::Decode(reader, targetLevel);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOpenDuration, Fields::kTargetLevel>(reader, openDuration, targetLevel);
 }
 } // namespace Open.
 namespace Close {
@@ -14499,15 +7380,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Close.
 } // namespace Commands
@@ -14568,32 +7441,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kValveState))
-        {
-            err = DataModel::Decode(reader, valveState);
-        }
-        else if (__context_tag == to_underlying(Fields::kValveLevel))
-        {
-            err = DataModel::Decode(reader, valveLevel);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kValveState, Fields::kValveLevel>(reader, valveState, valveLevel);
 }
 } // namespace ValveStateChanged.
 namespace ValveFault {
@@ -14607,28 +7455,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kValveFault))
-        {
-            err = DataModel::Decode(reader, valveFault);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kValveFault>(reader, valveFault);
 }
 } // namespace ValveFault.
 } // namespace Events
@@ -14648,32 +7475,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOrder))
-        {
-            err = DataModel::Decode(reader, order);
-        }
-        else if (__context_tag == to_underlying(Fields::kMeasurement))
-        {
-            err = DataModel::Decode(reader, measurement);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOrder, Fields::kMeasurement>(reader, order, measurement);
 }
 
 } // namespace HarmonicMeasurementStruct
@@ -14698,72 +7500,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
+    return DataModel::DecodeStruct<Fields::kMeasurementType, Fields::kMin, Fields::kMax, Fields::kStartTimestamp,
+                                   Fields::kEndTimestamp, Fields::kMinTimestamp, Fields::kMaxTimestamp, Fields::kStartSystime,
+                                   Fields::kEndSystime, Fields::kMinSystime, Fields::kMaxSystime>(
+        reader, measurementType, min, max, startTimestamp, endTimestamp, minTimestamp, maxTimestamp, startSystime, endSystime,
+        minSystime, maxSystime);
+}
 
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMeasurementType))
-        {
-            err = DataModel::Decode(reader, measurementType);
-        }
-        else if (__context_tag == to_underlying(Fields::kMin))
-        {
-            err = DataModel::Decode(reader, min);
-        }
-        else if (__context_tag == to_underlying(Fields::kMax))
-        {
-            err = DataModel::Decode(reader, max);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTimestamp))
-        {
-            err = DataModel::Decode(reader, startTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndTimestamp))
-        {
-            err = DataModel::Decode(reader, endTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinTimestamp))
-        {
-            err = DataModel::Decode(reader, minTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxTimestamp))
-        {
-            err = DataModel::Decode(reader, maxTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartSystime))
-        {
-            err = DataModel::Decode(reader, startSystime);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndSystime))
-        {
-            err = DataModel::Decode(reader, endSystime);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinSystime))
-        {
-            err = DataModel::Decode(reader, minSystime);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxSystime))
-        {
-            err = DataModel::Decode(reader, maxSystime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
-}
-
-} // namespace MeasurementRangeStruct
-} // namespace Structs
+} // namespace MeasurementRangeStruct
+} // namespace Structs
 
 namespace Commands {} // namespace Commands
 
@@ -14838,28 +7583,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kRanges))
-        {
-            err = DataModel::Decode(reader, ranges);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kRanges>(reader, ranges);
 }
 } // namespace MeasurementPeriodRanges.
 } // namespace Events
@@ -14881,40 +7605,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kImportedResetTimestamp))
-        {
-            err = DataModel::Decode(reader, importedResetTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kExportedResetTimestamp))
-        {
-            err = DataModel::Decode(reader, exportedResetTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kImportedResetSystime))
-        {
-            err = DataModel::Decode(reader, importedResetSystime);
-        }
-        else if (__context_tag == to_underlying(Fields::kExportedResetSystime))
-        {
-            err = DataModel::Decode(reader, exportedResetSystime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kImportedResetTimestamp, Fields::kExportedResetTimestamp, Fields::kImportedResetSystime,
+                                   Fields::kExportedResetSystime>(reader, importedResetTimestamp, exportedResetTimestamp,
+                                                                  importedResetSystime, exportedResetSystime);
 }
 
 } // namespace CumulativeEnergyResetStruct
@@ -14933,44 +7626,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEnergy))
-        {
-            err = DataModel::Decode(reader, energy);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTimestamp))
-        {
-            err = DataModel::Decode(reader, startTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndTimestamp))
-        {
-            err = DataModel::Decode(reader, endTimestamp);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartSystime))
-        {
-            err = DataModel::Decode(reader, startSystime);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndSystime))
-        {
-            err = DataModel::Decode(reader, endSystime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEnergy, Fields::kStartTimestamp, Fields::kEndTimestamp, Fields::kStartSystime,
+                                   Fields::kEndSystime>(reader, energy, startTimestamp, endTimestamp, startSystime, endSystime);
 }
 
 } // namespace EnergyMeasurementStruct
@@ -15024,32 +7681,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEnergyImported))
-        {
-            err = DataModel::Decode(reader, energyImported);
-        }
-        else if (__context_tag == to_underlying(Fields::kEnergyExported))
-        {
-            err = DataModel::Decode(reader, energyExported);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEnergyImported, Fields::kEnergyExported>(reader, energyImported, energyExported);
 }
 } // namespace CumulativeEnergyMeasured.
 namespace PeriodicEnergyMeasured {
@@ -15064,32 +7696,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEnergyImported))
-        {
-            err = DataModel::Decode(reader, energyImported);
-        }
-        else if (__context_tag == to_underlying(Fields::kEnergyExported))
-        {
-            err = DataModel::Decode(reader, energyExported);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEnergyImported, Fields::kEnergyExported>(reader, energyImported, energyExported);
 }
 } // namespace PeriodicEnergyMeasured.
 } // namespace Events
@@ -15113,48 +7720,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else if (__context_tag == to_underlying(Fields::kOneShot))
-        {
-            err = DataModel::Decode(reader, oneShot);
-        }
-        else if (__context_tag == to_underlying(Fields::kEmergencyBoost))
-        {
-            err = DataModel::Decode(reader, emergencyBoost);
-        }
-        else if (__context_tag == to_underlying(Fields::kTemporarySetpoint))
-        {
-            err = DataModel::Decode(reader, temporarySetpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kTargetPercentage))
-        {
-            err = DataModel::Decode(reader, targetPercentage);
-        }
-        else if (__context_tag == to_underlying(Fields::kTargetReheat))
-        {
-            err = DataModel::Decode(reader, targetReheat);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDuration, Fields::kOneShot, Fields::kEmergencyBoost, Fields::kTemporarySetpoint,
+                                   Fields::kTargetPercentage, Fields::kTargetReheat>(
+        reader, duration, oneShot, emergencyBoost, temporarySetpoint, targetPercentage, targetReheat);
 }
 
 } // namespace WaterHeaterBoostInfoStruct
@@ -15171,28 +7739,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kBoostInfo))
-        {
-            err = DataModel::Decode(reader, boostInfo);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kBoostInfo>(reader, boostInfo);
 }
 } // namespace Boost.
 namespace CancelBoost {
@@ -15204,15 +7751,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace CancelBoost.
 } // namespace Commands
@@ -15262,28 +7801,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kBoostInfo))
-        {
-            err = DataModel::Decode(reader, boostInfo);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kBoostInfo>(reader, boostInfo);
 }
 } // namespace BoostStarted.
 namespace BoostEnded {
@@ -15296,15 +7814,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace BoostEnded.
 } // namespace Events
@@ -15323,28 +7833,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kHeatingSource))
-        {
-            err = DataModel::Decode(reader, heatingSource);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kHeatingSource>(reader, heatingSource);
 }
 
 } // namespace HeatingSourceControlStruct
@@ -15359,28 +7848,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPowerSavings))
-        {
-            err = DataModel::Decode(reader, powerSavings);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPowerSavings>(reader, powerSavings);
 }
 
 } // namespace PowerSavingsControlStruct
@@ -15395,28 +7863,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDutyCycle))
-        {
-            err = DataModel::Decode(reader, dutyCycle);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDutyCycle>(reader, dutyCycle);
 }
 
 } // namespace DutyCycleControlStruct
@@ -15431,28 +7878,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLoadAdjustment))
-        {
-            err = DataModel::Decode(reader, loadAdjustment);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLoadAdjustment>(reader, loadAdjustment);
 }
 
 } // namespace AverageLoadControlStruct
@@ -15470,40 +7896,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCoolingTempOffset))
-        {
-            err = DataModel::Decode(reader, coolingTempOffset);
-        }
-        else if (__context_tag == to_underlying(Fields::kHeatingtTempOffset))
-        {
-            err = DataModel::Decode(reader, heatingtTempOffset);
-        }
-        else if (__context_tag == to_underlying(Fields::kCoolingTempSetpoint))
-        {
-            err = DataModel::Decode(reader, coolingTempSetpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kHeatingTempSetpoint))
-        {
-            err = DataModel::Decode(reader, heatingTempSetpoint);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCoolingTempOffset, Fields::kHeatingtTempOffset, Fields::kCoolingTempSetpoint,
+                                   Fields::kHeatingTempSetpoint>(reader, coolingTempOffset, heatingtTempOffset, coolingTempSetpoint,
+                                                                 heatingTempSetpoint);
 }
 
 } // namespace TemperatureControlStruct
@@ -15524,52 +7919,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else if (__context_tag == to_underlying(Fields::kControl))
-        {
-            err = DataModel::Decode(reader, control);
-        }
-        else if (__context_tag == to_underlying(Fields::kTemperatureControl))
-        {
-            err = DataModel::Decode(reader, temperatureControl);
-        }
-        else if (__context_tag == to_underlying(Fields::kAverageLoadControl))
-        {
-            err = DataModel::Decode(reader, averageLoadControl);
-        }
-        else if (__context_tag == to_underlying(Fields::kDutyCycleControl))
-        {
-            err = DataModel::Decode(reader, dutyCycleControl);
-        }
-        else if (__context_tag == to_underlying(Fields::kPowerSavingsControl))
-        {
-            err = DataModel::Decode(reader, powerSavingsControl);
-        }
-        else if (__context_tag == to_underlying(Fields::kHeatingSourceControl))
-        {
-            err = DataModel::Decode(reader, heatingSourceControl);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDuration, Fields::kControl, Fields::kTemperatureControl, Fields::kAverageLoadControl,
+                                   Fields::kDutyCycleControl, Fields::kPowerSavingsControl, Fields::kHeatingSourceControl>(
+        reader, duration, control, temperatureControl, averageLoadControl, dutyCycleControl, powerSavingsControl,
+        heatingSourceControl);
 }
 
 } // namespace LoadControlEventTransitionStruct
@@ -15591,56 +7944,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEventID))
-        {
-            err = DataModel::Decode(reader, eventID);
-        }
-        else if (__context_tag == to_underlying(Fields::kProgramID))
-        {
-            err = DataModel::Decode(reader, programID);
-        }
-        else if (__context_tag == to_underlying(Fields::kControl))
-        {
-            err = DataModel::Decode(reader, control);
-        }
-        else if (__context_tag == to_underlying(Fields::kDeviceClass))
-        {
-            err = DataModel::Decode(reader, deviceClass);
-        }
-        else if (__context_tag == to_underlying(Fields::kEnrollmentGroup))
-        {
-            err = DataModel::Decode(reader, enrollmentGroup);
-        }
-        else if (__context_tag == to_underlying(Fields::kCriticality))
-        {
-            err = DataModel::Decode(reader, criticality);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTime))
-        {
-            err = DataModel::Decode(reader, startTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitions))
-        {
-            err = DataModel::Decode(reader, transitions);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEventID, Fields::kProgramID, Fields::kControl, Fields::kDeviceClass,
+                                   Fields::kEnrollmentGroup, Fields::kCriticality, Fields::kStartTime, Fields::kTransitions>(
+        reader, eventID, programID, control, deviceClass, enrollmentGroup, criticality, startTime, transitions);
 }
 
 } // namespace LoadControlEventStruct
@@ -15659,48 +7965,13 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
+    return DataModel::DecodeStruct<Fields::kProgramID, Fields::kName, Fields::kEnrollmentGroup, Fields::kRandomStartMinutes,
+                                   Fields::kRandomDurationMinutes>(reader, programID, name, enrollmentGroup, randomStartMinutes,
+                                                                   randomDurationMinutes);
+}
 
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kProgramID))
-        {
-            err = DataModel::Decode(reader, programID);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kEnrollmentGroup))
-        {
-            err = DataModel::Decode(reader, enrollmentGroup);
-        }
-        else if (__context_tag == to_underlying(Fields::kRandomStartMinutes))
-        {
-            err = DataModel::Decode(reader, randomStartMinutes);
-        }
-        else if (__context_tag == to_underlying(Fields::kRandomDurationMinutes))
-        {
-            err = DataModel::Decode(reader, randomDurationMinutes);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
-}
-
-} // namespace LoadControlProgramStruct
-} // namespace Structs
+} // namespace LoadControlProgramStruct
+} // namespace Structs
 
 namespace Commands {
 namespace RegisterLoadControlProgramRequest {
@@ -15713,28 +7984,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLoadControlProgram))
-        {
-            err = DataModel::Decode(reader, loadControlProgram);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLoadControlProgram>(reader, loadControlProgram);
 }
 } // namespace RegisterLoadControlProgramRequest.
 namespace UnregisterLoadControlProgramRequest {
@@ -15747,28 +7997,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLoadControlProgramID))
-        {
-            err = DataModel::Decode(reader, loadControlProgramID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLoadControlProgramID>(reader, loadControlProgramID);
 }
 } // namespace UnregisterLoadControlProgramRequest.
 namespace AddLoadControlEventRequest {
@@ -15781,28 +8010,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEvent))
-        {
-            err = DataModel::Decode(reader, event);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEvent>(reader, event);
 }
 } // namespace AddLoadControlEventRequest.
 namespace RemoveLoadControlEventRequest {
@@ -15816,32 +8024,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEventID))
-        {
-            err = DataModel::Decode(reader, eventID);
-        }
-        else if (__context_tag == to_underlying(Fields::kCancelControl))
-        {
-            err = DataModel::Decode(reader, cancelControl);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEventID, Fields::kCancelControl>(reader, eventID, cancelControl);
 }
 } // namespace RemoveLoadControlEventRequest.
 namespace ClearLoadControlEventsRequest {
@@ -15853,15 +8036,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ClearLoadControlEventsRequest.
 } // namespace Commands
@@ -15924,64 +8099,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEventID))
-        {
-            err = DataModel::Decode(reader, eventID);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionIndex))
-        {
-            err = DataModel::Decode(reader, transitionIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kCriticality))
-        {
-            err = DataModel::Decode(reader, criticality);
-        }
-        else if (__context_tag == to_underlying(Fields::kControl))
-        {
-            err = DataModel::Decode(reader, control);
-        }
-        else if (__context_tag == to_underlying(Fields::kTemperatureControl))
-        {
-            err = DataModel::Decode(reader, temperatureControl);
-        }
-        else if (__context_tag == to_underlying(Fields::kAverageLoadControl))
-        {
-            err = DataModel::Decode(reader, averageLoadControl);
-        }
-        else if (__context_tag == to_underlying(Fields::kDutyCycleControl))
-        {
-            err = DataModel::Decode(reader, dutyCycleControl);
-        }
-        else if (__context_tag == to_underlying(Fields::kPowerSavingsControl))
-        {
-            err = DataModel::Decode(reader, powerSavingsControl);
-        }
-        else if (__context_tag == to_underlying(Fields::kHeatingSourceControl))
-        {
-            err = DataModel::Decode(reader, heatingSourceControl);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEventID, Fields::kTransitionIndex, Fields::kStatus, Fields::kCriticality,
+                                   Fields::kControl, Fields::kTemperatureControl, Fields::kAverageLoadControl,
+                                   Fields::kDutyCycleControl, Fields::kPowerSavingsControl, Fields::kHeatingSourceControl>(
+        reader, eventID, transitionIndex, status, criticality, control, temperatureControl, averageLoadControl, dutyCycleControl,
+        powerSavingsControl, heatingSourceControl);
 }
 } // namespace LoadControlEventStatusChange.
 } // namespace Events
@@ -16001,32 +8123,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMessageResponseID))
-        {
-            err = DataModel::Decode(reader, messageResponseID);
-        }
-        else if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMessageResponseID, Fields::kLabel>(reader, messageResponseID, label);
 }
 
 } // namespace MessageResponseOptionStruct
@@ -16047,52 +8144,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMessageID))
-        {
-            err = DataModel::Decode(reader, messageID);
-        }
-        else if (__context_tag == to_underlying(Fields::kPriority))
-        {
-            err = DataModel::Decode(reader, priority);
-        }
-        else if (__context_tag == to_underlying(Fields::kMessageControl))
-        {
-            err = DataModel::Decode(reader, messageControl);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTime))
-        {
-            err = DataModel::Decode(reader, startTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else if (__context_tag == to_underlying(Fields::kMessageText))
-        {
-            err = DataModel::Decode(reader, messageText);
-        }
-        else if (__context_tag == to_underlying(Fields::kResponses))
-        {
-            err = DataModel::Decode(reader, responses);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMessageID, Fields::kPriority, Fields::kMessageControl, Fields::kStartTime,
+                                   Fields::kDuration, Fields::kMessageText, Fields::kResponses>(
+        reader, messageID, priority, messageControl, startTime, duration, messageText, responses);
 }
 
 } // namespace MessageStruct
@@ -16115,52 +8169,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMessageID))
-        {
-            err = DataModel::Decode(reader, messageID);
-        }
-        else if (__context_tag == to_underlying(Fields::kPriority))
-        {
-            err = DataModel::Decode(reader, priority);
-        }
-        else if (__context_tag == to_underlying(Fields::kMessageControl))
-        {
-            err = DataModel::Decode(reader, messageControl);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTime))
-        {
-            err = DataModel::Decode(reader, startTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else if (__context_tag == to_underlying(Fields::kMessageText))
-        {
-            err = DataModel::Decode(reader, messageText);
-        }
-        else if (__context_tag == to_underlying(Fields::kResponses))
-        {
-            err = DataModel::Decode(reader, responses);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMessageID, Fields::kPriority, Fields::kMessageControl, Fields::kStartTime,
+                                   Fields::kDuration, Fields::kMessageText, Fields::kResponses>(
+        reader, messageID, priority, messageControl, startTime, duration, messageText, responses);
 }
 } // namespace PresentMessagesRequest.
 namespace CancelMessagesRequest {
@@ -16173,28 +8184,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMessageIDs))
-        {
-            err = DataModel::Decode(reader, messageIDs);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMessageIDs>(reader, messageIDs);
 }
 } // namespace CancelMessagesRequest.
 } // namespace Commands
@@ -16236,28 +8226,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMessageID))
-        {
-            err = DataModel::Decode(reader, messageID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMessageID>(reader, messageID);
 }
 } // namespace MessageQueued.
 namespace MessagePresented {
@@ -16271,28 +8240,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMessageID))
-        {
-            err = DataModel::Decode(reader, messageID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMessageID>(reader, messageID);
 }
 } // namespace MessagePresented.
 namespace MessageComplete {
@@ -16309,40 +8257,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMessageID))
-        {
-            err = DataModel::Decode(reader, messageID);
-        }
-        else if (__context_tag == to_underlying(Fields::kResponseID))
-        {
-            err = DataModel::Decode(reader, responseID);
-        }
-        else if (__context_tag == to_underlying(Fields::kReply))
-        {
-            err = DataModel::Decode(reader, reply);
-        }
-        else if (__context_tag == to_underlying(Fields::kFutureMessagesPreference))
-        {
-            err = DataModel::Decode(reader, futureMessagesPreference);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMessageID, Fields::kResponseID, Fields::kReply, Fields::kFutureMessagesPreference>(
+        reader, messageID, responseID, reply, futureMessagesPreference);
 }
 } // namespace MessageComplete.
 } // namespace Events
@@ -16364,40 +8280,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCostType))
-        {
-            err = DataModel::Decode(reader, costType);
-        }
-        else if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-        else if (__context_tag == to_underlying(Fields::kDecimalPoints))
-        {
-            err = DataModel::Decode(reader, decimalPoints);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrency))
-        {
-            err = DataModel::Decode(reader, currency);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCostType, Fields::kValue, Fields::kDecimalPoints, Fields::kCurrency>(
+        reader, costType, value, decimalPoints, currency);
 }
 
 } // namespace CostStruct
@@ -16415,40 +8299,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMinPower))
-        {
-            err = DataModel::Decode(reader, minPower);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxPower))
-        {
-            err = DataModel::Decode(reader, maxPower);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinDuration))
-        {
-            err = DataModel::Decode(reader, minDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxDuration))
-        {
-            err = DataModel::Decode(reader, maxDuration);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMinPower, Fields::kMaxPower, Fields::kMinDuration, Fields::kMaxDuration>(
+        reader, minPower, maxPower, minDuration, maxDuration);
 }
 
 } // namespace PowerAdjustStruct
@@ -16464,32 +8316,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPowerAdjustCapability))
-        {
-            err = DataModel::Decode(reader, powerAdjustCapability);
-        }
-        else if (__context_tag == to_underlying(Fields::kCause))
-        {
-            err = DataModel::Decode(reader, cause);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPowerAdjustCapability, Fields::kCause>(reader, powerAdjustCapability, cause);
 }
 
 } // namespace PowerAdjustCapabilityStruct
@@ -16521,96 +8348,15 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMinDuration))
-        {
-            err = DataModel::Decode(reader, minDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxDuration))
-        {
-            err = DataModel::Decode(reader, maxDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kDefaultDuration))
-        {
-            err = DataModel::Decode(reader, defaultDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kElapsedSlotTime))
-        {
-            err = DataModel::Decode(reader, elapsedSlotTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kRemainingSlotTime))
-        {
-            err = DataModel::Decode(reader, remainingSlotTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kSlotIsPausable))
-        {
-            err = DataModel::Decode(reader, slotIsPausable);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinPauseDuration))
-        {
-            err = DataModel::Decode(reader, minPauseDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxPauseDuration))
-        {
-            err = DataModel::Decode(reader, maxPauseDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kManufacturerESAState))
-        {
-            err = DataModel::Decode(reader, manufacturerESAState);
-        }
-        else if (__context_tag == to_underlying(Fields::kNominalPower))
-        {
-            err = DataModel::Decode(reader, nominalPower);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinPower))
-        {
-            err = DataModel::Decode(reader, minPower);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxPower))
-        {
-            err = DataModel::Decode(reader, maxPower);
-        }
-        else if (__context_tag == to_underlying(Fields::kNominalEnergy))
-        {
-            err = DataModel::Decode(reader, nominalEnergy);
-        }
-        else if (__context_tag == to_underlying(Fields::kCosts))
-        {
-            err = DataModel::Decode(reader, costs);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinPowerAdjustment))
-        {
-            err = DataModel::Decode(reader, minPowerAdjustment);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxPowerAdjustment))
-        {
-            err = DataModel::Decode(reader, maxPowerAdjustment);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinDurationAdjustment))
-        {
-            err = DataModel::Decode(reader, minDurationAdjustment);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxDurationAdjustment))
-        {
-            err = DataModel::Decode(reader, maxDurationAdjustment);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMinDuration, Fields::kMaxDuration, Fields::kDefaultDuration, Fields::kElapsedSlotTime,
+                                   Fields::kRemainingSlotTime, Fields::kSlotIsPausable, Fields::kMinPauseDuration,
+                                   Fields::kMaxPauseDuration, Fields::kManufacturerESAState, Fields::kNominalPower,
+                                   Fields::kMinPower, Fields::kMaxPower, Fields::kNominalEnergy, Fields::kCosts,
+                                   Fields::kMinPowerAdjustment, Fields::kMaxPowerAdjustment, Fields::kMinDurationAdjustment,
+                                   Fields::kMaxDurationAdjustment>(
+        reader, minDuration, maxDuration, defaultDuration, elapsedSlotTime, remainingSlotTime, slotIsPausable, minPauseDuration,
+        maxPauseDuration, manufacturerESAState, nominalPower, minPower, maxPower, nominalEnergy, costs, minPowerAdjustment,
+        maxPowerAdjustment, minDurationAdjustment, maxDurationAdjustment);
 }
 
 } // namespace SlotStruct
@@ -16633,60 +8379,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kForecastID))
-        {
-            err = DataModel::Decode(reader, forecastID);
-        }
-        else if (__context_tag == to_underlying(Fields::kActiveSlotNumber))
-        {
-            err = DataModel::Decode(reader, activeSlotNumber);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTime))
-        {
-            err = DataModel::Decode(reader, startTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndTime))
-        {
-            err = DataModel::Decode(reader, endTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kEarliestStartTime))
-        {
-            err = DataModel::Decode(reader, earliestStartTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kLatestEndTime))
-        {
-            err = DataModel::Decode(reader, latestEndTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kIsPausable))
-        {
-            err = DataModel::Decode(reader, isPausable);
-        }
-        else if (__context_tag == to_underlying(Fields::kSlots))
-        {
-            err = DataModel::Decode(reader, slots);
-        }
-        else if (__context_tag == to_underlying(Fields::kForecastUpdateReason))
-        {
-            err = DataModel::Decode(reader, forecastUpdateReason);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kForecastID, Fields::kActiveSlotNumber, Fields::kStartTime, Fields::kEndTime,
+                                   Fields::kEarliestStartTime, Fields::kLatestEndTime, Fields::kIsPausable, Fields::kSlots,
+                                   Fields::kForecastUpdateReason>(reader, forecastID, activeSlotNumber, startTime, endTime,
+                                                                  earliestStartTime, latestEndTime, isPausable, slots,
+                                                                  forecastUpdateReason);
 }
 
 } // namespace ForecastStruct
@@ -16705,44 +8402,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStartTime))
-        {
-            err = DataModel::Decode(reader, startTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else if (__context_tag == to_underlying(Fields::kNominalPower))
-        {
-            err = DataModel::Decode(reader, nominalPower);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaximumEnergy))
-        {
-            err = DataModel::Decode(reader, maximumEnergy);
-        }
-        else if (__context_tag == to_underlying(Fields::kLoadControl))
-        {
-            err = DataModel::Decode(reader, loadControl);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStartTime, Fields::kDuration, Fields::kNominalPower, Fields::kMaximumEnergy,
+                                   Fields::kLoadControl>(reader, startTime, duration, nominalPower, maximumEnergy, loadControl);
 }
 
 } // namespace ConstraintsStruct
@@ -16759,36 +8420,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSlotIndex))
-        {
-            err = DataModel::Decode(reader, slotIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kNominalPower))
-        {
-            err = DataModel::Decode(reader, nominalPower);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSlotIndex, Fields::kNominalPower, Fields::kDuration>(reader, slotIndex, nominalPower,
+                                                                                                 duration);
 }
 
 } // namespace SlotAdjustmentStruct
@@ -16807,36 +8440,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPower))
-        {
-            err = DataModel::Decode(reader, power);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else if (__context_tag == to_underlying(Fields::kCause))
-        {
-            err = DataModel::Decode(reader, cause);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPower, Fields::kDuration, Fields::kCause>(reader, power, duration, cause);
 }
 } // namespace PowerAdjustRequest.
 namespace CancelPowerAdjustRequest {
@@ -16848,15 +8452,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace CancelPowerAdjustRequest.
 namespace StartTimeAdjustRequest {
@@ -16870,32 +8466,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kRequestedStartTime))
-        {
-            err = DataModel::Decode(reader, requestedStartTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kCause))
-        {
-            err = DataModel::Decode(reader, cause);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kRequestedStartTime, Fields::kCause>(reader, requestedStartTime, cause);
 }
 } // namespace StartTimeAdjustRequest.
 namespace PauseRequest {
@@ -16909,32 +8480,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else if (__context_tag == to_underlying(Fields::kCause))
-        {
-            err = DataModel::Decode(reader, cause);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDuration, Fields::kCause>(reader, duration, cause);
 }
 } // namespace PauseRequest.
 namespace ResumeRequest {
@@ -16946,15 +8492,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ResumeRequest.
 namespace ModifyForecastRequest {
@@ -16969,36 +8507,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kForecastID))
-        {
-            err = DataModel::Decode(reader, forecastID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSlotAdjustments))
-        {
-            err = DataModel::Decode(reader, slotAdjustments);
-        }
-        else if (__context_tag == to_underlying(Fields::kCause))
-        {
-            err = DataModel::Decode(reader, cause);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kForecastID, Fields::kSlotAdjustments, Fields::kCause>(reader, forecastID,
+                                                                                                  slotAdjustments, cause);
 }
 } // namespace ModifyForecastRequest.
 namespace RequestConstraintBasedForecast {
@@ -17012,32 +8522,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kConstraints))
-        {
-            err = DataModel::Decode(reader, constraints);
-        }
-        else if (__context_tag == to_underlying(Fields::kCause))
-        {
-            err = DataModel::Decode(reader, cause);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kConstraints, Fields::kCause>(reader, constraints, cause);
 }
 } // namespace RequestConstraintBasedForecast.
 namespace CancelRequest {
@@ -17049,15 +8534,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace CancelRequest.
 } // namespace Commands
@@ -17110,15 +8587,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace PowerAdjustStart.
 namespace PowerAdjustEnd {
@@ -17134,36 +8603,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCause))
-        {
-            err = DataModel::Decode(reader, cause);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else if (__context_tag == to_underlying(Fields::kEnergyUse))
-        {
-            err = DataModel::Decode(reader, energyUse);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCause, Fields::kDuration, Fields::kEnergyUse>(reader, cause, duration, energyUse);
 }
 } // namespace PowerAdjustEnd.
 namespace Paused {
@@ -17176,15 +8616,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Paused.
 namespace Resumed {
@@ -17198,28 +8630,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCause))
-        {
-            err = DataModel::Decode(reader, cause);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCause>(reader, cause);
 }
 } // namespace Resumed.
 } // namespace Events
@@ -17240,36 +8651,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTargetTimeMinutesPastMidnight))
-        {
-            err = DataModel::Decode(reader, targetTimeMinutesPastMidnight);
-        }
-        else if (__context_tag == to_underlying(Fields::kTargetSoC))
-        {
-            err = DataModel::Decode(reader, targetSoC);
-        }
-        else if (__context_tag == to_underlying(Fields::kAddedEnergy))
-        {
-            err = DataModel::Decode(reader, addedEnergy);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTargetTimeMinutesPastMidnight, Fields::kTargetSoC, Fields::kAddedEnergy>(
+        reader, targetTimeMinutesPastMidnight, targetSoC, addedEnergy);
 }
 
 } // namespace ChargingTargetStruct
@@ -17285,32 +8668,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDayOfWeekForSequence))
-        {
-            err = DataModel::Decode(reader, dayOfWeekForSequence);
-        }
-        else if (__context_tag == to_underlying(Fields::kChargingTargets))
-        {
-            err = DataModel::Decode(reader, chargingTargets);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDayOfWeekForSequence, Fields::kChargingTargets>(reader, dayOfWeekForSequence,
+                                                                                            chargingTargets);
 }
 
 } // namespace ChargingTargetScheduleStruct
@@ -17327,28 +8686,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kChargingTargetSchedules))
-        {
-            err = DataModel::Decode(reader, chargingTargetSchedules);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kChargingTargetSchedules>(reader, chargingTargetSchedules);
 }
 } // namespace GetTargetsResponse.
 namespace Disable {
@@ -17360,15 +8698,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Disable.
 namespace EnableCharging {
@@ -17383,36 +8713,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kChargingEnabledUntil))
-        {
-            err = DataModel::Decode(reader, chargingEnabledUntil);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinimumChargeCurrent))
-        {
-            err = DataModel::Decode(reader, minimumChargeCurrent);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaximumChargeCurrent))
-        {
-            err = DataModel::Decode(reader, maximumChargeCurrent);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kChargingEnabledUntil, Fields::kMinimumChargeCurrent, Fields::kMaximumChargeCurrent>(
+        reader, chargingEnabledUntil, minimumChargeCurrent, maximumChargeCurrent);
 }
 } // namespace EnableCharging.
 namespace EnableDischarging {
@@ -17426,32 +8728,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDischargingEnabledUntil))
-        {
-            err = DataModel::Decode(reader, dischargingEnabledUntil);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaximumDischargeCurrent))
-        {
-            err = DataModel::Decode(reader, maximumDischargeCurrent);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDischargingEnabledUntil, Fields::kMaximumDischargeCurrent>(
+        reader, dischargingEnabledUntil, maximumDischargeCurrent);
 }
 } // namespace EnableDischarging.
 namespace StartDiagnostics {
@@ -17463,15 +8741,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace StartDiagnostics.
 namespace SetTargets {
@@ -17484,28 +8754,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kChargingTargetSchedules))
-        {
-            err = DataModel::Decode(reader, chargingTargetSchedules);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kChargingTargetSchedules>(reader, chargingTargetSchedules);
 }
 } // namespace SetTargets.
 namespace GetTargets {
@@ -17517,15 +8766,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace GetTargets.
 namespace ClearTargets {
@@ -17537,15 +8778,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ClearTargets.
 } // namespace Commands
@@ -17629,28 +8862,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSessionID))
-        {
-            err = DataModel::Decode(reader, sessionID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSessionID>(reader, sessionID);
 }
 } // namespace EVConnected.
 namespace EVNotDetected {
@@ -17668,44 +8880,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSessionID))
-        {
-            err = DataModel::Decode(reader, sessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kState))
-        {
-            err = DataModel::Decode(reader, state);
-        }
-        else if (__context_tag == to_underlying(Fields::kSessionDuration))
-        {
-            err = DataModel::Decode(reader, sessionDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kSessionEnergyCharged))
-        {
-            err = DataModel::Decode(reader, sessionEnergyCharged);
-        }
-        else if (__context_tag == to_underlying(Fields::kSessionEnergyDischarged))
-        {
-            err = DataModel::Decode(reader, sessionEnergyDischarged);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSessionID, Fields::kState, Fields::kSessionDuration, Fields::kSessionEnergyCharged,
+                                   Fields::kSessionEnergyDischarged>(reader, sessionID, state, sessionDuration,
+                                                                     sessionEnergyCharged, sessionEnergyDischarged);
 }
 } // namespace EVNotDetected.
 namespace EnergyTransferStarted {
@@ -17722,40 +8899,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSessionID))
-        {
-            err = DataModel::Decode(reader, sessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kState))
-        {
-            err = DataModel::Decode(reader, state);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaximumCurrent))
-        {
-            err = DataModel::Decode(reader, maximumCurrent);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaximumDischargeCurrent))
-        {
-            err = DataModel::Decode(reader, maximumDischargeCurrent);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSessionID, Fields::kState, Fields::kMaximumCurrent, Fields::kMaximumDischargeCurrent>(
+        reader, sessionID, state, maximumCurrent, maximumDischargeCurrent);
 }
 } // namespace EnergyTransferStarted.
 namespace EnergyTransferStopped {
@@ -17773,44 +8918,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSessionID))
-        {
-            err = DataModel::Decode(reader, sessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kState))
-        {
-            err = DataModel::Decode(reader, state);
-        }
-        else if (__context_tag == to_underlying(Fields::kReason))
-        {
-            err = DataModel::Decode(reader, reason);
-        }
-        else if (__context_tag == to_underlying(Fields::kEnergyTransferred))
-        {
-            err = DataModel::Decode(reader, energyTransferred);
-        }
-        else if (__context_tag == to_underlying(Fields::kEnergyDischarged))
-        {
-            err = DataModel::Decode(reader, energyDischarged);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSessionID, Fields::kState, Fields::kReason, Fields::kEnergyTransferred,
+                                   Fields::kEnergyDischarged>(reader, sessionID, state, reason, energyTransferred,
+                                                              energyDischarged);
 }
 } // namespace EnergyTransferStopped.
 namespace Fault {
@@ -17827,40 +8937,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSessionID))
-        {
-            err = DataModel::Decode(reader, sessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kState))
-        {
-            err = DataModel::Decode(reader, state);
-        }
-        else if (__context_tag == to_underlying(Fields::kFaultStatePreviousState))
-        {
-            err = DataModel::Decode(reader, faultStatePreviousState);
-        }
-        else if (__context_tag == to_underlying(Fields::kFaultStateCurrentState))
-        {
-            err = DataModel::Decode(reader, faultStateCurrentState);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSessionID, Fields::kState, Fields::kFaultStatePreviousState,
+                                   Fields::kFaultStateCurrentState>(reader, sessionID, state, faultStatePreviousState,
+                                                                    faultStateCurrentState);
 }
 } // namespace Fault.
 namespace Rfid {
@@ -17874,28 +8953,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kUid))
-        {
-            err = DataModel::Decode(reader, uid);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kUid>(reader, uid);
 }
 } // namespace Rfid.
 } // namespace Events
@@ -17915,32 +8973,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStep))
-        {
-            err = DataModel::Decode(reader, step);
-        }
-        else if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStep, Fields::kLabel>(reader, step, label);
 }
 
 } // namespace BalanceStruct
@@ -18028,28 +9061,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewMode))
-        {
-            err = DataModel::Decode(reader, newMode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewMode>(reader, newMode);
 }
 } // namespace ChangeToMode.
 namespace ChangeToModeResponse {
@@ -18063,32 +9075,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusText))
-        {
-            err = DataModel::Decode(reader, statusText);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kStatusText>(reader, status, statusText);
 }
 } // namespace ChangeToModeResponse.
 } // namespace Commands
@@ -18135,28 +9122,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewMode))
-        {
-            err = DataModel::Decode(reader, newMode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewMode>(reader, newMode);
 }
 } // namespace ChangeToMode.
 namespace ChangeToModeResponse {
@@ -18170,32 +9136,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusText))
-        {
-            err = DataModel::Decode(reader, statusText);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kStatusText>(reader, status, statusText);
 }
 } // namespace ChangeToModeResponse.
 } // namespace Commands
@@ -18242,28 +9183,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewMode))
-        {
-            err = DataModel::Decode(reader, newMode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewMode>(reader, newMode);
 }
 } // namespace ChangeToMode.
 namespace ChangeToModeResponse {
@@ -18277,32 +9197,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusText))
-        {
-            err = DataModel::Decode(reader, statusText);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kStatusText>(reader, status, statusText);
 }
 } // namespace ChangeToModeResponse.
 } // namespace Commands
@@ -18349,32 +9244,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCredentialType))
-        {
-            err = DataModel::Decode(reader, credentialType);
-        }
-        else if (__context_tag == to_underlying(Fields::kCredentialIndex))
-        {
-            err = DataModel::Decode(reader, credentialIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCredentialType, Fields::kCredentialIndex>(reader, credentialType, credentialIndex);
 }
 
 } // namespace CredentialStruct
@@ -18391,28 +9261,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPINCode))
-        {
-            err = DataModel::Decode(reader, PINCode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPINCode>(reader, PINCode);
 }
 } // namespace LockDoor.
 namespace UnlockDoor {
@@ -18425,28 +9274,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPINCode))
-        {
-            err = DataModel::Decode(reader, PINCode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPINCode>(reader, PINCode);
 }
 } // namespace UnlockDoor.
 namespace UnlockWithTimeout {
@@ -18460,32 +9288,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTimeout))
-        {
-            err = DataModel::Decode(reader, timeout);
-        }
-        else if (__context_tag == to_underlying(Fields::kPINCode))
-        {
-            err = DataModel::Decode(reader, PINCode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTimeout, Fields::kPINCode>(reader, timeout, PINCode);
 }
 } // namespace UnlockWithTimeout.
 namespace SetWeekDaySchedule {
@@ -18504,52 +9307,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWeekDayIndex))
-        {
-            err = DataModel::Decode(reader, weekDayIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kDaysMask))
-        {
-            err = DataModel::Decode(reader, daysMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartHour))
-        {
-            err = DataModel::Decode(reader, startHour);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartMinute))
-        {
-            err = DataModel::Decode(reader, startMinute);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndHour))
-        {
-            err = DataModel::Decode(reader, endHour);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndMinute))
-        {
-            err = DataModel::Decode(reader, endMinute);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWeekDayIndex, Fields::kUserIndex, Fields::kDaysMask, Fields::kStartHour,
+                                   Fields::kStartMinute, Fields::kEndHour, Fields::kEndMinute>(
+        reader, weekDayIndex, userIndex, daysMask, startHour, startMinute, endHour, endMinute);
 }
 } // namespace SetWeekDaySchedule.
 namespace GetWeekDaySchedule {
@@ -18563,32 +9323,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWeekDayIndex))
-        {
-            err = DataModel::Decode(reader, weekDayIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWeekDayIndex, Fields::kUserIndex>(reader, weekDayIndex, userIndex);
 }
 } // namespace GetWeekDaySchedule.
 namespace GetWeekDayScheduleResponse {
@@ -18608,56 +9343,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWeekDayIndex))
-        {
-            err = DataModel::Decode(reader, weekDayIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kDaysMask))
-        {
-            err = DataModel::Decode(reader, daysMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartHour))
-        {
-            err = DataModel::Decode(reader, startHour);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartMinute))
-        {
-            err = DataModel::Decode(reader, startMinute);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndHour))
-        {
-            err = DataModel::Decode(reader, endHour);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndMinute))
-        {
-            err = DataModel::Decode(reader, endMinute);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWeekDayIndex, Fields::kUserIndex, Fields::kStatus, Fields::kDaysMask,
+                                   Fields::kStartHour, Fields::kStartMinute, Fields::kEndHour, Fields::kEndMinute>(
+        reader, weekDayIndex, userIndex, status, daysMask, startHour, startMinute, endHour, endMinute);
 }
 } // namespace GetWeekDayScheduleResponse.
 namespace ClearWeekDaySchedule {
@@ -18671,32 +9359,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWeekDayIndex))
-        {
-            err = DataModel::Decode(reader, weekDayIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWeekDayIndex, Fields::kUserIndex>(reader, weekDayIndex, userIndex);
 }
 } // namespace ClearWeekDaySchedule.
 namespace SetYearDaySchedule {
@@ -18712,40 +9375,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kYearDayIndex))
-        {
-            err = DataModel::Decode(reader, yearDayIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kLocalStartTime))
-        {
-            err = DataModel::Decode(reader, localStartTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kLocalEndTime))
-        {
-            err = DataModel::Decode(reader, localEndTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kYearDayIndex, Fields::kUserIndex, Fields::kLocalStartTime,
+                                   Fields::kLocalEndTime>(reader, yearDayIndex, userIndex, localStartTime, localEndTime);
 }
 } // namespace SetYearDaySchedule.
 namespace GetYearDaySchedule {
@@ -18759,32 +9390,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kYearDayIndex))
-        {
-            err = DataModel::Decode(reader, yearDayIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kYearDayIndex, Fields::kUserIndex>(reader, yearDayIndex, userIndex);
 }
 } // namespace GetYearDaySchedule.
 namespace GetYearDayScheduleResponse {
@@ -18801,44 +9407,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kYearDayIndex))
-        {
-            err = DataModel::Decode(reader, yearDayIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kLocalStartTime))
-        {
-            err = DataModel::Decode(reader, localStartTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kLocalEndTime))
-        {
-            err = DataModel::Decode(reader, localEndTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kYearDayIndex, Fields::kUserIndex, Fields::kStatus, Fields::kLocalStartTime,
+                                   Fields::kLocalEndTime>(reader, yearDayIndex, userIndex, status, localStartTime, localEndTime);
 }
 } // namespace GetYearDayScheduleResponse.
 namespace ClearYearDaySchedule {
@@ -18852,32 +9422,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kYearDayIndex))
-        {
-            err = DataModel::Decode(reader, yearDayIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kYearDayIndex, Fields::kUserIndex>(reader, yearDayIndex, userIndex);
 }
 } // namespace ClearYearDaySchedule.
 namespace SetHolidaySchedule {
@@ -18893,40 +9438,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kHolidayIndex))
-        {
-            err = DataModel::Decode(reader, holidayIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kLocalStartTime))
-        {
-            err = DataModel::Decode(reader, localStartTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kLocalEndTime))
-        {
-            err = DataModel::Decode(reader, localEndTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOperatingMode))
-        {
-            err = DataModel::Decode(reader, operatingMode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kHolidayIndex, Fields::kLocalStartTime, Fields::kLocalEndTime,
+                                   Fields::kOperatingMode>(reader, holidayIndex, localStartTime, localEndTime, operatingMode);
 }
 } // namespace SetHolidaySchedule.
 namespace GetHolidaySchedule {
@@ -18939,28 +9452,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kHolidayIndex))
-        {
-            err = DataModel::Decode(reader, holidayIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kHolidayIndex>(reader, holidayIndex);
 }
 } // namespace GetHolidaySchedule.
 namespace GetHolidayScheduleResponse {
@@ -18977,44 +9469,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kHolidayIndex))
-        {
-            err = DataModel::Decode(reader, holidayIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kLocalStartTime))
-        {
-            err = DataModel::Decode(reader, localStartTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kLocalEndTime))
-        {
-            err = DataModel::Decode(reader, localEndTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOperatingMode))
-        {
-            err = DataModel::Decode(reader, operatingMode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kHolidayIndex, Fields::kStatus, Fields::kLocalStartTime, Fields::kLocalEndTime,
+                                   Fields::kOperatingMode>(reader, holidayIndex, status, localStartTime, localEndTime,
+                                                           operatingMode);
 }
 } // namespace GetHolidayScheduleResponse.
 namespace ClearHolidaySchedule {
@@ -19027,28 +9484,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kHolidayIndex))
-        {
-            err = DataModel::Decode(reader, holidayIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kHolidayIndex>(reader, holidayIndex);
 }
 } // namespace ClearHolidaySchedule.
 namespace SetUser {
@@ -19067,52 +9503,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOperationType))
-        {
-            err = DataModel::Decode(reader, operationType);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserName))
-        {
-            err = DataModel::Decode(reader, userName);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserUniqueID))
-        {
-            err = DataModel::Decode(reader, userUniqueID);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserStatus))
-        {
-            err = DataModel::Decode(reader, userStatus);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserType))
-        {
-            err = DataModel::Decode(reader, userType);
-        }
-        else if (__context_tag == to_underlying(Fields::kCredentialRule))
-        {
-            err = DataModel::Decode(reader, credentialRule);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOperationType, Fields::kUserIndex, Fields::kUserName, Fields::kUserUniqueID,
+                                   Fields::kUserStatus, Fields::kUserType, Fields::kCredentialRule>(
+        reader, operationType, userIndex, userName, userUniqueID, userStatus, userType, credentialRule);
 }
 } // namespace SetUser.
 namespace GetUser {
@@ -19125,28 +9518,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kUserIndex>(reader, userIndex);
 }
 } // namespace GetUser.
 namespace GetUserResponse {
@@ -19168,64 +9540,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserName))
-        {
-            err = DataModel::Decode(reader, userName);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserUniqueID))
-        {
-            err = DataModel::Decode(reader, userUniqueID);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserStatus))
-        {
-            err = DataModel::Decode(reader, userStatus);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserType))
-        {
-            err = DataModel::Decode(reader, userType);
-        }
-        else if (__context_tag == to_underlying(Fields::kCredentialRule))
-        {
-            err = DataModel::Decode(reader, credentialRule);
-        }
-        else if (__context_tag == to_underlying(Fields::kCredentials))
-        {
-            err = DataModel::Decode(reader, credentials);
-        }
-        else if (__context_tag == to_underlying(Fields::kCreatorFabricIndex))
-        {
-            err = DataModel::Decode(reader, creatorFabricIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kLastModifiedFabricIndex))
-        {
-            err = DataModel::Decode(reader, lastModifiedFabricIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kNextUserIndex))
-        {
-            err = DataModel::Decode(reader, nextUserIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kUserIndex, Fields::kUserName, Fields::kUserUniqueID, Fields::kUserStatus,
+                                   Fields::kUserType, Fields::kCredentialRule, Fields::kCredentials, Fields::kCreatorFabricIndex,
+                                   Fields::kLastModifiedFabricIndex, Fields::kNextUserIndex>(
+        reader, userIndex, userName, userUniqueID, userStatus, userType, credentialRule, credentials, creatorFabricIndex,
+        lastModifiedFabricIndex, nextUserIndex);
 }
 } // namespace GetUserResponse.
 namespace ClearUser {
@@ -19238,28 +9557,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kUserIndex>(reader, userIndex);
 }
 } // namespace ClearUser.
 namespace SetCredential {
@@ -19277,48 +9575,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOperationType))
-        {
-            err = DataModel::Decode(reader, operationType);
-        }
-        else if (__context_tag == to_underlying(Fields::kCredential))
-        {
-            err = DataModel::Decode(reader, credential);
-        }
-        else if (__context_tag == to_underlying(Fields::kCredentialData))
-        {
-            err = DataModel::Decode(reader, credentialData);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserStatus))
-        {
-            err = DataModel::Decode(reader, userStatus);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserType))
-        {
-            err = DataModel::Decode(reader, userType);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOperationType, Fields::kCredential, Fields::kCredentialData, Fields::kUserIndex,
+                                   Fields::kUserStatus, Fields::kUserType>(reader, operationType, credential, credentialData,
+                                                                           userIndex, userStatus, userType);
 }
 } // namespace SetCredential.
 namespace SetCredentialResponse {
@@ -19333,36 +9592,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kNextCredentialIndex))
-        {
-            err = DataModel::Decode(reader, nextCredentialIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kUserIndex, Fields::kNextCredentialIndex>(reader, status, userIndex,
+                                                                                                      nextCredentialIndex);
 }
 } // namespace SetCredentialResponse.
 namespace GetCredentialStatus {
@@ -19375,28 +9606,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCredential))
-        {
-            err = DataModel::Decode(reader, credential);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCredential>(reader, credential);
 }
 } // namespace GetCredentialStatus.
 namespace GetCredentialStatusResponse {
@@ -19414,48 +9624,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCredentialExists))
-        {
-            err = DataModel::Decode(reader, credentialExists);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kCreatorFabricIndex))
-        {
-            err = DataModel::Decode(reader, creatorFabricIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kLastModifiedFabricIndex))
-        {
-            err = DataModel::Decode(reader, lastModifiedFabricIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kNextCredentialIndex))
-        {
-            err = DataModel::Decode(reader, nextCredentialIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kCredentialData))
-        {
-            err = DataModel::Decode(reader, credentialData);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCredentialExists, Fields::kUserIndex, Fields::kCreatorFabricIndex,
+                                   Fields::kLastModifiedFabricIndex, Fields::kNextCredentialIndex, Fields::kCredentialData>(
+        reader, credentialExists, userIndex, creatorFabricIndex, lastModifiedFabricIndex, nextCredentialIndex, credentialData);
 }
 } // namespace GetCredentialStatusResponse.
 namespace ClearCredential {
@@ -19468,28 +9639,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCredential))
-        {
-            err = DataModel::Decode(reader, credential);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCredential>(reader, credential);
 }
 } // namespace ClearCredential.
 namespace UnboltDoor {
@@ -19502,28 +9652,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPINCode))
-        {
-            err = DataModel::Decode(reader, PINCode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPINCode>(reader, PINCode);
 }
 } // namespace UnboltDoor.
 namespace SetAliroReaderConfig {
@@ -19539,40 +9668,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSigningKey))
-        {
-            err = DataModel::Decode(reader, signingKey);
-        }
-        else if (__context_tag == to_underlying(Fields::kVerificationKey))
-        {
-            err = DataModel::Decode(reader, verificationKey);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupIdentifier))
-        {
-            err = DataModel::Decode(reader, groupIdentifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kGroupResolvingKey))
-        {
-            err = DataModel::Decode(reader, groupResolvingKey);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSigningKey, Fields::kVerificationKey, Fields::kGroupIdentifier,
+                                   Fields::kGroupResolvingKey>(reader, signingKey, verificationKey, groupIdentifier,
+                                                               groupResolvingKey);
 }
 } // namespace SetAliroReaderConfig.
 namespace ClearAliroReaderConfig {
@@ -19584,15 +9682,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ClearAliroReaderConfig.
 } // namespace Commands
@@ -19720,28 +9810,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAlarmCode))
-        {
-            err = DataModel::Decode(reader, alarmCode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAlarmCode>(reader, alarmCode);
 }
 } // namespace DoorLockAlarm.
 namespace DoorStateChange {
@@ -19755,28 +9824,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDoorState))
-        {
-            err = DataModel::Decode(reader, doorState);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDoorState>(reader, doorState);
 }
 } // namespace DoorStateChange.
 namespace LockOperation {
@@ -19795,48 +9843,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLockOperationType))
-        {
-            err = DataModel::Decode(reader, lockOperationType);
-        }
-        else if (__context_tag == to_underlying(Fields::kOperationSource))
-        {
-            err = DataModel::Decode(reader, operationSource);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kSourceNode))
-        {
-            err = DataModel::Decode(reader, sourceNode);
-        }
-        else if (__context_tag == to_underlying(Fields::kCredentials))
-        {
-            err = DataModel::Decode(reader, credentials);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLockOperationType, Fields::kOperationSource, Fields::kUserIndex, Fields::kFabricIndex,
+                                   Fields::kSourceNode, Fields::kCredentials>(reader, lockOperationType, operationSource, userIndex,
+                                                                              fabricIndex, sourceNode, credentials);
 }
 } // namespace LockOperation.
 namespace LockOperationError {
@@ -19856,52 +9865,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLockOperationType))
-        {
-            err = DataModel::Decode(reader, lockOperationType);
-        }
-        else if (__context_tag == to_underlying(Fields::kOperationSource))
-        {
-            err = DataModel::Decode(reader, operationSource);
-        }
-        else if (__context_tag == to_underlying(Fields::kOperationError))
-        {
-            err = DataModel::Decode(reader, operationError);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kSourceNode))
-        {
-            err = DataModel::Decode(reader, sourceNode);
-        }
-        else if (__context_tag == to_underlying(Fields::kCredentials))
-        {
-            err = DataModel::Decode(reader, credentials);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLockOperationType, Fields::kOperationSource, Fields::kOperationError,
+                                   Fields::kUserIndex, Fields::kFabricIndex, Fields::kSourceNode, Fields::kCredentials>(
+        reader, lockOperationType, operationSource, operationError, userIndex, fabricIndex, sourceNode, credentials);
 }
 } // namespace LockOperationError.
 namespace LockUserChange {
@@ -19921,52 +9887,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLockDataType))
-        {
-            err = DataModel::Decode(reader, lockDataType);
-        }
-        else if (__context_tag == to_underlying(Fields::kDataOperationType))
-        {
-            err = DataModel::Decode(reader, dataOperationType);
-        }
-        else if (__context_tag == to_underlying(Fields::kOperationSource))
-        {
-            err = DataModel::Decode(reader, operationSource);
-        }
-        else if (__context_tag == to_underlying(Fields::kUserIndex))
-        {
-            err = DataModel::Decode(reader, userIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else if (__context_tag == to_underlying(Fields::kSourceNode))
-        {
-            err = DataModel::Decode(reader, sourceNode);
-        }
-        else if (__context_tag == to_underlying(Fields::kDataIndex))
-        {
-            err = DataModel::Decode(reader, dataIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLockDataType, Fields::kDataOperationType, Fields::kOperationSource, Fields::kUserIndex,
+                                   Fields::kFabricIndex, Fields::kSourceNode, Fields::kDataIndex>(
+        reader, lockDataType, dataOperationType, operationSource, userIndex, fabricIndex, sourceNode, dataIndex);
 }
 } // namespace LockUserChange.
 } // namespace Events
@@ -19984,15 +9907,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace UpOrOpen.
 namespace DownOrClose {
@@ -20004,15 +9919,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace DownOrClose.
 namespace StopMotion {
@@ -20024,15 +9931,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace StopMotion.
 namespace GoToLiftValue {
@@ -20045,28 +9944,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLiftValue))
-        {
-            err = DataModel::Decode(reader, liftValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLiftValue>(reader, liftValue);
 }
 } // namespace GoToLiftValue.
 namespace GoToLiftPercentage {
@@ -20079,28 +9957,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLiftPercent100thsValue))
-        {
-            err = DataModel::Decode(reader, liftPercent100thsValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLiftPercent100thsValue>(reader, liftPercent100thsValue);
 }
 } // namespace GoToLiftPercentage.
 namespace GoToTiltValue {
@@ -20113,28 +9970,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTiltValue))
-        {
-            err = DataModel::Decode(reader, tiltValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTiltValue>(reader, tiltValue);
 }
 } // namespace GoToTiltValue.
 namespace GoToTiltPercentage {
@@ -20147,28 +9983,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTiltPercent100thsValue))
-        {
-            err = DataModel::Decode(reader, tiltPercent100thsValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTiltPercent100thsValue>(reader, tiltPercent100thsValue);
 }
 } // namespace GoToTiltPercentage.
 } // namespace Commands
@@ -20255,32 +10070,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLandmarkTag))
-        {
-            err = DataModel::Decode(reader, landmarkTag);
-        }
-        else if (__context_tag == to_underlying(Fields::kRelativePositionTag))
-        {
-            err = DataModel::Decode(reader, relativePositionTag);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLandmarkTag, Fields::kRelativePositionTag>(reader, landmarkTag, relativePositionTag);
 }
 
 } // namespace LandmarkInfoStruct
@@ -20296,32 +10086,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLocationInfo))
-        {
-            err = DataModel::Decode(reader, locationInfo);
-        }
-        else if (__context_tag == to_underlying(Fields::kLandmarkInfo))
-        {
-            err = DataModel::Decode(reader, landmarkInfo);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLocationInfo, Fields::kLandmarkInfo>(reader, locationInfo, landmarkInfo);
 }
 
 } // namespace AreaInfoStruct
@@ -20338,36 +10103,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAreaID))
-        {
-            err = DataModel::Decode(reader, areaID);
-        }
-        else if (__context_tag == to_underlying(Fields::kMapID))
-        {
-            err = DataModel::Decode(reader, mapID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAreaInfo))
-        {
-            err = DataModel::Decode(reader, areaInfo);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAreaID, Fields::kMapID, Fields::kAreaInfo>(reader, areaID, mapID, areaInfo);
 }
 
 } // namespace AreaStruct
@@ -20383,32 +10119,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMapID))
-        {
-            err = DataModel::Decode(reader, mapID);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMapID, Fields::kName>(reader, mapID, name);
 }
 
 } // namespace MapStruct
@@ -20426,40 +10137,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAreaID))
-        {
-            err = DataModel::Decode(reader, areaID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kTotalOperationalTime))
-        {
-            err = DataModel::Decode(reader, totalOperationalTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kEstimatedTime))
-        {
-            err = DataModel::Decode(reader, estimatedTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAreaID, Fields::kStatus, Fields::kTotalOperationalTime, Fields::kEstimatedTime>(
+        reader, areaID, status, totalOperationalTime, estimatedTime);
 }
 
 } // namespace ProgressStruct
@@ -20476,28 +10155,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNewAreas))
-        {
-            err = DataModel::Decode(reader, newAreas);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNewAreas>(reader, newAreas);
 }
 } // namespace SelectAreas.
 namespace SelectAreasResponse {
@@ -20511,32 +10169,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusText))
-        {
-            err = DataModel::Decode(reader, statusText);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kStatusText>(reader, status, statusText);
 }
 } // namespace SelectAreasResponse.
 namespace SkipArea {
@@ -20549,28 +10182,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSkippedArea))
-        {
-            err = DataModel::Decode(reader, skippedArea);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSkippedArea>(reader, skippedArea);
 }
 } // namespace SkipArea.
 namespace SkipAreaResponse {
@@ -20584,32 +10196,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusText))
-        {
-            err = DataModel::Decode(reader, statusText);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kStatusText>(reader, status, statusText);
 }
 } // namespace SkipAreaResponse.
 } // namespace Commands
@@ -20732,15 +10319,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace SupplyVoltageLow.
 namespace SupplyVoltageHigh {
@@ -20753,15 +10332,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace SupplyVoltageHigh.
 namespace PowerMissingPhase {
@@ -20774,15 +10345,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace PowerMissingPhase.
 namespace SystemPressureLow {
@@ -20795,15 +10358,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace SystemPressureLow.
 namespace SystemPressureHigh {
@@ -20816,15 +10371,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace SystemPressureHigh.
 namespace DryRunning {
@@ -20837,15 +10384,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace DryRunning.
 namespace MotorTemperatureHigh {
@@ -20858,15 +10397,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace MotorTemperatureHigh.
 namespace PumpMotorFatalFailure {
@@ -20879,15 +10410,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace PumpMotorFatalFailure.
 namespace ElectronicTemperatureHigh {
@@ -20900,15 +10423,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ElectronicTemperatureHigh.
 namespace PumpBlocked {
@@ -20921,15 +10436,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace PumpBlocked.
 namespace SensorFailure {
@@ -20942,15 +10449,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace SensorFailure.
 namespace ElectronicNonFatalFailure {
@@ -20963,15 +10462,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ElectronicNonFatalFailure.
 namespace ElectronicFatalFailure {
@@ -20984,15 +10475,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ElectronicFatalFailure.
 namespace GeneralFault {
@@ -21005,15 +10488,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace GeneralFault.
 namespace Leakage {
@@ -21026,15 +10501,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Leakage.
 namespace AirDetection {
@@ -21047,15 +10514,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace AirDetection.
 namespace TurbineOperation {
@@ -21068,15 +10527,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace TurbineOperation.
 } // namespace Events
@@ -21100,48 +10551,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDayOfWeek))
-        {
-            err = DataModel::Decode(reader, dayOfWeek);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kPresetHandle))
-        {
-            err = DataModel::Decode(reader, presetHandle);
-        }
-        else if (__context_tag == to_underlying(Fields::kSystemMode))
-        {
-            err = DataModel::Decode(reader, systemMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kCoolingSetpoint))
-        {
-            err = DataModel::Decode(reader, coolingSetpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kHeatingSetpoint))
-        {
-            err = DataModel::Decode(reader, heatingSetpoint);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDayOfWeek, Fields::kTransitionTime, Fields::kPresetHandle, Fields::kSystemMode,
+                                   Fields::kCoolingSetpoint, Fields::kHeatingSetpoint>(
+        reader, dayOfWeek, transitionTime, presetHandle, systemMode, coolingSetpoint, heatingSetpoint);
 }
 
 } // namespace ScheduleTransitionStruct
@@ -21161,51 +10573,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
+    return DataModel::DecodeStruct<Fields::kScheduleHandle, Fields::kSystemMode, Fields::kName, Fields::kPresetHandle,
+                                   Fields::kTransitions, Fields::kBuiltIn>(reader, scheduleHandle, systemMode, name, presetHandle,
+                                                                           transitions, builtIn);
+}
 
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kScheduleHandle))
-        {
-            err = DataModel::Decode(reader, scheduleHandle);
-        }
-        else if (__context_tag == to_underlying(Fields::kSystemMode))
-        {
-            err = DataModel::Decode(reader, systemMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kPresetHandle))
-        {
-            err = DataModel::Decode(reader, presetHandle);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitions))
-        {
-            err = DataModel::Decode(reader, transitions);
-        }
-        else if (__context_tag == to_underlying(Fields::kBuiltIn))
-        {
-            err = DataModel::Decode(reader, builtIn);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
-}
-
-} // namespace ScheduleStruct
+} // namespace ScheduleStruct
 
 namespace PresetStruct {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
@@ -21222,48 +10595,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPresetHandle))
-        {
-            err = DataModel::Decode(reader, presetHandle);
-        }
-        else if (__context_tag == to_underlying(Fields::kPresetScenario))
-        {
-            err = DataModel::Decode(reader, presetScenario);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kCoolingSetpoint))
-        {
-            err = DataModel::Decode(reader, coolingSetpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kHeatingSetpoint))
-        {
-            err = DataModel::Decode(reader, heatingSetpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kBuiltIn))
-        {
-            err = DataModel::Decode(reader, builtIn);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPresetHandle, Fields::kPresetScenario, Fields::kName, Fields::kCoolingSetpoint,
+                                   Fields::kHeatingSetpoint, Fields::kBuiltIn>(reader, presetHandle, presetScenario, name,
+                                                                               coolingSetpoint, heatingSetpoint, builtIn);
 }
 
 } // namespace PresetStruct
@@ -21280,36 +10614,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPresetScenario))
-        {
-            err = DataModel::Decode(reader, presetScenario);
-        }
-        else if (__context_tag == to_underlying(Fields::kNumberOfPresets))
-        {
-            err = DataModel::Decode(reader, numberOfPresets);
-        }
-        else if (__context_tag == to_underlying(Fields::kPresetTypeFeatures))
-        {
-            err = DataModel::Decode(reader, presetTypeFeatures);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPresetScenario, Fields::kNumberOfPresets, Fields::kPresetTypeFeatures>(
+        reader, presetScenario, numberOfPresets, presetTypeFeatures);
 }
 
 } // namespace PresetTypeStruct
@@ -21326,36 +10632,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSystemMode))
-        {
-            err = DataModel::Decode(reader, systemMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kNumberOfSchedules))
-        {
-            err = DataModel::Decode(reader, numberOfSchedules);
-        }
-        else if (__context_tag == to_underlying(Fields::kScheduleTypeFeatures))
-        {
-            err = DataModel::Decode(reader, scheduleTypeFeatures);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSystemMode, Fields::kNumberOfSchedules, Fields::kScheduleTypeFeatures>(
+        reader, systemMode, numberOfSchedules, scheduleTypeFeatures);
 }
 
 } // namespace ScheduleTypeStruct
@@ -21372,36 +10650,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kHeatSetpoint))
-        {
-            err = DataModel::Decode(reader, heatSetpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kCoolSetpoint))
-        {
-            err = DataModel::Decode(reader, coolSetpoint);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTransitionTime, Fields::kHeatSetpoint, Fields::kCoolSetpoint>(
+        reader, transitionTime, heatSetpoint, coolSetpoint);
 }
 
 } // namespace WeeklyScheduleTransitionStruct
@@ -21419,32 +10669,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMode))
-        {
-            err = DataModel::Decode(reader, mode);
-        }
-        else if (__context_tag == to_underlying(Fields::kAmount))
-        {
-            err = DataModel::Decode(reader, amount);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMode, Fields::kAmount>(reader, mode, amount);
 }
 } // namespace SetpointRaiseLower.
 namespace GetWeeklyScheduleResponse {
@@ -21460,40 +10685,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNumberOfTransitionsForSequence))
-        {
-            err = DataModel::Decode(reader, numberOfTransitionsForSequence);
-        }
-        else if (__context_tag == to_underlying(Fields::kDayOfWeekForSequence))
-        {
-            err = DataModel::Decode(reader, dayOfWeekForSequence);
-        }
-        else if (__context_tag == to_underlying(Fields::kModeForSequence))
-        {
-            err = DataModel::Decode(reader, modeForSequence);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitions))
-        {
-            err = DataModel::Decode(reader, transitions);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNumberOfTransitionsForSequence, Fields::kDayOfWeekForSequence, Fields::kModeForSequence,
+                                   Fields::kTransitions>(reader, numberOfTransitionsForSequence, dayOfWeekForSequence,
+                                                         modeForSequence, transitions);
 }
 } // namespace GetWeeklyScheduleResponse.
 namespace SetWeeklySchedule {
@@ -21509,40 +10703,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNumberOfTransitionsForSequence))
-        {
-            err = DataModel::Decode(reader, numberOfTransitionsForSequence);
-        }
-        else if (__context_tag == to_underlying(Fields::kDayOfWeekForSequence))
-        {
-            err = DataModel::Decode(reader, dayOfWeekForSequence);
-        }
-        else if (__context_tag == to_underlying(Fields::kModeForSequence))
-        {
-            err = DataModel::Decode(reader, modeForSequence);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitions))
-        {
-            err = DataModel::Decode(reader, transitions);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNumberOfTransitionsForSequence, Fields::kDayOfWeekForSequence, Fields::kModeForSequence,
+                                   Fields::kTransitions>(reader, numberOfTransitionsForSequence, dayOfWeekForSequence,
+                                                         modeForSequence, transitions);
 }
 } // namespace SetWeeklySchedule.
 namespace GetWeeklySchedule {
@@ -21556,32 +10719,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDaysToReturn))
-        {
-            err = DataModel::Decode(reader, daysToReturn);
-        }
-        else if (__context_tag == to_underlying(Fields::kModeToReturn))
-        {
-            err = DataModel::Decode(reader, modeToReturn);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDaysToReturn, Fields::kModeToReturn>(reader, daysToReturn, modeToReturn);
 }
 } // namespace GetWeeklySchedule.
 namespace ClearWeeklySchedule {
@@ -21593,15 +10731,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ClearWeeklySchedule.
 namespace SetActiveScheduleRequest {
@@ -21614,28 +10744,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kScheduleHandle))
-        {
-            err = DataModel::Decode(reader, scheduleHandle);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kScheduleHandle>(reader, scheduleHandle);
 }
 } // namespace SetActiveScheduleRequest.
 namespace SetActivePresetRequest {
@@ -21648,28 +10757,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPresetHandle))
-        {
-            err = DataModel::Decode(reader, presetHandle);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPresetHandle>(reader, presetHandle);
 }
 } // namespace SetActivePresetRequest.
 namespace AtomicResponse {
@@ -21684,36 +10772,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatusCode))
-        {
-            err = DataModel::Decode(reader, statusCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kAttributeStatus))
-        {
-            err = DataModel::Decode(reader, attributeStatus);
-        }
-        else if (__context_tag == to_underlying(Fields::kTimeout))
-        {
-            err = DataModel::Decode(reader, timeout);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatusCode, Fields::kAttributeStatus, Fields::kTimeout>(reader, statusCode,
+                                                                                                    attributeStatus, timeout);
 }
 } // namespace AtomicResponse.
 namespace AtomicRequest {
@@ -21728,36 +10788,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kRequestType))
-        {
-            err = DataModel::Decode(reader, requestType);
-        }
-        else if (__context_tag == to_underlying(Fields::kAttributeRequests))
-        {
-            err = DataModel::Decode(reader, attributeRequests);
-        }
-        else if (__context_tag == to_underlying(Fields::kTimeout))
-        {
-            err = DataModel::Decode(reader, timeout);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kRequestType, Fields::kAttributeRequests, Fields::kTimeout>(reader, requestType,
+                                                                                                       attributeRequests, timeout);
 }
 } // namespace AtomicRequest.
 } // namespace Commands
@@ -21921,36 +10953,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDirection))
-        {
-            err = DataModel::Decode(reader, direction);
-        }
-        else if (__context_tag == to_underlying(Fields::kWrap))
-        {
-            err = DataModel::Decode(reader, wrap);
-        }
-        else if (__context_tag == to_underlying(Fields::kLowestOff))
-        {
-            err = DataModel::Decode(reader, lowestOff);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDirection, Fields::kWrap, Fields::kLowestOff>(reader, direction, wrap, lowestOff);
 }
 } // namespace Step.
 } // namespace Commands
@@ -22054,44 +11057,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kHue))
-        {
-            err = DataModel::Decode(reader, hue);
-        }
-        else if (__context_tag == to_underlying(Fields::kDirection))
-        {
-            err = DataModel::Decode(reader, direction);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kHue, Fields::kDirection, Fields::kTransitionTime, Fields::kOptionsMask,
+                                   Fields::kOptionsOverride>(reader, hue, direction, transitionTime, optionsMask, optionsOverride);
 }
 } // namespace MoveToHue.
 namespace MoveHue {
@@ -22107,40 +11074,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMoveMode))
-        {
-            err = DataModel::Decode(reader, moveMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kRate))
-        {
-            err = DataModel::Decode(reader, rate);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMoveMode, Fields::kRate, Fields::kOptionsMask, Fields::kOptionsOverride>(
+        reader, moveMode, rate, optionsMask, optionsOverride);
 }
 } // namespace MoveHue.
 namespace StepHue {
@@ -22157,44 +11092,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStepMode))
-        {
-            err = DataModel::Decode(reader, stepMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kStepSize))
-        {
-            err = DataModel::Decode(reader, stepSize);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStepMode, Fields::kStepSize, Fields::kTransitionTime, Fields::kOptionsMask,
+                                   Fields::kOptionsOverride>(reader, stepMode, stepSize, transitionTime, optionsMask,
+                                                             optionsOverride);
 }
 } // namespace StepHue.
 namespace MoveToSaturation {
@@ -22210,40 +11110,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSaturation))
-        {
-            err = DataModel::Decode(reader, saturation);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSaturation, Fields::kTransitionTime, Fields::kOptionsMask,
+                                   Fields::kOptionsOverride>(reader, saturation, transitionTime, optionsMask, optionsOverride);
 }
 } // namespace MoveToSaturation.
 namespace MoveSaturation {
@@ -22259,40 +11127,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMoveMode))
-        {
-            err = DataModel::Decode(reader, moveMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kRate))
-        {
-            err = DataModel::Decode(reader, rate);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMoveMode, Fields::kRate, Fields::kOptionsMask, Fields::kOptionsOverride>(
+        reader, moveMode, rate, optionsMask, optionsOverride);
 }
 } // namespace MoveSaturation.
 namespace StepSaturation {
@@ -22309,44 +11145,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStepMode))
-        {
-            err = DataModel::Decode(reader, stepMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kStepSize))
-        {
-            err = DataModel::Decode(reader, stepSize);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStepMode, Fields::kStepSize, Fields::kTransitionTime, Fields::kOptionsMask,
+                                   Fields::kOptionsOverride>(reader, stepMode, stepSize, transitionTime, optionsMask,
+                                                             optionsOverride);
 }
 } // namespace StepSaturation.
 namespace MoveToHueAndSaturation {
@@ -22363,44 +11164,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kHue))
-        {
-            err = DataModel::Decode(reader, hue);
-        }
-        else if (__context_tag == to_underlying(Fields::kSaturation))
-        {
-            err = DataModel::Decode(reader, saturation);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kHue, Fields::kSaturation, Fields::kTransitionTime, Fields::kOptionsMask,
+                                   Fields::kOptionsOverride>(reader, hue, saturation, transitionTime, optionsMask, optionsOverride);
 }
 } // namespace MoveToHueAndSaturation.
 namespace MoveToColor {
@@ -22417,44 +11182,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kColorX))
-        {
-            err = DataModel::Decode(reader, colorX);
-        }
-        else if (__context_tag == to_underlying(Fields::kColorY))
-        {
-            err = DataModel::Decode(reader, colorY);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kColorX, Fields::kColorY, Fields::kTransitionTime, Fields::kOptionsMask,
+                                   Fields::kOptionsOverride>(reader, colorX, colorY, transitionTime, optionsMask, optionsOverride);
 }
 } // namespace MoveToColor.
 namespace MoveColor {
@@ -22470,40 +11199,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kRateX))
-        {
-            err = DataModel::Decode(reader, rateX);
-        }
-        else if (__context_tag == to_underlying(Fields::kRateY))
-        {
-            err = DataModel::Decode(reader, rateY);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kRateX, Fields::kRateY, Fields::kOptionsMask, Fields::kOptionsOverride>(
+        reader, rateX, rateY, optionsMask, optionsOverride);
 }
 } // namespace MoveColor.
 namespace StepColor {
@@ -22520,44 +11217,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStepX))
-        {
-            err = DataModel::Decode(reader, stepX);
-        }
-        else if (__context_tag == to_underlying(Fields::kStepY))
-        {
-            err = DataModel::Decode(reader, stepY);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStepX, Fields::kStepY, Fields::kTransitionTime, Fields::kOptionsMask,
+                                   Fields::kOptionsOverride>(reader, stepX, stepY, transitionTime, optionsMask, optionsOverride);
 }
 } // namespace StepColor.
 namespace MoveToColorTemperature {
@@ -22573,40 +11234,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kColorTemperatureMireds))
-        {
-            err = DataModel::Decode(reader, colorTemperatureMireds);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kColorTemperatureMireds, Fields::kTransitionTime, Fields::kOptionsMask,
+                                   Fields::kOptionsOverride>(reader, colorTemperatureMireds, transitionTime, optionsMask,
+                                                             optionsOverride);
 }
 } // namespace MoveToColorTemperature.
 namespace EnhancedMoveToHue {
@@ -22623,44 +11253,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEnhancedHue))
-        {
-            err = DataModel::Decode(reader, enhancedHue);
-        }
-        else if (__context_tag == to_underlying(Fields::kDirection))
-        {
-            err = DataModel::Decode(reader, direction);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEnhancedHue, Fields::kDirection, Fields::kTransitionTime, Fields::kOptionsMask,
+                                   Fields::kOptionsOverride>(reader, enhancedHue, direction, transitionTime, optionsMask,
+                                                             optionsOverride);
 }
 } // namespace EnhancedMoveToHue.
 namespace EnhancedMoveHue {
@@ -22676,40 +11271,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMoveMode))
-        {
-            err = DataModel::Decode(reader, moveMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kRate))
-        {
-            err = DataModel::Decode(reader, rate);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMoveMode, Fields::kRate, Fields::kOptionsMask, Fields::kOptionsOverride>(
+        reader, moveMode, rate, optionsMask, optionsOverride);
 }
 } // namespace EnhancedMoveHue.
 namespace EnhancedStepHue {
@@ -22726,44 +11289,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStepMode))
-        {
-            err = DataModel::Decode(reader, stepMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kStepSize))
-        {
-            err = DataModel::Decode(reader, stepSize);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStepMode, Fields::kStepSize, Fields::kTransitionTime, Fields::kOptionsMask,
+                                   Fields::kOptionsOverride>(reader, stepMode, stepSize, transitionTime, optionsMask,
+                                                             optionsOverride);
 }
 } // namespace EnhancedStepHue.
 namespace EnhancedMoveToHueAndSaturation {
@@ -22780,44 +11308,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kEnhancedHue))
-        {
-            err = DataModel::Decode(reader, enhancedHue);
-        }
-        else if (__context_tag == to_underlying(Fields::kSaturation))
-        {
-            err = DataModel::Decode(reader, saturation);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kEnhancedHue, Fields::kSaturation, Fields::kTransitionTime, Fields::kOptionsMask,
+                                   Fields::kOptionsOverride>(reader, enhancedHue, saturation, transitionTime, optionsMask,
+                                                             optionsOverride);
 }
 } // namespace EnhancedMoveToHueAndSaturation.
 namespace ColorLoopSet {
@@ -22836,52 +11329,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kUpdateFlags))
-        {
-            err = DataModel::Decode(reader, updateFlags);
-        }
-        else if (__context_tag == to_underlying(Fields::kAction))
-        {
-            err = DataModel::Decode(reader, action);
-        }
-        else if (__context_tag == to_underlying(Fields::kDirection))
-        {
-            err = DataModel::Decode(reader, direction);
-        }
-        else if (__context_tag == to_underlying(Fields::kTime))
-        {
-            err = DataModel::Decode(reader, time);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartHue))
-        {
-            err = DataModel::Decode(reader, startHue);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kUpdateFlags, Fields::kAction, Fields::kDirection, Fields::kTime, Fields::kStartHue,
+                                   Fields::kOptionsMask, Fields::kOptionsOverride>(reader, updateFlags, action, direction, time,
+                                                                                   startHue, optionsMask, optionsOverride);
 }
 } // namespace ColorLoopSet.
 namespace StopMoveStep {
@@ -22895,32 +11345,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOptionsMask, Fields::kOptionsOverride>(reader, optionsMask, optionsOverride);
 }
 } // namespace StopMoveStep.
 namespace MoveColorTemperature {
@@ -22938,48 +11363,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMoveMode))
-        {
-            err = DataModel::Decode(reader, moveMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kRate))
-        {
-            err = DataModel::Decode(reader, rate);
-        }
-        else if (__context_tag == to_underlying(Fields::kColorTemperatureMinimumMireds))
-        {
-            err = DataModel::Decode(reader, colorTemperatureMinimumMireds);
-        }
-        else if (__context_tag == to_underlying(Fields::kColorTemperatureMaximumMireds))
-        {
-            err = DataModel::Decode(reader, colorTemperatureMaximumMireds);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMoveMode, Fields::kRate, Fields::kColorTemperatureMinimumMireds,
+                                   Fields::kColorTemperatureMaximumMireds, Fields::kOptionsMask, Fields::kOptionsOverride>(
+        reader, moveMode, rate, colorTemperatureMinimumMireds, colorTemperatureMaximumMireds, optionsMask, optionsOverride);
 }
 } // namespace MoveColorTemperature.
 namespace StepColorTemperature {
@@ -22998,52 +11384,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStepMode))
-        {
-            err = DataModel::Decode(reader, stepMode);
-        }
-        else if (__context_tag == to_underlying(Fields::kStepSize))
-        {
-            err = DataModel::Decode(reader, stepSize);
-        }
-        else if (__context_tag == to_underlying(Fields::kTransitionTime))
-        {
-            err = DataModel::Decode(reader, transitionTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kColorTemperatureMinimumMireds))
-        {
-            err = DataModel::Decode(reader, colorTemperatureMinimumMireds);
-        }
-        else if (__context_tag == to_underlying(Fields::kColorTemperatureMaximumMireds))
-        {
-            err = DataModel::Decode(reader, colorTemperatureMaximumMireds);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsMask))
-        {
-            err = DataModel::Decode(reader, optionsMask);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionsOverride))
-        {
-            err = DataModel::Decode(reader, optionsOverride);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStepMode, Fields::kStepSize, Fields::kTransitionTime,
+                                   Fields::kColorTemperatureMinimumMireds, Fields::kColorTemperatureMaximumMireds,
+                                   Fields::kOptionsMask, Fields::kOptionsOverride>(
+        reader, stepMode, stepSize, transitionTime, colorTemperatureMinimumMireds, colorTemperatureMaximumMireds, optionsMask,
+        optionsOverride);
 }
 } // namespace StepColorTemperature.
 } // namespace Commands
@@ -23439,36 +11784,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kHoldTimeMin))
-        {
-            err = DataModel::Decode(reader, holdTimeMin);
-        }
-        else if (__context_tag == to_underlying(Fields::kHoldTimeMax))
-        {
-            err = DataModel::Decode(reader, holdTimeMax);
-        }
-        else if (__context_tag == to_underlying(Fields::kHoldTimeDefault))
-        {
-            err = DataModel::Decode(reader, holdTimeDefault);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kHoldTimeMin, Fields::kHoldTimeMax, Fields::kHoldTimeDefault>(
+        reader, holdTimeMin, holdTimeMax, holdTimeDefault);
 }
 
 } // namespace HoldTimeLimitsStruct
@@ -23537,28 +11854,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOccupancy))
-        {
-            err = DataModel::Decode(reader, occupancy);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOccupancy>(reader, occupancy);
 }
 } // namespace OccupancyChanged.
 } // namespace Events
@@ -24076,15 +12372,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace NetworkPassphraseRequest.
 namespace NetworkPassphraseResponse {
@@ -24097,28 +12385,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPassphrase))
-        {
-            err = DataModel::Decode(reader, passphrase);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPassphrase>(reader, passphrase);
 }
 } // namespace NetworkPassphraseResponse.
 } // namespace Commands
@@ -24163,15 +12430,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace GetActiveDatasetRequest.
 namespace GetPendingDatasetRequest {
@@ -24183,15 +12442,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace GetPendingDatasetRequest.
 namespace DatasetResponse {
@@ -24204,28 +12455,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDataset))
-        {
-            err = DataModel::Decode(reader, dataset);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDataset>(reader, dataset);
 }
 } // namespace DatasetResponse.
 namespace SetActiveDatasetRequest {
@@ -24239,32 +12469,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kActiveDataset))
-        {
-            err = DataModel::Decode(reader, activeDataset);
-        }
-        else if (__context_tag == to_underlying(Fields::kBreadcrumb))
-        {
-            err = DataModel::Decode(reader, breadcrumb);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kActiveDataset, Fields::kBreadcrumb>(reader, activeDataset, breadcrumb);
 }
 } // namespace SetActiveDatasetRequest.
 namespace SetPendingDatasetRequest {
@@ -24277,28 +12482,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPendingDataset))
-        {
-            err = DataModel::Decode(reader, pendingDataset);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPendingDataset>(reader, pendingDataset);
 }
 } // namespace SetPendingDatasetRequest.
 } // namespace Commands
@@ -24355,40 +12539,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kExtendedPanID))
-        {
-            err = DataModel::Decode(reader, extendedPanID);
-        }
-        else if (__context_tag == to_underlying(Fields::kNetworkName))
-        {
-            err = DataModel::Decode(reader, networkName);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannel))
-        {
-            err = DataModel::Decode(reader, channel);
-        }
-        else if (__context_tag == to_underlying(Fields::kActiveTimestamp))
-        {
-            err = DataModel::Decode(reader, activeTimestamp);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kExtendedPanID, Fields::kNetworkName, Fields::kChannel, Fields::kActiveTimestamp>(
+        reader, extendedPanID, networkName, channel, activeTimestamp);
 }
 
 } // namespace ThreadNetworkStruct
@@ -24405,28 +12557,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOperationalDataset))
-        {
-            err = DataModel::Decode(reader, operationalDataset);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOperationalDataset>(reader, operationalDataset);
 }
 } // namespace AddNetwork.
 namespace RemoveNetwork {
@@ -24439,28 +12570,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kExtendedPanID))
-        {
-            err = DataModel::Decode(reader, extendedPanID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kExtendedPanID>(reader, extendedPanID);
 }
 } // namespace RemoveNetwork.
 namespace GetOperationalDataset {
@@ -24473,28 +12583,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kExtendedPanID))
-        {
-            err = DataModel::Decode(reader, extendedPanID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kExtendedPanID>(reader, extendedPanID);
 }
 } // namespace GetOperationalDataset.
 namespace OperationalDatasetResponse {
@@ -24507,28 +12596,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOperationalDataset))
-        {
-            err = DataModel::Decode(reader, operationalDataset);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOperationalDataset>(reader, operationalDataset);
 }
 } // namespace OperationalDatasetResponse.
 } // namespace Commands
@@ -24609,32 +12677,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kRole))
-        {
-            err = DataModel::Decode(reader, role);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kName, Fields::kRole>(reader, name, role);
 }
 
 } // namespace ProgramCastStruct
@@ -24650,32 +12693,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCategory))
-        {
-            err = DataModel::Decode(reader, category);
-        }
-        else if (__context_tag == to_underlying(Fields::kSubCategory))
-        {
-            err = DataModel::Decode(reader, subCategory);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCategory, Fields::kSubCategory>(reader, category, subCategory);
 }
 
 } // namespace ProgramCategoryStruct
@@ -24691,32 +12709,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSeason))
-        {
-            err = DataModel::Decode(reader, season);
-        }
-        else if (__context_tag == to_underlying(Fields::kEpisode))
-        {
-            err = DataModel::Decode(reader, episode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSeason, Fields::kEpisode>(reader, season, episode);
 }
 
 } // namespace SeriesInfoStruct
@@ -24737,55 +12730,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
+    return DataModel::DecodeStruct<Fields::kMajorNumber, Fields::kMinorNumber, Fields::kName, Fields::kCallSign,
+                                   Fields::kAffiliateCallSign, Fields::kIdentifier, Fields::kType>(
+        reader, majorNumber, minorNumber, name, callSign, affiliateCallSign, identifier, type);
+}
 
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMajorNumber))
-        {
-            err = DataModel::Decode(reader, majorNumber);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinorNumber))
-        {
-            err = DataModel::Decode(reader, minorNumber);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kCallSign))
-        {
-            err = DataModel::Decode(reader, callSign);
-        }
-        else if (__context_tag == to_underlying(Fields::kAffiliateCallSign))
-        {
-            err = DataModel::Decode(reader, affiliateCallSign);
-        }
-        else if (__context_tag == to_underlying(Fields::kIdentifier))
-        {
-            err = DataModel::Decode(reader, identifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kType))
-        {
-            err = DataModel::Decode(reader, type);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
-}
-
-} // namespace ChannelInfoStruct
+} // namespace ChannelInfoStruct
 
 namespace ProgramStruct {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
@@ -24815,100 +12765,14 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kIdentifier))
-        {
-            err = DataModel::Decode(reader, identifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannel))
-        {
-            err = DataModel::Decode(reader, channel);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTime))
-        {
-            err = DataModel::Decode(reader, startTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndTime))
-        {
-            err = DataModel::Decode(reader, endTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kTitle))
-        {
-            err = DataModel::Decode(reader, title);
-        }
-        else if (__context_tag == to_underlying(Fields::kSubtitle))
-        {
-            err = DataModel::Decode(reader, subtitle);
-        }
-        else if (__context_tag == to_underlying(Fields::kDescription))
-        {
-            err = DataModel::Decode(reader, description);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioLanguages))
-        {
-            err = DataModel::Decode(reader, audioLanguages);
-        }
-        else if (__context_tag == to_underlying(Fields::kRatings))
-        {
-            err = DataModel::Decode(reader, ratings);
-        }
-        else if (__context_tag == to_underlying(Fields::kThumbnailUrl))
-        {
-            err = DataModel::Decode(reader, thumbnailUrl);
-        }
-        else if (__context_tag == to_underlying(Fields::kPosterArtUrl))
-        {
-            err = DataModel::Decode(reader, posterArtUrl);
-        }
-        else if (__context_tag == to_underlying(Fields::kDvbiUrl))
-        {
-            err = DataModel::Decode(reader, dvbiUrl);
-        }
-        else if (__context_tag == to_underlying(Fields::kReleaseDate))
-        {
-            err = DataModel::Decode(reader, releaseDate);
-        }
-        else if (__context_tag == to_underlying(Fields::kParentalGuidanceText))
-        {
-            err = DataModel::Decode(reader, parentalGuidanceText);
-        }
-        else if (__context_tag == to_underlying(Fields::kRecordingFlag))
-        {
-            err = DataModel::Decode(reader, recordingFlag);
-        }
-        else if (__context_tag == to_underlying(Fields::kSeriesInfo))
-        {
-            err = DataModel::Decode(reader, seriesInfo);
-        }
-        else if (__context_tag == to_underlying(Fields::kCategoryList))
-        {
-            err = DataModel::Decode(reader, categoryList);
-        }
-        else if (__context_tag == to_underlying(Fields::kCastList))
-        {
-            err = DataModel::Decode(reader, castList);
-        }
-        else if (__context_tag == to_underlying(Fields::kExternalIDList))
-        {
-            err = DataModel::Decode(reader, externalIDList);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kIdentifier, Fields::kChannel, Fields::kStartTime, Fields::kEndTime, Fields::kTitle,
+                                   Fields::kSubtitle, Fields::kDescription, Fields::kAudioLanguages, Fields::kRatings,
+                                   Fields::kThumbnailUrl, Fields::kPosterArtUrl, Fields::kDvbiUrl, Fields::kReleaseDate,
+                                   Fields::kParentalGuidanceText, Fields::kRecordingFlag, Fields::kSeriesInfo,
+                                   Fields::kCategoryList, Fields::kCastList, Fields::kExternalIDList>(
+        reader, identifier, channel, startTime, endTime, title, subtitle, description, audioLanguages, ratings, thumbnailUrl,
+        posterArtUrl, dvbiUrl, releaseDate, parentalGuidanceText, recordingFlag, seriesInfo, categoryList, castList,
+        externalIDList);
 }
 
 } // namespace ProgramStruct
@@ -24925,36 +12789,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLimit))
-        {
-            err = DataModel::Decode(reader, limit);
-        }
-        else if (__context_tag == to_underlying(Fields::kAfter))
-        {
-            err = DataModel::Decode(reader, after);
-        }
-        else if (__context_tag == to_underlying(Fields::kBefore))
-        {
-            err = DataModel::Decode(reader, before);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLimit, Fields::kAfter, Fields::kBefore>(reader, limit, after, before);
 }
 
 } // namespace PageTokenStruct
@@ -24970,32 +12805,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPreviousToken))
-        {
-            err = DataModel::Decode(reader, previousToken);
-        }
-        else if (__context_tag == to_underlying(Fields::kNextToken))
-        {
-            err = DataModel::Decode(reader, nextToken);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPreviousToken, Fields::kNextToken>(reader, previousToken, nextToken);
 }
 
 } // namespace ChannelPagingStruct
@@ -25011,32 +12821,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kName, Fields::kValue>(reader, name, value);
 }
 
 } // namespace AdditionalInfoStruct
@@ -25054,40 +12839,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOperatorName))
-        {
-            err = DataModel::Decode(reader, operatorName);
-        }
-        else if (__context_tag == to_underlying(Fields::kLineupName))
-        {
-            err = DataModel::Decode(reader, lineupName);
-        }
-        else if (__context_tag == to_underlying(Fields::kPostalCode))
-        {
-            err = DataModel::Decode(reader, postalCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kLineupInfoType))
-        {
-            err = DataModel::Decode(reader, lineupInfoType);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOperatorName, Fields::kLineupName, Fields::kPostalCode, Fields::kLineupInfoType>(
+        reader, operatorName, lineupName, postalCode, lineupInfoType);
 }
 
 } // namespace LineupInfoStruct
@@ -25104,28 +12857,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMatch))
-        {
-            err = DataModel::Decode(reader, match);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMatch>(reader, match);
 }
 } // namespace ChangeChannel.
 namespace ChangeChannelResponse {
@@ -25139,32 +12871,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kData>(reader, status, data);
 }
 } // namespace ChangeChannelResponse.
 namespace ChangeChannelByNumber {
@@ -25178,32 +12885,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMajorNumber))
-        {
-            err = DataModel::Decode(reader, majorNumber);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinorNumber))
-        {
-            err = DataModel::Decode(reader, minorNumber);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMajorNumber, Fields::kMinorNumber>(reader, majorNumber, minorNumber);
 }
 } // namespace ChangeChannelByNumber.
 namespace SkipChannel {
@@ -25216,28 +12898,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCount))
-        {
-            err = DataModel::Decode(reader, count);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCount>(reader, count);
 }
 } // namespace SkipChannel.
 namespace GetProgramGuide {
@@ -25256,52 +12917,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStartTime))
-        {
-            err = DataModel::Decode(reader, startTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndTime))
-        {
-            err = DataModel::Decode(reader, endTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannelList))
-        {
-            err = DataModel::Decode(reader, channelList);
-        }
-        else if (__context_tag == to_underlying(Fields::kPageToken))
-        {
-            err = DataModel::Decode(reader, pageToken);
-        }
-        else if (__context_tag == to_underlying(Fields::kRecordingFlag))
-        {
-            err = DataModel::Decode(reader, recordingFlag);
-        }
-        else if (__context_tag == to_underlying(Fields::kExternalIDList))
-        {
-            err = DataModel::Decode(reader, externalIDList);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStartTime, Fields::kEndTime, Fields::kChannelList, Fields::kPageToken,
+                                   Fields::kRecordingFlag, Fields::kExternalIDList, Fields::kData>(
+        reader, startTime, endTime, channelList, pageToken, recordingFlag, externalIDList, data);
 }
 } // namespace GetProgramGuide.
 namespace ProgramGuideResponse {
@@ -25315,32 +12933,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPaging))
-        {
-            err = DataModel::Decode(reader, paging);
-        }
-        else if (__context_tag == to_underlying(Fields::kProgramList))
-        {
-            err = DataModel::Decode(reader, programList);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPaging, Fields::kProgramList>(reader, paging, programList);
 }
 } // namespace ProgramGuideResponse.
 namespace RecordProgram {
@@ -25356,40 +12949,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kProgramIdentifier))
-        {
-            err = DataModel::Decode(reader, programIdentifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kShouldRecordSeries))
-        {
-            err = DataModel::Decode(reader, shouldRecordSeries);
-        }
-        else if (__context_tag == to_underlying(Fields::kExternalIDList))
-        {
-            err = DataModel::Decode(reader, externalIDList);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kProgramIdentifier, Fields::kShouldRecordSeries, Fields::kExternalIDList,
+                                   Fields::kData>(reader, programIdentifier, shouldRecordSeries, externalIDList, data);
 }
 } // namespace RecordProgram.
 namespace CancelRecordProgram {
@@ -25405,40 +12966,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kProgramIdentifier))
-        {
-            err = DataModel::Decode(reader, programIdentifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kShouldRecordSeries))
-        {
-            err = DataModel::Decode(reader, shouldRecordSeries);
-        }
-        else if (__context_tag == to_underlying(Fields::kExternalIDList))
-        {
-            err = DataModel::Decode(reader, externalIDList);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kProgramIdentifier, Fields::kShouldRecordSeries, Fields::kExternalIDList,
+                                   Fields::kData>(reader, programIdentifier, shouldRecordSeries, externalIDList, data);
 }
 } // namespace CancelRecordProgram.
 } // namespace Commands
@@ -25487,32 +13016,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kIdentifier))
-        {
-            err = DataModel::Decode(reader, identifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kIdentifier, Fields::kName>(reader, identifier, name);
 }
 
 } // namespace TargetInfoStruct
@@ -25530,32 +13034,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTarget))
-        {
-            err = DataModel::Decode(reader, target);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTarget, Fields::kData>(reader, target, data);
 }
 } // namespace NavigateTarget.
 namespace NavigateTargetResponse {
@@ -25569,32 +13048,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kData>(reader, status, data);
 }
 } // namespace NavigateTargetResponse.
 } // namespace Commands
@@ -25638,36 +13092,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTargetList))
-        {
-            err = DataModel::Decode(reader, targetList);
-        }
-        else if (__context_tag == to_underlying(Fields::kCurrentTarget))
-        {
-            err = DataModel::Decode(reader, currentTarget);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTargetList, Fields::kCurrentTarget, Fields::kData>(reader, targetList, currentTarget,
+                                                                                               data);
 }
 } // namespace TargetUpdated.
 } // namespace Events
@@ -25687,32 +13113,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLanguageCode))
-        {
-            err = DataModel::Decode(reader, languageCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kDisplayName))
-        {
-            err = DataModel::Decode(reader, displayName);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLanguageCode, Fields::kDisplayName>(reader, languageCode, displayName);
 }
 
 } // namespace TrackAttributesStruct
@@ -25728,32 +13129,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kId))
-        {
-            err = DataModel::Decode(reader, id);
-        }
-        else if (__context_tag == to_underlying(Fields::kTrackAttributes))
-        {
-            err = DataModel::Decode(reader, trackAttributes);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kId, Fields::kTrackAttributes>(reader, id, trackAttributes);
 }
 
 } // namespace TrackStruct
@@ -25769,32 +13145,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kUpdatedAt))
-        {
-            err = DataModel::Decode(reader, updatedAt);
-        }
-        else if (__context_tag == to_underlying(Fields::kPosition))
-        {
-            err = DataModel::Decode(reader, position);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kUpdatedAt, Fields::kPosition>(reader, updatedAt, position);
 }
 
 } // namespace PlaybackPositionStruct
@@ -25810,15 +13161,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Play.
 namespace Pause {
@@ -25830,15 +13173,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Pause.
 namespace Stop {
@@ -25850,15 +13185,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Stop.
 namespace StartOver {
@@ -25870,15 +13197,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace StartOver.
 namespace Previous {
@@ -25890,15 +13209,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Previous.
 namespace Next {
@@ -25910,15 +13221,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Next.
 namespace Rewind {
@@ -25931,28 +13234,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAudioAdvanceUnmuted))
-        {
-            err = DataModel::Decode(reader, audioAdvanceUnmuted);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAudioAdvanceUnmuted>(reader, audioAdvanceUnmuted);
 }
 } // namespace Rewind.
 namespace FastForward {
@@ -25965,28 +13247,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAudioAdvanceUnmuted))
-        {
-            err = DataModel::Decode(reader, audioAdvanceUnmuted);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAudioAdvanceUnmuted>(reader, audioAdvanceUnmuted);
 }
 } // namespace FastForward.
 namespace SkipForward {
@@ -25999,28 +13260,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDeltaPositionMilliseconds))
-        {
-            err = DataModel::Decode(reader, deltaPositionMilliseconds);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDeltaPositionMilliseconds>(reader, deltaPositionMilliseconds);
 }
 } // namespace SkipForward.
 namespace SkipBackward {
@@ -26033,28 +13273,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDeltaPositionMilliseconds))
-        {
-            err = DataModel::Decode(reader, deltaPositionMilliseconds);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDeltaPositionMilliseconds>(reader, deltaPositionMilliseconds);
 }
 } // namespace SkipBackward.
 namespace PlaybackResponse {
@@ -26068,32 +13287,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kData>(reader, status, data);
 }
 } // namespace PlaybackResponse.
 namespace Seek {
@@ -26106,28 +13300,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPosition))
-        {
-            err = DataModel::Decode(reader, position);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPosition>(reader, position);
 }
 } // namespace Seek.
 namespace ActivateAudioTrack {
@@ -26141,32 +13314,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTrackID))
-        {
-            err = DataModel::Decode(reader, trackID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioOutputIndex))
-        {
-            err = DataModel::Decode(reader, audioOutputIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTrackID, Fields::kAudioOutputIndex>(reader, trackID, audioOutputIndex);
 }
 } // namespace ActivateAudioTrack.
 namespace ActivateTextTrack {
@@ -26179,28 +13327,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTrackID))
-        {
-            err = DataModel::Decode(reader, trackID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTrackID>(reader, trackID);
 }
 } // namespace ActivateTextTrack.
 namespace DeactivateTextTrack {
@@ -26212,15 +13339,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace DeactivateTextTrack.
 } // namespace Commands
@@ -26288,60 +13407,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCurrentState))
-        {
-            err = DataModel::Decode(reader, currentState);
-        }
-        else if (__context_tag == to_underlying(Fields::kStartTime))
-        {
-            err = DataModel::Decode(reader, startTime);
-        }
-        else if (__context_tag == to_underlying(Fields::kDuration))
-        {
-            err = DataModel::Decode(reader, duration);
-        }
-        else if (__context_tag == to_underlying(Fields::kSampledPosition))
-        {
-            err = DataModel::Decode(reader, sampledPosition);
-        }
-        else if (__context_tag == to_underlying(Fields::kPlaybackSpeed))
-        {
-            err = DataModel::Decode(reader, playbackSpeed);
-        }
-        else if (__context_tag == to_underlying(Fields::kSeekRangeEnd))
-        {
-            err = DataModel::Decode(reader, seekRangeEnd);
-        }
-        else if (__context_tag == to_underlying(Fields::kSeekRangeStart))
-        {
-            err = DataModel::Decode(reader, seekRangeStart);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioAdvanceUnmuted))
-        {
-            err = DataModel::Decode(reader, audioAdvanceUnmuted);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCurrentState, Fields::kStartTime, Fields::kDuration, Fields::kSampledPosition,
+                                   Fields::kPlaybackSpeed, Fields::kSeekRangeEnd, Fields::kSeekRangeStart, Fields::kData,
+                                   Fields::kAudioAdvanceUnmuted>(reader, currentState, startTime, duration, sampledPosition,
+                                                                 playbackSpeed, seekRangeEnd, seekRangeStart, data,
+                                                                 audioAdvanceUnmuted);
 }
 } // namespace StateChanged.
 } // namespace Events
@@ -26363,40 +13433,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kIndex))
-        {
-            err = DataModel::Decode(reader, index);
-        }
-        else if (__context_tag == to_underlying(Fields::kInputType))
-        {
-            err = DataModel::Decode(reader, inputType);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kDescription))
-        {
-            err = DataModel::Decode(reader, description);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kIndex, Fields::kInputType, Fields::kName, Fields::kDescription>(
+        reader, index, inputType, name, description);
 }
 
 } // namespace InputInfoStruct
@@ -26413,28 +13451,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kIndex))
-        {
-            err = DataModel::Decode(reader, index);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kIndex>(reader, index);
 }
 } // namespace SelectInput.
 namespace ShowInputStatus {
@@ -26446,15 +13463,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ShowInputStatus.
 namespace HideInputStatus {
@@ -26466,15 +13475,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace HideInputStatus.
 namespace RenameInput {
@@ -26488,32 +13489,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kIndex))
-        {
-            err = DataModel::Decode(reader, index);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kIndex, Fields::kName>(reader, index, name);
 }
 } // namespace RenameInput.
 } // namespace Commands
@@ -26558,15 +13534,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Sleep.
 } // namespace Commands
@@ -26608,28 +13576,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kKeyCode))
-        {
-            err = DataModel::Decode(reader, keyCode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kKeyCode>(reader, keyCode);
 }
 } // namespace SendKey.
 namespace SendKeyResponse {
@@ -26642,28 +13589,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus>(reader, status);
 }
 } // namespace SendKeyResponse.
 } // namespace Commands
@@ -26707,36 +13633,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWidth))
-        {
-            err = DataModel::Decode(reader, width);
-        }
-        else if (__context_tag == to_underlying(Fields::kHeight))
-        {
-            err = DataModel::Decode(reader, height);
-        }
-        else if (__context_tag == to_underlying(Fields::kMetric))
-        {
-            err = DataModel::Decode(reader, metric);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWidth, Fields::kHeight, Fields::kMetric>(reader, width, height, metric);
 }
 
 } // namespace DimensionStruct
@@ -26753,36 +13650,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kLanguageCode))
-        {
-            err = DataModel::Decode(reader, languageCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kCharacteristics))
-        {
-            err = DataModel::Decode(reader, characteristics);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioOutputIndex))
-        {
-            err = DataModel::Decode(reader, audioOutputIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kLanguageCode, Fields::kCharacteristics, Fields::kAudioOutputIndex>(
+        reader, languageCode, characteristics, audioOutputIndex);
 }
 
 } // namespace TrackPreferenceStruct
@@ -26799,36 +13668,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPlaybackPosition))
-        {
-            err = DataModel::Decode(reader, playbackPosition);
-        }
-        else if (__context_tag == to_underlying(Fields::kTextTrack))
-        {
-            err = DataModel::Decode(reader, textTrack);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioTracks))
-        {
-            err = DataModel::Decode(reader, audioTracks);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPlaybackPosition, Fields::kTextTrack, Fields::kAudioTracks>(reader, playbackPosition,
+                                                                                                        textTrack, audioTracks);
 }
 
 } // namespace PlaybackPreferencesStruct
@@ -26844,32 +13685,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kName, Fields::kValue>(reader, name, value);
 }
 
 } // namespace AdditionalInfoStruct
@@ -26886,36 +13702,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kType))
-        {
-            err = DataModel::Decode(reader, type);
-        }
-        else if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-        else if (__context_tag == to_underlying(Fields::kExternalIDList))
-        {
-            err = DataModel::Decode(reader, externalIDList);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kType, Fields::kValue, Fields::kExternalIDList>(reader, type, value, externalIDList);
 }
 
 } // namespace ParameterStruct
@@ -26930,28 +13717,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kParameterList))
-        {
-            err = DataModel::Decode(reader, parameterList);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kParameterList>(reader, parameterList);
 }
 
 } // namespace ContentSearchStruct
@@ -26968,36 +13734,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kImageURL))
-        {
-            err = DataModel::Decode(reader, imageURL);
-        }
-        else if (__context_tag == to_underlying(Fields::kColor))
-        {
-            err = DataModel::Decode(reader, color);
-        }
-        else if (__context_tag == to_underlying(Fields::kSize))
-        {
-            err = DataModel::Decode(reader, size);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kImageURL, Fields::kColor, Fields::kSize>(reader, imageURL, color, size);
 }
 
 } // namespace StyleInformationStruct
@@ -27017,48 +13754,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kProviderName))
-        {
-            err = DataModel::Decode(reader, providerName);
-        }
-        else if (__context_tag == to_underlying(Fields::kBackground))
-        {
-            err = DataModel::Decode(reader, background);
-        }
-        else if (__context_tag == to_underlying(Fields::kLogo))
-        {
-            err = DataModel::Decode(reader, logo);
-        }
-        else if (__context_tag == to_underlying(Fields::kProgressBar))
-        {
-            err = DataModel::Decode(reader, progressBar);
-        }
-        else if (__context_tag == to_underlying(Fields::kSplash))
-        {
-            err = DataModel::Decode(reader, splash);
-        }
-        else if (__context_tag == to_underlying(Fields::kWaterMark))
-        {
-            err = DataModel::Decode(reader, waterMark);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kProviderName, Fields::kBackground, Fields::kLogo, Fields::kProgressBar, Fields::kSplash,
+                                   Fields::kWaterMark>(reader, providerName, background, logo, progressBar, splash, waterMark);
 }
 
 } // namespace BrandingInformationStruct
@@ -27079,44 +13776,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSearch))
-        {
-            err = DataModel::Decode(reader, search);
-        }
-        else if (__context_tag == to_underlying(Fields::kAutoPlay))
-        {
-            err = DataModel::Decode(reader, autoPlay);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else if (__context_tag == to_underlying(Fields::kPlaybackPreferences))
-        {
-            err = DataModel::Decode(reader, playbackPreferences);
-        }
-        else if (__context_tag == to_underlying(Fields::kUseCurrentContext))
-        {
-            err = DataModel::Decode(reader, useCurrentContext);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSearch, Fields::kAutoPlay, Fields::kData, Fields::kPlaybackPreferences,
+                                   Fields::kUseCurrentContext>(reader, search, autoPlay, data, playbackPreferences,
+                                                               useCurrentContext);
 }
 } // namespace LaunchContent.
 namespace LaunchURL {
@@ -27131,36 +13793,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kContentURL))
-        {
-            err = DataModel::Decode(reader, contentURL);
-        }
-        else if (__context_tag == to_underlying(Fields::kDisplayString))
-        {
-            err = DataModel::Decode(reader, displayString);
-        }
-        else if (__context_tag == to_underlying(Fields::kBrandingInformation))
-        {
-            err = DataModel::Decode(reader, brandingInformation);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kContentURL, Fields::kDisplayString, Fields::kBrandingInformation>(
+        reader, contentURL, displayString, brandingInformation);
 }
 } // namespace LaunchURL.
 namespace LauncherResponse {
@@ -27174,32 +13808,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kData>(reader, status, data);
 }
 } // namespace LauncherResponse.
 } // namespace Commands
@@ -27247,36 +13856,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kIndex))
-        {
-            err = DataModel::Decode(reader, index);
-        }
-        else if (__context_tag == to_underlying(Fields::kOutputType))
-        {
-            err = DataModel::Decode(reader, outputType);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kIndex, Fields::kOutputType, Fields::kName>(reader, index, outputType, name);
 }
 
 } // namespace OutputInfoStruct
@@ -27293,28 +13873,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kIndex))
-        {
-            err = DataModel::Decode(reader, index);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kIndex>(reader, index);
 }
 } // namespace SelectOutput.
 namespace RenameOutput {
@@ -27328,32 +13887,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kIndex))
-        {
-            err = DataModel::Decode(reader, index);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kIndex, Fields::kName>(reader, index, name);
 }
 } // namespace RenameOutput.
 } // namespace Commands
@@ -27400,32 +13934,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kApplication))
-        {
-            err = DataModel::Decode(reader, application);
-        }
-        else if (__context_tag == to_underlying(Fields::kEndpoint))
-        {
-            err = DataModel::Decode(reader, endpoint);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kApplication, Fields::kEndpoint>(reader, application, endpoint);
 }
 
 } // namespace ApplicationEPStruct
@@ -27443,32 +13952,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kApplication))
-        {
-            err = DataModel::Decode(reader, application);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kApplication, Fields::kData>(reader, application, data);
 }
 } // namespace LaunchApp.
 namespace StopApp {
@@ -27481,28 +13965,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kApplication))
-        {
-            err = DataModel::Decode(reader, application);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kApplication>(reader, application);
 }
 } // namespace StopApp.
 namespace HideApp {
@@ -27515,28 +13978,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kApplication))
-        {
-            err = DataModel::Decode(reader, application);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kApplication>(reader, application);
 }
 } // namespace HideApp.
 namespace LauncherResponse {
@@ -27550,32 +13992,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kData>(reader, status, data);
 }
 } // namespace LauncherResponse.
 } // namespace Commands
@@ -27666,28 +14083,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTempAccountIdentifier))
-        {
-            err = DataModel::Decode(reader, tempAccountIdentifier);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTempAccountIdentifier>(reader, tempAccountIdentifier);
 }
 } // namespace GetSetupPIN.
 namespace GetSetupPINResponse {
@@ -27700,28 +14096,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSetupPIN))
-        {
-            err = DataModel::Decode(reader, setupPIN);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSetupPIN>(reader, setupPIN);
 }
 } // namespace GetSetupPINResponse.
 namespace Login {
@@ -27736,36 +14111,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kTempAccountIdentifier))
-        {
-            err = DataModel::Decode(reader, tempAccountIdentifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kSetupPIN))
-        {
-            err = DataModel::Decode(reader, setupPIN);
-        }
-        else if (__context_tag == to_underlying(Fields::kNode))
-        {
-            err = DataModel::Decode(reader, node);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kTempAccountIdentifier, Fields::kSetupPIN, Fields::kNode>(reader, tempAccountIdentifier,
+                                                                                                     setupPIN, node);
 }
 } // namespace Login.
 namespace Logout {
@@ -27778,28 +14125,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNode))
-        {
-            err = DataModel::Decode(reader, node);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNode>(reader, node);
 }
 } // namespace Logout.
 } // namespace Commands
@@ -27837,28 +14163,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNode))
-        {
-            err = DataModel::Decode(reader, node);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNode>(reader, node);
 }
 } // namespace LoggedOut.
 } // namespace Events
@@ -27878,32 +14183,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kRatingName))
-        {
-            err = DataModel::Decode(reader, ratingName);
-        }
-        else if (__context_tag == to_underlying(Fields::kRatingNameDesc))
-        {
-            err = DataModel::Decode(reader, ratingNameDesc);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kRatingName, Fields::kRatingNameDesc>(reader, ratingName, ratingNameDesc);
 }
 
 } // namespace RatingNameStruct
@@ -27921,32 +14201,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kOldPIN))
-        {
-            err = DataModel::Decode(reader, oldPIN);
-        }
-        else if (__context_tag == to_underlying(Fields::kNewPIN))
-        {
-            err = DataModel::Decode(reader, newPIN);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kOldPIN, Fields::kNewPIN>(reader, oldPIN, newPIN);
 }
 } // namespace UpdatePIN.
 namespace ResetPIN {
@@ -27958,15 +14213,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace ResetPIN.
 namespace ResetPINResponse {
@@ -27979,28 +14226,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPINCode))
-        {
-            err = DataModel::Decode(reader, PINCode);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPINCode>(reader, PINCode);
 }
 } // namespace ResetPINResponse.
 namespace Enable {
@@ -28012,15 +14238,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Enable.
 namespace Disable {
@@ -28032,15 +14250,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Disable.
 namespace AddBonusTime {
@@ -28054,32 +14264,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPINCode))
-        {
-            err = DataModel::Decode(reader, PINCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kBonusTime))
-        {
-            err = DataModel::Decode(reader, bonusTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPINCode, Fields::kBonusTime>(reader, PINCode, bonusTime);
 }
 } // namespace AddBonusTime.
 namespace SetScreenDailyTime {
@@ -28092,28 +14277,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kScreenTime))
-        {
-            err = DataModel::Decode(reader, screenTime);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kScreenTime>(reader, screenTime);
 }
 } // namespace SetScreenDailyTime.
 namespace BlockUnratedContent {
@@ -28125,15 +14289,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace BlockUnratedContent.
 namespace UnblockUnratedContent {
@@ -28145,15 +14301,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace UnblockUnratedContent.
 namespace SetOnDemandRatingThreshold {
@@ -28166,28 +14314,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kRating))
-        {
-            err = DataModel::Decode(reader, rating);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kRating>(reader, rating);
 }
 } // namespace SetOnDemandRatingThreshold.
 namespace SetScheduledContentRatingThreshold {
@@ -28200,28 +14327,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kRating))
-        {
-            err = DataModel::Decode(reader, rating);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kRating>(reader, rating);
 }
 } // namespace SetScheduledContentRatingThreshold.
 } // namespace Commands
@@ -28274,15 +14380,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace RemainingScreenTimeExpired.
 } // namespace Events
@@ -28302,32 +14400,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else if (__context_tag == to_underlying(Fields::kEncodingHint))
-        {
-            err = DataModel::Decode(reader, encodingHint);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kData, Fields::kEncodingHint>(reader, data, encodingHint);
 }
 } // namespace ContentAppMessage.
 namespace ContentAppMessageResponse {
@@ -28342,36 +14415,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStatus))
-        {
-            err = DataModel::Decode(reader, status);
-        }
-        else if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else if (__context_tag == to_underlying(Fields::kEncodingHint))
-        {
-            err = DataModel::Decode(reader, encodingHint);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStatus, Fields::kData, Fields::kEncodingHint>(reader, status, data, encodingHint);
 }
 } // namespace ContentAppMessageResponse.
 } // namespace Commands
@@ -28414,32 +14458,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kX))
-        {
-            err = DataModel::Decode(reader, x);
-        }
-        else if (__context_tag == to_underlying(Fields::kY))
-        {
-            err = DataModel::Decode(reader, y);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kX, Fields::kY>(reader, x, y);
 }
 
 } // namespace TwoDCartesianVertexStruct
@@ -28457,40 +14476,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else if (__context_tag == to_underlying(Fields::kUse))
-        {
-            err = DataModel::Decode(reader, use);
-        }
-        else if (__context_tag == to_underlying(Fields::kVertices))
-        {
-            err = DataModel::Decode(reader, vertices);
-        }
-        else if (__context_tag == to_underlying(Fields::kColor))
-        {
-            err = DataModel::Decode(reader, color);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kName, Fields::kUse, Fields::kVertices, Fields::kColor>(reader, name, use, vertices,
+                                                                                                   color);
 }
 
 } // namespace TwoDCartesianZoneStruct
@@ -28507,36 +14494,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kZoneID))
-        {
-            err = DataModel::Decode(reader, zoneID);
-        }
-        else if (__context_tag == to_underlying(Fields::kZoneType))
-        {
-            err = DataModel::Decode(reader, zoneType);
-        }
-        else if (__context_tag == to_underlying(Fields::kZoneSource))
-        {
-            err = DataModel::Decode(reader, zoneSource);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kZoneID, Fields::kZoneType, Fields::kZoneSource>(reader, zoneID, zoneType, zoneSource);
 }
 
 } // namespace ZoneInformationStruct
@@ -28555,44 +14513,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kInitialDuration))
-        {
-            err = DataModel::Decode(reader, initialDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kAugmentationDuration))
-        {
-            err = DataModel::Decode(reader, augmentationDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxDuration))
-        {
-            err = DataModel::Decode(reader, maxDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kBlindDuration))
-        {
-            err = DataModel::Decode(reader, blindDuration);
-        }
-        else if (__context_tag == to_underlying(Fields::kSensitivity))
-        {
-            err = DataModel::Decode(reader, sensitivity);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kInitialDuration, Fields::kAugmentationDuration, Fields::kMaxDuration,
+                                   Fields::kBlindDuration, Fields::kSensitivity>(reader, initialDuration, augmentationDuration,
+                                                                                 maxDuration, blindDuration, sensitivity);
 }
 
 } // namespace ZoneTriggerControlStruct
@@ -28609,28 +14532,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kZone))
-        {
-            err = DataModel::Decode(reader, zone);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kZone>(reader, zone);
 }
 } // namespace CreateTwoDCartesianZone.
 namespace CreateTwoDCartesianZoneResponse {
@@ -28643,28 +14545,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kZoneID))
-        {
-            err = DataModel::Decode(reader, zoneID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kZoneID>(reader, zoneID);
 }
 } // namespace CreateTwoDCartesianZoneResponse.
 namespace UpdateTwoDCartesianZone {
@@ -28678,32 +14559,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kZoneID))
-        {
-            err = DataModel::Decode(reader, zoneID);
-        }
-        else if (__context_tag == to_underlying(Fields::kZone))
-        {
-            err = DataModel::Decode(reader, zone);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kZoneID, Fields::kZone>(reader, zoneID, zone);
 }
 } // namespace UpdateTwoDCartesianZone.
 namespace GetTwoDCartesianZone {
@@ -28716,28 +14572,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kZoneID))
-        {
-            err = DataModel::Decode(reader, zoneID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kZoneID>(reader, zoneID);
 }
 } // namespace GetTwoDCartesianZone.
 namespace GetTwoDCartesianZoneResponse {
@@ -28750,28 +14585,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kZones))
-        {
-            err = DataModel::Decode(reader, zones);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kZones>(reader, zones);
 }
 } // namespace GetTwoDCartesianZoneResponse.
 namespace RemoveZone {
@@ -28784,28 +14598,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kZoneID))
-        {
-            err = DataModel::Decode(reader, zoneID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kZoneID>(reader, zoneID);
 }
 } // namespace RemoveZone.
 } // namespace Commands
@@ -28852,32 +14645,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kZones))
-        {
-            err = DataModel::Decode(reader, zones);
-        }
-        else if (__context_tag == to_underlying(Fields::kReason))
-        {
-            err = DataModel::Decode(reader, reason);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kZones, Fields::kReason>(reader, zones, reason);
 }
 } // namespace ZoneTriggered.
 namespace ZoneStopped {
@@ -28892,32 +14660,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kZones))
-        {
-            err = DataModel::Decode(reader, zones);
-        }
-        else if (__context_tag == to_underlying(Fields::kReason))
-        {
-            err = DataModel::Decode(reader, reason);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kZones, Fields::kReason>(reader, zones, reason);
 }
 } // namespace ZoneStopped.
 } // namespace Events
@@ -28937,32 +14680,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWidth))
-        {
-            err = DataModel::Decode(reader, width);
-        }
-        else if (__context_tag == to_underlying(Fields::kHeight))
-        {
-            err = DataModel::Decode(reader, height);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWidth, Fields::kHeight>(reader, width, height);
 }
 
 } // namespace VideoResolutionStruct
@@ -28990,80 +14708,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kVideoStreamID))
-        {
-            err = DataModel::Decode(reader, videoStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStreamType))
-        {
-            err = DataModel::Decode(reader, streamType);
-        }
-        else if (__context_tag == to_underlying(Fields::kVideoCodec))
-        {
-            err = DataModel::Decode(reader, videoCodec);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinFrameRate))
-        {
-            err = DataModel::Decode(reader, minFrameRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxFrameRate))
-        {
-            err = DataModel::Decode(reader, maxFrameRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinResolution))
-        {
-            err = DataModel::Decode(reader, minResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxResolution))
-        {
-            err = DataModel::Decode(reader, maxResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinBitRate))
-        {
-            err = DataModel::Decode(reader, minBitRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxBitRate))
-        {
-            err = DataModel::Decode(reader, maxBitRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinFragmentLen))
-        {
-            err = DataModel::Decode(reader, minFragmentLen);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxFragmentLen))
-        {
-            err = DataModel::Decode(reader, maxFragmentLen);
-        }
-        else if (__context_tag == to_underlying(Fields::kWatermarkEnabled))
-        {
-            err = DataModel::Decode(reader, watermarkEnabled);
-        }
-        else if (__context_tag == to_underlying(Fields::kOSDEnabled))
-        {
-            err = DataModel::Decode(reader, OSDEnabled);
-        }
-        else if (__context_tag == to_underlying(Fields::kReferenceCount))
-        {
-            err = DataModel::Decode(reader, referenceCount);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kVideoStreamID, Fields::kStreamType, Fields::kVideoCodec, Fields::kMinFrameRate,
+                                   Fields::kMaxFrameRate, Fields::kMinResolution, Fields::kMaxResolution, Fields::kMinBitRate,
+                                   Fields::kMaxBitRate, Fields::kMinFragmentLen, Fields::kMaxFragmentLen, Fields::kWatermarkEnabled,
+                                   Fields::kOSDEnabled, Fields::kReferenceCount>(
+        reader, videoStreamID, streamType, videoCodec, minFrameRate, maxFrameRate, minResolution, maxResolution, minBitRate,
+        maxBitRate, minFragmentLen, maxFragmentLen, watermarkEnabled, OSDEnabled, referenceCount);
 }
 
 } // namespace VideoStreamStruct
@@ -29085,56 +14735,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
-        {
-            err = DataModel::Decode(reader, snapshotStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kImageCodec))
-        {
-            err = DataModel::Decode(reader, imageCodec);
-        }
-        else if (__context_tag == to_underlying(Fields::kFrameRate))
-        {
-            err = DataModel::Decode(reader, frameRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kBitRate))
-        {
-            err = DataModel::Decode(reader, bitRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinResolution))
-        {
-            err = DataModel::Decode(reader, minResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxResolution))
-        {
-            err = DataModel::Decode(reader, maxResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kQuality))
-        {
-            err = DataModel::Decode(reader, quality);
-        }
-        else if (__context_tag == to_underlying(Fields::kReferenceCount))
-        {
-            err = DataModel::Decode(reader, referenceCount);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSnapshotStreamID, Fields::kImageCodec, Fields::kFrameRate, Fields::kBitRate,
+                                   Fields::kMinResolution, Fields::kMaxResolution, Fields::kQuality, Fields::kReferenceCount>(
+        reader, snapshotStreamID, imageCodec, frameRate, bitRate, minResolution, maxResolution, quality, referenceCount);
 }
 
 } // namespace SnapshotStreamStruct
@@ -29151,36 +14754,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kResolution))
-        {
-            err = DataModel::Decode(reader, resolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxFrameRate))
-        {
-            err = DataModel::Decode(reader, maxFrameRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kImageCodec))
-        {
-            err = DataModel::Decode(reader, imageCodec);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kResolution, Fields::kMaxFrameRate, Fields::kImageCodec>(reader, resolution,
+                                                                                                    maxFrameRate, imageCodec);
 }
 
 } // namespace SnapshotParamsStruct
@@ -29197,36 +14772,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCodec))
-        {
-            err = DataModel::Decode(reader, codec);
-        }
-        else if (__context_tag == to_underlying(Fields::kResolution))
-        {
-            err = DataModel::Decode(reader, resolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinBitRate))
-        {
-            err = DataModel::Decode(reader, minBitRate);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCodec, Fields::kResolution, Fields::kMinBitRate>(reader, codec, resolution, minBitRate);
 }
 
 } // namespace RateDistortionTradeOffPointsStruct
@@ -29244,43 +14790,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
+    return DataModel::DecodeStruct<Fields::kMaxNumberOfChannels, Fields::kSupportedCodecs, Fields::kSupportedSampleRates,
+                                   Fields::kSupportedBitDepths>(reader, maxNumberOfChannels, supportedCodecs, supportedSampleRates,
+                                                                supportedBitDepths);
+}
 
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMaxNumberOfChannels))
-        {
-            err = DataModel::Decode(reader, maxNumberOfChannels);
-        }
-        else if (__context_tag == to_underlying(Fields::kSupportedCodecs))
-        {
-            err = DataModel::Decode(reader, supportedCodecs);
-        }
-        else if (__context_tag == to_underlying(Fields::kSupportedSampleRates))
-        {
-            err = DataModel::Decode(reader, supportedSampleRates);
-        }
-        else if (__context_tag == to_underlying(Fields::kSupportedBitDepths))
-        {
-            err = DataModel::Decode(reader, supportedBitDepths);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
-}
-
-} // namespace AudioCapabilitiesStruct
+} // namespace AudioCapabilitiesStruct
 
 namespace AudioStreamStruct {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
@@ -29299,56 +14814,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAudioStreamID))
-        {
-            err = DataModel::Decode(reader, audioStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStreamType))
-        {
-            err = DataModel::Decode(reader, streamType);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioCodec))
-        {
-            err = DataModel::Decode(reader, audioCodec);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannelCount))
-        {
-            err = DataModel::Decode(reader, channelCount);
-        }
-        else if (__context_tag == to_underlying(Fields::kSampleRate))
-        {
-            err = DataModel::Decode(reader, sampleRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kBitRate))
-        {
-            err = DataModel::Decode(reader, bitRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kBitDepth))
-        {
-            err = DataModel::Decode(reader, bitDepth);
-        }
-        else if (__context_tag == to_underlying(Fields::kReferenceCount))
-        {
-            err = DataModel::Decode(reader, referenceCount);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAudioStreamID, Fields::kStreamType, Fields::kAudioCodec, Fields::kChannelCount,
+                                   Fields::kSampleRate, Fields::kBitRate, Fields::kBitDepth, Fields::kReferenceCount>(
+        reader, audioStreamID, streamType, audioCodec, channelCount, sampleRate, bitRate, bitDepth, referenceCount);
 }
 
 } // namespace AudioStreamStruct
@@ -29367,44 +14835,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSensorWidth))
-        {
-            err = DataModel::Decode(reader, sensorWidth);
-        }
-        else if (__context_tag == to_underlying(Fields::kSensorHeight))
-        {
-            err = DataModel::Decode(reader, sensorHeight);
-        }
-        else if (__context_tag == to_underlying(Fields::kHDRCapable))
-        {
-            err = DataModel::Decode(reader, HDRCapable);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxFPS))
-        {
-            err = DataModel::Decode(reader, maxFPS);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxHDRFPS))
-        {
-            err = DataModel::Decode(reader, maxHDRFPS);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSensorWidth, Fields::kSensorHeight, Fields::kHDRCapable, Fields::kMaxFPS,
+                                   Fields::kMaxHDRFPS>(reader, sensorWidth, sensorHeight, HDRCapable, maxFPS, maxHDRFPS);
 }
 
 } // namespace VideoSensorParamsStruct
@@ -29426,48 +14858,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStreamType))
-        {
-            err = DataModel::Decode(reader, streamType);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioCodec))
-        {
-            err = DataModel::Decode(reader, audioCodec);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannelCount))
-        {
-            err = DataModel::Decode(reader, channelCount);
-        }
-        else if (__context_tag == to_underlying(Fields::kSampleRate))
-        {
-            err = DataModel::Decode(reader, sampleRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kBitRate))
-        {
-            err = DataModel::Decode(reader, bitRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kBitDepth))
-        {
-            err = DataModel::Decode(reader, bitDepth);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStreamType, Fields::kAudioCodec, Fields::kChannelCount, Fields::kSampleRate,
+                                   Fields::kBitRate, Fields::kBitDepth>(reader, streamType, audioCodec, channelCount, sampleRate,
+                                                                        bitRate, bitDepth);
 }
 } // namespace AudioStreamAllocate.
 namespace AudioStreamAllocateResponse {
@@ -29480,28 +14873,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAudioStreamID))
-        {
-            err = DataModel::Decode(reader, audioStreamID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAudioStreamID>(reader, audioStreamID);
 }
 } // namespace AudioStreamAllocateResponse.
 namespace AudioStreamDeallocate {
@@ -29514,28 +14886,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAudioStreamID))
-        {
-            err = DataModel::Decode(reader, audioStreamID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAudioStreamID>(reader, audioStreamID);
 }
 } // namespace AudioStreamDeallocate.
 namespace VideoStreamAllocate {
@@ -29559,72 +14910,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStreamType))
-        {
-            err = DataModel::Decode(reader, streamType);
-        }
-        else if (__context_tag == to_underlying(Fields::kVideoCodec))
-        {
-            err = DataModel::Decode(reader, videoCodec);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinFrameRate))
-        {
-            err = DataModel::Decode(reader, minFrameRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxFrameRate))
-        {
-            err = DataModel::Decode(reader, maxFrameRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinResolution))
-        {
-            err = DataModel::Decode(reader, minResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxResolution))
-        {
-            err = DataModel::Decode(reader, maxResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinBitRate))
-        {
-            err = DataModel::Decode(reader, minBitRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxBitRate))
-        {
-            err = DataModel::Decode(reader, maxBitRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinFragmentLen))
-        {
-            err = DataModel::Decode(reader, minFragmentLen);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxFragmentLen))
-        {
-            err = DataModel::Decode(reader, maxFragmentLen);
-        }
-        else if (__context_tag == to_underlying(Fields::kWatermarkEnabled))
-        {
-            err = DataModel::Decode(reader, watermarkEnabled);
-        }
-        else if (__context_tag == to_underlying(Fields::kOSDEnabled))
-        {
-            err = DataModel::Decode(reader, OSDEnabled);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStreamType, Fields::kVideoCodec, Fields::kMinFrameRate, Fields::kMaxFrameRate,
+                                   Fields::kMinResolution, Fields::kMaxResolution, Fields::kMinBitRate, Fields::kMaxBitRate,
+                                   Fields::kMinFragmentLen, Fields::kMaxFragmentLen, Fields::kWatermarkEnabled,
+                                   Fields::kOSDEnabled>(reader, streamType, videoCodec, minFrameRate, maxFrameRate, minResolution,
+                                                        maxResolution, minBitRate, maxBitRate, minFragmentLen, maxFragmentLen,
+                                                        watermarkEnabled, OSDEnabled);
 }
 } // namespace VideoStreamAllocate.
 namespace VideoStreamAllocateResponse {
@@ -29637,28 +14928,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kVideoStreamID))
-        {
-            err = DataModel::Decode(reader, videoStreamID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kVideoStreamID>(reader, videoStreamID);
 }
 } // namespace VideoStreamAllocateResponse.
 namespace VideoStreamModify {
@@ -29674,40 +14944,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kVideoStreamID))
-        {
-            err = DataModel::Decode(reader, videoStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kResolution))
-        {
-            err = DataModel::Decode(reader, resolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kWatermarkEnabled))
-        {
-            err = DataModel::Decode(reader, watermarkEnabled);
-        }
-        else if (__context_tag == to_underlying(Fields::kOSDEnabled))
-        {
-            err = DataModel::Decode(reader, OSDEnabled);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kVideoStreamID, Fields::kResolution, Fields::kWatermarkEnabled,
+                                   Fields::kOSDEnabled>(reader, videoStreamID, resolution, watermarkEnabled, OSDEnabled);
 }
 } // namespace VideoStreamModify.
 namespace VideoStreamDeallocate {
@@ -29720,28 +14958,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kVideoStreamID))
-        {
-            err = DataModel::Decode(reader, videoStreamID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kVideoStreamID>(reader, videoStreamID);
 }
 } // namespace VideoStreamDeallocate.
 namespace SnapshotStreamAllocate {
@@ -29759,48 +14976,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kImageCodec))
-        {
-            err = DataModel::Decode(reader, imageCodec);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxFrameRate))
-        {
-            err = DataModel::Decode(reader, maxFrameRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kBitRate))
-        {
-            err = DataModel::Decode(reader, bitRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinResolution))
-        {
-            err = DataModel::Decode(reader, minResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxResolution))
-        {
-            err = DataModel::Decode(reader, maxResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kQuality))
-        {
-            err = DataModel::Decode(reader, quality);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kImageCodec, Fields::kMaxFrameRate, Fields::kBitRate, Fields::kMinResolution,
+                                   Fields::kMaxResolution, Fields::kQuality>(reader, imageCodec, maxFrameRate, bitRate,
+                                                                             minResolution, maxResolution, quality);
 }
 } // namespace SnapshotStreamAllocate.
 namespace SnapshotStreamAllocateResponse {
@@ -29813,28 +14991,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
-        {
-            err = DataModel::Decode(reader, snapshotStreamID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSnapshotStreamID>(reader, snapshotStreamID);
 }
 } // namespace SnapshotStreamAllocateResponse.
 namespace SnapshotStreamDeallocate {
@@ -29847,28 +15004,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
-        {
-            err = DataModel::Decode(reader, snapshotStreamID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSnapshotStreamID>(reader, snapshotStreamID);
 }
 } // namespace SnapshotStreamDeallocate.
 namespace SetStreamPriorities {
@@ -29881,28 +15017,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStreamPriorities))
-        {
-            err = DataModel::Decode(reader, streamPriorities);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStreamPriorities>(reader, streamPriorities);
 }
 } // namespace SetStreamPriorities.
 namespace CaptureSnapshot {
@@ -29916,32 +15031,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
-        {
-            err = DataModel::Decode(reader, snapshotStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kRequestedResolution))
-        {
-            err = DataModel::Decode(reader, requestedResolution);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSnapshotStreamID, Fields::kRequestedResolution>(reader, snapshotStreamID,
+                                                                                            requestedResolution);
 }
 } // namespace CaptureSnapshot.
 namespace CaptureSnapshotResponse {
@@ -29956,36 +15047,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kData))
-        {
-            err = DataModel::Decode(reader, data);
-        }
-        else if (__context_tag == to_underlying(Fields::kImageCodec))
-        {
-            err = DataModel::Decode(reader, imageCodec);
-        }
-        else if (__context_tag == to_underlying(Fields::kResolution))
-        {
-            err = DataModel::Decode(reader, resolution);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kData, Fields::kImageCodec, Fields::kResolution>(reader, data, imageCodec, resolution);
 }
 } // namespace CaptureSnapshotResponse.
 } // namespace Commands
@@ -30115,68 +15177,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kVideoStreamID))
-        {
-            err = DataModel::Decode(reader, videoStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStreamType))
-        {
-            err = DataModel::Decode(reader, streamType);
-        }
-        else if (__context_tag == to_underlying(Fields::kVideoCodec))
-        {
-            err = DataModel::Decode(reader, videoCodec);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinFrameRate))
-        {
-            err = DataModel::Decode(reader, minFrameRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxFrameRate))
-        {
-            err = DataModel::Decode(reader, maxFrameRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinResolution))
-        {
-            err = DataModel::Decode(reader, minResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxResolution))
-        {
-            err = DataModel::Decode(reader, maxResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinBitRate))
-        {
-            err = DataModel::Decode(reader, minBitRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxBitRate))
-        {
-            err = DataModel::Decode(reader, maxBitRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinFragmentLen))
-        {
-            err = DataModel::Decode(reader, minFragmentLen);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxFragmentLen))
-        {
-            err = DataModel::Decode(reader, maxFragmentLen);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kVideoStreamID, Fields::kStreamType, Fields::kVideoCodec, Fields::kMinFrameRate,
+                                   Fields::kMaxFrameRate, Fields::kMinResolution, Fields::kMaxResolution, Fields::kMinBitRate,
+                                   Fields::kMaxBitRate, Fields::kMinFragmentLen, Fields::kMaxFragmentLen>(
+        reader, videoStreamID, streamType, videoCodec, minFrameRate, maxFrameRate, minResolution, maxResolution, minBitRate,
+        maxBitRate, minFragmentLen, maxFragmentLen);
 }
 } // namespace VideoStreamChanged.
 namespace AudioStreamChanged {
@@ -30196,52 +15201,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kAudioStreamID))
-        {
-            err = DataModel::Decode(reader, audioStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStreamType))
-        {
-            err = DataModel::Decode(reader, streamType);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioCodec))
-        {
-            err = DataModel::Decode(reader, audioCodec);
-        }
-        else if (__context_tag == to_underlying(Fields::kChannelCount))
-        {
-            err = DataModel::Decode(reader, channelCount);
-        }
-        else if (__context_tag == to_underlying(Fields::kSampleRate))
-        {
-            err = DataModel::Decode(reader, sampleRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kBitRate))
-        {
-            err = DataModel::Decode(reader, bitRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kBitDepth))
-        {
-            err = DataModel::Decode(reader, bitDepth);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kAudioStreamID, Fields::kStreamType, Fields::kAudioCodec, Fields::kChannelCount,
+                                   Fields::kSampleRate, Fields::kBitRate, Fields::kBitDepth>(
+        reader, audioStreamID, streamType, audioCodec, channelCount, sampleRate, bitRate, bitDepth);
 }
 } // namespace AudioStreamChanged.
 namespace SnapshotStreamChanged {
@@ -30261,52 +15223,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSnapshotStreamID))
-        {
-            err = DataModel::Decode(reader, snapshotStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kImageCodec))
-        {
-            err = DataModel::Decode(reader, imageCodec);
-        }
-        else if (__context_tag == to_underlying(Fields::kFrameRate))
-        {
-            err = DataModel::Decode(reader, frameRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kBitRate))
-        {
-            err = DataModel::Decode(reader, bitRate);
-        }
-        else if (__context_tag == to_underlying(Fields::kMinResolution))
-        {
-            err = DataModel::Decode(reader, minResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kMaxResolution))
-        {
-            err = DataModel::Decode(reader, maxResolution);
-        }
-        else if (__context_tag == to_underlying(Fields::kQuality))
-        {
-            err = DataModel::Decode(reader, quality);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSnapshotStreamID, Fields::kImageCodec, Fields::kFrameRate, Fields::kBitRate,
+                                   Fields::kMinResolution, Fields::kMaxResolution, Fields::kQuality>(
+        reader, snapshotStreamID, imageCodec, frameRate, bitRate, minResolution, maxResolution, quality);
 }
 } // namespace SnapshotStreamChanged.
 } // namespace Events
@@ -30331,48 +15250,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kStreamType))
-        {
-            err = DataModel::Decode(reader, streamType);
-        }
-        else if (__context_tag == to_underlying(Fields::kVideoStreamID))
-        {
-            err = DataModel::Decode(reader, videoStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioStreamID))
-        {
-            err = DataModel::Decode(reader, audioStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kICEServers))
-        {
-            err = DataModel::Decode(reader, ICEServers);
-        }
-        else if (__context_tag == to_underlying(Fields::kICETransportPolicy))
-        {
-            err = DataModel::Decode(reader, ICETransportPolicy);
-        }
-        else if (__context_tag == to_underlying(Fields::kMetadataOptions))
-        {
-            err = DataModel::Decode(reader, metadataOptions);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kStreamType, Fields::kVideoStreamID, Fields::kAudioStreamID, Fields::kICEServers,
+                                   Fields::kICETransportPolicy, Fields::kMetadataOptions>(
+        reader, streamType, videoStreamID, audioStreamID, ICEServers, ICETransportPolicy, metadataOptions);
 }
 } // namespace SolicitOffer.
 namespace SolicitOfferResponse {
@@ -30388,40 +15268,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
-        {
-            err = DataModel::Decode(reader, webRTCSessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kDeferredOffer))
-        {
-            err = DataModel::Decode(reader, deferredOffer);
-        }
-        else if (__context_tag == to_underlying(Fields::kVideoStreamID))
-        {
-            err = DataModel::Decode(reader, videoStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioStreamID))
-        {
-            err = DataModel::Decode(reader, audioStreamID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWebRTCSessionID, Fields::kDeferredOffer, Fields::kVideoStreamID,
+                                   Fields::kAudioStreamID>(reader, webRTCSessionID, deferredOffer, videoStreamID, audioStreamID);
 }
 } // namespace SolicitOfferResponse.
 namespace ProvideOffer {
@@ -30441,56 +15289,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
-        {
-            err = DataModel::Decode(reader, webRTCSessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSdp))
-        {
-            err = DataModel::Decode(reader, sdp);
-        }
-        else if (__context_tag == to_underlying(Fields::kStreamType))
-        {
-            err = DataModel::Decode(reader, streamType);
-        }
-        else if (__context_tag == to_underlying(Fields::kVideoStreamID))
-        {
-            err = DataModel::Decode(reader, videoStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioStreamID))
-        {
-            err = DataModel::Decode(reader, audioStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kICEServers))
-        {
-            err = DataModel::Decode(reader, ICEServers);
-        }
-        else if (__context_tag == to_underlying(Fields::kICETransportPolicy))
-        {
-            err = DataModel::Decode(reader, ICETransportPolicy);
-        }
-        else if (__context_tag == to_underlying(Fields::kMetadataOptions))
-        {
-            err = DataModel::Decode(reader, metadataOptions);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWebRTCSessionID, Fields::kSdp, Fields::kStreamType, Fields::kVideoStreamID,
+                                   Fields::kAudioStreamID, Fields::kICEServers, Fields::kICETransportPolicy,
+                                   Fields::kMetadataOptions>(reader, webRTCSessionID, sdp, streamType, videoStreamID, audioStreamID,
+                                                             ICEServers, ICETransportPolicy, metadataOptions);
 }
 } // namespace ProvideOffer.
 namespace ProvideOfferResponse {
@@ -30505,36 +15307,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
-        {
-            err = DataModel::Decode(reader, webRTCSessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kVideoStreamID))
-        {
-            err = DataModel::Decode(reader, videoStreamID);
-        }
-        else if (__context_tag == to_underlying(Fields::kAudioStreamID))
-        {
-            err = DataModel::Decode(reader, audioStreamID);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWebRTCSessionID, Fields::kVideoStreamID, Fields::kAudioStreamID>(
+        reader, webRTCSessionID, videoStreamID, audioStreamID);
 }
 } // namespace ProvideOfferResponse.
 namespace ProvideAnswer {
@@ -30548,32 +15322,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
-        {
-            err = DataModel::Decode(reader, webRTCSessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSdp))
-        {
-            err = DataModel::Decode(reader, sdp);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWebRTCSessionID, Fields::kSdp>(reader, webRTCSessionID, sdp);
 }
 } // namespace ProvideAnswer.
 namespace ProvideICECandidate {
@@ -30587,32 +15336,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
-        {
-            err = DataModel::Decode(reader, webRTCSessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kICECandidate))
-        {
-            err = DataModel::Decode(reader, ICECandidate);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWebRTCSessionID, Fields::kICECandidate>(reader, webRTCSessionID, ICECandidate);
 }
 } // namespace ProvideICECandidate.
 namespace EndSession {
@@ -30626,32 +15350,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
-        {
-            err = DataModel::Decode(reader, webRTCSessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kReason))
-        {
-            err = DataModel::Decode(reader, reason);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWebRTCSessionID, Fields::kReason>(reader, webRTCSessionID, reason);
 }
 } // namespace EndSession.
 } // namespace Commands
@@ -30699,40 +15398,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
-        {
-            err = DataModel::Decode(reader, webRTCSessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSdp))
-        {
-            err = DataModel::Decode(reader, sdp);
-        }
-        else if (__context_tag == to_underlying(Fields::kICEServers))
-        {
-            err = DataModel::Decode(reader, ICEServers);
-        }
-        else if (__context_tag == to_underlying(Fields::kICETransportPolicy))
-        {
-            err = DataModel::Decode(reader, ICETransportPolicy);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWebRTCSessionID, Fields::kSdp, Fields::kICEServers, Fields::kICETransportPolicy>(
+        reader, webRTCSessionID, sdp, ICEServers, ICETransportPolicy);
 }
 } // namespace Offer.
 namespace Answer {
@@ -30746,32 +15413,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
-        {
-            err = DataModel::Decode(reader, webRTCSessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kSdp))
-        {
-            err = DataModel::Decode(reader, sdp);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWebRTCSessionID, Fields::kSdp>(reader, webRTCSessionID, sdp);
 }
 } // namespace Answer.
 namespace ICECandidate {
@@ -30785,32 +15427,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
-        {
-            err = DataModel::Decode(reader, webRTCSessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kICECandidate))
-        {
-            err = DataModel::Decode(reader, ICECandidate);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWebRTCSessionID, Fields::kICECandidate>(reader, webRTCSessionID, ICECandidate);
 }
 } // namespace ICECandidate.
 namespace End {
@@ -30824,32 +15441,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWebRTCSessionID))
-        {
-            err = DataModel::Decode(reader, webRTCSessionID);
-        }
-        else if (__context_tag == to_underlying(Fields::kReason))
-        {
-            err = DataModel::Decode(reader, reason);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWebRTCSessionID, Fields::kReason>(reader, webRTCSessionID, reason);
 }
 } // namespace End.
 } // namespace Commands
@@ -30894,36 +15486,11 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
+    return DataModel::DecodeStruct<Fields::kChimeID, Fields::kName>(reader, chimeID, name);
+}
 
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kChimeID))
-        {
-            err = DataModel::Decode(reader, chimeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kName))
-        {
-            err = DataModel::Decode(reader, name);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
-}
-
-} // namespace ChimeSoundStruct
-} // namespace Structs
+} // namespace ChimeSoundStruct
+} // namespace Structs
 
 namespace Commands {
 namespace PlayChimeSound {
@@ -30935,15 +15502,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace PlayChimeSound.
 } // namespace Commands
@@ -31036,56 +15595,11 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kDeviceName))
-        {
-            err = DataModel::Decode(reader, deviceName);
-        }
-        else if (__context_tag == to_underlying(Fields::kDeviceNameLastEdit))
-        {
-            err = DataModel::Decode(reader, deviceNameLastEdit);
-        }
-        else if (__context_tag == to_underlying(Fields::kBridgedEndpoint))
-        {
-            err = DataModel::Decode(reader, bridgedEndpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kOriginalEndpoint))
-        {
-            err = DataModel::Decode(reader, originalEndpoint);
-        }
-        else if (__context_tag == to_underlying(Fields::kDeviceTypes))
-        {
-            err = DataModel::Decode(reader, deviceTypes);
-        }
-        else if (__context_tag == to_underlying(Fields::kUniqueLocationIDs))
-        {
-            err = DataModel::Decode(reader, uniqueLocationIDs);
-        }
-        else if (__context_tag == to_underlying(Fields::kUniqueLocationIDsLastEdit))
-        {
-            err = DataModel::Decode(reader, uniqueLocationIDsLastEdit);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kDeviceName, Fields::kDeviceNameLastEdit, Fields::kBridgedEndpoint,
+                                   Fields::kOriginalEndpoint, Fields::kDeviceTypes, Fields::kUniqueLocationIDs,
+                                   Fields::kUniqueLocationIDsLastEdit, Fields::kFabricIndex>(
+        reader, deviceName, deviceNameLastEdit, bridgedEndpoint, originalEndpoint, deviceTypes, uniqueLocationIDs,
+        uniqueLocationIDsLastEdit, fabricIndex);
 }
 
 } // namespace EcosystemDeviceStruct
@@ -31129,40 +15643,9 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kUniqueLocationID))
-        {
-            err = DataModel::Decode(reader, uniqueLocationID);
-        }
-        else if (__context_tag == to_underlying(Fields::kLocationDescriptor))
-        {
-            err = DataModel::Decode(reader, locationDescriptor);
-        }
-        else if (__context_tag == to_underlying(Fields::kLocationDescriptorLastEdit))
-        {
-            err = DataModel::Decode(reader, locationDescriptorLastEdit);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kUniqueLocationID, Fields::kLocationDescriptor, Fields::kLocationDescriptorLastEdit,
+                                   Fields::kFabricIndex>(reader, uniqueLocationID, locationDescriptor, locationDescriptorLastEdit,
+                                                         fabricIndex);
 }
 
 } // namespace EcosystemLocationStruct
@@ -31214,40 +15697,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kRequestID))
-        {
-            err = DataModel::Decode(reader, requestID);
-        }
-        else if (__context_tag == to_underlying(Fields::kVendorID))
-        {
-            err = DataModel::Decode(reader, vendorID);
-        }
-        else if (__context_tag == to_underlying(Fields::kProductID))
-        {
-            err = DataModel::Decode(reader, productID);
-        }
-        else if (__context_tag == to_underlying(Fields::kLabel))
-        {
-            err = DataModel::Decode(reader, label);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kRequestID, Fields::kVendorID, Fields::kProductID, Fields::kLabel>(
+        reader, requestID, vendorID, productID, label);
 }
 } // namespace RequestCommissioningApproval.
 namespace CommissionNode {
@@ -31261,32 +15712,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kRequestID))
-        {
-            err = DataModel::Decode(reader, requestID);
-        }
-        else if (__context_tag == to_underlying(Fields::kResponseTimeoutSeconds))
-        {
-            err = DataModel::Decode(reader, responseTimeoutSeconds);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kRequestID, Fields::kResponseTimeoutSeconds>(reader, requestID, responseTimeoutSeconds);
 }
 } // namespace CommissionNode.
 namespace ReverseOpenCommissioningWindow {
@@ -31303,44 +15729,9 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCommissioningTimeout))
-        {
-            err = DataModel::Decode(reader, commissioningTimeout);
-        }
-        else if (__context_tag == to_underlying(Fields::kPAKEPasscodeVerifier))
-        {
-            err = DataModel::Decode(reader, PAKEPasscodeVerifier);
-        }
-        else if (__context_tag == to_underlying(Fields::kDiscriminator))
-        {
-            err = DataModel::Decode(reader, discriminator);
-        }
-        else if (__context_tag == to_underlying(Fields::kIterations))
-        {
-            err = DataModel::Decode(reader, iterations);
-        }
-        else if (__context_tag == to_underlying(Fields::kSalt))
-        {
-            err = DataModel::Decode(reader, salt);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCommissioningTimeout, Fields::kPAKEPasscodeVerifier, Fields::kDiscriminator,
+                                   Fields::kIterations, Fields::kSalt>(reader, commissioningTimeout, PAKEPasscodeVerifier,
+                                                                       discriminator, iterations, salt);
 }
 } // namespace ReverseOpenCommissioningWindow.
 } // namespace Commands
@@ -31383,40 +15774,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kRequestID))
-        {
-            err = DataModel::Decode(reader, requestID);
-        }
-        else if (__context_tag == to_underlying(Fields::kClientNodeID))
-        {
-            err = DataModel::Decode(reader, clientNodeID);
-        }
-        else if (__context_tag == to_underlying(Fields::kStatusCode))
-        {
-            err = DataModel::Decode(reader, statusCode);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kRequestID, Fields::kClientNodeID, Fields::kStatusCode, Fields::kFabricIndex>(
+        reader, requestID, clientNodeID, statusCode, fabricIndex);
 }
 } // namespace CommissioningRequestResult.
 } // namespace Events
@@ -31443,60 +15802,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kA))
-        {
-            err = DataModel::Decode(reader, a);
-        }
-        else if (__context_tag == to_underlying(Fields::kB))
-        {
-            err = DataModel::Decode(reader, b);
-        }
-        else if (__context_tag == to_underlying(Fields::kC))
-        {
-            err = DataModel::Decode(reader, c);
-        }
-        else if (__context_tag == to_underlying(Fields::kD))
-        {
-            err = DataModel::Decode(reader, d);
-        }
-        else if (__context_tag == to_underlying(Fields::kE))
-        {
-            err = DataModel::Decode(reader, e);
-        }
-        else if (__context_tag == to_underlying(Fields::kF))
-        {
-            err = DataModel::Decode(reader, f);
-        }
-        else if (__context_tag == to_underlying(Fields::kG))
-        {
-            err = DataModel::Decode(reader, g);
-        }
-        else if (__context_tag == to_underlying(Fields::kH))
-        {
-            err = DataModel::Decode(reader, h);
-        }
-        else if (__context_tag == to_underlying(Fields::kI))
-        {
-            err = DataModel::Decode(reader, i);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kA, Fields::kB, Fields::kC, Fields::kD, Fields::kE, Fields::kF, Fields::kG, Fields::kH,
+                                   Fields::kI>(reader, a, b, c, d, e, f, g, h, i);
 }
 
 } // namespace SimpleStruct
@@ -31556,56 +15863,13 @@ CHIP_ERROR Type::DoEncode(TLV::TLVWriter & aWriter, TLV::Tag aTag, const Optiona
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kFabricSensitiveInt8u))
-        {
-            err = DataModel::Decode(reader, fabricSensitiveInt8u);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalFabricSensitiveInt8u))
-        {
-            err = DataModel::Decode(reader, optionalFabricSensitiveInt8u);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableFabricSensitiveInt8u))
-        {
-            err = DataModel::Decode(reader, nullableFabricSensitiveInt8u);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalFabricSensitiveInt8u))
-        {
-            err = DataModel::Decode(reader, nullableOptionalFabricSensitiveInt8u);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricSensitiveCharString))
-        {
-            err = DataModel::Decode(reader, fabricSensitiveCharString);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricSensitiveStruct))
-        {
-            err = DataModel::Decode(reader, fabricSensitiveStruct);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricSensitiveInt8uList))
-        {
-            err = DataModel::Decode(reader, fabricSensitiveInt8uList);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kFabricSensitiveInt8u, Fields::kOptionalFabricSensitiveInt8u,
+                                   Fields::kNullableFabricSensitiveInt8u, Fields::kNullableOptionalFabricSensitiveInt8u,
+                                   Fields::kFabricSensitiveCharString, Fields::kFabricSensitiveStruct,
+                                   Fields::kFabricSensitiveInt8uList, Fields::kFabricIndex>(
+        reader, fabricSensitiveInt8u, optionalFabricSensitiveInt8u, nullableFabricSensitiveInt8u,
+        nullableOptionalFabricSensitiveInt8u, fabricSensitiveCharString, fabricSensitiveStruct, fabricSensitiveInt8uList,
+        fabricIndex);
 }
 
 } // namespace TestFabricScoped
@@ -31631,72 +15895,12 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNullableInt))
-        {
-            err = DataModel::Decode(reader, nullableInt);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalInt))
-        {
-            err = DataModel::Decode(reader, optionalInt);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalInt))
-        {
-            err = DataModel::Decode(reader, nullableOptionalInt);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableString))
-        {
-            err = DataModel::Decode(reader, nullableString);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalString))
-        {
-            err = DataModel::Decode(reader, optionalString);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalString))
-        {
-            err = DataModel::Decode(reader, nullableOptionalString);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableStruct))
-        {
-            err = DataModel::Decode(reader, nullableStruct);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalStruct))
-        {
-            err = DataModel::Decode(reader, optionalStruct);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalStruct))
-        {
-            err = DataModel::Decode(reader, nullableOptionalStruct);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableList))
-        {
-            err = DataModel::Decode(reader, nullableList);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalList))
-        {
-            err = DataModel::Decode(reader, optionalList);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalList))
-        {
-            err = DataModel::Decode(reader, nullableOptionalList);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNullableInt, Fields::kOptionalInt, Fields::kNullableOptionalInt,
+                                   Fields::kNullableString, Fields::kOptionalString, Fields::kNullableOptionalString,
+                                   Fields::kNullableStruct, Fields::kOptionalStruct, Fields::kNullableOptionalStruct,
+                                   Fields::kNullableList, Fields::kOptionalList, Fields::kNullableOptionalList>(
+        reader, nullableInt, optionalInt, nullableOptionalInt, nullableString, optionalString, nullableOptionalString,
+        nullableStruct, optionalStruct, nullableOptionalStruct, nullableList, optionalList, nullableOptionalList);
 }
 
 } // namespace NullablesAndOptionalsStruct
@@ -31714,40 +15918,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kA))
-        {
-            err = DataModel::Decode(reader, a);
-        }
-        else if (__context_tag == to_underlying(Fields::kB))
-        {
-            err = DataModel::Decode(reader, b);
-        }
-        else if (__context_tag == to_underlying(Fields::kC))
-        {
-            err = DataModel::Decode(reader, c);
-        }
-        else if (__context_tag == to_underlying(Fields::kD))
-        {
-            err = DataModel::Decode(reader, d);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kA, Fields::kB, Fields::kC, Fields::kD>(reader, a, b, c, d);
 }
 
 } // namespace NestedStruct
@@ -31768,52 +15939,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kA))
-        {
-            err = DataModel::Decode(reader, a);
-        }
-        else if (__context_tag == to_underlying(Fields::kB))
-        {
-            err = DataModel::Decode(reader, b);
-        }
-        else if (__context_tag == to_underlying(Fields::kC))
-        {
-            err = DataModel::Decode(reader, c);
-        }
-        else if (__context_tag == to_underlying(Fields::kD))
-        {
-            err = DataModel::Decode(reader, d);
-        }
-        else if (__context_tag == to_underlying(Fields::kE))
-        {
-            err = DataModel::Decode(reader, e);
-        }
-        else if (__context_tag == to_underlying(Fields::kF))
-        {
-            err = DataModel::Decode(reader, f);
-        }
-        else if (__context_tag == to_underlying(Fields::kG))
-        {
-            err = DataModel::Decode(reader, g);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kA, Fields::kB, Fields::kC, Fields::kD, Fields::kE, Fields::kF, Fields::kG>(
+        reader, a, b, c, d, e, f, g);
 }
 
 } // namespace NestedStructList
@@ -31828,31 +15955,10 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
+    return DataModel::DecodeStruct<Fields::kA>(reader, a);
+}
 
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kA))
-        {
-            err = DataModel::Decode(reader, a);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
-}
-
-} // namespace DoubleNestedStructList
+} // namespace DoubleNestedStructList
 
 namespace TestListStructOctet {
 CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
@@ -31865,32 +15971,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kMember1))
-        {
-            err = DataModel::Decode(reader, member1);
-        }
-        else if (__context_tag == to_underlying(Fields::kMember2))
-        {
-            err = DataModel::Decode(reader, member2);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kMember1, Fields::kMember2>(reader, member1, member2);
 }
 
 } // namespace TestListStructOctet
@@ -31906,15 +15987,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Test.
 namespace TestSpecificResponse {
@@ -31927,28 +16000,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kReturnValue))
-        {
-            err = DataModel::Decode(reader, returnValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kReturnValue>(reader, returnValue);
 }
 } // namespace TestSpecificResponse.
 namespace TestNotHandled {
@@ -31960,15 +16012,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace TestNotHandled.
 namespace TestAddArgumentsResponse {
@@ -31981,28 +16025,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kReturnValue))
-        {
-            err = DataModel::Decode(reader, returnValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kReturnValue>(reader, returnValue);
 }
 } // namespace TestAddArgumentsResponse.
 namespace TestSpecific {
@@ -32014,15 +16037,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace TestSpecific.
 namespace TestSimpleArgumentResponse {
@@ -32035,28 +16050,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kReturnValue))
-        {
-            err = DataModel::Decode(reader, returnValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kReturnValue>(reader, returnValue);
 }
 } // namespace TestSimpleArgumentResponse.
 namespace TestUnknownCommand {
@@ -32068,15 +16062,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace TestUnknownCommand.
 namespace TestStructArrayArgumentResponse {
@@ -32094,48 +16080,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg2))
-        {
-            err = DataModel::Decode(reader, arg2);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg3))
-        {
-            err = DataModel::Decode(reader, arg3);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg4))
-        {
-            err = DataModel::Decode(reader, arg4);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg5))
-        {
-            err = DataModel::Decode(reader, arg5);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg6))
-        {
-            err = DataModel::Decode(reader, arg6);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1, Fields::kArg2, Fields::kArg3, Fields::kArg4, Fields::kArg5, Fields::kArg6>(
+        reader, arg1, arg2, arg3, arg4, arg5, arg6);
 }
 } // namespace TestStructArrayArgumentResponse.
 namespace TestAddArguments {
@@ -32149,32 +16095,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg2))
-        {
-            err = DataModel::Decode(reader, arg2);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1, Fields::kArg2>(reader, arg1, arg2);
 }
 } // namespace TestAddArguments.
 namespace TestListInt8UReverseResponse {
@@ -32187,28 +16108,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace TestListInt8UReverseResponse.
 namespace TestSimpleArgumentRequest {
@@ -32221,28 +16121,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace TestSimpleArgumentRequest.
 namespace TestEnumsResponse {
@@ -32256,32 +16135,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg2))
-        {
-            err = DataModel::Decode(reader, arg2);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1, Fields::kArg2>(reader, arg1, arg2);
 }
 } // namespace TestEnumsResponse.
 namespace TestStructArrayArgumentRequest {
@@ -32299,48 +16153,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg2))
-        {
-            err = DataModel::Decode(reader, arg2);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg3))
-        {
-            err = DataModel::Decode(reader, arg3);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg4))
-        {
-            err = DataModel::Decode(reader, arg4);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg5))
-        {
-            err = DataModel::Decode(reader, arg5);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg6))
-        {
-            err = DataModel::Decode(reader, arg6);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1, Fields::kArg2, Fields::kArg3, Fields::kArg4, Fields::kArg5, Fields::kArg6>(
+        reader, arg1, arg2, arg3, arg4, arg5, arg6);
 }
 } // namespace TestStructArrayArgumentRequest.
 namespace TestNullableOptionalResponse {
@@ -32356,40 +16170,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kWasPresent))
-        {
-            err = DataModel::Decode(reader, wasPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kWasNull))
-        {
-            err = DataModel::Decode(reader, wasNull);
-        }
-        else if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-        else if (__context_tag == to_underlying(Fields::kOriginalValue))
-        {
-            err = DataModel::Decode(reader, originalValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kWasPresent, Fields::kWasNull, Fields::kValue, Fields::kOriginalValue>(
+        reader, wasPresent, wasNull, value, originalValue);
 }
 } // namespace TestNullableOptionalResponse.
 namespace TestStructArgumentRequest {
@@ -32402,28 +16184,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace TestStructArgumentRequest.
 namespace TestComplexNullableOptionalResponse {
@@ -32463,136 +16224,24 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNullableIntWasNull))
-        {
-            err = DataModel::Decode(reader, nullableIntWasNull);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableIntValue))
-        {
-            err = DataModel::Decode(reader, nullableIntValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalIntWasPresent))
-        {
-            err = DataModel::Decode(reader, optionalIntWasPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalIntValue))
-        {
-            err = DataModel::Decode(reader, optionalIntValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalIntWasPresent))
-        {
-            err = DataModel::Decode(reader, nullableOptionalIntWasPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalIntWasNull))
-        {
-            err = DataModel::Decode(reader, nullableOptionalIntWasNull);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalIntValue))
-        {
-            err = DataModel::Decode(reader, nullableOptionalIntValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableStringWasNull))
-        {
-            err = DataModel::Decode(reader, nullableStringWasNull);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableStringValue))
-        {
-            err = DataModel::Decode(reader, nullableStringValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalStringWasPresent))
-        {
-            err = DataModel::Decode(reader, optionalStringWasPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalStringValue))
-        {
-            err = DataModel::Decode(reader, optionalStringValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalStringWasPresent))
-        {
-            err = DataModel::Decode(reader, nullableOptionalStringWasPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalStringWasNull))
-        {
-            err = DataModel::Decode(reader, nullableOptionalStringWasNull);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalStringValue))
-        {
-            err = DataModel::Decode(reader, nullableOptionalStringValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableStructWasNull))
-        {
-            err = DataModel::Decode(reader, nullableStructWasNull);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableStructValue))
-        {
-            err = DataModel::Decode(reader, nullableStructValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalStructWasPresent))
-        {
-            err = DataModel::Decode(reader, optionalStructWasPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalStructValue))
-        {
-            err = DataModel::Decode(reader, optionalStructValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalStructWasPresent))
-        {
-            err = DataModel::Decode(reader, nullableOptionalStructWasPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalStructWasNull))
-        {
-            err = DataModel::Decode(reader, nullableOptionalStructWasNull);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalStructValue))
-        {
-            err = DataModel::Decode(reader, nullableOptionalStructValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableListWasNull))
-        {
-            err = DataModel::Decode(reader, nullableListWasNull);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableListValue))
-        {
-            err = DataModel::Decode(reader, nullableListValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalListWasPresent))
-        {
-            err = DataModel::Decode(reader, optionalListWasPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalListValue))
-        {
-            err = DataModel::Decode(reader, optionalListValue);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalListWasPresent))
-        {
-            err = DataModel::Decode(reader, nullableOptionalListWasPresent);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalListWasNull))
-        {
-            err = DataModel::Decode(reader, nullableOptionalListWasNull);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalListValue))
-        {
-            err = DataModel::Decode(reader, nullableOptionalListValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kNullableIntWasNull, Fields::kNullableIntValue, Fields::kOptionalIntWasPresent,
+                                   Fields::kOptionalIntValue, Fields::kNullableOptionalIntWasPresent,
+                                   Fields::kNullableOptionalIntWasNull, Fields::kNullableOptionalIntValue,
+                                   Fields::kNullableStringWasNull, Fields::kNullableStringValue, Fields::kOptionalStringWasPresent,
+                                   Fields::kOptionalStringValue, Fields::kNullableOptionalStringWasPresent,
+                                   Fields::kNullableOptionalStringWasNull, Fields::kNullableOptionalStringValue,
+                                   Fields::kNullableStructWasNull, Fields::kNullableStructValue, Fields::kOptionalStructWasPresent,
+                                   Fields::kOptionalStructValue, Fields::kNullableOptionalStructWasPresent,
+                                   Fields::kNullableOptionalStructWasNull, Fields::kNullableOptionalStructValue,
+                                   Fields::kNullableListWasNull, Fields::kNullableListValue, Fields::kOptionalListWasPresent,
+                                   Fields::kOptionalListValue, Fields::kNullableOptionalListWasPresent,
+                                   Fields::kNullableOptionalListWasNull, Fields::kNullableOptionalListValue>(
+        reader, nullableIntWasNull, nullableIntValue, optionalIntWasPresent, optionalIntValue, nullableOptionalIntWasPresent,
+        nullableOptionalIntWasNull, nullableOptionalIntValue, nullableStringWasNull, nullableStringValue, optionalStringWasPresent,
+        optionalStringValue, nullableOptionalStringWasPresent, nullableOptionalStringWasNull, nullableOptionalStringValue,
+        nullableStructWasNull, nullableStructValue, optionalStructWasPresent, optionalStructValue, nullableOptionalStructWasPresent,
+        nullableOptionalStructWasNull, nullableOptionalStructValue, nullableListWasNull, nullableListValue, optionalListWasPresent,
+        optionalListValue, nullableOptionalListWasPresent, nullableOptionalListWasNull, nullableOptionalListValue);
 }
 } // namespace TestComplexNullableOptionalResponse.
 namespace TestNestedStructArgumentRequest {
@@ -32605,28 +16254,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace TestNestedStructArgumentRequest.
 namespace BooleanResponse {
@@ -32639,28 +16267,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kValue>(reader, value);
 }
 } // namespace BooleanResponse.
 namespace TestListStructArgumentRequest {
@@ -32673,28 +16280,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace TestListStructArgumentRequest.
 namespace SimpleStructResponse {
@@ -32707,28 +16293,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace SimpleStructResponse.
 namespace TestListInt8UArgumentRequest {
@@ -32741,28 +16306,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace TestListInt8UArgumentRequest.
 namespace TestEmitTestEventResponse {
@@ -32775,28 +16319,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kValue>(reader, value);
 }
 } // namespace TestEmitTestEventResponse.
 namespace TestNestedStructListArgumentRequest {
@@ -32809,28 +16332,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace TestNestedStructListArgumentRequest.
 namespace TestEmitTestFabricScopedEventResponse {
@@ -32843,28 +16345,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kValue))
-        {
-            err = DataModel::Decode(reader, value);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kValue>(reader, value);
 }
 } // namespace TestEmitTestFabricScopedEventResponse.
 namespace TestListNestedStructListArgumentRequest {
@@ -32877,28 +16358,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace TestListNestedStructListArgumentRequest.
 namespace TestBatchHelperResponse {
@@ -32911,28 +16371,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kBuffer))
-        {
-            err = DataModel::Decode(reader, buffer);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kBuffer>(reader, buffer);
 }
 } // namespace TestBatchHelperResponse.
 namespace TestListInt8UReverseRequest {
@@ -32945,28 +16384,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace TestListInt8UReverseRequest.
 namespace StringEchoResponse {
@@ -32979,28 +16397,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPayload))
-        {
-            err = DataModel::Decode(reader, payload);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPayload>(reader, payload);
 }
 } // namespace StringEchoResponse.
 namespace TestEnumsRequest {
@@ -33014,32 +16411,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg2))
-        {
-            err = DataModel::Decode(reader, arg2);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1, Fields::kArg2>(reader, arg1, arg2);
 }
 } // namespace TestEnumsRequest.
 namespace GlobalEchoResponse {
@@ -33053,32 +16425,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kField1))
-        {
-            err = DataModel::Decode(reader, field1);
-        }
-        else if (__context_tag == to_underlying(Fields::kField2))
-        {
-            err = DataModel::Decode(reader, field2);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kField1, Fields::kField2>(reader, field1, field2);
 }
 } // namespace GlobalEchoResponse.
 namespace TestNullableOptionalRequest {
@@ -33091,28 +16438,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace TestNullableOptionalRequest.
 namespace TestComplexNullableOptionalRequest {
@@ -33128,80 +16454,20 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
     encoder.Encode(to_underlying(Fields::kNullableStruct), nullableStruct);
     encoder.Encode(to_underlying(Fields::kOptionalStruct), optionalStruct);
     encoder.Encode(to_underlying(Fields::kNullableOptionalStruct), nullableOptionalStruct);
-    encoder.Encode(to_underlying(Fields::kNullableList), nullableList);
-    encoder.Encode(to_underlying(Fields::kOptionalList), optionalList);
-    encoder.Encode(to_underlying(Fields::kNullableOptionalList), nullableOptionalList);
-    return encoder.Finalize();
-}
-
-CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
-{
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kNullableInt))
-        {
-            err = DataModel::Decode(reader, nullableInt);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalInt))
-        {
-            err = DataModel::Decode(reader, optionalInt);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalInt))
-        {
-            err = DataModel::Decode(reader, nullableOptionalInt);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableString))
-        {
-            err = DataModel::Decode(reader, nullableString);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalString))
-        {
-            err = DataModel::Decode(reader, optionalString);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalString))
-        {
-            err = DataModel::Decode(reader, nullableOptionalString);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableStruct))
-        {
-            err = DataModel::Decode(reader, nullableStruct);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalStruct))
-        {
-            err = DataModel::Decode(reader, optionalStruct);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalStruct))
-        {
-            err = DataModel::Decode(reader, nullableOptionalStruct);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableList))
-        {
-            err = DataModel::Decode(reader, nullableList);
-        }
-        else if (__context_tag == to_underlying(Fields::kOptionalList))
-        {
-            err = DataModel::Decode(reader, optionalList);
-        }
-        else if (__context_tag == to_underlying(Fields::kNullableOptionalList))
-        {
-            err = DataModel::Decode(reader, nullableOptionalList);
-        }
-        else
-        {
-        }
+    encoder.Encode(to_underlying(Fields::kNullableList), nullableList);
+    encoder.Encode(to_underlying(Fields::kOptionalList), optionalList);
+    encoder.Encode(to_underlying(Fields::kNullableOptionalList), nullableOptionalList);
+    return encoder.Finalize();
+}
 
-        ReturnErrorOnFailure(err);
-    }
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct<Fields::kNullableInt, Fields::kOptionalInt, Fields::kNullableOptionalInt,
+                                   Fields::kNullableString, Fields::kOptionalString, Fields::kNullableOptionalString,
+                                   Fields::kNullableStruct, Fields::kOptionalStruct, Fields::kNullableOptionalStruct,
+                                   Fields::kNullableList, Fields::kOptionalList, Fields::kNullableOptionalList>(
+        reader, nullableInt, optionalInt, nullableOptionalInt, nullableString, optionalString, nullableOptionalString,
+        nullableStruct, optionalStruct, nullableOptionalStruct, nullableList, optionalList, nullableOptionalList);
 }
 } // namespace TestComplexNullableOptionalRequest.
 namespace SimpleStructEchoRequest {
@@ -33214,28 +16480,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace SimpleStructEchoRequest.
 namespace TimedInvokeRequest {
@@ -33247,15 +16492,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace TimedInvokeRequest.
 namespace TestSimpleOptionalArgumentRequest {
@@ -33268,28 +16505,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace TestSimpleOptionalArgumentRequest.
 namespace TestEmitTestEventRequest {
@@ -33304,36 +16520,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg2))
-        {
-            err = DataModel::Decode(reader, arg2);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg3))
-        {
-            err = DataModel::Decode(reader, arg3);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1, Fields::kArg2, Fields::kArg3>(reader, arg1, arg2, arg3);
 }
 } // namespace TestEmitTestEventRequest.
 namespace TestEmitTestFabricScopedEventRequest {
@@ -33346,28 +16533,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace TestEmitTestFabricScopedEventRequest.
 namespace TestBatchHelperRequest {
@@ -33382,36 +16548,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSleepBeforeResponseTimeMs))
-        {
-            err = DataModel::Decode(reader, sleepBeforeResponseTimeMs);
-        }
-        else if (__context_tag == to_underlying(Fields::kSizeOfResponseBuffer))
-        {
-            err = DataModel::Decode(reader, sizeOfResponseBuffer);
-        }
-        else if (__context_tag == to_underlying(Fields::kFillCharacter))
-        {
-            err = DataModel::Decode(reader, fillCharacter);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSleepBeforeResponseTimeMs, Fields::kSizeOfResponseBuffer,
+                                   Fields::kFillCharacter>(reader, sleepBeforeResponseTimeMs, sizeOfResponseBuffer, fillCharacter);
 }
 } // namespace TestBatchHelperRequest.
 namespace TestSecondBatchHelperRequest {
@@ -33426,36 +16564,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kSleepBeforeResponseTimeMs))
-        {
-            err = DataModel::Decode(reader, sleepBeforeResponseTimeMs);
-        }
-        else if (__context_tag == to_underlying(Fields::kSizeOfResponseBuffer))
-        {
-            err = DataModel::Decode(reader, sizeOfResponseBuffer);
-        }
-        else if (__context_tag == to_underlying(Fields::kFillCharacter))
-        {
-            err = DataModel::Decode(reader, fillCharacter);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kSleepBeforeResponseTimeMs, Fields::kSizeOfResponseBuffer,
+                                   Fields::kFillCharacter>(reader, sleepBeforeResponseTimeMs, sizeOfResponseBuffer, fillCharacter);
 }
 } // namespace TestSecondBatchHelperRequest.
 namespace StringEchoRequest {
@@ -33468,28 +16578,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kPayload))
-        {
-            err = DataModel::Decode(reader, payload);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kPayload>(reader, payload);
 }
 } // namespace StringEchoRequest.
 namespace GlobalEchoRequest {
@@ -33503,32 +16592,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kField1))
-        {
-            err = DataModel::Decode(reader, field1);
-        }
-        else if (__context_tag == to_underlying(Fields::kField2))
-        {
-            err = DataModel::Decode(reader, field2);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kField1, Fields::kField2>(reader, field1, field2);
 }
 } // namespace GlobalEchoRequest.
 namespace TestDifferentVendorMeiRequest {
@@ -33541,28 +16605,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace TestDifferentVendorMeiRequest.
 namespace TestDifferentVendorMeiResponse {
@@ -33576,32 +16619,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else if (__context_tag == to_underlying(Fields::kEventNumber))
-        {
-            err = DataModel::Decode(reader, eventNumber);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1, Fields::kEventNumber>(reader, arg1, eventNumber);
 }
 } // namespace TestDifferentVendorMeiResponse.
 } // namespace Commands
@@ -33822,48 +16840,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg2))
-        {
-            err = DataModel::Decode(reader, arg2);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg3))
-        {
-            err = DataModel::Decode(reader, arg3);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg4))
-        {
-            err = DataModel::Decode(reader, arg4);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg5))
-        {
-            err = DataModel::Decode(reader, arg5);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg6))
-        {
-            err = DataModel::Decode(reader, arg6);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1, Fields::kArg2, Fields::kArg3, Fields::kArg4, Fields::kArg5, Fields::kArg6>(
+        reader, arg1, arg2, arg3, arg4, arg5, arg6);
 }
 } // namespace TestEvent.
 namespace TestFabricScopedEvent {
@@ -33877,28 +16855,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kFabricIndex>(reader, fabricIndex);
 }
 } // namespace TestFabricScopedEvent.
 namespace TestDifferentVendorMeiEvent {
@@ -33912,28 +16869,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1>(reader, arg1);
 }
 } // namespace TestDifferentVendorMeiEvent.
 } // namespace Events
@@ -33956,44 +16892,8 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kType))
-        {
-            err = DataModel::Decode(reader, type);
-        }
-        else if (__context_tag == to_underlying(Fields::kId))
-        {
-            err = DataModel::Decode(reader, id);
-        }
-        else if (__context_tag == to_underlying(Fields::kNumCallsToSkip))
-        {
-            err = DataModel::Decode(reader, numCallsToSkip);
-        }
-        else if (__context_tag == to_underlying(Fields::kNumCallsToFail))
-        {
-            err = DataModel::Decode(reader, numCallsToFail);
-        }
-        else if (__context_tag == to_underlying(Fields::kTakeMutex))
-        {
-            err = DataModel::Decode(reader, takeMutex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kType, Fields::kId, Fields::kNumCallsToSkip, Fields::kNumCallsToFail,
+                                   Fields::kTakeMutex>(reader, type, id, numCallsToSkip, numCallsToFail, takeMutex);
 }
 } // namespace FailAtFault.
 namespace FailRandomlyAtFault {
@@ -34008,36 +16908,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kType))
-        {
-            err = DataModel::Decode(reader, type);
-        }
-        else if (__context_tag == to_underlying(Fields::kId))
-        {
-            err = DataModel::Decode(reader, id);
-        }
-        else if (__context_tag == to_underlying(Fields::kPercentage))
-        {
-            err = DataModel::Decode(reader, percentage);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kType, Fields::kId, Fields::kPercentage>(reader, type, id, percentage);
 }
 } // namespace FailRandomlyAtFault.
 } // namespace Commands
@@ -34078,15 +16949,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-    }
+    return DataModel::DecodeStruct<>(reader);
 }
 } // namespace Ping.
 namespace AddArgumentsResponse {
@@ -34099,28 +16962,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kReturnValue))
-        {
-            err = DataModel::Decode(reader, returnValue);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kReturnValue>(reader, returnValue);
 }
 } // namespace AddArgumentsResponse.
 namespace AddArguments {
@@ -34134,32 +16976,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kArg1))
-        {
-            err = DataModel::Decode(reader, arg1);
-        }
-        else if (__context_tag == to_underlying(Fields::kArg2))
-        {
-            err = DataModel::Decode(reader, arg2);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kArg1, Fields::kArg2>(reader, arg1, arg2);
 }
 } // namespace AddArguments.
 } // namespace Commands
@@ -34200,32 +17017,7 @@ CHIP_ERROR Type::Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
 
 CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 {
-    detail::StructDecodeIterator __iterator(reader);
-    while (true)
-    {
-        auto __element = __iterator.Next();
-        if (std::holds_alternative<CHIP_ERROR>(__element))
-        {
-            return std::get<CHIP_ERROR>(__element);
-        }
-
-        CHIP_ERROR err              = CHIP_NO_ERROR;
-        const uint8_t __context_tag = std::get<uint8_t>(__element);
-
-        if (__context_tag == to_underlying(Fields::kCount))
-        {
-            err = DataModel::Decode(reader, count);
-        }
-        else if (__context_tag == to_underlying(Fields::kFabricIndex))
-        {
-            err = DataModel::Decode(reader, fabricIndex);
-        }
-        else
-        {
-        }
-
-        ReturnErrorOnFailure(err);
-    }
+    return DataModel::DecodeStruct<Fields::kCount, Fields::kFabricIndex>(reader, count, fabricIndex);
 }
 } // namespace PingCountEvent.
 } // namespace Events